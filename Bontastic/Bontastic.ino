@@ -2,165 +2,231 @@
 #include "Arduino.h"
 #include "src/protobufs/mesh.pb.h"
 #include "src/protobufs/portnums.pb.h"
+#include "src/protobufs/telemetry.pb.h"
 #include "src/nanopb/pb.h"
 #include "src/nanopb/pb_decode.h"
 #include "src/nanopb/pb_encode.h"
 
+#include "src/bench/DecodeBench.h"
+#include "src/mesh/DuplicateFilter.h"
+#include "src/mesh/NodeDirectory.h"
+#include "src/mesh/TelemetryStats.h"
+#include "src/mesh/Unishox2.h"
 #include "src/printer/PrintHelpers.h"
+#include "src/printer/PrintQueue.h"
 #include "src/printer/PrinterControl.h"
+#include "src/pipeline/Pipeline.h"
+#include "src/radio/FrameCapture.h"
+#include "src/radio/FromRadioDecoder.h"
+#include "src/radio/FromRadioRing.h"
+#include "src/radio/RadioLink.h"
+#include "src/radio/RemoteRead.h"
 
-#include <map>
 #include <string>
 
-std::map<uint32_t, std::string> nodeNames;
-
 const char *localDeviceName = "Bontastic Printer";
 
-const char *targetService = "6ba1b218-15a8-461f-9fa8-5dcae273eafd";
-const char *uuidFromRadio = "2c55e69e-4993-11ed-b878-0242ac120002";
-const char *uuidToRadio = "f75c76d2-129e-4dad-a1dd-7866124401e7";
-const char *uuidFromNum = "ed9da18c-a800-4f66-a670-aa7547e34453";
-
-const char *deviceInfoServiceUuid = "180a";
-const char *manufacturerUuid = "2a29";
-const char *modelNumberUuid = "2a24";
-const char *serialNumberUuid = "2a25";
-const char *hardwareRevUuid = "2a27";
-const char *firmwareRevUuid = "2a26";
-const char *softwareRevUuid = "2a28";
+bool readFromRadioPacket(FromRadioFrame &frame)
+{
+  size_t length = 0;
+  bool read = readRemoteValue(radioAcquireFromRadio(), frame.bytes, sizeof(frame.bytes), length);
+  radioReleaseFromRadio();
+  if (!read)
+  {
+    return false;
+  }
+  frame.size = length;
+  return length > 0;
+}
 
-static uint32_t wantConfigId;
-static NimBLERemoteCharacteristic *fromRadio;
-static NimBLERemoteCharacteristic *toRadio;
-static NimBLERemoteCharacteristic *fromNum;
-static volatile bool fromRadioPending;
-static const int maxNotifyQueue = 8;
-static volatile int notifyQueueCount;
+void printMeshText(const meshtastic_MeshPacket &packet, const uint8_t *text, size_t size,
+                   PrintPriority priority)
+{
+  char senderName[sizeof(NodeEntry::longName)];
+  formatNodeName(packet.from, senderName, sizeof(senderName));
+  printTextMessage(text, size, senderName, packet.rx_time, priority);
+}
 
-bool readFromRadioPacket(std::string &packet)
+void printNodeTelemetry(uint32_t window, uint32_t num, uint16_t reports, const char *text, size_t size)
 {
-  packet = fromRadio->readValue();
-  return !packet.empty();
+  char name[sizeof(NodeEntry::longName)];
+  formatNodeName(num, name, sizeof(name));
+  printTelemetrySummary(window, name, reports, text, size);
 }
 
-void decodeFromRadioPacket(const std::string &packet)
+void handleMeshPacket(const meshtastic_MeshPacket &packet)
 {
-  meshtastic_FromRadio msg = meshtastic_FromRadio_init_zero;
-  pb_istream_t stream = pb_istream_from_buffer(reinterpret_cast<const uint8_t *>(packet.data()), packet.size());
-  if (!pb_decode(&stream, meshtastic_FromRadio_fields, &msg))
+  if (packet.which_payload_variant != meshtastic_MeshPacket_decoded_tag)
   {
-    Serial.println("FromRadio decode failed");
     return;
   }
-
-  if (msg.which_payload_variant == meshtastic_FromRadio_packet_tag)
+  if (duplicatePacket(packet.from, packet.id))
   {
-    const meshtastic_Data &d = msg.packet.decoded;
-    Serial.print("Port ");
-    Serial.print(d.portnum);
-    Serial.print(" Len ");
-    Serial.println(d.payload.size);
+    Serial.print("Duplicate packet ");
+    Serial.println(packet.id);
+    return;
+  }
 
-    switch (d.portnum)
-    {
-    case meshtastic_PortNum_TEXT_MESSAGE_APP:
-      if (d.payload.size > 0)
-      {
-        Serial.print("TEXT: ");
-        std::string senderName = "Unknown";
-        if (nodeNames.count(msg.packet.from))
-        {
-          senderName = nodeNames[msg.packet.from];
-        }
-        else
-        {
-          char buf[16];
-          snprintf(buf, sizeof(buf), "!%08x", msg.packet.from);
-          senderName = buf;
-        }
-        printTextMessage(d.payload.bytes, d.payload.size, senderName.c_str(), msg.packet.rx_time);
-      }
-      break;
+  const meshtastic_Data &d = packet.decoded;
+  Serial.print("Port ");
+  Serial.print(d.portnum);
+  Serial.print(" Len ");
+  Serial.println(d.payload.size);
 
-    case meshtastic_PortNum_POSITION_APP:
+  switch (d.portnum)
+  {
+  case meshtastic_PortNum_TEXT_MESSAGE_APP:
+    if (d.payload.size > 0)
     {
-      meshtastic_Position position = meshtastic_Position_init_zero;
-      pb_istream_t ps = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
-      if (pb_decode(&ps, meshtastic_Position_fields, &position))
-      {
-        printPosition(position.latitude_i / 1e7, position.longitude_i / 1e7, position.altitude);
-      }
-      else
-      {
-        Serial.println("POS decode fail");
-      }
-      break;
+      Serial.print("TEXT: ");
+      printMeshText(packet, d.payload.bytes, d.payload.size, PriorityNormal);
     }
+    break;
 
-    case meshtastic_PortNum_NODEINFO_APP:
+  case meshtastic_PortNum_ALERT_APP:
+  case meshtastic_PortNum_DETECTION_SENSOR_APP:
+    if (d.payload.size > 0)
     {
-      meshtastic_User user = meshtastic_User_init_zero;
-      pb_istream_t ns = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
-      if (pb_decode(&ns, meshtastic_User_fields, &user))
-      {
-        printNodeInfo(msg.packet.from, user.long_name);
-        nodeNames[msg.packet.from] = user.long_name;
-      }
-      else
-      {
-        Serial.println("NODE decode fail");
-      }
-      break;
+      Serial.print("ALERT: ");
+      printMeshText(packet, d.payload.bytes, d.payload.size, PriorityAlert);
     }
+    break;
 
-    default:
-      Serial.print("BIN ");
+#if UNISHOX2_TEXT
+  case meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP:
+  {
+    // Only touched by the decode task; a print job holds no more than this.
+    static uint8_t text[printJobTextSize];
+    int length = unishox2Decompress(d.payload.bytes, d.payload.size, text, sizeof(text));
+    if (length > 0)
+    {
+      Serial.print("TEXT (compressed ");
+      Serial.print(d.payload.size);
+      Serial.print("): ");
+      printMeshText(packet, text, length, PriorityNormal);
+    }
+    else
+    {
+      Serial.print("Unishox decode fail ");
       printBinaryPayload(d.payload.bytes, d.payload.size);
-      break;
     }
+    break;
   }
-}
+#endif
 
-void drainFromRadio()
-{
-  while (true)
+  case meshtastic_PortNum_POSITION_APP:
   {
-    std::string packet;
-    if (!readFromRadioPacket(packet))
+    meshtastic_Position position = meshtastic_Position_init_zero;
+    pb_istream_t ps = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
+    if (!pb_decode(&ps, meshtastic_Position_fields, &position))
+    {
+      Serial.println("POS decode fail");
+    }
+    else if (!position.has_latitude_i || !position.has_longitude_i)
+    {
+      // Altitude- or time-only reports carry no fix to print or remember.
+      Serial.println("POS without fix");
+    }
+    else
     {
-      Serial.println("FromRadio empty");
-      break;
+      NodeEntry update = {};
+      update.num = packet.from;
+      update.latitudeI = position.latitude_i;
+      update.longitudeI = position.longitude_i;
+      rememberNode(update, NodePosition);
+      char senderName[sizeof(NodeEntry::longName)];
+      formatNodeName(packet.from, senderName, sizeof(senderName));
+      printPosition(position.latitude_i / 1e7, position.longitude_i / 1e7,
+                    position.has_altitude ? &position.altitude : nullptr, senderName);
     }
-    Serial.print("FromRadio bytes ");
-    Serial.println(packet.size());
-    decodeFromRadioPacket(packet);
+    break;
   }
-}
 
-class ClientCallbacks : public NimBLEClientCallbacks
-{
-  void onConnect(NimBLEClient *) override
+  case meshtastic_PortNum_NODEINFO_APP:
   {
-    Serial.println("Connected");
+    meshtastic_User user = meshtastic_User_init_zero;
+    pb_istream_t ns = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
+    if (pb_decode(&ns, meshtastic_User_fields, &user))
+    {
+      printNodeInfo(packet.from, user.long_name);
+      rememberNode(packet.from, user.long_name, user.short_name);
+    }
+    else
+    {
+      Serial.println("NODE decode fail");
+    }
+    break;
   }
 
-  void onDisconnect(NimBLEClient *, int) override
+  case meshtastic_PortNum_TELEMETRY_APP:
   {
-    Serial.println("Disconnected");
+    meshtastic_Telemetry telemetry = meshtastic_Telemetry_init_zero;
+    pb_istream_t ts = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
+    if (pb_decode(&ts, meshtastic_Telemetry_fields, &telemetry))
+    {
+      telemetryRecord(packet.from, telemetry);
+      telemetrySummarize(false, printNodeTelemetry);
+    }
+    else
+    {
+      Serial.println("TELEMETRY decode fail");
+    }
+    break;
   }
 
-  void onPassKeyEntry(NimBLEConnInfo &info) override
+  default:
+    Serial.print("BIN ");
+    printBinaryPayload(d.payload.bytes, d.payload.size);
+    break;
+  }
+}
+
+void handleNodeInfo(const meshtastic_NodeInfo &info)
+{
+  NodeEntry update = {};
+  update.num = info.num;
+  update.lastHeard = info.last_heard;
+  uint8_t fields = NodeLastHeard;
+  if (info.has_user)
+  {
+    strlcpy(update.longName, info.user.long_name, sizeof(update.longName));
+    strlcpy(update.shortName, info.user.short_name, sizeof(update.shortName));
+    fields |= NodeNames;
+  }
+  if (info.has_position && info.position.has_latitude_i && info.position.has_longitude_i)
   {
-    Serial.println("Passkey requested");
-    uint32_t passkey = atoi(getPrinterSettings().meshPin);
-    NimBLEDevice::injectPassKey(info, passkey);
+    update.latitudeI = info.position.latitude_i;
+    update.longitudeI = info.position.longitude_i;
+    fields |= NodePosition;
   }
+  rememberNode(update, fields);
+}
 
-  void onAuthenticationComplete(NimBLEConnInfo &) override
+void handleConfigComplete(uint32_t configId)
+{
+  nodeDirectorySave(true);
+  Serial.print("Config complete ");
+  Serial.print(configId);
+  Serial.print(", node directory ");
+  Serial.println(nodeDirectorySize());
+}
+
+void decodeFromRadioPacket(const FromRadioFrame &frame)
+{
+  static const FromRadioHandlers handlers = {handleMeshPacket, handleNodeInfo, handleConfigComplete};
+  if (!decodeFromRadio(frame.bytes, frame.size, handlers))
   {
-    Serial.println("Bonded");
+    Serial.println("FromRadio decode failed");
   }
-} clientCallbacks;
+}
+
+void decodeIdle()
+{
+  nodeDirectorySave(false);
+  telemetrySummarize(false, printNodeTelemetry);
+  frameCaptureIdle();
+  printQueueCheckpoint();
+}
 
 void setup()
 {
@@ -171,164 +237,36 @@ void setup()
   }
   Serial.println("Lets Go");
 
-  wantConfigId = millis() & 0xFFFF;
-
   NimBLEDevice::init(localDeviceName);
   setupPrinterControl();
   printerSetup();
+  nodeDirectoryBegin();
+  startPipeline({readFromRadioPacket, decodeFromRadioPacket, decodeIdle});
   NimBLEDevice::deleteAllBonds();
   Serial.println("Cleared bonds");
   NimBLEDevice::setMTU(512);
   NimBLEDevice::setSecurityAuth(false, false, false);
   NimBLEDevice::setSecurityIOCap(BLE_HS_IO_KEYBOARD_ONLY);
   NimBLEDevice::setSecurityPasskey(atoi(getPrinterSettings().meshPin));
-
-  NimBLEScan *scan = NimBLEDevice::getScan();
-  scan->setActiveScan(true);
-  NimBLEScanResults results = scan->getResults(5 * 1000, false);
-  Serial.println("Scan completed");
-
-  const NimBLEAdvertisedDevice *targetDevice = nullptr;
-  const char *targetName = getPrinterSettings().meshName;
-  for (int i = 0; i < results.getCount(); ++i)
-  {
-    const NimBLEAdvertisedDevice *device = results.getDevice(i);
-    std::string name = device->getName();
-    if (name == targetName)
-    {
-      targetDevice = device;
-      Serial.print("Target ");
-      Serial.print(device->getAddress().toString().c_str());
-      Serial.print(" ");
-      Serial.println(name.c_str());
-      break;
-    }
-  }
-
-  if (!targetDevice)
-  {
-    Serial.println("Target not found");
-    return;
-  }
-
-  NimBLEClient *client = NimBLEDevice::createClient();
-  if (!client)
-  {
-    Serial.println("Client create failed");
-    return;
-  }
-
-  client->setClientCallbacks(&clientCallbacks, false);
-  Serial.println("Connecting");
-  if (!client->connect(targetDevice))
-  {
-    Serial.println("Connect failed");
-    NimBLEDevice::deleteClient(client);
-    return;
-  }
-
-  NimBLERemoteService *deviceInfo = client->getService(deviceInfoServiceUuid);
-  if (deviceInfo)
-  {
-    Serial.println("DeviceInformationService");
-
-    auto printChar = [&](const char *name, const char *uuid)
-    {
-      NimBLERemoteCharacteristic *c = deviceInfo->getCharacteristic(uuid);
-      if (!c)
-      {
-        return;
-      }
-      std::string v = c->readValue();
-      printInfo(name, v.c_str());
-    };
-
-    printChar("Manufacturer", manufacturerUuid);
-    printChar("Model", modelNumberUuid);
-    printChar("Serial", serialNumberUuid);
-    printChar("HW", hardwareRevUuid);
-    printChar("FW", firmwareRevUuid);
-    printChar("SW", softwareRevUuid);
-  }
-
-  Serial.println("Securing");
-  if (!client->secureConnection())
-  {
-    Serial.println("Secure start failed");
-  }
-
-  NimBLERemoteService *service = client->getService(targetService);
-  if (!service)
-  {
-    Serial.println("Service not found");
-    return;
-  }
-
-  Serial.print("Service ");
-  Serial.println(targetService);
-
-  fromRadio = service->getCharacteristic(uuidFromRadio);
-  toRadio = service->getCharacteristic(uuidToRadio);
-  fromNum = service->getCharacteristic(uuidFromNum);
-
-  meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
-  req.which_payload_variant = meshtastic_ToRadio_want_config_id_tag;
-  req.want_config_id = wantConfigId++;
-
-  uint8_t buffer[16];
-  pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
-  if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
-  {
-    Serial.println("Start config encode failed");
-    return;
-  }
-
-  Serial.println("Request config");
-  if (!toRadio->writeValue(buffer, ostream.bytes_written, true))
-  {
-    Serial.println("Start config failed");
-    return;
-  }
-
-  Serial.println("Reading FromRadio");
-  drainFromRadio();
-
-  auto notifyCallback = [](NimBLERemoteCharacteristic *characteristic, uint8_t *, size_t, bool isNotify)
-  {
-    if (!isNotify)
-    {
-      return;
-    }
-    if (notifyQueueCount < maxNotifyQueue)
-    {
-      notifyQueueCount++;
-      fromRadioPending = true;
-      Serial.print("FromNum notify queued: ");
-      Serial.println(notifyQueueCount);
-    }
-    else
-    {
-      Serial.println("FromNum notify dropped (queue full)");
-    }
-  };
-
-  if (!fromNum->subscribe(true, notifyCallback, true))
-  {
-    Serial.println("FromNum subscribe failed");
-  }
+  radioLinkBegin();
 }
 
 void loop()
 {
   printerControlLoop();
-  if (fromRadioPending)
+  radioLinkLoop();
+#if DECODE_BENCH
+  if (Serial.available())
   {
-    fromRadioPending = false;
-    int count = notifyQueueCount;
-    notifyQueueCount = 0;
-    Serial.print("Draining FromRadio for ");
-    Serial.print(count);
-    Serial.println(" notify events");
-    drainFromRadio();
+    int command = Serial.read();
+    if (command == 'b')
+    {
+      runDecodeBench(handleMeshPacket, Serial);
+    }
+    else if (command == 'B')
+    {
+      runCaptureBench(handleMeshPacket, Serial);
+    }
   }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,3 @@
+-DPRINTER_DRY_RUN=0
+-DDECODE_BENCH=0
+-DUNISHOX2_TEXT=0
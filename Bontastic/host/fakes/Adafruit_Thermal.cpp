@@ -0,0 +1,228 @@
+#include "Adafruit_Thermal.h"
+#include <ctype.h>
+
+Adafruit_Thermal::Adafruit_Thermal(Stream *s, uint8_t) : stream(s)
+{
+    byteTime = (11UL * 1000000UL + BAUDRATE / 2) / BAUDRATE;
+}
+
+void Adafruit_Thermal::timeoutSet(unsigned long us)
+{
+    resumeTime = micros() + us;
+}
+
+void Adafruit_Thermal::timeoutWait()
+{
+    long remaining = static_cast<long>(resumeTime - micros());
+    if (remaining > 0)
+    {
+        hostAdvanceMicros(remaining);
+    }
+}
+
+void Adafruit_Thermal::setTimes(unsigned long printMicros, unsigned long feedMicros)
+{
+    dotPrintTime = printMicros;
+    dotFeedTime = feedMicros;
+}
+
+size_t Adafruit_Thermal::write(uint8_t c)
+{
+    if (c == 0x13)
+    {
+        return 1;
+    }
+    timeoutWait();
+    stream->write(c);
+    unsigned long d = byteTime;
+    if (c == '\n' || column == maxColumn)
+    {
+        d += prevByte == '\n' ? (charHeight + lineSpacing) * dotFeedTime
+                              : charHeight * dotPrintTime + lineSpacing * dotFeedTime;
+        column = 0;
+        c = '\n';
+    }
+    else
+    {
+        column++;
+    }
+    timeoutSet(d);
+    prevByte = c;
+    return 1;
+}
+
+void Adafruit_Thermal::writeBytes(uint8_t a)
+{
+    timeoutWait();
+    stream->write(a);
+    timeoutSet(byteTime);
+}
+
+void Adafruit_Thermal::writeBytes(uint8_t a, uint8_t b)
+{
+    timeoutWait();
+    stream->write(a);
+    stream->write(b);
+    timeoutSet(2 * byteTime);
+}
+
+void Adafruit_Thermal::writeBytes(uint8_t a, uint8_t b, uint8_t c)
+{
+    timeoutWait();
+    stream->write(a);
+    stream->write(b);
+    stream->write(c);
+    timeoutSet(3 * byteTime);
+}
+
+void Adafruit_Thermal::writeBytes(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+{
+    timeoutWait();
+    stream->write(a);
+    stream->write(b);
+    stream->write(c);
+    stream->write(d);
+    timeoutSet(4 * byteTime);
+}
+
+void Adafruit_Thermal::begin(uint16_t)
+{
+    timeoutSet(500000);
+    wake();
+    reset();
+    setHeatConfig();
+    dotPrintTime = 30000;
+    dotFeedTime = 2100;
+}
+
+void Adafruit_Thermal::wake()
+{
+    timeoutSet(0);
+    writeBytes(255);
+    delay(50);
+    writeBytes(ASCII_ESC, '8', 0, 0);
+}
+
+void Adafruit_Thermal::reset()
+{
+    writeBytes(ASCII_ESC, '@');
+    prevByte = '\n';
+    column = 0;
+    maxColumn = 32;
+    charHeight = 24;
+    lineSpacing = 6;
+    printMode = 0;
+    writeBytes(ASCII_ESC, 'D');
+    writeBytes(4, 8, 12, 16);
+    writeBytes(20, 24, 28, 0);
+}
+
+void Adafruit_Thermal::setHeatConfig(uint8_t dots, uint8_t time, uint8_t interval)
+{
+    writeBytes(ASCII_ESC, '7');
+    writeBytes(dots, time, interval);
+}
+
+void Adafruit_Thermal::setPrintDensity(uint8_t density, uint8_t breakTime)
+{
+    writeBytes(ASCII_DC2, '#', (density << 5) | breakTime);
+}
+
+void Adafruit_Thermal::setPrintMode(uint8_t mask)
+{
+    printMode |= mask;
+    writeBytes(ASCII_ESC, '!', printMode);
+    charHeight = printMode & doubleHeightMask ? 48 : 24;
+    maxColumn = printMode & doubleWidthMask ? 16 : 32;
+}
+
+void Adafruit_Thermal::unsetPrintMode(uint8_t mask)
+{
+    printMode &= ~mask;
+    writeBytes(ASCII_ESC, '!', printMode);
+    charHeight = printMode & doubleHeightMask ? 48 : 24;
+    maxColumn = printMode & doubleWidthMask ? 16 : 32;
+}
+
+void Adafruit_Thermal::normal()
+{
+    printMode = 0;
+    writeBytes(ASCII_ESC, '!', printMode);
+}
+
+void Adafruit_Thermal::feed(uint8_t x)
+{
+    writeBytes(ASCII_ESC, 'd', x);
+    timeoutSet(dotFeedTime * charHeight);
+    prevByte = '\n';
+    column = 0;
+}
+
+void Adafruit_Thermal::feedRows(uint8_t rows)
+{
+    writeBytes(ASCII_ESC, 'J', rows);
+    timeoutSet(rows * dotFeedTime);
+    prevByte = '\n';
+    column = 0;
+}
+
+void Adafruit_Thermal::justify(char value)
+{
+    uint8_t pos = 0;
+    switch (toupper(value))
+    {
+    case 'C':
+        pos = 1;
+        break;
+    case 'R':
+        pos = 2;
+        break;
+    }
+    writeBytes(ASCII_ESC, 'a', pos);
+}
+
+void Adafruit_Thermal::setFont(char font)
+{
+    if (toupper(font) == 'B')
+    {
+        setPrintMode(fontMask);
+    }
+    else
+    {
+        unsetPrintMode(fontMask);
+    }
+}
+
+void Adafruit_Thermal::setSize(char value)
+{
+    uint8_t size = 0;
+    switch (toupper(value))
+    {
+    case 'M':
+        size = 0x01;
+        charHeight = 48;
+        maxColumn = 32;
+        break;
+    case 'L':
+        size = 0x11;
+        charHeight = 48;
+        maxColumn = 16;
+        break;
+    default:
+        charHeight = 24;
+        maxColumn = 32;
+        break;
+    }
+    writeBytes(ASCII_GS, '!', size);
+    prevByte = '\n';
+}
+
+void Adafruit_Thermal::setLineHeight(int val)
+{
+    if (val < 24)
+    {
+        val = 24;
+    }
+    lineSpacing = val - 24;
+    writeBytes(ASCII_ESC, '3', val);
+}
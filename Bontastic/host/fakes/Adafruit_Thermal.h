@@ -0,0 +1,85 @@
+#pragma once
+
+// Host stand-in for Adafruit_Thermal. Emits the same ESC/POS bytes the
+// library does for the calls the sketch makes, into the Stream it was given,
+// and keeps the library's time-based pacing on the fake clock: timeoutWait()
+// advances time instead of spinning, so tests can read simulated print time.
+
+#include "Arduino.h"
+
+#define ASCII_TAB '\t'
+#define ASCII_LF '\n'
+#define ASCII_FF '\f'
+#define ASCII_CR '\r'
+#define ASCII_DC2 18
+#define ASCII_ESC 27
+#define ASCII_FS 28
+#define ASCII_GS 29
+#define BAUDRATE 19200
+
+class Adafruit_Thermal : public Print
+{
+public:
+    Adafruit_Thermal(Stream *s = nullptr, uint8_t dtr = 255);
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void begin(uint16_t version = 268);
+    void boldOff() { unsetPrintMode(boldMask); }
+    void boldOn() { setPrintMode(boldMask); }
+    void doubleHeightOff() { unsetPrintMode(doubleHeightMask); }
+    void doubleHeightOn() { setPrintMode(doubleHeightMask); }
+    void doubleWidthOff() { unsetPrintMode(doubleWidthMask); }
+    void doubleWidthOn() { setPrintMode(doubleWidthMask); }
+    void feed(uint8_t x = 1);
+    void feedRows(uint8_t rows);
+    void inverseOff() { writeBytes(ASCII_GS, 'B', 0); }
+    void inverseOn() { writeBytes(ASCII_GS, 'B', 1); }
+    void justify(char value);
+    void normal();
+    void reset();
+    void setCharset(uint8_t charset = 0) { writeBytes(ASCII_ESC, 'R', charset > 15 ? 15 : charset); }
+    void setCodePage(uint8_t codePage = 0) { writeBytes(ASCII_ESC, 't', codePage > 47 ? 47 : codePage); }
+    void setFont(char font = 'A');
+    void setHeatConfig(uint8_t dots = 11, uint8_t time = 120, uint8_t interval = 40);
+    void setLineHeight(int val = 30);
+    void setPrintDensity(uint8_t density = 10, uint8_t breakTime = 2);
+    void setSize(char value);
+    void setTimes(unsigned long printMicros, unsigned long feedMicros);
+    void strikeOff() { unsetPrintMode(strikeMask); }
+    void strikeOn() { setPrintMode(strikeMask); }
+    void timeoutSet(unsigned long us);
+    void timeoutWait();
+    void underlineOff() { writeBytes(ASCII_ESC, '-', 0); }
+    void underlineOn(uint8_t weight = 1) { writeBytes(ASCII_ESC, '-', weight > 2 ? 2 : weight); }
+    void wake();
+    bool hasPaper() { return true; }
+
+    void writeBytes(uint8_t a);
+    void writeBytes(uint8_t a, uint8_t b);
+    void writeBytes(uint8_t a, uint8_t b, uint8_t c);
+    void writeBytes(uint8_t a, uint8_t b, uint8_t c, uint8_t d);
+
+private:
+    static const uint8_t fontMask = 1 << 0;
+    static const uint8_t boldMask = 1 << 3;
+    static const uint8_t doubleHeightMask = 1 << 4;
+    static const uint8_t doubleWidthMask = 1 << 5;
+    static const uint8_t strikeMask = 1 << 6;
+
+    void setPrintMode(uint8_t mask);
+    void unsetPrintMode(uint8_t mask);
+
+    Stream *stream;
+    uint8_t printMode = 0;
+    uint8_t prevByte = '\n';
+    uint8_t column = 0;
+    uint8_t maxColumn = 32;
+    uint8_t charHeight = 24;
+    uint8_t lineSpacing = 6;
+    unsigned long byteTime = 0;
+    unsigned long dotPrintTime = 30000;
+    unsigned long dotFeedTime = 2100;
+    unsigned long resumeTime = 0;
+};
@@ -0,0 +1,171 @@
+#include "Arduino.h"
+#include <stdarg.h>
+#include "esp_timer.h"
+
+HardwareSerial Serial;
+HardwareSerial Serial2;
+EspClass ESP;
+
+static uint64_t hostMicros;
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t length = strlen(src);
+    if (size)
+    {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+#endif
+
+void hostAdvanceMicros(uint64_t us)
+{
+    hostMicros += us;
+}
+
+unsigned long millis()
+{
+    return static_cast<unsigned long>(hostMicros / 1000);
+}
+
+unsigned long micros()
+{
+    return static_cast<unsigned long>(hostMicros);
+}
+
+int64_t esp_timer_get_time()
+{
+    return static_cast<int64_t>(hostMicros);
+}
+
+void delay(uint32_t ms)
+{
+    hostAdvanceMicros(static_cast<uint64_t>(ms) * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    hostAdvanceMicros(us);
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+int digitalRead(uint8_t)
+{
+    return LOW;
+}
+
+void yield()
+{
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+    {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::print(long n, int base)
+{
+    if (base == DEC)
+    {
+        char text[24];
+        snprintf(text, sizeof(text), "%ld", n);
+        return write(text);
+    }
+    return print(static_cast<unsigned long>(n), base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+    char text[72];
+    char *p = text + sizeof(text) - 1;
+    *p = '\0';
+    if (base < 2)
+    {
+        base = DEC;
+    }
+    do
+    {
+        unsigned digit = n % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        n /= base;
+    } while (n);
+    return write(p);
+}
+
+size_t Print::print(double n, int digits)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", digits, n);
+    return write(text);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (length < 0)
+    {
+        return 0;
+    }
+    return write(reinterpret_cast<const uint8_t *>(text),
+                 static_cast<size_t>(length) < sizeof(text) ? length : sizeof(text) - 1);
+}
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length)
+{
+    size_t n = 0;
+    while (n < length && available())
+    {
+        buffer[n++] = read();
+    }
+    return n;
+}
+
+void HardwareSerial::begin(unsigned long newBaud, uint32_t, int8_t, int8_t, bool, unsigned long, uint8_t)
+{
+    baud = newBaud;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    output.push_back(static_cast<char>(c));
+    writes++;
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    output.append(reinterpret_cast<const char *>(buffer), size);
+    writes++;
+    return size;
+}
+
+int HardwareSerial::available()
+{
+    return static_cast<int>(input.size() - readAt);
+}
+
+int HardwareSerial::read()
+{
+    return readAt < input.size() ? static_cast<uint8_t>(input[readAt++]) : -1;
+}
+
+int HardwareSerial::peek()
+{
+    return readAt < input.size() ? static_cast<uint8_t>(input[readAt]) : -1;
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+// Host stand-in for the parts of the Arduino-ESP32 core the sketch uses.
+// Time only moves when a test (or delay()) advances it, and both UARTs record
+// what is written to them so tests can inspect the exact byte stream.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "freertos/FreeRTOS.h"
+
+#define F(x) x
+#define HEX 16
+#define DEC 10
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define SERIAL_8N1 0x800001c
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void yield();
+
+// Moves the fake clock; delay() and vTaskDelay() do the same.
+void hostAdvanceMicros(uint64_t us);
+
+class String
+{
+public:
+    String(const char *s = "") : value(s ? s : "") {}
+    String(const std::string &s) : value(s) {}
+    const char *c_str() const { return value.c_str(); }
+    size_t length() const { return value.length(); }
+    bool operator==(const char *s) const { return value == (s ? s : ""); }
+    bool operator==(const String &s) const { return value == s.value; }
+    String operator+(const char *s) const { return String(value + (s ? s : "")); }
+
+private:
+    std::string value;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *s) { return s ? write(reinterpret_cast<const uint8_t *>(s), strlen(s)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write(reinterpret_cast<const uint8_t *>(buffer), size); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(int n, int base = DEC) { return print(static_cast<long>(n), base); }
+    size_t print(unsigned n, int base = DEC) { return print(static_cast<unsigned long>(n), base); }
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T value) { return print(value) + println(); }
+    template <typename T> size_t println(T value, int format) { return print(value, format) + println(); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    size_t readBytes(uint8_t *buffer, size_t length);
+};
+
+enum SerialHwFlowCtrl
+{
+    UART_HW_FLOWCTRL_DISABLE = 0,
+    UART_HW_FLOWCTRL_RTS,
+    UART_HW_FLOWCTRL_CTS,
+    UART_HW_FLOWCTRL_CTS_RTS
+};
+
+// A UART whose TX side appends to output and whose RX side serves input.
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1,
+               bool invert = false, unsigned long timeoutMs = 20000UL, uint8_t rxFifoFull = 112);
+    void end() {}
+    void updateBaudRate(unsigned long newBaud) { baud = newBaud; }
+    bool setPins(int8_t, int8_t, int8_t = -1, int8_t = -1) { return true; }
+    bool setHwFlowCtrlMode(SerialHwFlowCtrl = UART_HW_FLOWCTRL_CTS_RTS, uint8_t = 64) { return true; }
+    size_t setTxBufferSize(size_t size) { return size; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    int availableForWrite() override { return 256; }
+    void flush(bool) {}
+    using Print::flush;
+    operator bool() const { return true; }
+
+    unsigned long baud = 0;
+    // Every byte written since the last clear().
+    std::string output;
+    // Bytes read() will return, front first.
+    std::string input;
+    // Number of write() calls, so tests can tell a burst from a byte trickle.
+    size_t writes = 0;
+
+    void clear()
+    {
+        output.clear();
+        input.clear();
+        writes = 0;
+        readAt = 0;
+    }
+
+private:
+    size_t readAt = 0;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap() { return 200000; }
+    uint32_t getMinFreeHeap() { return 150000; }
+    uint32_t getMaxAllocHeap() { return 100000; }
+    void restart() { abort(); }
+};
+
+extern EspClass ESP;
@@ -0,0 +1,122 @@
+#include "FS.h"
+#include "LittleFS.h"
+
+fs::LittleFSFS LittleFS;
+
+namespace fs
+{
+
+File::File(const FileData &contents, const std::string &path, bool canWrite, bool appendOnly)
+    : data(contents), filePath(path), offset(appendOnly ? contents->size() : 0), writable(canWrite),
+      append(appendOnly)
+{
+}
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+    if (!data || !writable)
+    {
+        return 0;
+    }
+    if (append)
+    {
+        offset = data->size();
+    }
+    if (offset + size > data->size())
+    {
+        data->resize(offset + size);
+    }
+    memcpy(data->data() + offset, buffer, size);
+    offset += size;
+    return size;
+}
+
+int File::available()
+{
+    return data && offset < data->size() ? static_cast<int>(data->size() - offset) : 0;
+}
+
+int File::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek()
+{
+    return available() ? (*data)[offset] : -1;
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+    size_t n = available();
+    n = n < size ? n : size;
+    if (n)
+    {
+        memcpy(buffer, data->data() + offset, n);
+        offset += n;
+    }
+    return n;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+    if (!data)
+    {
+        return false;
+    }
+    size_t base = mode == SeekCur ? offset : mode == SeekEnd ? data->size() : 0;
+    if (base + pos > data->size())
+    {
+        return false;
+    }
+    offset = base + pos;
+    return true;
+}
+
+File FS::open(const char *path, const char *mode, bool)
+{
+    auto found = files.find(path);
+    if (mode[0] == 'r')
+    {
+        return found == files.end() ? File() : File(found->second, path, false, false);
+    }
+    FileData data = std::make_shared<std::vector<uint8_t>>();
+    if (mode[0] == 'a' && found != files.end())
+    {
+        data = found->second;
+    }
+    // "w" replaces the file; handles still open on the old one keep it.
+    files[path] = data;
+    return File(data, path, true, mode[0] == 'a');
+}
+
+bool FS::rename(const char *from, const char *to)
+{
+    auto found = files.find(from);
+    if (found == files.end())
+    {
+        return false;
+    }
+    files[to] = found->second;
+    files.erase(found);
+    return true;
+}
+
+FileData FS::contents(const char *path) const
+{
+    auto found = files.find(path);
+    return found == files.end() ? nullptr : found->second;
+}
+
+size_t LittleFSFS::usedBytes() const
+{
+    size_t used = 0;
+    for (const auto &file : files)
+    {
+        used += file.second->size();
+    }
+    return used;
+}
+
+} // namespace fs
@@ -0,0 +1,75 @@
+#pragma once
+
+// In-memory file system behind the fs::FS interface the sketch uses. Files
+// are shared byte vectors, so a handle sees writes made through another.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+typedef std::shared_ptr<std::vector<uint8_t>> FileData;
+
+class File : public Stream
+{
+public:
+    File() {}
+    File(const FileData &data, const std::string &path, bool writable, bool append);
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t *buffer, size_t size);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const { return offset; }
+    size_t size() const { return data ? data->size() : 0; }
+    void close() { data.reset(); }
+    operator bool() const { return data != nullptr; }
+    const char *path() const { return filePath.c_str(); }
+
+private:
+    FileData data;
+    std::string filePath;
+    size_t offset = 0;
+    bool writable = false;
+    bool append = false;
+};
+
+class FS
+{
+public:
+    File open(const char *path, const char *mode = FILE_READ, bool create = false);
+    bool exists(const char *path) const { return files.count(path) != 0; }
+    bool remove(const char *path) { return files.erase(path) != 0; }
+    bool rename(const char *from, const char *to);
+
+    // Test hooks: drop every file, or look at one directly.
+    void wipe() { files.clear(); }
+    FileData contents(const char *path) const;
+
+protected:
+    std::map<std::string, FileData> files;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,135 @@
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "Arduino.h"
+
+struct HostSemaphore
+{
+    bool counting;
+    UBaseType_t count;
+};
+
+static uint32_t notifications;
+
+static SemaphoreHandle_t createSemaphore(bool counting)
+{
+    return new HostSemaphore{counting, 0};
+}
+
+static void waitTicks(TickType_t wait)
+{
+    if (wait != portMAX_DELAY)
+    {
+        delay(wait * portTICK_PERIOD_MS);
+    }
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    return createSemaphore(true);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return createSemaphore(false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+    return createSemaphore(false);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+    HostSemaphore *s = static_cast<HostSemaphore *>(semaphore);
+    if (!s->counting)
+    {
+        return pdTRUE;
+    }
+    if (s->count)
+    {
+        s->count--;
+        return pdTRUE;
+    }
+    waitTicks(wait);
+    return pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    HostSemaphore *s = static_cast<HostSemaphore *>(semaphore);
+    if (s->counting)
+    {
+        // Binary: a second give before a take is lost, as on the target.
+        s->count = 1;
+    }
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+    return xSemaphoreTake(semaphore, wait);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore)
+{
+    return xSemaphoreGive(semaphore);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char *, uint32_t, void *, UBaseType_t, TaskHandle_t *handle,
+                                   BaseType_t)
+{
+    if (handle)
+    {
+        *handle = nullptr;
+    }
+    return pdFAIL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack, void *arg, UBaseType_t priority,
+                       TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(code, name, stack, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+void vTaskDelete(TaskHandle_t)
+{
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return millis() / portTICK_PERIOD_MS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t)
+{
+    return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    notifications++;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+    uint32_t count = notifications;
+    if (!count)
+    {
+        waitTicks(wait);
+        return 0;
+    }
+    notifications = clear ? 0 : count - 1;
+    return count;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    static int mainTask;
+    return &mainTask;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "FS.h"
+
+namespace fs
+{
+
+class LittleFSFS : public FS
+{
+public:
+    bool begin(bool = false, const char * = "/littlefs", uint8_t = 10, const char * = "spiffs") { return true; }
+    void end() {}
+    bool format()
+    {
+        wipe();
+        return true;
+    }
+    size_t totalBytes() const { return 1024 * 1024; }
+    size_t usedBytes() const;
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
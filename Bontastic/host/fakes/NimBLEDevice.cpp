@@ -0,0 +1,147 @@
+#include "NimBLEDevice.h"
+#include <string.h>
+
+// Long reads arrive in pieces of the default ATT MTU less the opcode byte.
+static const uint16_t attChunk = 22;
+
+static std::vector<NimBLERemoteCharacteristic *> &remotes()
+{
+    static std::vector<NimBLERemoteCharacteristic *> all;
+    return all;
+}
+
+static std::vector<NimBLECharacteristic *> &locals()
+{
+    static std::vector<NimBLECharacteristic *> all;
+    return all;
+}
+
+static NimBLEClient hostClient;
+static NimBLEScan hostScan;
+static NimBLEServer hostServer;
+static NimBLEAdvertising hostAdvertising;
+
+NimBLERemoteCharacteristic::NimBLERemoteCharacteristic()
+{
+    remotes().push_back(this);
+    handle = remotes().size();
+}
+
+NimBLERemoteCharacteristic::~NimBLERemoteCharacteristic()
+{
+    remotes()[handle - 1] = nullptr;
+}
+
+NimBLEClient *NimBLERemoteCharacteristic::getClient() const
+{
+    return &hostClient;
+}
+
+NimBLERemoteCharacteristic *NimBLERemoteCharacteristic::byHandle(uint16_t handle)
+{
+    return handle && handle <= remotes().size() ? remotes()[handle - 1] : nullptr;
+}
+
+struct StalledRead
+{
+    uint16_t conn;
+    uint16_t handle;
+    ble_gatt_attr_fn *cb;
+    void *arg;
+};
+
+static StalledRead stalledRead;
+
+void NimBLERemoteCharacteristic::completeStalledRead()
+{
+    StalledRead read = stalledRead;
+    stalledRead = {};
+    NimBLERemoteCharacteristic *c = byHandle(read.handle);
+    if (read.cb && c)
+    {
+        c->stalled = false;
+        ble_gattc_read_long(read.conn, read.handle, 0, read.cb, read.arg);
+    }
+}
+
+int os_mbuf_copydata(const struct os_mbuf *om, int off, int len, void *dst)
+{
+    if (off < 0 || len < 0 || off + len > om->om_len)
+    {
+        return -1;
+    }
+    memcpy(dst, om->om_data + off, len);
+    return 0;
+}
+
+// Completes synchronously: every chunk callback, then the BLE_HS_EDONE one.
+// A stalled characteristic keeps the procedure until completeStalledRead().
+int ble_gattc_read_long(uint16_t conn, uint16_t handle, uint16_t offset, ble_gatt_attr_fn *cb, void *arg)
+{
+    NimBLERemoteCharacteristic *c = NimBLERemoteCharacteristic::byHandle(handle);
+    if (!c)
+    {
+        return BLE_HS_ENOTCONN;
+    }
+    if (c->stalled)
+    {
+        stalledRead = {conn, handle, cb, arg};
+        return 0;
+    }
+    ble_gatt_error error = {0, handle};
+    if (c->readStatus)
+    {
+        error.status = c->readStatus;
+        cb(conn, &error, nullptr, arg);
+        return 0;
+    }
+    for (size_t at = offset; at < c->value.size(); at += attChunk)
+    {
+        size_t left = c->value.size() - at;
+        os_mbuf om = {static_cast<uint16_t>(left < attChunk ? left : attChunk), c->value.data() + at};
+        ble_gatt_attr attr = {handle, static_cast<uint16_t>(at), &om};
+        cb(conn, &error, &attr, arg);
+    }
+    error.status = BLE_HS_EDONE;
+    cb(conn, &error, nullptr, arg);
+    return 0;
+}
+
+NimBLECharacteristic *NimBLEService::createCharacteristic(const char *uuid, uint32_t, uint16_t)
+{
+    NimBLECharacteristic *c = new NimBLECharacteristic(uuid);
+    locals().push_back(c);
+    return c;
+}
+
+NimBLEScan *NimBLEDevice::getScan()
+{
+    return &hostScan;
+}
+
+NimBLEClient *NimBLEDevice::createClient()
+{
+    return &hostClient;
+}
+
+NimBLEServer *NimBLEDevice::createServer()
+{
+    return &hostServer;
+}
+
+NimBLEAdvertising *NimBLEDevice::getAdvertising()
+{
+    return &hostAdvertising;
+}
+
+NimBLECharacteristic *NimBLEDevice::findCharacteristic(const char *uuid)
+{
+    for (NimBLECharacteristic *c : locals())
+    {
+        if (c->getUUID() == NimBLEUUID(uuid))
+        {
+            return c;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,325 @@
+#pragma once
+
+// NimBLE-Arduino 2.x stand-in. Nothing connects: scans find nothing and
+// connects fail, so the link state machine idles. The pieces the decode path
+// touches are real enough to test: a NimBLERemoteCharacteristic serves its
+// value through the long-read procedure in ATT-sized chunks and records what
+// is written to it, and local characteristics can be written from a test.
+
+#include <stdint.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <functional>
+
+#define BLE_HS_IO_KEYBOARD_ONLY 2
+#define BLE_HS_ADV_F_DISC_GEN 0x02
+#define BLE_HS_ADV_F_BREDR_UNSUP 0x04
+#define BLE_HS_EDONE 14
+#define BLE_HS_ENOTCONN 7
+#define BLE_HS_CONN_HANDLE_NONE 0xffff
+#define BLE_ADDR_PUBLIC 0
+#define BLE_ADDR_RANDOM 1
+
+struct os_mbuf
+{
+    uint16_t om_len;
+    const uint8_t *om_data;
+};
+#define OS_MBUF_PKTLEN(om) ((om)->om_len)
+int os_mbuf_copydata(const struct os_mbuf *om, int off, int len, void *dst);
+
+struct ble_gatt_error
+{
+    uint16_t status;
+    uint16_t att_handle;
+};
+
+struct ble_gatt_attr
+{
+    uint16_t handle;
+    uint16_t offset;
+    struct os_mbuf *om;
+};
+
+typedef int ble_gatt_attr_fn(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr,
+                             void *arg);
+int ble_gattc_read_long(uint16_t conn_handle, uint16_t handle, uint16_t offset, ble_gatt_attr_fn *cb, void *cb_arg);
+
+namespace NIMBLE_PROPERTY
+{
+enum
+{
+    READ = 1,
+    READ_ENC = 2,
+    READ_AUTHEN = 4,
+    READ_AUTHOR = 8,
+    WRITE = 16,
+    WRITE_NR = 32,
+    WRITE_ENC = 64,
+    WRITE_AUTHEN = 128,
+    WRITE_AUTHOR = 256,
+    BROADCAST = 512,
+    NOTIFY = 1024,
+    INDICATE = 2048
+};
+}
+
+class NimBLEAttValue : public std::string
+{
+public:
+    NimBLEAttValue() {}
+    NimBLEAttValue(const char *s) : std::string(s) {}
+    NimBLEAttValue(const std::string &s) : std::string(s) {}
+    NimBLEAttValue(const uint8_t *bytes, size_t size) : std::string(reinterpret_cast<const char *>(bytes), size) {}
+};
+
+class NimBLEUUID
+{
+public:
+    NimBLEUUID() {}
+    NimBLEUUID(const char *s) : uuid(s) {}
+    NimBLEUUID(const std::string &s) : uuid(s) {}
+    bool operator==(const NimBLEUUID &other) const { return uuid == other.uuid; }
+    std::string toString() const { return uuid; }
+
+private:
+    std::string uuid;
+};
+
+class NimBLEAddress
+{
+public:
+    NimBLEAddress() {}
+    NimBLEAddress(const std::string &addr, uint8_t addrType) : text(addr), type(addrType) {}
+    std::string toString() const { return text; }
+    uint8_t getType() const { return type; }
+    bool isNull() const { return text.empty(); }
+    bool operator==(const NimBLEAddress &other) const { return text == other.text && type == other.type; }
+
+private:
+    std::string text;
+    uint8_t type = BLE_ADDR_PUBLIC;
+};
+
+struct NimBLEConnInfo
+{
+    NimBLEAddress getAddress() const { return NimBLEAddress(); }
+    uint16_t getConnHandle() const { return 0; }
+};
+
+class NimBLEClient;
+
+class NimBLERemoteCharacteristic
+{
+public:
+    typedef std::function<void(NimBLERemoteCharacteristic *, uint8_t *, size_t, bool)> notify_callback;
+
+    NimBLERemoteCharacteristic();
+    ~NimBLERemoteCharacteristic();
+
+    NimBLEAttValue readValue(time_t * = nullptr) { return NimBLEAttValue(value.data(), value.size()); }
+    bool writeValue(const uint8_t *data, size_t length, bool = false) const
+    {
+        written.emplace_back(data, data + length);
+        return true;
+    }
+    bool subscribe(bool = true, const notify_callback = nullptr, bool = true) const { return true; }
+    bool unsubscribe(bool = true) const { return true; }
+    uint16_t getHandle() const { return handle; }
+    NimBLEClient *getClient() const;
+    NimBLEUUID getUUID() const { return NimBLEUUID(); }
+
+    // What the peripheral returns to reads; reads fail with readStatus when set.
+    std::vector<uint8_t> value;
+    int readStatus = 0;
+    // Reads start but do not complete until completeStalledRead().
+    bool stalled = false;
+    // Every value written, oldest first.
+    mutable std::vector<std::vector<uint8_t>> written;
+
+    static NimBLERemoteCharacteristic *byHandle(uint16_t handle);
+    // Delivers the read a stalled characteristic left pending.
+    static void completeStalledRead();
+
+private:
+    uint16_t handle;
+};
+
+class NimBLERemoteService
+{
+public:
+    NimBLERemoteCharacteristic *getCharacteristic(const NimBLEUUID &) const { return nullptr; }
+    NimBLEClient *getClient() const { return nullptr; }
+};
+
+class NimBLEAdvertisedDevice
+{
+public:
+    std::string getName() const { return std::string(); }
+    NimBLEAddress getAddress() const { return NimBLEAddress(); }
+    bool isAdvertisingService(const NimBLEUUID &) const { return false; }
+    int getRSSI() const { return 0; }
+};
+
+class NimBLEScanResults
+{
+public:
+    int getCount() const { return 0; }
+};
+
+class NimBLEClientCallbacks
+{
+public:
+    virtual ~NimBLEClientCallbacks() {}
+    virtual void onConnect(NimBLEClient *) {}
+    virtual void onConnectFail(NimBLEClient *, int) {}
+    virtual void onDisconnect(NimBLEClient *, int) {}
+    virtual void onPassKeyEntry(NimBLEConnInfo &) {}
+    virtual void onAuthenticationComplete(NimBLEConnInfo &) {}
+};
+
+class NimBLEClient
+{
+public:
+    bool connect(const NimBLEAddress &, bool = true, bool = false, bool = true) { return false; }
+    bool disconnect(uint8_t = 0x13) { return true; }
+    bool isConnected() const { return false; }
+    bool secureConnection(bool = false) const { return false; }
+    NimBLERemoteService *getService(const NimBLEUUID &) { return nullptr; }
+    void setClientCallbacks(NimBLEClientCallbacks *, bool = true) {}
+    uint16_t getConnHandle() const { return 1; }
+    NimBLEAddress getPeerAddress() const { return NimBLEAddress(); }
+    void setConnectTimeout(uint32_t) {}
+    void deleteServices() {}
+};
+
+class NimBLEScanCallbacks
+{
+public:
+    virtual ~NimBLEScanCallbacks() {}
+    virtual void onDiscovered(const NimBLEAdvertisedDevice *) {}
+    virtual void onResult(const NimBLEAdvertisedDevice *) {}
+    virtual void onScanEnd(const NimBLEScanResults &, int) {}
+};
+
+class NimBLEScan
+{
+public:
+    void setActiveScan(bool) {}
+    void setInterval(uint16_t) {}
+    void setWindow(uint16_t) {}
+    void setMaxResults(uint8_t) {}
+    void setScanCallbacks(NimBLEScanCallbacks *cb, bool = false) { callbacks = cb; }
+    bool start(uint32_t, bool = false, bool = true)
+    {
+        if (callbacks)
+        {
+            callbacks->onScanEnd(NimBLEScanResults(), 0);
+        }
+        return true;
+    }
+    bool stop() { return true; }
+    bool isScanning() { return false; }
+
+private:
+    NimBLEScanCallbacks *callbacks = nullptr;
+};
+
+class NimBLECharacteristic;
+
+class NimBLECharacteristicCallbacks
+{
+public:
+    virtual ~NimBLECharacteristicCallbacks() {}
+    virtual void onRead(NimBLECharacteristic *, NimBLEConnInfo &) {}
+    virtual void onWrite(NimBLECharacteristic *, NimBLEConnInfo &) {}
+};
+
+class NimBLECharacteristic
+{
+public:
+    explicit NimBLECharacteristic(const std::string &id) : uuid(id) {}
+    void setValue(const uint8_t *bytes, size_t size) { value = NimBLEAttValue(bytes, size); }
+    void setValue(const std::string &s) { value = s; }
+    bool notify(bool = true) { return true; }
+    void setCallbacks(NimBLECharacteristicCallbacks *cb) { callbacks = cb; }
+    NimBLEAttValue getValue() { return value; }
+    NimBLEUUID getUUID() const { return NimBLEUUID(uuid); }
+
+    // Test hook: a central writes s to this characteristic.
+    void centralWrite(const std::string &s)
+    {
+        value = s;
+        NimBLEConnInfo info;
+        if (callbacks)
+        {
+            callbacks->onWrite(this, info);
+        }
+    }
+
+private:
+    std::string uuid;
+    NimBLEAttValue value;
+    NimBLECharacteristicCallbacks *callbacks = nullptr;
+};
+
+class NimBLEService
+{
+public:
+    NimBLECharacteristic *createCharacteristic(const char *uuid, uint32_t, uint16_t = 512);
+    bool start() { return true; }
+};
+
+class NimBLEServer;
+
+class NimBLEServerCallbacks
+{
+public:
+    virtual ~NimBLEServerCallbacks() {}
+    virtual void onConnect(NimBLEServer *, NimBLEConnInfo &) {}
+    virtual void onDisconnect(NimBLEServer *, NimBLEConnInfo &, int) {}
+};
+
+class NimBLEServer
+{
+public:
+    void setCallbacks(NimBLEServerCallbacks *, bool = true) {}
+    void advertiseOnDisconnect(bool) {}
+    NimBLEService *createService(const char *) { return new NimBLEService(); }
+};
+
+class NimBLEAdvertisementData
+{
+public:
+    void setFlags(uint8_t) {}
+    void setAppearance(uint16_t) {}
+    void setName(const std::string &, bool = true) {}
+    void addServiceUUID(const NimBLEUUID &) {}
+};
+
+class NimBLEAdvertising
+{
+public:
+    bool setAdvertisementData(const NimBLEAdvertisementData &) { return true; }
+    bool setScanResponseData(const NimBLEAdvertisementData &) { return true; }
+};
+
+class NimBLEDevice
+{
+public:
+    static bool init(const std::string &) { return true; }
+    static NimBLEScan *getScan();
+    static NimBLEClient *createClient();
+    static bool deleteAllBonds() { return true; }
+    static bool setMTU(uint16_t) { return true; }
+    static void setSecurityAuth(bool, bool, bool) {}
+    static void setSecurityIOCap(uint8_t) {}
+    static void setSecurityPasskey(uint32_t) {}
+    static bool injectPassKey(const NimBLEConnInfo &, uint32_t) { return true; }
+    static NimBLEServer *createServer();
+    static NimBLEAdvertising *getAdvertising();
+    static bool startAdvertising(uint32_t = 0) { return true; }
+    // Local characteristic created with uuid, or null.
+    static NimBLECharacteristic *findCharacteristic(const char *uuid);
+};
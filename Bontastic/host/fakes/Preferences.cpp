@@ -0,0 +1,94 @@
+#include "Preferences.h"
+
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> &storage()
+{
+    static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> spaces;
+    return spaces;
+}
+
+void Preferences::wipe()
+{
+    storage().clear();
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *)
+{
+    space = &storage()[name];
+    writable = !readOnly;
+    return true;
+}
+
+bool Preferences::clear()
+{
+    if (!space || !writable)
+    {
+        return false;
+    }
+    space->clear();
+    return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+    return space && writable && space->erase(key);
+}
+
+size_t Preferences::putString(const char *key, const char *value)
+{
+    return putBytes(key, value, strlen(value) + 1);
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t size)
+{
+    if (!space || !writable)
+    {
+        return 0;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(value);
+    (*space)[key].assign(bytes, bytes + size);
+    return size;
+}
+
+String Preferences::getString(const char *key, String fallback)
+{
+    size_t size = getBytesLength(key);
+    if (!size)
+    {
+        return fallback;
+    }
+    std::vector<char> text(size);
+    getBytes(key, text.data(), size);
+    text.back() = '\0';
+    return String(text.data());
+}
+
+size_t Preferences::getString(const char *key, char *value, size_t capacity)
+{
+    size_t size = getBytesLength(key);
+    if (!size || size > capacity)
+    {
+        return 0;
+    }
+    return getBytes(key, value, capacity);
+}
+
+size_t Preferences::getBytes(const char *key, void *value, size_t capacity)
+{
+    size_t size = getBytesLength(key);
+    if (!size || size > capacity)
+    {
+        return 0;
+    }
+    memcpy(value, (*space)[key].data(), size);
+    return size;
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+    if (!space)
+    {
+        return 0;
+    }
+    auto found = space->find(key);
+    return found == space->end() ? 0 : found->second.size();
+}
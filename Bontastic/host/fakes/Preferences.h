@@ -0,0 +1,47 @@
+#pragma once
+
+// NVS stand-in: namespaces of typed keys held in memory for the process.
+
+#include <map>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+class Preferences
+{
+public:
+    bool begin(const char *name, bool readOnly = false, const char *partition = nullptr);
+    void end() { space = nullptr; }
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key) const { return space && space->count(key); }
+
+    size_t putUChar(const char *key, uint8_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putUShort(const char *key, uint16_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putUInt(const char *key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putString(const char *key, const char *value);
+    size_t putBytes(const char *key, const void *value, size_t size);
+
+    uint8_t getUChar(const char *key, uint8_t fallback = 0) { return get(key, fallback); }
+    uint16_t getUShort(const char *key, uint16_t fallback = 0) { return get(key, fallback); }
+    uint32_t getUInt(const char *key, uint32_t fallback = 0) { return get(key, fallback); }
+    String getString(const char *key, String fallback = String());
+    size_t getString(const char *key, char *value, size_t capacity);
+    size_t getBytes(const char *key, void *value, size_t capacity);
+    size_t getBytesLength(const char *key);
+
+    // Test hook: forget every namespace.
+    static void wipe();
+
+private:
+    typedef std::map<std::string, std::vector<uint8_t>> Space;
+
+    template <typename T> T get(const char *key, T fallback)
+    {
+        T value;
+        return getBytesLength(key) == sizeof(value) && getBytes(key, &value, sizeof(value)) ? value : fallback;
+    }
+
+    Space *space = nullptr;
+    bool writable = false;
+};
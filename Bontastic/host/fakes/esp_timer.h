@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// Microseconds on the fake clock (see hostAdvanceMicros in Arduino.h).
+int64_t esp_timer_get_time();
@@ -0,0 +1,36 @@
+#pragma once
+
+// ESP-IDF qrcode component stand-in. No encoder is bundled, so generation
+// always fails and callers take their no-QR path.
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_QRCODE_ECC_LOW 0
+#define ESP_QRCODE_ECC_MED 1
+
+typedef const uint8_t *esp_qrcode_handle_t;
+
+typedef struct
+{
+    void (*display_func)(esp_qrcode_handle_t qrcode);
+    int max_qrcode_version;
+    int qrcode_ecc_level;
+} esp_qrcode_config_t;
+
+inline esp_err_t esp_qrcode_generate(esp_qrcode_config_t *, const char *)
+{
+    return ESP_FAIL;
+}
+
+inline int esp_qrcode_get_size(esp_qrcode_handle_t)
+{
+    return 0;
+}
+
+inline bool esp_qrcode_get_module(esp_qrcode_handle_t, int, int)
+{
+    return false;
+}
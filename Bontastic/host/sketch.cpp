@@ -0,0 +1,3 @@
+// The Arduino builder compiles the .ino as C++ after adding prototypes; the
+// sketch declares everything before use, so including it is equivalent.
+#include "../Bontastic.ino"
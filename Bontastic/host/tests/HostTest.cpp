@@ -0,0 +1,119 @@
+#include "HostTest.h"
+#include <LittleFS.h>
+#include <Preferences.h>
+#include <vector>
+#include "nanopb/pb_encode.h"
+
+struct RegisteredTest
+{
+    const char *name;
+    void (*body)();
+};
+
+static std::vector<RegisteredTest> &registry()
+{
+    static std::vector<RegisteredTest> tests;
+    return tests;
+}
+
+static int currentFailures;
+
+HostTestCase::HostTestCase(const char *name, void (*body)())
+{
+    registry().push_back({name, body});
+}
+
+void hostCheck(bool ok, const char *what, const char *file, int line)
+{
+    if (!ok)
+    {
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, what);
+        currentFailures++;
+    }
+}
+
+void hostCheckEqual(long long actual, long long expected, const char *what, const char *file, int line)
+{
+    if (actual != expected)
+    {
+        fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", file, line, what, actual, expected);
+        currentFailures++;
+    }
+}
+
+void hostCheckBytes(const std::string &actual, const std::string &expected, const char *what, const char *file,
+                    int line)
+{
+    if (actual != expected)
+    {
+        fprintf(stderr, "%s:%d: %s is\n  \"%s\", expected\n  \"%s\"\n", file, line, what, escapeBytes(actual).c_str(),
+                escapeBytes(expected).c_str());
+        currentFailures++;
+    }
+}
+
+std::string escapeBytes(const std::string &bytes)
+{
+    std::string text;
+    for (unsigned char c : bytes)
+    {
+        if (c >= 0x20 && c < 0x7F && c != '\\')
+        {
+            text += static_cast<char>(c);
+        }
+        else
+        {
+            char hex[8];
+            snprintf(hex, sizeof(hex), "\\x%02X", c);
+            text += hex;
+        }
+    }
+    return text;
+}
+
+void hostReset()
+{
+    Serial.clear();
+    Serial2.clear();
+    LittleFS.wipe();
+    Preferences::wipe();
+}
+
+FromRadioFrame meshFrame(uint32_t from, uint32_t id, int port, const std::string &payload)
+{
+    meshtastic_FromRadio message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_packet_tag;
+    meshtastic_MeshPacket &packet = message.packet;
+    packet.from = from;
+    packet.to = 0xFFFFFFFF;
+    packet.id = id;
+    packet.rx_time = 1700000000;
+    packet.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    packet.decoded.portnum = static_cast<meshtastic_PortNum>(port);
+    packet.decoded.payload.size = payload.size();
+    memcpy(packet.decoded.payload.bytes, payload.data(), payload.size());
+
+    FromRadioFrame frame = {};
+    pb_ostream_t stream = pb_ostream_from_buffer(frame.bytes, sizeof(frame.bytes));
+    if (!pb_encode(&stream, meshtastic_FromRadio_fields, &message))
+    {
+        fprintf(stderr, "FromRadio encode failed: %s\n", PB_GET_ERROR(&stream));
+        abort();
+    }
+    frame.size = stream.bytes_written;
+    return frame;
+}
+
+int main()
+{
+    int failed = 0;
+    for (const RegisteredTest &test : registry())
+    {
+        currentFailures = 0;
+        test.body();
+        printf("%s %s\n", currentFailures ? "FAIL" : "ok  ", test.name);
+        failed += currentFailures ? 1 : 0;
+    }
+    printf("%d of %zu failed\n", failed, registry().size());
+    return failed;
+}
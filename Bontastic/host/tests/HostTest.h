@@ -0,0 +1,37 @@
+#pragma once
+
+// Minimal test registry for the host build: TEST() bodies run in file order,
+// CHECK failures are reported and counted, and the exit status is the number
+// of failed tests.
+
+#include <Arduino.h>
+#include <string>
+#include "radio/FromRadioRing.h"
+
+struct HostTestCase
+{
+    HostTestCase(const char *name, void (*body)());
+};
+
+#define TEST(name)                                                                                                     \
+    static void name();                                                                                                \
+    static HostTestCase name##Case(#name, name);                                                                       \
+    static void name()
+
+#define CHECK(condition) hostCheck((condition), #condition, __FILE__, __LINE__)
+#define CHECK_EQ(actual, expected)                                                                                     \
+    hostCheckEqual(static_cast<long long>(actual), static_cast<long long>(expected), #actual, __FILE__, __LINE__)
+#define CHECK_BYTES(actual, expected) hostCheckBytes((actual), (expected), #actual, __FILE__, __LINE__)
+
+void hostCheck(bool ok, const char *what, const char *file, int line);
+void hostCheckEqual(long long actual, long long expected, const char *what, const char *file, int line);
+void hostCheckBytes(const std::string &actual, const std::string &expected, const char *what, const char *file,
+                    int line);
+
+// Clears both UART recordings, the file system and preferences.
+void hostReset();
+// Printable rendering of a byte string, non-ASCII bytes as \xNN.
+std::string escapeBytes(const std::string &bytes);
+
+// Encodes a FromRadio carrying a decoded MeshPacket on port with payload.
+FromRadioFrame meshFrame(uint32_t from, uint32_t id, int port, const std::string &payload);
@@ -0,0 +1,113 @@
+#include "HostTest.h"
+#include <vector>
+#include "mesh/DuplicateFilter.h"
+
+static const uint32_t node = 0x1234ABCD;
+static const size_t ringSize = 64;
+static const size_t slotCount = 128;
+
+// Same hash as the filter's index, to pick ids whose home slots collide.
+static size_t home(uint32_t id)
+{
+    return ((node * 2654435761u) ^ (id * 2246822519u)) >> 25 & (slotCount - 1);
+}
+
+// The first count ids past after whose home slot is slot.
+static std::vector<uint32_t> idsAt(size_t slot, size_t count, uint32_t after = 0)
+{
+    std::vector<uint32_t> ids;
+    for (uint32_t id = after + 1; ids.size() < count; ++id)
+    {
+        if (home(id) == slot)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+// A, B and C share home slot h and D has home h + 1, so they sit in a row
+// from h. Filler packets, one per slot well away from h, fill the rest of
+// the ring; the next new packet recycles A and empties slot h. B, C and D
+// must move back, or the lookups for them stop at the hole.
+static void checkBackwardShift(size_t h)
+{
+    duplicateFilterReset();
+    std::vector<uint32_t> chain = idsAt(h, 3);
+    uint32_t d = idsAt((h + 1) & (slotCount - 1), 1)[0];
+    chain.push_back(d);
+    for (uint32_t id : chain)
+    {
+        CHECK(!duplicatePacket(node, id));
+    }
+    uint32_t last = 0;
+    for (size_t i = 0; i < ringSize - chain.size(); ++i)
+    {
+        last = idsAt((h + 32 + i) & (slotCount - 1), 1, 0x10000)[0];
+        CHECK(!duplicatePacket(node, last));
+    }
+    CHECK(duplicatePacket(node, last));
+    CHECK(duplicatePacket(node, chain[0]));
+
+    // One more new packet recycles the oldest ring entry, A.
+    CHECK(!duplicatePacket(node, idsAt((h + 100) & (slotCount - 1), 1, 0x20000)[0]));
+    CHECK(duplicatePacket(node, chain[1]));
+    CHECK(duplicatePacket(node, chain[2]));
+    CHECK(duplicatePacket(node, d));
+    CHECK(!duplicatePacket(node, chain[0]));
+}
+
+TEST(shiftsProbeChainBackOnRemoval)
+{
+    checkBackwardShift(40);
+}
+
+TEST(shiftsProbeChainBackAcrossWrap)
+{
+    // The chain runs 126, 127, 0, 1.
+    checkBackwardShift(slotCount - 2);
+}
+
+TEST(recyclesOldestAfterFullRing)
+{
+    duplicateFilterReset();
+    for (uint32_t id = 1; id <= ringSize; ++id)
+    {
+        CHECK(!duplicatePacket(node, id));
+    }
+    for (uint32_t id = 1; id <= ringSize; ++id)
+    {
+        CHECK(duplicatePacket(node, id));
+    }
+    // Packet 65 takes packet 1's entry, 66 takes packet 2's.
+    CHECK(!duplicatePacket(node, ringSize + 1));
+    CHECK(!duplicatePacket(node, ringSize + 2));
+    CHECK(duplicatePacket(node, ringSize + 1));
+    CHECK(duplicatePacket(node, 3));
+    CHECK(duplicatePacket(node, ringSize));
+    // Packet 1 counts as new again and in turn takes packet 3's entry.
+    CHECK(!duplicatePacket(node, 1));
+    CHECK(!duplicatePacket(node, 3));
+    // Same id from another node is a different packet.
+    CHECK(!duplicatePacket(node + 1, 3));
+}
+
+TEST(expiresAfterWindow)
+{
+    duplicateFilterReset();
+    CHECK(!duplicatePacket(node, 7));
+    hostAdvanceMicros((duplicateWindow - 1) * 1000ULL);
+    CHECK(duplicatePacket(node, 7));
+    hostAdvanceMicros(1000);
+    // Seen again after the window: printed, and the window restarts.
+    CHECK(!duplicatePacket(node, 7));
+    hostAdvanceMicros((duplicateWindow - 1) * 1000ULL);
+    CHECK(duplicatePacket(node, 7));
+}
+
+TEST(ignoresPacketsWithoutId)
+{
+    duplicateFilterReset();
+    CHECK(!duplicatePacket(node, 0));
+    CHECK(!duplicatePacket(node, 0));
+}
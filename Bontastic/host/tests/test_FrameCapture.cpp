@@ -0,0 +1,101 @@
+#include "HostTest.h"
+#include <LittleFS.h>
+#include "radio/FrameCapture.h"
+
+static FromRadioFrame frameOf(const std::string &bytes)
+{
+    FromRadioFrame frame = {};
+    memcpy(frame.bytes, bytes.data(), bytes.size());
+    frame.size = bytes.size();
+    return frame;
+}
+
+static size_t fileSize()
+{
+    fs::FileData data = LittleFS.contents(captureFilePath);
+    return data ? data->size() : 0;
+}
+
+// Reads the whole capture back as "payload" per frame and "|" per session.
+static std::string readBack()
+{
+    CaptureReader reader;
+    std::string out;
+    if (!reader.open(captureFilePath))
+    {
+        return "(none)";
+    }
+    FromRadioFrame frame;
+    uint32_t stamp;
+    while (reader.next(frame, stamp))
+    {
+        if (reader.startsSession())
+        {
+            out += "|";
+        }
+        out.append(reinterpret_cast<const char *>(frame.bytes), frame.size);
+    }
+    reader.close();
+    return out;
+}
+
+TEST(recordsFramesInSession)
+{
+    hostReset();
+    CHECK(frameCaptureStart(false));
+    captureFrame(frameOf("one"));
+    captureFrame(frameOf("two"));
+    frameCaptureStop();
+    CHECK_BYTES(readBack(), "|onetwo");
+}
+
+TEST(freshStartReplacesRecording)
+{
+    hostReset();
+    frameCaptureStart(false);
+    captureFrame(frameOf("old"));
+    frameCaptureStop();
+    frameCaptureStart(false);
+    captureFrame(frameOf("new"));
+    frameCaptureStop();
+    CHECK_BYTES(readBack(), "|new");
+}
+
+TEST(appendMarksEachBoot)
+{
+    hostReset();
+    frameCaptureStart(false);
+    captureFrame(frameOf("a"));
+    frameCaptureStop();
+    frameCaptureStart(true);
+    captureFrame(frameOf("b"));
+    captureFrame(frameOf("c"));
+    frameCaptureStop();
+    CHECK_BYTES(readBack(), "|a|bc");
+}
+
+TEST(flushesStagedFramesWhenIdle)
+{
+    hostReset();
+    frameCaptureStart(false);
+    captureFrame(frameOf("quiet"));
+    frameCaptureIdle();
+    CHECK_EQ(fileSize(), 0);
+    hostAdvanceMicros(captureFlushInterval * 1000ULL);
+    frameCaptureIdle();
+    // Magic, session record, then the frame record.
+    CHECK_EQ(fileSize(), 4 + 6 + 6 + 5);
+    frameCaptureStop();
+}
+
+TEST(flushesOldFramesOnNextCapture)
+{
+    hostReset();
+    frameCaptureStart(false);
+    captureFrame(frameOf("first"));
+    hostAdvanceMicros(captureFlushInterval * 1000ULL);
+    captureFrame(frameOf("second"));
+    CHECK_EQ(fileSize(), 4 + 6 + 6 + 5 + 6 + 6);
+    frameCaptureStop();
+    CHECK_BYTES(readBack(), "|firstsecond");
+}
@@ -0,0 +1,174 @@
+#include "HostTest.h"
+#include <vector>
+#include "nanopb/pb_encode.h"
+#include "radio/FromRadioDecoder.h"
+#include "radio/RemoteRead.h"
+
+static std::vector<meshtastic_MeshPacket> packets;
+static std::vector<meshtastic_NodeInfo> nodes;
+static std::vector<uint32_t> completions;
+
+static void onPacket(const meshtastic_MeshPacket &packet)
+{
+    packets.push_back(packet);
+}
+
+static void onNodeInfo(const meshtastic_NodeInfo &info)
+{
+    nodes.push_back(info);
+}
+
+static void onConfigComplete(uint32_t configId)
+{
+    completions.push_back(configId);
+}
+
+static const FromRadioHandlers allHandlers = {onPacket, onNodeInfo, onConfigComplete};
+
+static void clearSeen()
+{
+    packets.clear();
+    nodes.clear();
+    completions.clear();
+}
+
+static FromRadioFrame encode(const meshtastic_FromRadio &message)
+{
+    FromRadioFrame frame = {};
+    pb_ostream_t stream = pb_ostream_from_buffer(frame.bytes, sizeof(frame.bytes));
+    CHECK(pb_encode(&stream, meshtastic_FromRadio_fields, &message));
+    frame.size = stream.bytes_written;
+    return frame;
+}
+
+TEST(decodesTextPacket)
+{
+    clearSeen();
+    FromRadioFrame frame = meshFrame(0x1234, 77, meshtastic_PortNum_TEXT_MESSAGE_APP, "hello mesh");
+    CHECK(decodeFromRadio(frame.bytes, frame.size, allHandlers));
+    CHECK_EQ(packets.size(), 1);
+    CHECK_EQ(packets[0].from, 0x1234);
+    CHECK_EQ(packets[0].id, 77);
+    CHECK_EQ(packets[0].which_payload_variant, meshtastic_MeshPacket_decoded_tag);
+    CHECK_EQ(packets[0].decoded.portnum, meshtastic_PortNum_TEXT_MESSAGE_APP);
+    CHECK_BYTES(std::string((const char *)packets[0].decoded.payload.bytes, packets[0].decoded.payload.size),
+                "hello mesh");
+    CHECK(nodes.empty() && completions.empty());
+}
+
+TEST(decodesNodeInfo)
+{
+    clearSeen();
+    meshtastic_FromRadio message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_node_info_tag;
+    message.node_info.num = 0xABCD;
+    message.node_info.has_user = true;
+    strcpy(message.node_info.user.long_name, "Base Camp");
+    strcpy(message.node_info.user.short_name, "BC");
+    message.node_info.has_position = true;
+    message.node_info.position.has_latitude_i = true;
+    message.node_info.position.latitude_i = 473000000;
+    FromRadioFrame frame = encode(message);
+    CHECK(decodeFromRadio(frame.bytes, frame.size, allHandlers));
+    CHECK_EQ(nodes.size(), 1);
+    CHECK_EQ(nodes[0].num, 0xABCD);
+    CHECK(nodes[0].has_user);
+    CHECK_BYTES(nodes[0].user.long_name, "Base Camp");
+    CHECK_EQ(nodes[0].position.latitude_i, 473000000);
+}
+
+TEST(decodesConfigComplete)
+{
+    clearSeen();
+    meshtastic_FromRadio message = meshtastic_FromRadio_init_zero;
+    message.id = 9;
+    message.which_payload_variant = meshtastic_FromRadio_config_complete_id_tag;
+    message.config_complete_id = 0xBEEF;
+    FromRadioFrame frame = encode(message);
+    CHECK(decodeFromRadio(frame.bytes, frame.size, allHandlers));
+    CHECK_EQ(completions.size(), 1);
+    CHECK_EQ(completions[0], 0xBEEF);
+}
+
+TEST(skipsVariantsWithoutHandler)
+{
+    clearSeen();
+    meshtastic_FromRadio message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_my_info_tag;
+    message.my_info.my_node_num = 42;
+    FromRadioFrame info = encode(message);
+    CHECK(decodeFromRadio(info.bytes, info.size, allHandlers));
+
+    FromRadioFrame text = meshFrame(1, 2, meshtastic_PortNum_TEXT_MESSAGE_APP, "x");
+    FromRadioHandlers noPackets = {nullptr, onNodeInfo, onConfigComplete};
+    CHECK(decodeFromRadio(text.bytes, text.size, noPackets));
+    CHECK(packets.empty() && nodes.empty() && completions.empty());
+}
+
+TEST(rejectsTruncatedFrame)
+{
+    clearSeen();
+    FromRadioFrame frame = meshFrame(1, 2, meshtastic_PortNum_TEXT_MESSAGE_APP, "truncated payload");
+    CHECK(!decodeFromRadio(frame.bytes, frame.size - 3, allHandlers));
+    CHECK(packets.empty());
+    static const uint8_t badTag[] = {0x12, 0x80};
+    CHECK(!decodeFromRadio(badTag, sizeof(badTag), allHandlers));
+}
+
+TEST(readsLongValueInChunks)
+{
+    FromRadioFrame frame = meshFrame(5, 6, meshtastic_PortNum_TEXT_MESSAGE_APP, std::string(150, 'm'));
+    NimBLERemoteCharacteristic fromRadio;
+    fromRadio.value.assign(frame.bytes, frame.bytes + frame.size);
+
+    uint8_t buffer[fromRadioSlotSize];
+    size_t length = 0;
+    CHECK(readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK_EQ(length, frame.size);
+    CHECK(memcmp(buffer, frame.bytes, frame.size) == 0);
+
+    clearSeen();
+    CHECK(decodeFromRadio(buffer, length, allHandlers));
+    CHECK_EQ(packets.size(), 1);
+    CHECK_EQ(packets[0].decoded.payload.size, 150);
+}
+
+TEST(readFailsOnOverflowAndError)
+{
+    NimBLERemoteCharacteristic fromRadio;
+    fromRadio.value.assign(64, 0x55);
+    uint8_t buffer[32];
+    size_t length = 1;
+    CHECK(!readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK_EQ(length, 0);
+
+    fromRadio.readStatus = 0x105;
+    CHECK(!readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK(!readRemoteValue(nullptr, buffer, sizeof(buffer), length));
+
+    fromRadio.readStatus = 0;
+    fromRadio.value.clear();
+    CHECK(readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK_EQ(length, 0);
+}
+
+TEST(readTimesOutWhenNeverCompleted)
+{
+    NimBLERemoteCharacteristic fromRadio;
+    fromRadio.value.assign(20, 0x33);
+    fromRadio.stalled = true;
+    uint8_t buffer[32] = {};
+    size_t length = 1;
+    CHECK(!readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK_EQ(length, 0);
+    CHECK(Serial.output.find("Read timed out") != std::string::npos);
+    // Refused while NimBLE still owns the abandoned procedure.
+    CHECK(!readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+
+    // Its late completion leaves the buffer alone and frees the reader.
+    NimBLERemoteCharacteristic::completeStalledRead();
+    CHECK_EQ(buffer[0], 0);
+    CHECK(readRemoteValue(&fromRadio, buffer, sizeof(buffer), length));
+    CHECK_EQ(length, 20);
+    CHECK_EQ(buffer[0], 0x33);
+}
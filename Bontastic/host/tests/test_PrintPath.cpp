@@ -0,0 +1,357 @@
+#include "HostTest.h"
+#include <LittleFS.h>
+#include <NimBLEDevice.h>
+#include <algorithm>
+#include "mesh/DuplicateFilter.h"
+#include "mesh/NodeDirectory.h"
+#include "mesh/TelemetryStats.h"
+#include "printer/PrintHelpers.h"
+#include "printer/PrintQueue.h"
+#include "printer/PrinterControl.h"
+#include "printer/SpoolQueue.h"
+#include "nanopb/pb_encode.h"
+
+// Defined in Bontastic.ino.
+void decodeFromRadioPacket(const FromRadioFrame &frame);
+void printNodeTelemetry(uint32_t window, uint32_t num, uint16_t reports, const char *text, size_t size);
+
+static void startPrinter()
+{
+    hostReset();
+    setupPrinterControl();
+    printerSetup();
+    Serial2.clear();
+}
+
+// Prints every queued job and returns the UART bytes they produced.
+static std::string drainPrinter()
+{
+    Serial2.clear();
+    PrintJob job;
+    while (takePrintJob(job, 0))
+    {
+        printJob(job);
+        completePrintJob();
+    }
+    return Serial2.output;
+}
+
+TEST(printsReadyBanner)
+{
+    hostReset();
+    setupPrinterControl();
+    printerSetup();
+    CHECK(Serial2.output.find("Bontastic Printer Ready") != std::string::npos);
+}
+
+TEST(printsTextMessageFromFrame)
+{
+    startPrinter();
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 501, meshtastic_PortNum_TEXT_MESSAGE_APP, "hello mesh"));
+    CHECK_EQ(printQueueDepth(PriorityNormal), 1);
+    std::string out = drainPrinter();
+    CHECK(out.find("From: !1234abcd\n") != std::string::npos);
+    CHECK(out.find("Time: 2023-11-14 22:13:20\n") != std::string::npos);
+    CHECK(out.find("hello mesh") != std::string::npos);
+    // The whole receipt goes to the UART as one write.
+    CHECK_EQ(Serial2.writes, 1);
+}
+
+TEST(transcodesMessageBody)
+{
+    startPrinter();
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 502, meshtastic_PortNum_TEXT_MESSAGE_APP, "caf\xC3\xA9"));
+    std::string out = drainPrinter();
+    // The default code page is ISO 8859-1.
+    CHECK(out.find("caf\xE9") != std::string::npos);
+    CHECK(out.find("\xC3\xA9") == std::string::npos);
+}
+
+TEST(printsCompressedMessage)
+{
+    startPrinter();
+    // "meet at the printer at 18:30 then feed the printer", as in the bench
+    // corpus.
+    static const char compressed[] = "\xf9\x6e\x14\xc2\x8e\xcd\x78\xdd\xe4\x3d\xa9\x84\x43"
+                                     "\x9b\x0c\x14\x76\x78\xbe\x1b\xe8\xd1\xde\x5f\xff";
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 505, meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP,
+                                    std::string(compressed, sizeof(compressed) - 1)));
+    std::string out = drainPrinter();
+#if UNISHOX2_TEXT
+    CHECK(out.find("meet at the printer at 18:30 then feed the printer") != std::string::npos);
+#else
+    CHECK(out.find("meet at") == std::string::npos);
+#endif
+}
+
+static std::string positionPayload(const meshtastic_Position &position)
+{
+    uint8_t bytes[meshtastic_Position_size];
+    pb_ostream_t stream = pb_ostream_from_buffer(bytes, sizeof(bytes));
+    pb_encode(&stream, meshtastic_Position_fields, &position);
+    return std::string(reinterpret_cast<const char *>(bytes), stream.bytes_written);
+}
+
+TEST(ignoresPositionWithoutFix)
+{
+    startPrinter();
+    meshtastic_Position position = meshtastic_Position_init_zero;
+    position.has_altitude = true;
+    position.altitude = 120;
+    position.has_latitude_i = true;
+    position.latitude_i = 525200000;
+    decodeFromRadioPacket(meshFrame(0x5A5A0001, 506, meshtastic_PortNum_POSITION_APP, positionPayload(position)));
+    CHECK_EQ(printQueueDepth(PriorityNormal), 0);
+    const NodeEntry *node = findNode(0x5A5A0001);
+    CHECK(!node || !node->hasPosition);
+}
+
+TEST(printsPositionWithoutAltitude)
+{
+    startPrinter();
+    meshtastic_Position position = meshtastic_Position_init_zero;
+    position.has_latitude_i = true;
+    position.latitude_i = 525200000;
+    position.has_longitude_i = true;
+    position.longitude_i = 134050000;
+    decodeFromRadioPacket(meshFrame(0x5A5A0002, 507, meshtastic_PortNum_POSITION_APP, positionPayload(position)));
+    const NodeEntry *node = findNode(0x5A5A0002);
+    CHECK(node && node->hasPosition && node->latitudeI == 525200000);
+    std::string out = drainPrinter();
+    CHECK(out.find("geo:52.520000,13.405000\n") != std::string::npos);
+
+    position.has_altitude = true;
+    position.altitude = 34;
+    decodeFromRadioPacket(meshFrame(0x5A5A0002, 508, meshtastic_PortNum_POSITION_APP, positionPayload(position)));
+    out = drainPrinter();
+    CHECK(out.find("geo:52.520000,13.405000,34\n") != std::string::npos);
+}
+
+TEST(printsLongRawTextInParts)
+{
+    startPrinter();
+    std::string text;
+    for (int i = 0; i < 40; ++i)
+    {
+        text += "line " + std::to_string(i) + " of the raw text\n";
+    }
+    printRawText(text);
+    CHECK(printQueueDepth(PriorityNormal) > 1);
+    std::string out = drainPrinter();
+    size_t at = 0;
+    for (int i = 0; i < 40; ++i)
+    {
+        at = out.find("line " + std::to_string(i) + " of the raw text\n", at);
+        CHECK(at != std::string::npos);
+    }
+    // Parts break at line ends, and only the last one feeds the paper.
+    CHECK_EQ(out.find("\n\n"), out.find("line 39 of the raw text\n") + 23);
+    CHECK_EQ(out.find("\x1B" "d\x02"), out.rfind("\x1B" "d\x02"));
+
+    // Without line breaks a part never ends inside a UTF-8 sequence.
+    std::string accents;
+    for (int i = 0; i < 300; ++i)
+    {
+        accents += "\xC3\xA9";
+    }
+    printRawText(accents);
+    out = drainPrinter();
+    CHECK_EQ(std::count(out.begin(), out.end(), '\xE9'), 300);
+    CHECK(out.find('?') == std::string::npos);
+}
+
+static PrintJob spoolJob(uint32_t from)
+{
+    PrintJob job = {};
+    job.kind = TextJob;
+    job.from = from;
+    return job;
+}
+
+TEST(spoolStaysInRamUntilWindowFills)
+{
+    hostReset();
+    SpoolQueue spool;
+    spool.begin("/t.bin", "/t.cur");
+    for (uint32_t i = 0; i < spoolRamJobs; ++i)
+    {
+        CHECK(spool.push(spoolJob(i)));
+    }
+    CHECK(!LittleFS.exists("/t.bin"));
+
+    // The first job past the window takes the whole window to flash with it.
+    CHECK(spool.push(spoolJob(spoolRamJobs)));
+    CHECK_EQ(LittleFS.contents("/t.bin")->size(), (spoolRamJobs + 1) * (2 * sizeof(uint32_t) + sizeof(PrintJob)));
+    SpoolQueue recovered;
+    recovered.begin("/t.bin", "/t.cur");
+    CHECK_EQ(recovered.size(), spoolRamJobs + 1);
+    PrintJob job;
+    CHECK(recovered.peek(spoolRamJobs, job) && job.from == spoolRamJobs);
+
+    // The cursor is written once per batch of pops, and the journal goes
+    // once everything on it has printed.
+    for (uint32_t i = 0; i + 1 < spoolCursorBatch; ++i)
+    {
+        CHECK(spool.peek(0, job) && job.from == i);
+        spool.pop();
+    }
+    CHECK(!LittleFS.exists("/t.cur"));
+    spool.pop();
+    CHECK(LittleFS.exists("/t.cur"));
+    spool.pop();
+    CHECK_EQ(spool.size(), 0u);
+    CHECK(!LittleFS.exists("/t.bin"));
+    CHECK(spool.push(spoolJob(100)));
+    CHECK(!LittleFS.exists("/t.bin"));
+}
+
+TEST(spoolCheckpointJournalsRamJobs)
+{
+    hostReset();
+    SpoolQueue spool;
+    spool.begin("/t.bin", "/t.cur");
+    CHECK(spool.push(spoolJob(1)));
+    CHECK(spool.push(spoolJob(2)));
+    spool.checkpoint();
+    CHECK(spool.push(spoolJob(3)));
+    spool.pop();
+    spool.checkpoint();
+
+    SpoolQueue recovered;
+    recovered.begin("/t.bin", "/t.cur");
+    CHECK_EQ(recovered.size(), 2u);
+    PrintJob job;
+    CHECK(recovered.peek(0, job) && job.from == 2);
+    CHECK(recovered.peek(1, job) && job.from == 3);
+}
+
+TEST(dropsRepeatedPacket)
+{
+    startPrinter();
+    FromRadioFrame frame = meshFrame(0x1234ABCD, 503, meshtastic_PortNum_TEXT_MESSAGE_APP, "once");
+    decodeFromRadioPacket(frame);
+    decodeFromRadioPacket(frame);
+    CHECK_EQ(printQueueDepth(PriorityNormal), 1);
+    drainPrinter();
+}
+
+TEST(ignoresCorruptFrame)
+{
+    startPrinter();
+    FromRadioFrame frame = meshFrame(0x1234ABCD, 504, meshtastic_PortNum_TEXT_MESSAGE_APP, "cut short");
+    frame.size -= 4;
+    decodeFromRadioPacket(frame);
+    CHECK_EQ(printQueueDepth(PriorityNormal), 0);
+    CHECK(Serial.output.find("FromRadio decode failed") != std::string::npos);
+}
+
+TEST(combinesTelemetryWindow)
+{
+    startPrinter();
+    // Close whatever window earlier tests left open.
+    telemetrySummarize(true, printNodeTelemetry);
+    drainPrinter();
+
+    meshtastic_Telemetry device = meshtastic_Telemetry_init_zero;
+    device.which_variant = meshtastic_Telemetry_device_metrics_tag;
+    device.variant.device_metrics.has_battery_level = true;
+    device.variant.device_metrics.battery_level = 80;
+    telemetryRecord(0x11111111, device);
+    device.variant.device_metrics.battery_level = 90;
+    telemetryRecord(0x11111111, device);
+    meshtastic_Telemetry environment = meshtastic_Telemetry_init_zero;
+    environment.which_variant = meshtastic_Telemetry_environment_metrics_tag;
+    environment.variant.environment_metrics.has_temperature = true;
+    environment.variant.environment_metrics.temperature = 21.5f;
+    telemetryRecord(0x22222222, environment);
+    // Reported, but with none of the tracked metrics.
+    meshtastic_Telemetry empty = meshtastic_Telemetry_init_zero;
+    empty.which_variant = meshtastic_Telemetry_device_metrics_tag;
+    telemetryRecord(0x33333333, empty);
+
+    telemetrySummarize(true, printNodeTelemetry);
+    CHECK_EQ(printQueueDepth(PriorityNormal), 2);
+    Serial2.clear();
+    PrintJob job;
+    CHECK(takePrintJob(job, 0));
+    CHECK_EQ(printTelemetry(job), 2);
+    completePrintJobs(2);
+    CHECK_EQ(printQueueDepth(PriorityNormal), 0);
+    std::string out = Serial2.output;
+    CHECK_EQ(Serial2.writes, 1);
+    CHECK(out.find("!11111111 (2)\nBatt    80.0   85.0   90.0\n") != std::string::npos);
+    CHECK(out.find("!22222222 (1)\nTemp    21.5   21.5   21.5\n") != std::string::npos);
+    CHECK(out.find("!33333333") == std::string::npos);
+    CHECK_EQ(out.find("Telemetry\n"), out.rfind("Telemetry\n"));
+}
+
+// Runs the print task's loop until the queue is empty and returns the UART
+// bytes it produced.
+static std::string servePrintQueue()
+{
+    Serial2.clear();
+    PrintJob job;
+    while (takePrintJob(job, 0))
+    {
+        if (digestWanted(job))
+        {
+            completePrintJobs(printDigest(job));
+        }
+        else
+        {
+            printJob(job);
+            completePrintJob();
+        }
+    }
+    return Serial2.output;
+}
+
+TEST(alertCutsDigestHoldShort)
+{
+    startPrinter();
+    NimBLECharacteristic *digestWindow = NimBLEDevice::findCharacteristic("5a1a001b-8f19-4a86-9a9e-7b4f7f9b0002");
+    CHECK(digestWindow);
+    digestWindow->centralWrite("30");
+    servePrintQueue();
+    CHECK_EQ(getPrinterSettings().digestWindow, 30);
+
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 509, meshtastic_PortNum_TEXT_MESSAGE_APP, "held"));
+    PrintJob job;
+    CHECK(takePrintJob(job, 0) && digestWanted(job));
+    // The alert arrives while the message is held: the hold ends with
+    // nothing printed, the alert goes next and the held message right after
+    // it, without waiting out the rest of the window.
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 510, meshtastic_PortNum_ALERT_APP, "fire"));
+    uint32_t start = millis();
+    CHECK_EQ(printDigest(job), 0);
+    std::string out = servePrintQueue();
+    // Paper pacing advances the clock too, but far less than the window.
+    CHECK(millis() - start < 30000);
+    size_t fire = out.find("fire");
+    CHECK(fire != std::string::npos);
+    CHECK(out.find("held", fire) != std::string::npos);
+    CHECK_EQ(printQueueDepth(PriorityNormal), 0);
+
+    // The next message on its own is held for the whole window again.
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 513, meshtastic_PortNum_TEXT_MESSAGE_APP, "later"));
+    start = millis();
+    CHECK(servePrintQueue().find("later") != std::string::npos);
+    CHECK(millis() - start >= 30000);
+
+    digestWindow->centralWrite("0");
+    servePrintQueue();
+}
+
+TEST(recordsLatencyOfCompletedJobs)
+{
+    startPrinter();
+    uint32_t before = printQueueLatency(PriorityNormal).jobs;
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 511, meshtastic_PortNum_TEXT_MESSAGE_APP, "one"));
+    decodeFromRadioPacket(meshFrame(0x1234ABCD, 512, meshtastic_PortNum_TEXT_MESSAGE_APP, "two"));
+    PrintJob job;
+    CHECK(takePrintJob(job, 0));
+    // Taken but not yet on paper.
+    CHECK_EQ(printQueueLatency(PriorityNormal).jobs, before);
+    completePrintJobs(2);
+    CHECK_EQ(printQueueLatency(PriorityNormal).jobs, before + 2);
+}
@@ -0,0 +1,158 @@
+#include "HostTest.h"
+#include "printer/GlyphCache.h"
+#include "printer/RasterText.h"
+
+static const uint8_t cp437 = 0;
+
+static const uint8_t *u8(const char *s)
+{
+    return reinterpret_cast<const uint8_t *>(s);
+}
+
+static bool improves(const char *text)
+{
+    return rasterImproves(u8(text), strlen(text), cp437);
+}
+
+static std::string downloaded;
+
+static void recordGlyph(const uint8_t *bytes, size_t size)
+{
+    downloaded.append(reinterpret_cast<const char *>(bytes), size);
+}
+
+TEST(decidesWhenRasterHelps)
+{
+    CHECK(!improves("plain ascii"));
+    CHECK(!improves("caf\xC3\xA9"));         // in the code page
+    CHECK(improves("\xCE\xBB"));             // Greek small lambda, from the font
+    CHECK(improves("\xE4\xB8\xAD\xE6\x96\x87")); // CJK only: printed as boxes
+    CHECK(improves("\xF0\x9F\x98\x80"));     // emoticon from the font
+    CHECK(!improves("a\xEF\xB8\x8F"));       // a lone variation selector prints nothing
+}
+
+TEST(mapsCodepointsToGlyphs)
+{
+    CHECK_EQ(rasterGlyphFor(0x3BB), 0x3BB);
+    CHECK_EQ(rasterGlyphFor(0x1F600), 0x1F600);
+    CHECK_EQ(rasterGlyphFor(0x4E2D), rasterMissingGlyph);
+    CHECK_EQ(rasterGlyphFor(0x1F9A9), rasterMissingGlyph);
+    CHECK_EQ(rasterGlyphFor(0xFE0F), 0);
+    CHECK_EQ(rasterGlyphFor(0x200D), 0);
+}
+
+TEST(drawsBoxCellForMissingGlyph)
+{
+    uint8_t cell[rasterCellWidth * rasterCellBytes];
+    CHECK(rasterGlyphCell(0x4E2D, cell));
+    uint8_t other[sizeof(cell)];
+    CHECK(rasterGlyphCell(0xAC00, other));
+    CHECK(memcmp(cell, other, sizeof(cell)) == 0);
+    int ink = 0;
+    for (uint8_t b : cell)
+    {
+        ink += __builtin_popcount(b);
+    }
+    CHECK(ink > 20);
+    CHECK(!rasterGlyphCell(0xFE0F, cell));
+}
+
+TEST(cachesOneBoxForAllMissingCharacters)
+{
+    GlyphCache cache;
+    downloaded.clear();
+    // Three different ideographs, a lambda and an emoticon.
+    const char *text = "\xE4\xB8\xAD\xE6\x96\x87\xE5\xAD\x97 \xCE\xBB\xF0\x9F\x98\x80";
+    CHECK(cache.prepare(u8(text), strlen(text), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 3);
+
+    uint8_t out[64];
+    size_t n = cache.transcode(u8(text), strlen(text), cp437, out, sizeof(out));
+    std::string printed(reinterpret_cast<const char *>(out), n);
+    // ESC % 1, the box three times, the space, two glyph slots, ESC % 0.
+    CHECK_EQ(printed.size(), 3 + 3 + 1 + 2 + 3);
+    CHECK_BYTES(printed.substr(0, 3), "\x1B%\x01");
+    CHECK(printed[3] == printed[4] && printed[4] == printed[5]);
+    CHECK(printed[7] != printed[3] && printed[8] != printed[3] && printed[7] != printed[8]);
+}
+
+static std::string rasterOut;
+static uint32_t rasterRows;
+static uint32_t rasterFeedRows;
+
+static void recordRaster(const uint8_t *bytes, size_t size, uint16_t rows, uint16_t feedRows)
+{
+    rasterOut.append(reinterpret_cast<const char *>(bytes), size);
+    rasterRows += rows;
+    rasterFeedRows += feedRows;
+}
+
+static void resetRaster()
+{
+    rasterOut.clear();
+    rasterRows = 0;
+    rasterFeedRows = 0;
+}
+
+TEST(feedsAllWhiteBand)
+{
+    static uint8_t band[rasterHeaderSize + 300 * rasterRowBytes];
+    memset(band, 0, sizeof(band));
+    resetRaster();
+    RasterStats before = rasterStats();
+    sendRasterBand(band, 24, recordRaster);
+    CHECK_BYTES(rasterOut, std::string("\x1BJ\x18", 3));
+    CHECK_EQ(rasterRows, 0);
+    CHECK_EQ(rasterFeedRows, 24);
+    CHECK_EQ(rasterStats().bands - before.bands, 1);
+    CHECK_EQ(rasterStats().rawBytes - before.rawBytes, rasterHeaderSize + 24 * rasterRowBytes);
+    CHECK_EQ(rasterStats().sentBytes - before.sentBytes, 3);
+
+    // ESC J feeds at most 255 rows at a time.
+    resetRaster();
+    sendRasterBand(band, 300, recordRaster);
+    CHECK_BYTES(rasterOut, std::string("\x1BJ\xFF\x1BJ\x2D", 6));
+    CHECK_EQ(rasterFeedRows, 300);
+}
+
+TEST(trimsBandToInk)
+{
+    uint8_t band[rasterHeaderSize + 10 * rasterRowBytes] = {};
+    uint8_t *bitmap = band + rasterHeaderSize;
+    bitmap[3 * rasterRowBytes] = 0x80;
+    bitmap[4 * rasterRowBytes + 5] = 0x01;
+    resetRaster();
+    RasterStats before = rasterStats();
+    sendRasterBand(band, 10, recordRaster);
+
+    // Three white rows fed, two rows six bytes wide, five white rows fed.
+    std::string expected("\x1BJ\x03", 3);
+    expected += std::string("\x1Dv0\x00\x06\x00\x02\x00", 8);
+    expected += std::string("\x80\x00\x00\x00\x00\x00", 6);
+    expected += std::string("\x00\x00\x00\x00\x00\x01", 6);
+    expected += std::string("\x1BJ\x05", 3);
+    CHECK_BYTES(rasterOut, expected);
+    CHECK_EQ(rasterRows, 2);
+    CHECK_EQ(rasterFeedRows, 8);
+    CHECK_EQ(rasterStats().bands - before.bands, 1);
+    CHECK_EQ(rasterStats().rawBytes - before.rawBytes, rasterHeaderSize + 10 * rasterRowBytes);
+    CHECK_EQ(rasterStats().sentBytes - before.sentBytes, expected.size());
+}
+
+TEST(sendsFullWidthBandUntrimmed)
+{
+    uint8_t band[rasterHeaderSize + 2 * rasterRowBytes] = {};
+    uint8_t *bitmap = band + rasterHeaderSize;
+    bitmap[0] = 0xFF;
+    bitmap[2 * rasterRowBytes - 1] = 0x01;
+    resetRaster();
+    RasterStats before = rasterStats();
+    sendRasterBand(band, 2, recordRaster);
+
+    // No feeds around ink that fills the band; the header says 48 bytes wide.
+    CHECK_EQ(rasterOut.size(), rasterHeaderSize + 2 * rasterRowBytes);
+    CHECK_BYTES(rasterOut.substr(0, rasterHeaderSize), std::string("\x1Dv0\x00\x30\x00\x02\x00", 8));
+    CHECK_EQ(static_cast<uint8_t>(rasterOut[rasterHeaderSize]), 0xFF);
+    CHECK_EQ(static_cast<uint8_t>(rasterOut.back()), 0x01);
+    CHECK_EQ(rasterStats().sentBytes - before.sentBytes, rasterStats().rawBytes - before.rawBytes);
+}
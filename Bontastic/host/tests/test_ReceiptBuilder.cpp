@@ -0,0 +1,166 @@
+#include "HostTest.h"
+#include "printer/GlyphCache.h"
+#include "printer/RasterText.h"
+#include "printer/ReceiptBuilder.h"
+#include "printer/Transcoder.h"
+
+static const uint8_t cp437 = 0;
+
+static ReceiptBuilder receipt;
+
+static std::string bytes(const ReceiptBuilder &builder)
+{
+    return std::string(reinterpret_cast<const char *>(builder.data()), builder.size());
+}
+
+static const uint8_t *u8(const char *s)
+{
+    return reinterpret_cast<const uint8_t *>(s);
+}
+
+TEST(composesTextAndCountsLines)
+{
+    receipt.reset(32);
+    receipt.line("From: node").text("Time: ").line("12:00");
+    CHECK_BYTES(bytes(receipt), "From: node\nTime: 12:00\n");
+    CHECK_EQ(receipt.lines(), 2);
+    CHECK_EQ(receipt.feeds(), 0);
+    CHECK(!receipt.truncated());
+}
+
+TEST(countsWrappedLines)
+{
+    receipt.reset(32);
+    receipt.line(std::string(40, 'w').c_str());
+    CHECK_EQ(receipt.lines(), 2);
+    receipt.reset(16);
+    receipt.line(std::string(40, 'w').c_str());
+    CHECK_EQ(receipt.lines(), 3);
+}
+
+TEST(emitsFeedsAndCommands)
+{
+    receipt.reset(32);
+    receipt.rule().feed(3).command(0x1B, 'a', 1).feed(0);
+    CHECK_BYTES(bytes(receipt), std::string("----------------\n\x1B" "d\x03\x1B" "a\x01", 23));
+    CHECK_EQ(receipt.lines(), 1);
+    CHECK_EQ(receipt.feeds(), 3);
+}
+
+TEST(transcodesUtf8)
+{
+    receipt.reset(32);
+    uint16_t unmapped = 0;
+    const char *text = "caf\xC3\xA9 \xE4\xB8\xAD";
+    receipt.utf8(u8(text), strlen(text), cp437, &unmapped).line();
+    CHECK_BYTES(bytes(receipt), "caf\x82 ?\n");
+    CHECK_EQ(unmapped, 1);
+    CHECK_EQ(receipt.lines(), 1);
+}
+
+TEST(flagsOverflow)
+{
+    receipt.reset(32);
+    std::string big(receiptCapacity + 10, 'x');
+    receipt.text(big.c_str());
+    CHECK(receipt.truncated());
+    CHECK_EQ(receipt.size(), receiptCapacity);
+
+    receipt.reset(32);
+    receipt.utf8(u8(big.c_str()), big.size(), cp437);
+    CHECK(receipt.truncated());
+    CHECK_EQ(receipt.size(), receiptCapacity);
+
+    receipt.reset(32);
+    receipt.text(std::string(receiptCapacity - 2, 'x').c_str()).command(0x1B, 'd', 1);
+    CHECK(receipt.truncated());
+    CHECK_EQ(receipt.size(), receiptCapacity - 2);
+}
+
+TEST(encodesNativeQr)
+{
+    receipt.reset(32);
+    const char *uri = "geo:1,2";
+    receipt.text("pos").qrCode(u8(uri), strlen(uri), 6, 0);
+    std::string expected("pos\n"
+                         "\x1B" "a\x01"
+                         "\x1D(k\x04\x00" "1A2\x00"
+                         "\x1D(k\x03\x00" "1C\x06"
+                         "\x1D(k\x03\x00" "1E1"
+                         "\x1D(k\x0A\x00" "1P0" "geo:1,2"
+                         "\x1D(k\x03\x00" "1Q0"
+                         "\x1B" "a\x00",
+                         4 + 3 + 9 + 8 + 8 + 8 + 7 + 8 + 3);
+    CHECK_BYTES(bytes(receipt), expected);
+    // Version 1 at 6 dots per module with its quiet zone: 174 dots, 8 lines.
+    CHECK_EQ(receipt.lines(), 1 + 8);
+}
+
+static std::string downloaded;
+
+static void recordGlyph(const uint8_t *bytes, size_t size)
+{
+    downloaded.append(reinterpret_cast<const char *>(bytes), size);
+}
+
+TEST(printsCachedGlyphsFromUserSet)
+{
+    GlyphCache cache;
+    downloaded.clear();
+    const char *text = "a\xCE\xBB\xCE\xBB b";
+    CHECK(cache.prepare(u8(text), strlen(text), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 1);
+    // ESC & 3 c1 c2 12, then 12 columns of 3 bytes.
+    CHECK_EQ(downloaded.size(), 6 + 36);
+    CHECK_BYTES(downloaded.substr(0, 6), "\x1B&\x03!!\x0C");
+
+    receipt.reset(32);
+    receipt.utf8(u8(text), strlen(text), cp437, cache).line();
+    CHECK_BYTES(bytes(receipt), std::string("a\x1B%\x01!! \x1B%\x00" "b\n", 12));
+    CHECK_EQ(receipt.lines(), 1);
+
+    // Already resident: nothing more is sent.
+    CHECK(cache.prepare(u8(text), strlen(text), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 1);
+}
+
+// UTF-8 for count code points from first on that cp437 lacks and the raster
+// font draws, so each takes a user-defined slot of its own.
+static std::string slotHungry(uint32_t first, size_t count)
+{
+    std::string text;
+    for (uint32_t cp = first; count; ++cp)
+    {
+        if (codePageHas(cp, cp437) || rasterGlyphFor(cp) != cp)
+        {
+            continue;
+        }
+        text += static_cast<char>(0xC0 | cp >> 6);
+        text += static_cast<char>(0x80 | (cp & 0x3F));
+        count--;
+    }
+    return text;
+}
+
+TEST(keepsBatchGlyphsUntilSent)
+{
+    GlyphCache cache;
+    downloaded.clear();
+    std::string first = slotHungry(0x400, 60);
+    std::string second = slotHungry(0x500, 60);
+
+    // Both texts in one receipt: the second would need slots the unsent
+    // first one still refers to.
+    cache.beginBatch();
+    CHECK(cache.prepare(u8(first.c_str()), first.size(), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 60);
+    CHECK(cache.pinned());
+    CHECK(!cache.prepare(u8(second.c_str()), second.size(), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 60);
+
+    // Once the first receipt is sent its slots can be reused.
+    cache.beginBatch();
+    CHECK(!cache.pinned());
+    CHECK(cache.prepare(u8(second.c_str()), second.size(), cp437, recordGlyph));
+    CHECK_EQ(cache.downloads(), 120);
+}
@@ -0,0 +1,90 @@
+#include "HostTest.h"
+#include "printer/Transcoder.h"
+
+static const uint8_t cp437 = 0;
+static const uint8_t cp1252 = 16;
+
+static std::string transcode(const std::string &utf8, uint8_t codePage, uint16_t *unmapped = nullptr,
+                             size_t capacity = 128)
+{
+    uint8_t out[128];
+    size_t n = transcodeUtf8(reinterpret_cast<const uint8_t *>(utf8.data()), utf8.size(), codePage, out,
+                             capacity < sizeof(out) ? capacity : sizeof(out), unmapped);
+    return std::string(reinterpret_cast<const char *>(out), n);
+}
+
+TEST(passesPrintableAscii)
+{
+    uint16_t unmapped = 99;
+    CHECK_BYTES(transcode("Hello, mesh! 0123456789 ~{}", cp437, &unmapped), "Hello, mesh! 0123456789 ~{}");
+    CHECK_EQ(unmapped, 0);
+}
+
+TEST(mapsToCodePageBytes)
+{
+    CHECK_BYTES(transcode("Gr\xC3\xBC\xC3\x9F" "e caf\xC3\xA9", cp437), "Gr\x81\xE1" "e caf\x82");
+    CHECK_BYTES(transcode("\xE2\x82\xAC 5 \xE2\x80\x9Cok\xE2\x80\x9D", cp1252), "\x80 5 \x93ok\x94");
+}
+
+TEST(transliteratesMissingCharacters)
+{
+    uint16_t unmapped = 99;
+    CHECK_BYTES(transcode("\xE2\x82\xAC" "5 \xE2\x80\x9Cok\xE2\x80\x9D\xE2\x80\xA6", cp437, &unmapped), "EUR5 \"ok\"...");
+    CHECK_EQ(unmapped, 0);
+    CHECK_BYTES(transcode("\xC5\x81\xC3\xB3""d\xC5\xBA", cp437), "L\xA2" "dz");
+}
+
+TEST(dropsControlCharacters)
+{
+    CHECK_BYTES(transcode("a\x1B@b\tc\r\nd\x07", cp437), "a@b c\nd");
+}
+
+TEST(countsUnmappedAndInvalid)
+{
+    uint16_t unmapped = 0;
+    // An emoji, a CJK ideograph, a lone continuation byte, then a truncated
+    // sequence, which is replaced byte by byte.
+    CHECK_BYTES(transcode("x\xF0\x9F\x98\x80y\xE4\xB8\xADz\x80w\xE2\x82", cp437, &unmapped), "x?y?z?w??");
+    CHECK_EQ(unmapped, 5);
+}
+
+TEST(skipsCombiningMarksAndSelectors)
+{
+    uint16_t unmapped = 99;
+    CHECK_BYTES(transcode("e\xCC\x81 \xE2\x9D\xA4\xEF\xB8\x8F", cp437, &unmapped), "e ?");
+    CHECK_EQ(unmapped, 1);
+}
+
+TEST(stopsAtCapacity)
+{
+    CHECK_BYTES(transcode("abcdefgh", cp437, nullptr, 5), "abcde");
+    CHECK_BYTES(transcode("\xC3\xA9\xC3\xA9\xC3\xA9", cp437, nullptr, 2), "\x82\x82");
+    // A transliteration is cut rather than overrunning the buffer.
+    CHECK_BYTES(transcode("ab\xE2\x82\xAC", cp437, nullptr, 4), "abEU");
+}
+
+TEST(decodesUtf8Sequences)
+{
+    uint32_t cp = 0;
+    const uint8_t twoByte[] = {0xC3, 0xA9};
+    CHECK_EQ(decodeUtf8(twoByte, sizeof(twoByte), cp), 2);
+    CHECK_EQ(cp, 0xE9);
+    const uint8_t fourByte[] = {0xF0, 0x9F, 0x98, 0x80};
+    CHECK_EQ(decodeUtf8(fourByte, sizeof(fourByte), cp), 4);
+    CHECK_EQ(cp, 0x1F600);
+    CHECK_EQ(decodeUtf8(fourByte, 3, cp), 1);
+    CHECK_EQ(cp, 0);
+    const uint8_t badContinuation[] = {0xE2, 0x28, 0xA1};
+    CHECK_EQ(decodeUtf8(badContinuation, sizeof(badContinuation), cp), 1);
+    CHECK_EQ(cp, 0);
+}
+
+TEST(reportsCodePageCoverage)
+{
+    CHECK(codePageHas('A', cp437));
+    CHECK(codePageHas(0xE9, cp437));
+    CHECK(!codePageHas(0x20AC, cp437));
+    CHECK(codePageHas(0x20AC, cp1252));
+    CHECK(!codePageHas(0x4E2D, cp1252));
+    CHECK(!codePageHas(0xE9, 200));
+}
@@ -0,0 +1,375 @@
+#include "HostTest.h"
+#include <vector>
+#include "mesh/Unishox2.h"
+
+// Assembles Unishox2 bit streams code by code (default preset), so each
+// vector states exactly which codes the decoder is fed.
+class UnishoxBits
+{
+public:
+    enum Set
+    {
+        Alpha,
+        Sym,
+        Num,
+        Dict,
+        Delta
+    };
+
+    UnishoxBits() { bits(1, 1); } // magic bit
+
+    UnishoxBits &bits(uint32_t value, int count)
+    {
+        for (int i = count - 1; i >= 0; --i)
+        {
+            if (length % 8 == 0)
+            {
+                bytes.push_back(0);
+            }
+            if (value >> i & 1)
+            {
+                bytes.back() |= 0x80 >> (length % 8);
+            }
+            length++;
+        }
+        return *this;
+    }
+
+    UnishoxBits &v(int index)
+    {
+        static const uint8_t codes[28] = {0x00, 0x40, 0x60, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xD8,
+                                          0xE0, 0xE4, 0xE8, 0xEC, 0xEE, 0xF0, 0xF2, 0xF4, 0xF6, 0xF7,
+                                          0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+        static const uint8_t lengths[28] = {2, 3, 3, 4, 4, 4, 4, 4, 5, 5, 6, 6, 6, 7,
+                                            7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8};
+        return bits(codes[index] >> (8 - lengths[index]), lengths[index]);
+    }
+
+    UnishoxBits &h(Set set)
+    {
+        static const uint8_t codes[5] = {0x00, 0x40, 0x80, 0xC0, 0xE0};
+        static const uint8_t lengths[5] = {2, 2, 2, 3, 3};
+        return bits(codes[set] >> (8 - lengths[set]), lengths[set]);
+    }
+
+    // Vertical code 0 followed by the set's horizontal code.
+    UnishoxBits &to(Set set) { return v(0).h(set); }
+
+    // Number set code 0, then the kind: 0 template, 1 hex, 2 UUID, 3 upper
+    // hex, 4 upper UUID, 5 raw bytes.
+    UnishoxBits &number(int kind) { return to(Num).v(0).step(kind, 5); }
+
+    // Template index, characters left off its end, then the digit fields.
+    UnishoxBits &templ(int index, uint32_t omitted) { return number(0).step(index, 4).count(omitted); }
+
+    // Back-reference: length and distance back from the end of the output
+    // to where the copied text ends.
+    UnishoxBits &repeat(uint32_t length, uint32_t distance) { return count(length - 5).count(distance); }
+
+    UnishoxBits &lower(const char *text)
+    {
+        static const char alpha[] = " etaoinsrlcdhupmbgwfyvkqjxz";
+        for (; *text; ++text)
+        {
+            v(strchr(alpha, *text) - alpha + 1);
+        }
+        return *this;
+    }
+
+    // Unary step code: index ones, then a zero unless index is the limit.
+    UnishoxBits &step(int index, int limit)
+    {
+        bits((1u << index) - 1, index);
+        return index < limit ? bits(0, 1) : *this;
+    }
+
+    UnishoxBits &count(uint32_t n)
+    {
+        static const uint8_t widths[5] = {2, 4, 7, 11, 16};
+        static const uint32_t adders[5] = {0, 4, 20, 148, 2196};
+        int index = 0;
+        while (index < 4 && n >= adders[index + 1])
+        {
+            index++;
+        }
+        return step(index, 4).bits(n - adders[index], widths[index]);
+    }
+
+    // One code point difference in delta coding.
+    UnishoxBits &delta(int32_t d)
+    {
+        static const uint8_t widths[5] = {6, 12, 14, 16, 21};
+        static const int32_t adders[6] = {0, 64, 4160, 20544, 86080, 0x7FFFFFFF};
+        uint32_t magnitude = d < 0 ? -d : d;
+        int index = 0;
+        while (magnitude >= static_cast<uint32_t>(adders[index + 1]))
+        {
+            index++;
+        }
+        return step(index, 5).bits(d < 0, 1).bits(magnitude - adders[index], widths[index]);
+    }
+
+    // Delta-state special code: 0 space, 1 set switch, 2 comma, 3 full stop,
+    // 4 CR LF.
+    UnishoxBits &special(int index) { return step(5, 5).step(index, 4); }
+
+    // Number-set terminator, then padding with copies of the last bit.
+    std::string end(bool inDelta = false)
+    {
+        if (inDelta)
+        {
+            special(1).h(Num);
+        }
+        else
+        {
+            to(Num);
+        }
+        v(27);
+        bool last = bytes.back() & (0x80 >> ((length - 1) % 8));
+        bits(last ? 0xFF : 0, (8 - length % 8) % 8);
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+private:
+    std::vector<uint8_t> bytes;
+    int length = 0;
+};
+
+static int decompress(const std::string &in, std::string &out, size_t capacity = 256)
+{
+    std::vector<uint8_t> buffer(capacity);
+    int n = unishox2Decompress(reinterpret_cast<const uint8_t *>(in.data()), in.size(), buffer.data(), capacity);
+    out.assign(reinterpret_cast<const char *>(buffer.data()), n > 0 ? n : 0);
+    return n;
+}
+
+TEST(decodesLowercaseWords)
+{
+    std::string out;
+    CHECK_EQ(decompress(UnishoxBits().lower("hello world").end(), out), 11);
+    CHECK_BYTES(out, "hello world");
+}
+
+TEST(decodesShiftAndCapsLock)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.to(UnishoxBits::Alpha).lower("hi ");
+    bits.to(UnishoxBits::Alpha).to(UnishoxBits::Alpha).lower("nasa");
+    bits.to(UnishoxBits::Alpha).lower(" ok");
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "Hi NASA ok");
+}
+
+TEST(decodesSymbolsAndNumbers)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.lower("pin");
+    bits.to(UnishoxBits::Sym).v(6);  // ':'
+    bits.to(UnishoxBits::Num).v(11); // '4'
+    bits.to(UnishoxBits::Num).v(6);  // '2'
+    bits.to(UnishoxBits::Sym).v(19); // '!'
+    bits.to(UnishoxBits::Sym).v(8);  // CR LF
+    bits.to(UnishoxBits::Num).v(20); // '$'
+    bits.to(UnishoxBits::Num).v(26).count(2); // last character 6 more times
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "pin:42!\r\n$$$$$$$");
+}
+
+TEST(decodesSingleCodePoints)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.lower("caf").to(UnishoxBits::Delta).delta(0xE9).lower(" ok");
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "caf\xC3\xA9 ok");
+}
+
+TEST(decodesContinuousDelta)
+{
+    std::string out;
+    UnishoxBits bits;
+    // Shifted space enters delta coding; each code is relative to the last.
+    bits.to(UnishoxBits::Alpha).v(1);
+    bits.delta(0x41F).delta(0x440 - 0x41F).delta(0x438 - 0x440).delta(0x432 - 0x438);
+    bits.delta(0x435 - 0x432).delta(0x442 - 0x435);
+    bits.special(3).special(0).delta(0x1F600 - 0x442).special(2).special(3);
+    CHECK(decompress(bits.end(true), out) > 0);
+    // A full stop after a code point above U+3000 is the ideographic one.
+    CHECK_BYTES(out, "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82. \xF0\x9F\x98\x80,\xE3\x80\x82");
+}
+
+TEST(switchesBackFromDelta)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.to(UnishoxBits::Alpha).v(1).delta(0x3B1);
+    bits.special(1).h(UnishoxBits::Num).v(4); // one '1' without leaving delta
+    bits.special(1).h(UnishoxBits::Alpha).lower(" ok");
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "\xCE\xB1" "1 ok");
+}
+
+TEST(endsLinesInDelta)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.to(UnishoxBits::Alpha).v(1).delta(0x3B1).special(4).delta(0);
+    CHECK(decompress(bits.end(true), out) > 0);
+    CHECK_BYTES(out, "\xCE\xB1\r\n\xCE\xB1");
+}
+
+TEST(decodesFullTemplate)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.lower("at ");
+    // tfff-of-tfTtf:rf:rf.fffZ
+    bits.templ(0, 0);
+    bits.bits(2, 2).bits(0, 4).bits(2, 4).bits(4, 4);  // 2024
+    bits.bits(0, 1).bits(5, 4);                        // 05
+    bits.bits(1, 2).bits(7, 4);                        // 17
+    bits.bits(1, 2).bits(0, 4);                        // 10
+    bits.bits(3, 3).bits(0, 4);                        // 30
+    bits.bits(0, 3).bits(9, 4);                        // 09
+    bits.bits(1, 4).bits(2, 4).bits(3, 4);             // 123
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "at 2024-05-17T10:30:09.123Z");
+}
+
+TEST(decodesTemplatePrefix)
+{
+    std::string out;
+    UnishoxBits bits;
+    // Template 0 less its last 14 characters is a date.
+    bits.templ(0, 14);
+    bits.bits(2, 2).bits(0, 4).bits(2, 4).bits(5, 4);
+    bits.bits(1, 1).bits(2, 4);
+    bits.bits(3, 2).bits(1, 4);
+    bits.lower(" ok");
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "2025-12-31 ok");
+
+    UnishoxBits phone;
+    phone.templ(2, 0);
+    for (int digit : {5, 5, 5, 0, 1, 2, 3, 4, 5, 6})
+    {
+        phone.bits(digit, 4);
+    }
+    CHECK(decompress(phone.end(), out) > 0);
+    CHECK_BYTES(out, "(555) 012-3456");
+
+    // Template 3 is a time, and template 4 does not exist.
+    UnishoxBits time;
+    time.templ(3, 3).bits(2, 2).bits(3, 4).bits(5, 3).bits(9, 4);
+    CHECK(decompress(time.end(), out) > 0);
+    CHECK_BYTES(out, "23:59");
+    CHECK_EQ(decompress(UnishoxBits().templ(4, 0).end(), out), -1);
+    // More characters omitted than the template has.
+    CHECK_EQ(decompress(UnishoxBits().templ(1, 11).end(), out), -1);
+}
+
+TEST(decodesHexAndUuid)
+{
+    std::string out;
+    UnishoxBits hex;
+    hex.lower("id ").number(1).count(8);
+    for (int nibble : {0xd, 0xe, 0xa, 0xd, 0xb, 0xe, 0xe, 0xf})
+    {
+        hex.bits(nibble, 4);
+    }
+    CHECK(decompress(hex.end(), out) > 0);
+    CHECK_BYTES(out, "id deadbeef");
+
+    UnishoxBits upper;
+    upper.number(3).count(4);
+    for (int nibble : {0x0, 0xA, 0xF, 0x9})
+    {
+        upper.bits(nibble, 4);
+    }
+    CHECK(decompress(upper.end(), out) > 0);
+    CHECK_BYTES(out, "0AF9");
+
+    UnishoxBits uuid;
+    uuid.number(2);
+    for (int i = 0; i < 32; ++i)
+    {
+        uuid.bits(i % 16, 4);
+    }
+    CHECK(decompress(uuid.end(), out) > 0);
+    CHECK_BYTES(out, "01234567-89ab-cdef-0123-456789abcdef");
+}
+
+TEST(decodesRawBytes)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.lower("x").number(5).count(3).bits(0x00, 8).bits(0xFF, 8).bits(0x7F, 8).lower("y");
+    CHECK_EQ(decompress(bits.end(), out), 5);
+    CHECK_BYTES(out, std::string("x\x00\xFF\x7Fy", 5));
+}
+
+TEST(copiesRepeats)
+{
+    std::string out;
+    // "the cat" (7) again right away: it ends 0 characters back.
+    UnishoxBits adjacent;
+    adjacent.lower("the cat").to(UnishoxBits::Dict).repeat(7, 0);
+    CHECK(decompress(adjacent.end(), out) > 0);
+    CHECK_BYTES(out, "the catthe cat");
+
+    // Copy "the c" (5), which ends 7 characters back, past "at and ".
+    UnishoxBits earlier;
+    earlier.lower("the cat and ").to(UnishoxBits::Dict).repeat(5, 7).lower("at");
+    CHECK(decompress(earlier.end(), out) > 0);
+    CHECK_BYTES(out, "the cat and the cat");
+
+    // Distance 20 takes the second, wider count code.
+    UnishoxBits wide;
+    wide.lower("abcdefghijklmnopqrstuvwxy ").to(UnishoxBits::Dict).repeat(6, 20);
+    CHECK(decompress(wide.end(), out) > 0);
+    CHECK_BYTES(out, "abcdefghijklmnopqrstuvwxy abcdef");
+
+    // From delta coding the repeat follows a set switch.
+    UnishoxBits delta;
+    delta.to(UnishoxBits::Alpha).v(1).delta(0x3B1).delta(1).delta(1).delta(1).delta(1);
+    delta.special(1).h(UnishoxBits::Dict).repeat(10, 0);
+    CHECK(decompress(delta.end(true), out) > 0);
+    CHECK_BYTES(out, "\xCE\xB1\xCE\xB2\xCE\xB3\xCE\xB4\xCE\xB5\xCE\xB1\xCE\xB2\xCE\xB3\xCE\xB4\xCE\xB5");
+}
+
+TEST(expandsFrequentSequences)
+{
+    std::string out;
+    UnishoxBits bits;
+    bits.lower("http").to(UnishoxBits::Num).v(25).lower("x");       // ://
+    bits.to(UnishoxBits::Sym).v(27).lower("a");                     // </
+    bits.to(UnishoxBits::Num).v(23).lower("b");                     // ="
+    bits.to(UnishoxBits::Sym).v(25).lower("c");                     // ": "
+    bits.to(UnishoxBits::Sym).v(26).lower("d");                     // ":
+    bits.to(UnishoxBits::Num).v(24).lower("e");                     // ":"
+    CHECK(decompress(bits.end(), out) > 0);
+    CHECK_BYTES(out, "http://x</a=\"b\": \"c\": d\":\"e");
+}
+
+TEST(truncatesAtCapacity)
+{
+    std::string out;
+    CHECK_EQ(decompress(UnishoxBits().lower("hello world").end(), out, 5), 5);
+    CHECK_BYTES(out, "hello");
+    // A multi-byte character is dropped whole rather than split.
+    CHECK_EQ(decompress(UnishoxBits().lower("ab").to(UnishoxBits::Delta).delta(0x20AC).end(), out, 4), 2);
+    CHECK_BYTES(out, "ab");
+}
+
+TEST(rejectsInvalidStreams)
+{
+    std::string out;
+    // A repeat before any output has nothing to copy.
+    CHECK_EQ(decompress(UnishoxBits().to(UnishoxBits::Dict).count(0).count(0).end(), out), -1);
+    // A character repeat with nothing before it.
+    CHECK_EQ(decompress(UnishoxBits().to(UnishoxBits::Num).v(26).count(0).end(), out), -1);
+    // Raw bytes with a zero count.
+    CHECK_EQ(decompress(UnishoxBits().to(UnishoxBits::Num).v(0).step(5, 5).count(0).end(), out), -1);
+}
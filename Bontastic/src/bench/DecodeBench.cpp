@@ -0,0 +1,542 @@
+#include "DecodeBench.h"
+#include <esp_timer.h>
+#include <freertos/task.h>
+#include "../mesh/DuplicateFilter.h"
+#include "../nanopb/pb_decode.h"
+#include "../nanopb/pb_encode.h"
+#include "../pipeline/Pipeline.h"
+#include "../printer/PrintHelpers.h"
+#include "../protobufs/portnums.pb.h"
+#include "../protobufs/telemetry.pb.h"
+#include "../radio/FrameCapture.h"
+#include "../radio/FromRadioDecoder.h"
+
+#if DECODE_BENCH
+
+#if !PRINTER_DRY_RUN
+#error "DECODE_BENCH runs the real packet handler and needs PRINTER_DRY_RUN=1 to keep it off the printer"
+#endif
+
+static const uint16_t benchRounds = 200;
+static const uint32_t benchStackSize = 16384;
+static const uint8_t benchCategories = 16;
+
+enum BenchMode : uint8_t
+{
+    FullDecode,
+    SelectiveDecode,
+    BenchModeCount
+};
+
+static const char *modeNames[BenchModeCount] = {"full union", "selective"};
+
+struct BenchCategory
+{
+    char name[20];
+    uint16_t frames;
+    uint32_t nanos[BenchModeCount];
+};
+
+struct BenchRun
+{
+    const FromRadioFrame *frames;
+    size_t count;
+    const uint8_t *categoryOf;
+    BenchCategory *categories;
+    uint8_t categoryCount;
+    BenchMode mode;
+    BenchPacketHandler onPacket;
+    uint32_t decodeMicros;
+    uint32_t handlerMicros;
+    uint32_t stackUsed;
+    TaskHandle_t caller;
+};
+
+// Keeps the optimizer from discarding decode results.
+static volatile uint32_t benchSink;
+// Where decoded packets go: sinkPacket while timing decode alone, then the
+// sketch's handler, so both modes also pay for the same per-port work.
+static BenchPacketHandler benchPacket;
+
+static bool encodeFrame(FromRadioFrame &frame, const meshtastic_FromRadio &message)
+{
+    pb_ostream_t stream = pb_ostream_from_buffer(frame.bytes, sizeof(frame.bytes));
+    if (!pb_encode(&stream, meshtastic_FromRadio_fields, &message))
+    {
+        return false;
+    }
+    frame.size = stream.bytes_written;
+    return true;
+}
+
+static bool encodePayload(meshtastic_Data &data, const pb_msgdesc_t *fields, const void *message)
+{
+    pb_ostream_t stream = pb_ostream_from_buffer(data.payload.bytes, sizeof(data.payload.bytes));
+    if (!pb_encode(&stream, fields, message))
+    {
+        return false;
+    }
+    data.payload.size = stream.bytes_written;
+    return true;
+}
+
+static void initPacket(meshtastic_FromRadio &message, uint32_t from, meshtastic_PortNum port)
+{
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_packet_tag;
+    meshtastic_MeshPacket &packet = message.packet;
+    packet.from = from;
+    packet.to = 0xFFFFFFFF;
+    packet.id = 0x1000 + from;
+    packet.rx_time = 1735689600;
+    packet.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    packet.decoded.portnum = port;
+}
+
+size_t buildBenchCorpus(FromRadioFrame *frames, size_t capacity)
+{
+    // Static: the full union is large and this runs on the loop task.
+    static meshtastic_FromRadio message;
+    size_t count = 0;
+
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_my_info_tag;
+    message.my_info.my_node_num = 0x1dfd1dfd;
+    message.my_info.reboot_count = 12;
+    message.my_info.min_app_version = 30200;
+    strlcpy(message.my_info.pio_env, "heltec-v3", sizeof(message.my_info.pio_env));
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_config_tag;
+    message.config.which_payload_variant = meshtastic_Config_lora_tag;
+    message.config.payload_variant.lora.use_preset = true;
+    message.config.payload_variant.lora.modem_preset = meshtastic_Config_LoRaConfig_ModemPreset_LONG_FAST;
+    message.config.payload_variant.lora.region = meshtastic_Config_LoRaConfig_RegionCode_EU_868;
+    message.config.payload_variant.lora.hop_limit = 3;
+    message.config.payload_variant.lora.tx_enabled = true;
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_channel_tag;
+    message.channel.index = 0;
+    message.channel.has_settings = true;
+    strlcpy(message.channel.settings.name, "LongFast", sizeof(message.channel.settings.name));
+    message.channel.settings.psk.size = 1;
+    message.channel.settings.psk.bytes[0] = 1;
+    message.channel.role = meshtastic_Channel_Role_PRIMARY;
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_metadata_tag;
+    strlcpy(message.metadata.firmware_version, "2.5.20.4c97351", sizeof(message.metadata.firmware_version));
+    message.metadata.device_state_version = 23;
+    message.metadata.hasBluetooth = true;
+    message.metadata.hw_model = meshtastic_HardwareModel_HELTEC_V3;
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        message = meshtastic_FromRadio_init_zero;
+        message.which_payload_variant = meshtastic_FromRadio_node_info_tag;
+        meshtastic_NodeInfo &info = message.node_info;
+        info.num = 0xa0b0c000 + i;
+        info.has_user = true;
+        snprintf(info.user.id, sizeof(info.user.id), "!%08lx", (unsigned long)info.num);
+        snprintf(info.user.long_name, sizeof(info.user.long_name), "Bench Node %lu", (unsigned long)i);
+        strlcpy(info.user.short_name, "BN", sizeof(info.user.short_name));
+        info.user.hw_model = meshtastic_HardwareModel_HELTEC_V3;
+        info.has_position = true;
+        info.position.has_latitude_i = true;
+        info.position.latitude_i = 525200000 + i;
+        info.position.has_longitude_i = true;
+        info.position.longitude_i = 134050000 + i;
+        info.last_heard = 1735689600;
+        info.snr = 6.25f;
+        if (count < capacity && encodeFrame(frames[count], message))
+        {
+            count++;
+        }
+    }
+
+    message = meshtastic_FromRadio_init_zero;
+    message.which_payload_variant = meshtastic_FromRadio_config_complete_id_tag;
+    message.config_complete_id = 42;
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    static const char *texts[] = {"hi", "Meet at the printer in 10 minutes, bring paper rolls please",
+                                  "Ünïcödé ✓ test"};
+    for (const char *text : texts)
+    {
+        initPacket(message, 0xa0b0c000, meshtastic_PortNum_TEXT_MESSAGE_APP);
+        size_t length = strlen(text);
+        memcpy(message.packet.decoded.payload.bytes, text, length);
+        message.packet.decoded.payload.size = length;
+        if (count < capacity && encodeFrame(frames[count], message))
+        {
+            count++;
+        }
+    }
+
+    // "meet at the printer at 18:30 then feed the printer": lowercase codes,
+    // the time template and a back-reference.
+    static const uint8_t compressed[] = {0xf9, 0x6e, 0x14, 0xc2, 0x8e, 0xcd, 0x78, 0xdd, 0xe4,
+                                         0x3d, 0xa9, 0x84, 0x43, 0x9b, 0x0c, 0x14, 0x76, 0x78,
+                                         0xbe, 0x1b, 0xe8, 0xd1, 0xde, 0x5f, 0xff};
+    initPacket(message, 0xa0b0c002, meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP);
+    memcpy(message.packet.decoded.payload.bytes, compressed, sizeof(compressed));
+    message.packet.decoded.payload.size = sizeof(compressed);
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    initPacket(message, 0xa0b0c001, meshtastic_PortNum_POSITION_APP);
+    meshtastic_Position position = meshtastic_Position_init_zero;
+    position.has_latitude_i = true;
+    position.latitude_i = 525200000;
+    position.has_longitude_i = true;
+    position.longitude_i = 134050000;
+    position.has_altitude = true;
+    position.altitude = 34;
+    if (encodePayload(message.packet.decoded, meshtastic_Position_fields, &position) && count < capacity &&
+        encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    initPacket(message, 0xa0b0c002, meshtastic_PortNum_NODEINFO_APP);
+    meshtastic_User user = meshtastic_User_init_zero;
+    strlcpy(user.id, "!a0b0c002", sizeof(user.id));
+    strlcpy(user.long_name, "Bench Node 2", sizeof(user.long_name));
+    strlcpy(user.short_name, "BN2", sizeof(user.short_name));
+    if (encodePayload(message.packet.decoded, meshtastic_User_fields, &user) && count < capacity &&
+        encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    initPacket(message, 0xa0b0c000, meshtastic_PortNum_TELEMETRY_APP);
+    meshtastic_Telemetry telemetry = meshtastic_Telemetry_init_zero;
+    telemetry.time = 1735689600;
+    telemetry.which_variant = meshtastic_Telemetry_device_metrics_tag;
+    telemetry.variant.device_metrics.has_battery_level = true;
+    telemetry.variant.device_metrics.battery_level = 87;
+    telemetry.variant.device_metrics.has_voltage = true;
+    telemetry.variant.device_metrics.voltage = 4.05f;
+    telemetry.variant.device_metrics.has_channel_utilization = true;
+    telemetry.variant.device_metrics.channel_utilization = 12.5f;
+    telemetry.variant.device_metrics.has_uptime_seconds = true;
+    telemetry.variant.device_metrics.uptime_seconds = 86400;
+    if (encodePayload(message.packet.decoded, meshtastic_Telemetry_fields, &telemetry) && count < capacity &&
+        encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+
+    initPacket(message, 0xa0b0c001, meshtastic_PortNum_PRIVATE_APP);
+    for (uint8_t i = 0; i < 64; ++i)
+    {
+        message.packet.decoded.payload.bytes[i] = i * 7;
+    }
+    message.packet.decoded.payload.size = 64;
+    if (count < capacity && encodeFrame(frames[count], message))
+    {
+        count++;
+    }
+    return count;
+}
+
+static void benchNodeInfo(const meshtastic_NodeInfo &info)
+{
+    benchSink += info.num;
+}
+
+static void benchConfigComplete(uint32_t configId)
+{
+    benchSink += configId;
+}
+
+static void sinkPacket(const meshtastic_MeshPacket &packet)
+{
+    benchSink += packet.id;
+}
+
+static void decodeFull(const FromRadioFrame &frame)
+{
+    meshtastic_FromRadio message = meshtastic_FromRadio_init_zero;
+    pb_istream_t stream = pb_istream_from_buffer(frame.bytes, frame.size);
+    if (!pb_decode(&stream, meshtastic_FromRadio_fields, &message))
+    {
+        return;
+    }
+    if (message.which_payload_variant == meshtastic_FromRadio_packet_tag)
+    {
+        benchPacket(message.packet);
+    }
+    benchSink += message.which_payload_variant;
+}
+
+static void decodeSelective(const FromRadioFrame &frame)
+{
+    const FromRadioHandlers handlers = {benchPacket, benchNodeInfo, benchConfigComplete};
+    decodeFromRadio(frame.bytes, frame.size, handlers);
+}
+
+// Every round starts with an empty duplicate filter so the handler does the
+// full per-port work rather than dropping each packet as already seen.
+static void decodeRound(void (*decode)(const FromRadioFrame &), const BenchRun &run, int category)
+{
+    duplicateFilterReset();
+    for (size_t i = 0; i < run.count; ++i)
+    {
+        if (category < 0 || run.categoryOf[i] == category)
+        {
+            decode(run.frames[i]);
+        }
+    }
+}
+
+static void benchTask(void *param)
+{
+    BenchRun &run = *static_cast<BenchRun *>(param);
+    void (*decode)(const FromRadioFrame &) = run.mode == FullDecode ? decodeFull : decodeSelective;
+    benchPacket = sinkPacket;
+    // The live decode task waits meanwhile: the handler's state is unlocked.
+    pipelineLockDecode();
+    printerDiscardJobs(true);
+
+    for (uint8_t c = 0; c < run.categoryCount; ++c)
+    {
+        int64_t start = esp_timer_get_time();
+        for (uint16_t r = 0; r < benchRounds; ++r)
+        {
+            decodeRound(decode, run, c);
+        }
+        uint32_t micros = esp_timer_get_time() - start;
+        uint32_t decoded = (uint32_t)run.categories[c].frames * benchRounds;
+        run.categories[c].nanos[run.mode] = decoded ? (uint64_t)micros * 1000 / decoded : 0;
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (uint16_t r = 0; r < benchRounds; ++r)
+    {
+        decodeRound(decode, run, -1);
+    }
+    run.decodeMicros = esp_timer_get_time() - start;
+
+    // The handler logs every packet to the console, so this figure is
+    // mostly the UART; the ones above are decode alone.
+    benchPacket = run.onPacket;
+    start = esp_timer_get_time();
+    for (uint16_t r = 0; r < benchRounds; ++r)
+    {
+        decodeRound(decode, run, -1);
+    }
+    run.handlerMicros = esp_timer_get_time() - start;
+    run.stackUsed = benchStackSize - uxTaskGetStackHighWaterMark(nullptr);
+    duplicateFilterReset();
+    printerDiscardJobs(false);
+    pipelineUnlockDecode();
+    xTaskNotifyGive(run.caller);
+    vTaskDelete(nullptr);
+}
+
+static const char *variantName(pb_size_t variant)
+{
+    switch (variant)
+    {
+    case meshtastic_FromRadio_my_info_tag:
+        return "my_info";
+    case meshtastic_FromRadio_node_info_tag:
+        return "node_info";
+    case meshtastic_FromRadio_config_tag:
+        return "config";
+    case meshtastic_FromRadio_config_complete_id_tag:
+        return "config_complete";
+    case meshtastic_FromRadio_moduleConfig_tag:
+        return "module_config";
+    case meshtastic_FromRadio_channel_tag:
+        return "channel";
+    case meshtastic_FromRadio_metadata_tag:
+        return "metadata";
+    case meshtastic_FromRadio_log_record_tag:
+        return "log_record";
+    case meshtastic_FromRadio_queueStatus_tag:
+        return "queue_status";
+    default:
+        return "other";
+    }
+}
+
+static uint32_t classifiedPort;
+
+static void classifyPacket(const meshtastic_MeshPacket &packet)
+{
+    classifiedPort = packet.which_payload_variant == meshtastic_MeshPacket_decoded_tag ? packet.decoded.portnum : 0xFFFF;
+}
+
+static void categoryName(const FromRadioFrame &frame, char *name, size_t size)
+{
+    pb_size_t variant = peekFromRadioVariant(frame);
+    if (variant != meshtastic_FromRadio_packet_tag)
+    {
+        strlcpy(name, variantName(variant), size);
+        return;
+    }
+    static const FromRadioHandlers handlers = {classifyPacket, nullptr, nullptr};
+    classifiedPort = 0xFFFF;
+    decodeFromRadio(frame.bytes, frame.size, handlers);
+    switch (classifiedPort)
+    {
+    case meshtastic_PortNum_TEXT_MESSAGE_APP:
+        strlcpy(name, "packet/text", size);
+        break;
+    case meshtastic_PortNum_TEXT_MESSAGE_COMPRESSED_APP:
+        strlcpy(name, "packet/compressed", size);
+        break;
+    case meshtastic_PortNum_POSITION_APP:
+        strlcpy(name, "packet/position", size);
+        break;
+    case meshtastic_PortNum_NODEINFO_APP:
+        strlcpy(name, "packet/nodeinfo", size);
+        break;
+    case meshtastic_PortNum_TELEMETRY_APP:
+        strlcpy(name, "packet/telemetry", size);
+        break;
+    default:
+        strlcpy(name, "packet/other", size);
+        break;
+    }
+}
+
+void runDecodeBench(const FromRadioFrame *frames, size_t count, BenchPacketHandler onPacket, Print &out)
+{
+    uint8_t *categoryOf = (uint8_t *)malloc(count);
+    BenchCategory *categories = (BenchCategory *)calloc(benchCategories, sizeof(BenchCategory));
+    if (!categoryOf || !categories)
+    {
+        out.println("Bench: out of memory");
+        free(categoryOf);
+        free(categories);
+        return;
+    }
+
+    uint8_t categoryCount = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        char name[sizeof(BenchCategory::name)];
+        categoryName(frames[i], name, sizeof(name));
+        uint8_t c = 0;
+        while (c < categoryCount && strcmp(categories[c].name, name) != 0)
+        {
+            c++;
+        }
+        if (c == categoryCount)
+        {
+            if (categoryCount == benchCategories)
+            {
+                c = benchCategories - 1;
+            }
+            else
+            {
+                strlcpy(categories[c].name, name, sizeof(categories[c].name));
+                categoryCount++;
+            }
+        }
+        categories[c].frames++;
+        categoryOf[i] = c;
+    }
+
+    char line[96];
+    snprintf(line, sizeof(line), "Bench: %u frames x %u rounds, sizeof(FromRadio)=%u", (unsigned)count,
+             benchRounds, (unsigned)sizeof(meshtastic_FromRadio));
+    out.println(line);
+
+    BenchRun run = {frames,   count, categoryOf, categories, categoryCount, FullDecode, onPacket, 0, 0, 0,
+                    xTaskGetCurrentTaskHandle()};
+    for (uint8_t m = 0; m < BenchModeCount; ++m)
+    {
+        run.mode = (BenchMode)m;
+        if (xTaskCreatePinnedToCore(benchTask, "bench", benchStackSize, &run, 1, nullptr, PIPELINE_DECODE_CORE) !=
+            pdPASS)
+        {
+            out.println("Bench: task create failed");
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t decoded = count * benchRounds;
+        snprintf(line, sizeof(line), "%-10s %7lu frames/s, %7lu with handler  stack %lu B", modeNames[m],
+                 run.decodeMicros ? (unsigned long)((uint64_t)decoded * 1000000 / run.decodeMicros) : 0UL,
+                 run.handlerMicros ? (unsigned long)((uint64_t)decoded * 1000000 / run.handlerMicros) : 0UL,
+                 (unsigned long)run.stackUsed);
+        out.println(line);
+    }
+
+    snprintf(line, sizeof(line), "%-18s %3s %10s %10s", "variant", "n", "full ns", "select ns");
+    out.println(line);
+    for (uint8_t c = 0; c < categoryCount; ++c)
+    {
+        snprintf(line, sizeof(line), "%-18s %3u %10lu %10lu", categories[c].name, categories[c].frames,
+                 (unsigned long)categories[c].nanos[FullDecode], (unsigned long)categories[c].nanos[SelectiveDecode]);
+        out.println(line);
+    }
+    free(categoryOf);
+    free(categories);
+}
+
+void runDecodeBench(BenchPacketHandler onPacket, Print &out)
+{
+    FromRadioFrame *frames = (FromRadioFrame *)malloc(sizeof(FromRadioFrame) * benchCorpusFrames);
+    if (!frames)
+    {
+        out.println("Bench: out of memory");
+        return;
+    }
+    size_t count = buildBenchCorpus(frames, benchCorpusFrames);
+    runDecodeBench(frames, count, onPacket, out);
+    free(frames);
+}
+
+void runCaptureBench(BenchPacketHandler onPacket, Print &out)
+{
+    CaptureReader reader;
+    if (!reader.open(captureFilePath))
+    {
+        out.println("Bench: no capture");
+        return;
+    }
+    FromRadioFrame *frames = (FromRadioFrame *)malloc(sizeof(FromRadioFrame) * benchCaptureFrames);
+    if (!frames)
+    {
+        reader.close();
+        out.println("Bench: out of memory");
+        return;
+    }
+    size_t count = 0;
+    uint32_t stamp;
+    while (count < benchCaptureFrames && reader.next(frames[count], stamp))
+    {
+        count++;
+    }
+    reader.close();
+    runDecodeBench(frames, count, onPacket, out);
+    free(frames);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../protobufs/mesh.pb.h"
+#include "../radio/FromRadioRing.h"
+
+// Build with DECODE_BENCH=1 to expose the decode benchmark on the console
+// ('b' runs the synthetic corpus, 'B' the capture file). Off by default so
+// release builds carry none of it; set it in build_opt.h next to the sketch,
+// together with PRINTER_DRY_RUN=1.
+#ifndef DECODE_BENCH
+#define DECODE_BENCH 0
+#endif
+
+static const size_t benchCorpusFrames = 16;
+static const size_t benchCaptureFrames = 64;
+
+typedef void (*BenchPacketHandler)(const meshtastic_MeshPacket &packet);
+
+// Fills frames with a synthetic want_config dump plus typical mesh traffic:
+// my_info, config, channel, metadata, node_info, config_complete and packets
+// on the text, compressed text, position, nodeinfo, telemetry and an unknown
+// port.
+size_t buildBenchCorpus(FromRadioFrame *frames, size_t capacity);
+
+// Decodes the corpus repeatedly with the full FromRadio union and with the
+// selective tag-first decoder, each in a fresh task, and reports frames/s,
+// ns/frame per variant and peak stack use of each path. Those figures are
+// decode alone; a second frames/s figure also hands every packet to
+// onPacket, console logging included. Print jobs are dropped for the
+// duration; node names and positions from the corpus do reach the node
+// directory.
+void runDecodeBench(const FromRadioFrame *frames, size_t count, BenchPacketHandler onPacket, Print &out);
+void runDecodeBench(BenchPacketHandler onPacket, Print &out);
+// Same, over the first benchCaptureFrames frames of the flash capture.
+void runCaptureBench(BenchPacketHandler onPacket, Print &out);
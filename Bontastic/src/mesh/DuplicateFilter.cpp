@@ -0,0 +1,105 @@
+#include "DuplicateFilter.h"
+#include <Arduino.h>
+
+static const size_t seenCapacity = 64;
+static const size_t indexSlots = 128;
+
+static_assert((indexSlots & (indexSlots - 1)) == 0, "slot count must be a power of two");
+static_assert(seenCapacity < indexSlots && seenCapacity < 255, "index needs free slots and byte positions");
+
+struct SeenPacket
+{
+    uint32_t from;
+    uint32_t id;
+    uint32_t seenAt;
+};
+
+static SeenPacket seen[seenCapacity];
+// Ring position + 1 of each indexed packet; 0 marks a free slot.
+static uint8_t positions[indexSlots];
+static size_t oldest;
+
+static size_t homeSlot(uint32_t from, uint32_t id)
+{
+    return ((from * 2654435761u) ^ (id * 2246822519u)) >> 25 & (indexSlots - 1);
+}
+
+static size_t probe(uint32_t from, uint32_t id)
+{
+    size_t i = homeSlot(from, id);
+    while (positions[i])
+    {
+        const SeenPacket &packet = seen[positions[i] - 1];
+        if (packet.from == from && packet.id == id)
+        {
+            break;
+        }
+        i = (i + 1) & (indexSlots - 1);
+    }
+    return i;
+}
+
+static void removeAt(size_t i)
+{
+    positions[i] = 0;
+    // Shift later members of the probe chain back so lookups never hit a hole.
+    size_t j = i;
+    while (true)
+    {
+        j = (j + 1) & (indexSlots - 1);
+        if (!positions[j])
+        {
+            return;
+        }
+        const SeenPacket &packet = seen[positions[j] - 1];
+        size_t home = homeSlot(packet.from, packet.id);
+        bool movable = i <= j ? (home <= i || home > j) : (home <= i && home > j);
+        if (movable)
+        {
+            positions[i] = positions[j];
+            positions[j] = 0;
+            i = j;
+        }
+    }
+}
+
+bool duplicatePacket(uint32_t from, uint32_t id)
+{
+    if (!id)
+    {
+        return false;
+    }
+    uint32_t now = millis();
+    size_t i = probe(from, id);
+    if (positions[i])
+    {
+        SeenPacket &packet = seen[positions[i] - 1];
+        if (now - packet.seenAt < duplicateWindow)
+        {
+            return true;
+        }
+        packet.seenAt = now;
+        return false;
+    }
+
+    // Recycle the oldest ring entry.
+    SeenPacket &slot = seen[oldest];
+    if (slot.id)
+    {
+        removeAt(probe(slot.from, slot.id));
+        i = probe(from, id);
+    }
+    slot.from = from;
+    slot.id = id;
+    slot.seenAt = now;
+    positions[i] = oldest + 1;
+    oldest = (oldest + 1) % seenCapacity;
+    return false;
+}
+
+void duplicateFilterReset()
+{
+    memset(seen, 0, sizeof(seen));
+    memset(positions, 0, sizeof(positions));
+    oldest = 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+static const uint32_t duplicateWindow = 10UL * 60UL * 1000UL;
+
+// Remembers the last packets by (from, id) in a fixed ring with an
+// open-addressing index over it, so each check is O(1) and allocates
+// nothing. True when the packet was already seen within duplicateWindow;
+// otherwise it is recorded. Packets without an id are never duplicates.
+bool duplicatePacket(uint32_t from, uint32_t id);
+// Forgets every packet seen so far.
+void duplicateFilterReset();
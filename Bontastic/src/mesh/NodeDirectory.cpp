@@ -0,0 +1,245 @@
+#include "NodeDirectory.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+
+static_assert((nodeDirectorySlots & (nodeDirectorySlots - 1)) == 0, "slot count must be a power of two");
+static_assert(nodeDirectoryLimit < nodeDirectorySlots, "table needs free slots for probing");
+
+static const char *snapshotPath = "/nodes.bin";
+static const uint32_t snapshotMagic = 0x424E4402;
+static const unsigned long snapshotInterval = 30000;
+
+static NodeEntry slots[nodeDirectorySlots];
+static size_t nodeCount;
+static size_t clockHand;
+static bool dirty;
+static bool storageReady;
+static unsigned long lastSave;
+
+static size_t homeSlot(uint32_t num)
+{
+    return (num * 2654435761u) >> 25 & (nodeDirectorySlots - 1);
+}
+
+static size_t probe(uint32_t num)
+{
+    size_t i = homeSlot(num);
+    while (slots[i].num && slots[i].num != num)
+    {
+        i = (i + 1) & (nodeDirectorySlots - 1);
+    }
+    return i;
+}
+
+static void removeAt(size_t i)
+{
+    slots[i].num = 0;
+    nodeCount--;
+    // Shift later members of the probe chain back so lookups never hit a hole.
+    size_t j = i;
+    while (true)
+    {
+        j = (j + 1) & (nodeDirectorySlots - 1);
+        if (!slots[j].num)
+        {
+            return;
+        }
+        size_t home = homeSlot(slots[j].num);
+        bool movable = i <= j ? (home <= i || home > j) : (home <= i && home > j);
+        if (movable)
+        {
+            slots[i] = slots[j];
+            slots[j].num = 0;
+            i = j;
+        }
+    }
+}
+
+static void evictOne()
+{
+    while (true)
+    {
+        NodeEntry &e = slots[clockHand];
+        size_t current = clockHand;
+        clockHand = (clockHand + 1) & (nodeDirectorySlots - 1);
+        if (!e.num)
+        {
+            continue;
+        }
+        if (e.referenced)
+        {
+            e.referenced = 0;
+            continue;
+        }
+        removeAt(current);
+        return;
+    }
+}
+
+static void loadSnapshot()
+{
+    File file = LittleFS.open(snapshotPath, FILE_READ);
+    if (!file)
+    {
+        return;
+    }
+    uint32_t header[2] = {};
+    if (file.read(reinterpret_cast<uint8_t *>(header), sizeof(header)) != sizeof(header) || header[0] != snapshotMagic)
+    {
+        file.close();
+        return;
+    }
+    NodeEntry entry;
+    for (uint32_t n = 0; n < header[1] && nodeCount < nodeDirectoryLimit; ++n)
+    {
+        if (file.read(reinterpret_cast<uint8_t *>(&entry), sizeof(entry)) != sizeof(entry))
+        {
+            break;
+        }
+        if (!entry.num)
+        {
+            continue;
+        }
+        size_t i = probe(entry.num);
+        if (!slots[i].num)
+        {
+            nodeCount++;
+        }
+        entry.referenced = 0;
+        slots[i] = entry;
+    }
+    file.close();
+}
+
+void nodeDirectoryBegin()
+{
+    memset(slots, 0, sizeof(slots));
+    nodeCount = 0;
+    clockHand = 0;
+    dirty = false;
+    storageReady = LittleFS.begin(true);
+    if (storageReady)
+    {
+        loadSnapshot();
+    }
+    lastSave = millis();
+    Serial.print("Node directory ");
+    Serial.println(nodeCount);
+}
+
+const NodeEntry *findNode(uint32_t num)
+{
+    if (!num)
+    {
+        return nullptr;
+    }
+    NodeEntry &e = slots[probe(num)];
+    if (!e.num)
+    {
+        return nullptr;
+    }
+    e.referenced = 1;
+    return &e;
+}
+
+void rememberNode(const NodeEntry &update, uint8_t fields)
+{
+    uint32_t num = update.num;
+    if (!num)
+    {
+        return;
+    }
+    size_t i = probe(num);
+    if (!slots[i].num)
+    {
+        if (nodeCount >= nodeDirectoryLimit)
+        {
+            evictOne();
+            i = probe(num);
+        }
+        memset(&slots[i], 0, sizeof(slots[i]));
+        slots[i].num = num;
+        nodeCount++;
+        dirty = true;
+    }
+    NodeEntry &e = slots[i];
+    e.referenced = 1;
+    if ((fields & NodeNames) &&
+        (strncmp(e.longName, update.longName, sizeof(e.longName)) || strncmp(e.shortName, update.shortName, sizeof(e.shortName))))
+    {
+        strlcpy(e.longName, update.longName, sizeof(e.longName));
+        strlcpy(e.shortName, update.shortName, sizeof(e.shortName));
+        dirty = true;
+    }
+    if ((fields & NodeLastHeard) && update.lastHeard > e.lastHeard)
+    {
+        e.lastHeard = update.lastHeard;
+        dirty = true;
+    }
+    if ((fields & NodePosition) &&
+        (!e.hasPosition || e.latitudeI != update.latitudeI || e.longitudeI != update.longitudeI))
+    {
+        e.hasPosition = 1;
+        e.latitudeI = update.latitudeI;
+        e.longitudeI = update.longitudeI;
+        dirty = true;
+    }
+    nodeDirectorySave(false);
+}
+
+void rememberNode(uint32_t num, const char *longName, const char *shortName)
+{
+    NodeEntry update = {};
+    update.num = num;
+    strlcpy(update.longName, longName, sizeof(update.longName));
+    strlcpy(update.shortName, shortName, sizeof(update.shortName));
+    rememberNode(update, NodeNames);
+}
+
+void formatNodeName(uint32_t num, char *buffer, size_t size)
+{
+    const NodeEntry *e = findNode(num);
+    if (e && e->longName[0])
+    {
+        strlcpy(buffer, e->longName, size);
+    }
+    else
+    {
+        snprintf(buffer, size, "!%08x", (unsigned)num);
+    }
+}
+
+// Snapshots are rate-limited so a burst of NodeInfo costs one flash write.
+void nodeDirectorySave(bool force)
+{
+    if (!dirty || !storageReady)
+    {
+        return;
+    }
+    if (!force && millis() - lastSave < snapshotInterval)
+    {
+        return;
+    }
+    lastSave = millis();
+    File file = LittleFS.open(snapshotPath, FILE_WRITE);
+    if (!file)
+    {
+        return;
+    }
+    uint32_t header[2] = {snapshotMagic, static_cast<uint32_t>(nodeCount)};
+    file.write(reinterpret_cast<const uint8_t *>(header), sizeof(header));
+    for (size_t i = 0; i < nodeDirectorySlots; ++i)
+    {
+        if (slots[i].num)
+        {
+            file.write(reinterpret_cast<const uint8_t *>(&slots[i]), sizeof(slots[i]));
+        }
+    }
+    file.close();
+    dirty = false;
+}
+
+size_t nodeDirectorySize()
+{
+    return nodeCount;
+}
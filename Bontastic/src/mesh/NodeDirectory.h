@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const size_t nodeDirectorySlots = 128;
+static const size_t nodeDirectoryLimit = 96;
+
+struct NodeEntry
+{
+    uint32_t num;
+    char longName[40];
+    char shortName[5];
+    uint8_t referenced;
+    uint8_t hasPosition;
+    uint32_t lastHeard;
+    int32_t latitudeI;
+    int32_t longitudeI;
+};
+
+enum NodeFields : uint8_t
+{
+    NodeNames = 0x01,
+    NodeLastHeard = 0x02,
+    NodePosition = 0x04
+};
+
+// Fixed-capacity open-addressing table of node names keyed by node number.
+// Linear probing with backward-shift deletion; once nodeDirectoryLimit nodes
+// are known, a clock sweep evicts one that has not been looked up recently.
+// Owned by the decode task, so no locking.
+void nodeDirectoryBegin();
+const NodeEntry *findNode(uint32_t num);
+void rememberNode(uint32_t num, const char *longName, const char *shortName);
+void rememberNode(const NodeEntry &update, uint8_t fields);
+void formatNodeName(uint32_t num, char *buffer, size_t size);
+void nodeDirectorySave(bool force);
+size_t nodeDirectorySize();
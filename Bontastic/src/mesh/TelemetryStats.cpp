@@ -0,0 +1,165 @@
+#include "TelemetryStats.h"
+#include <Arduino.h>
+
+enum TelemetryMetric : uint8_t
+{
+    MetricBattery,
+    MetricVoltage,
+    MetricChannelUtil,
+    MetricAirUtilTx,
+    MetricTemperature,
+    MetricHumidity,
+    MetricPressure,
+    MetricPowerVoltage,
+    MetricPowerCurrent,
+    MetricPm25,
+    MetricPm100,
+    MetricCount
+};
+
+static const char *const metricLabels[MetricCount] = {"Batt", "Volt", "ChUt", "AirTx", "Temp", "Hum",
+                                                      "hPa",  "PwrV", "PwrmA", "PM2.5", "PM10"};
+
+struct MetricWindow
+{
+    float min;
+    float max;
+    float sum;
+    uint16_t count;
+};
+
+struct TelemetryNode
+{
+    uint32_t num;
+    uint32_t lastHeard;
+    uint16_t reports;
+    MetricWindow metrics[MetricCount];
+};
+
+static TelemetryNode nodes[telemetryNodeSlots];
+static uint32_t windowStart;
+
+static TelemetryNode &nodeFor(uint32_t num)
+{
+    TelemetryNode *oldest = &nodes[0];
+    for (TelemetryNode &node : nodes)
+    {
+        if (node.num == num)
+        {
+            return node;
+        }
+        if (!node.num || (oldest->num && node.lastHeard < oldest->lastHeard))
+        {
+            oldest = &node;
+        }
+    }
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->num = num;
+    return *oldest;
+}
+
+static void add(TelemetryNode &node, TelemetryMetric metric, bool present, float value)
+{
+    if (!present)
+    {
+        return;
+    }
+    MetricWindow &window = node.metrics[metric];
+    if (!window.count)
+    {
+        window.min = window.max = value;
+    }
+    if (value < window.min)
+    {
+        window.min = value;
+    }
+    if (value > window.max)
+    {
+        window.max = value;
+    }
+    window.sum += value;
+    window.count++;
+}
+
+void telemetryRecord(uint32_t from, const meshtastic_Telemetry &telemetry)
+{
+    TelemetryNode &node = nodeFor(from);
+    node.lastHeard = millis();
+    node.reports++;
+    switch (telemetry.which_variant)
+    {
+    case meshtastic_Telemetry_device_metrics_tag:
+    {
+        const meshtastic_DeviceMetrics &m = telemetry.variant.device_metrics;
+        add(node, MetricBattery, m.has_battery_level, m.battery_level);
+        add(node, MetricVoltage, m.has_voltage, m.voltage);
+        add(node, MetricChannelUtil, m.has_channel_utilization, m.channel_utilization);
+        add(node, MetricAirUtilTx, m.has_air_util_tx, m.air_util_tx);
+        break;
+    }
+    case meshtastic_Telemetry_environment_metrics_tag:
+    {
+        const meshtastic_EnvironmentMetrics &m = telemetry.variant.environment_metrics;
+        add(node, MetricTemperature, m.has_temperature, m.temperature);
+        add(node, MetricHumidity, m.has_relative_humidity, m.relative_humidity);
+        add(node, MetricPressure, m.has_barometric_pressure, m.barometric_pressure);
+        break;
+    }
+    case meshtastic_Telemetry_power_metrics_tag:
+    {
+        const meshtastic_PowerMetrics &m = telemetry.variant.power_metrics;
+        add(node, MetricPowerVoltage, m.has_ch1_voltage, m.ch1_voltage);
+        add(node, MetricPowerCurrent, m.has_ch1_current, m.ch1_current);
+        break;
+    }
+    case meshtastic_Telemetry_air_quality_metrics_tag:
+    {
+        const meshtastic_AirQualityMetrics &m = telemetry.variant.air_quality_metrics;
+        add(node, MetricPm25, m.has_pm25_standard, m.pm25_standard);
+        add(node, MetricPm100, m.has_pm100_standard, m.pm100_standard);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void telemetrySummarize(bool force, TelemetrySummarySink sink)
+{
+    uint32_t now = millis();
+    if (!force && now - windowStart < telemetrySummaryPeriod)
+    {
+        return;
+    }
+    windowStart = now;
+    char text[256];
+    for (TelemetryNode &node : nodes)
+    {
+        if (!node.num || !node.reports)
+        {
+            continue;
+        }
+        size_t size = 0;
+        for (uint8_t metric = 0; metric < MetricCount; ++metric)
+        {
+            const MetricWindow &window = node.metrics[metric];
+            if (!window.count)
+            {
+                continue;
+            }
+            int written = snprintf(text + size, sizeof(text) - size, "%-5s %6.1f %6.1f %6.1f\n", metricLabels[metric],
+                                   window.min, window.sum / window.count, window.max);
+            if (written < 0 || size + written >= sizeof(text))
+            {
+                break;
+            }
+            size += written;
+        }
+        if (size)
+        {
+            sink(now, node.num, node.reports, text, size);
+        }
+        node.reports = 0;
+        memset(node.metrics, 0, sizeof(node.metrics));
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../protobufs/telemetry.pb.h"
+
+static const size_t telemetryNodeSlots = 16;
+// How long reports are folded together before a summary is printed.
+static const uint32_t telemetrySummaryPeriod = 15UL * 60UL * 1000UL;
+
+// Receives one node's summary: a line per metric with min, mean and max.
+// window is the same for every node of one summary, so they can be printed
+// together.
+typedef void (*TelemetrySummarySink)(uint32_t window, uint32_t num, uint16_t reports, const char *text, size_t size);
+
+// Folds a TELEMETRY_APP report into its node's running min/max/sum, O(1) per
+// metric. Nodes live in a fixed table; when it is full the node heard least
+// recently is dropped, so memory stays bounded however many sensors report.
+void telemetryRecord(uint32_t from, const meshtastic_Telemetry &telemetry);
+// Once the period has elapsed (or when forced) hands each node heard since
+// the last summary to sink and starts a new window. Nodes whose reports
+// carried none of the tracked metrics are left out.
+void telemetrySummarize(bool force, TelemetrySummarySink sink);
@@ -0,0 +1,585 @@
+#include "Unishox2.h"
+#include <string.h>
+
+// Code tables of the Unishox2 default preset (USX_PSET_DFLT). Characters are
+// coded as a horizontal code picking a set and a vertical code picking the
+// character within it; switches between sets are prefixed by vertical code 0.
+enum UnishoxSet : uint8_t
+{
+    SetAlpha,
+    SetSym,
+    SetNum,
+    SetDict,
+    SetDelta
+};
+
+static const int invalid = 99;
+static const int32_t niceLength = 5;
+
+static const char sets[3][28] = {
+    {0, ' ', 'e', 't', 'a', 'o', 'i', 'n', 's', 'r', 'l', 'c', 'd', 'h', 'u', 'p', 'm', 'b', 'g', 'w', 'f', 'y', 'v',
+     'k', 'q', 'j', 'x', 'z'},
+    {'"', '{', '}', '_', '<', '>', ':', '\n', 0, '[', ']', '\\', ';', '\'', '\t', '@', '*', '&', '?', '!', '^', '|',
+     '\r', '~', '`', 0, 0, 0},
+    {0, ',', '.', '0', '1', '9', '2', '5', '-', '/', '3', '4', '6', '7', '8', '(', ')', ' ', '=', '+', '$', '%', '#',
+     0, 0, 0, 0, 0}};
+
+static const uint8_t vcodes[28] = {0x00, 0x40, 0x60, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xD8,
+                                   0xE0, 0xE4, 0xE8, 0xEC, 0xEE, 0xF0, 0xF2, 0xF4, 0xF6, 0xF7,
+                                   0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+static const uint8_t vcodeLengths[28] = {2, 3, 3, 4, 4, 4, 4, 4, 5, 5, 6, 6, 6, 7,
+                                         7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8};
+static const uint8_t hcodes[5] = {0x00, 0x40, 0x80, 0xC0, 0xE0};
+static const uint8_t hcodeLengths[5] = {2, 2, 2, 3, 3};
+
+static const char *const frequentSequences[6] = {"\": \"", "\": ", "</", "=\"", "\":\"", "://"};
+static const char *const templates[5] = {"tfff-of-tfTtf:rf:rf.fffZ", "tfff-of-tf", "(fff) fff-ffff", "tf:rf:rf",
+                                         nullptr};
+
+static const uint8_t countBits[5] = {2, 4, 7, 11, 16};
+static const int32_t countAdders[5] = {4, 20, 148, 2196, 67732};
+static const uint8_t unicodeBits[5] = {6, 12, 14, 16, 21};
+static const int32_t unicodeAdders[5] = {0, 64, 4160, 20544, 86080};
+
+struct BitReader
+{
+    const uint8_t *in;
+    int32_t length;
+    int32_t bit;
+};
+
+struct Output
+{
+    uint8_t *bytes;
+    size_t capacity;
+    size_t length;
+    bool full;
+
+    bool put(uint8_t c)
+    {
+        if (length >= capacity)
+        {
+            full = true;
+            return false;
+        }
+        bytes[length++] = c;
+        return true;
+    }
+
+    void text(const char *s)
+    {
+        while (*s && put(*s++))
+        {
+        }
+    }
+
+    bool codepoint(int32_t cp)
+    {
+        if (cp < 0 || cp > 0x10FFFF)
+        {
+            return false;
+        }
+        uint8_t encoded[4];
+        size_t size;
+        if (cp < 0x80)
+        {
+            encoded[0] = cp;
+            size = 1;
+        }
+        else if (cp < 0x800)
+        {
+            encoded[0] = 0xC0 | (cp >> 6);
+            encoded[1] = 0x80 | (cp & 0x3F);
+            size = 2;
+        }
+        else if (cp < 0x10000)
+        {
+            encoded[0] = 0xE0 | (cp >> 12);
+            encoded[1] = 0x80 | ((cp >> 6) & 0x3F);
+            encoded[2] = 0x80 | (cp & 0x3F);
+            size = 3;
+        }
+        else
+        {
+            encoded[0] = 0xF0 | (cp >> 18);
+            encoded[1] = 0x80 | ((cp >> 12) & 0x3F);
+            encoded[2] = 0x80 | ((cp >> 6) & 0x3F);
+            encoded[3] = 0x80 | (cp & 0x3F);
+            size = 4;
+        }
+        // Never leave half a sequence behind when truncating.
+        if (length + size > capacity)
+        {
+            full = true;
+            return true;
+        }
+        memcpy(bytes + length, encoded, size);
+        length += size;
+        return true;
+    }
+};
+
+static bool readBit(const BitReader &r)
+{
+    return r.in[r.bit >> 3] & (0x80 >> (r.bit & 7));
+}
+
+// The next eight bits, padded with ones past the end of the input.
+static uint8_t peekByte(const BitReader &r)
+{
+    int32_t shift = r.bit & 7;
+    int32_t index = r.bit >> 3;
+    uint8_t code = r.in[index] << shift;
+    if ((index + 1) * 8 < r.length)
+    {
+        code |= r.in[index + 1] >> (8 - shift);
+    }
+    else
+    {
+        code |= 0xFF >> (8 - shift);
+    }
+    return code;
+}
+
+static int32_t readBits(BitReader &r, uint8_t count)
+{
+    if (r.bit + count > r.length)
+    {
+        return -1;
+    }
+    int32_t value = 0;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        value = (value << 1) | readBit(r);
+        r.bit++;
+    }
+    return value;
+}
+
+static int readCode(BitReader &r, const uint8_t *codes, const uint8_t *lengths, int count)
+{
+    if (r.bit >= r.length)
+    {
+        return invalid;
+    }
+    uint8_t code = peekByte(r);
+    for (int i = 0; i < count; ++i)
+    {
+        if ((code & (0xFF << (8 - lengths[i]))) == codes[i])
+        {
+            r.bit += lengths[i];
+            return r.bit > r.length ? invalid : i;
+        }
+    }
+    return invalid;
+}
+
+static int readVCode(BitReader &r)
+{
+    return readCode(r, vcodes, vcodeLengths, 28);
+}
+
+static int readHCode(BitReader &r)
+{
+    return readCode(r, hcodes, hcodeLengths, 5);
+}
+
+// Unary step code: the number of one bits before a zero, up to limit.
+static int readStep(BitReader &r, int limit)
+{
+    int index = 0;
+    while (r.bit < r.length && readBit(r))
+    {
+        index++;
+        r.bit++;
+        if (index == limit)
+        {
+            return index;
+        }
+    }
+    if (r.bit >= r.length)
+    {
+        return invalid;
+    }
+    r.bit++;
+    return index;
+}
+
+static int32_t readCount(BitReader &r)
+{
+    int index = readStep(r, 4);
+    if (index == invalid)
+    {
+        return -1;
+    }
+    int32_t value = readBits(r, countBits[index]);
+    if (value < 0)
+    {
+        return -1;
+    }
+    return value + (index ? countAdders[index - 1] : 0);
+}
+
+// Reads one code of delta state: a signed code point difference, or
+// special >= 0 for the few codes that stand for ASCII or a set switch.
+static bool readUnicode(BitReader &r, int32_t &delta, int &special)
+{
+    special = -1;
+    int index = readStep(r, 5);
+    if (index == invalid)
+    {
+        return false;
+    }
+    if (index == 5)
+    {
+        special = readStep(r, 4);
+        return special != invalid;
+    }
+    bool negative = r.bit < r.length && readBit(r);
+    r.bit++;
+    int32_t value = readBits(r, unicodeBits[index]);
+    if (value < 0)
+    {
+        return false;
+    }
+    delta = value + unicodeAdders[index];
+    if (negative)
+    {
+        delta = -delta;
+    }
+    return true;
+}
+
+static bool copyRepeat(BitReader &r, Output &out)
+{
+    int32_t length = readCount(r);
+    int32_t distance = readCount(r);
+    if (length < 0 || distance < 0)
+    {
+        return false;
+    }
+    length += niceLength;
+    int32_t from = static_cast<int32_t>(out.length) - distance - length;
+    if (from < 0)
+    {
+        return false;
+    }
+    while (length-- && out.put(out.bytes[from++]))
+    {
+    }
+    return true;
+}
+
+// Number set code 0: templates, hex strings, UUIDs and raw bytes.
+static bool readNumber(BitReader &r, Output &out)
+{
+    int kind = readStep(r, 5);
+    if (kind == invalid)
+    {
+        return false;
+    }
+    if (kind == 0)
+    {
+        int index = readStep(r, 4);
+        if (index == invalid || !templates[index])
+        {
+            return false;
+        }
+        // The count is how many characters the text leaves off the end of
+        // the template; the rest is output from its start.
+        int32_t omitted = readCount(r);
+        int32_t size = strlen(templates[index]);
+        if (omitted < 0 || omitted > size)
+        {
+            return false;
+        }
+        const char *end = templates[index] + size - omitted;
+        for (const char *t = templates[index]; t < end; ++t)
+        {
+            uint8_t bits = *t == 'f' || *t == 'F' ? 4 : *t == 'r' ? 3 : *t == 't' ? 2 : *t == 'o' ? 1 : 0;
+            if (!bits)
+            {
+                out.put(*t);
+                continue;
+            }
+            int32_t value = readBits(r, bits);
+            if (value < 0)
+            {
+                return false;
+            }
+            out.put(value < 10 ? '0' + value : (*t == 'F' ? 'A' : 'a') + value - 10);
+        }
+        return true;
+    }
+    if (kind == 5)
+    {
+        int32_t count = readCount(r);
+        if (count <= 0)
+        {
+            return false;
+        }
+        while (count--)
+        {
+            int32_t value = readBits(r, 8);
+            if (value < 0)
+            {
+                return false;
+            }
+            out.put(value);
+        }
+        return true;
+    }
+    bool uuid = kind == 2 || kind == 4;
+    int32_t count = uuid ? 32 : readCount(r);
+    if (count <= 0)
+    {
+        return false;
+    }
+    char letter = kind < 3 ? 'a' : 'A';
+    while (count--)
+    {
+        int32_t nibble = readBits(r, 4);
+        if (nibble < 0)
+        {
+            return false;
+        }
+        out.put(nibble < 10 ? '0' + nibble : letter + nibble - 10);
+        if (uuid && (count == 24 || count == 20 || count == 16 || count == 12))
+        {
+            out.put('-');
+        }
+    }
+    return true;
+}
+
+int unishox2Decompress(const uint8_t *in, size_t size, uint8_t *out, size_t capacity)
+{
+    // The first bit is the Unishox magic bit.
+    BitReader r = {in, static_cast<int32_t>(size * 8), 1};
+    Output o = {out, capacity, 0, false};
+    int state = SetAlpha;
+    int h = SetAlpha;
+    bool allUpper = false;
+    int32_t previous = 0;
+
+    while (r.bit < r.length && !o.full)
+    {
+        if (state == SetDelta || h == SetDelta)
+        {
+            if (state != SetDelta)
+            {
+                h = state;
+            }
+            int32_t delta;
+            int special;
+            if (!readUnicode(r, delta, special))
+            {
+                break;
+            }
+            if (special < 0)
+            {
+                previous += delta;
+                if (!o.codepoint(previous))
+                {
+                    return -1;
+                }
+                continue;
+            }
+            if (special == 0)
+            {
+                o.put(' ');
+                continue;
+            }
+            if (special == 2)
+            {
+                o.put(',');
+                continue;
+            }
+            if (special == 3)
+            {
+                // CJK text gets the ideographic full stop.
+                if (previous > 0x3000)
+                {
+                    o.codepoint(0x3002);
+                }
+                else
+                {
+                    o.put('.');
+                }
+                continue;
+            }
+            if (special == 4)
+            {
+                o.put('\r');
+                o.put('\n');
+                continue;
+            }
+            if (special != 1)
+            {
+                return -1;
+            }
+            h = readHCode(r);
+            if (h == invalid)
+            {
+                break;
+            }
+            if (h == SetDelta || h == SetAlpha)
+            {
+                state = h;
+                continue;
+            }
+            if (h == SetDict)
+            {
+                if (!copyRepeat(r, o))
+                {
+                    return -1;
+                }
+                continue;
+            }
+            // A single symbol or number follows.
+        }
+        else
+        {
+            h = state;
+        }
+
+        bool upper = allUpper;
+        int v = readVCode(r);
+        if (v == invalid)
+        {
+            break;
+        }
+        if (v == 0 && h != SetSym)
+        {
+            if (r.bit >= r.length)
+            {
+                break;
+            }
+            if (h != SetNum || state != SetDelta)
+            {
+                h = readHCode(r);
+                if (h == invalid || r.bit >= r.length)
+                {
+                    break;
+                }
+            }
+            if (h == SetAlpha)
+            {
+                if (state != SetAlpha)
+                {
+                    state = SetAlpha;
+                    continue;
+                }
+                // Alpha to alpha shifts the next letter; twice locks caps,
+                // and once more unlocks them.
+                if (allUpper)
+                {
+                    allUpper = false;
+                    continue;
+                }
+                v = readVCode(r);
+                if (v == invalid)
+                {
+                    break;
+                }
+                if (v == 0)
+                {
+                    h = readHCode(r);
+                    if (h == invalid)
+                    {
+                        break;
+                    }
+                    if (h == SetAlpha)
+                    {
+                        allUpper = true;
+                        continue;
+                    }
+                }
+                upper = true;
+            }
+            else if (h == SetDict)
+            {
+                if (!copyRepeat(r, o))
+                {
+                    return -1;
+                }
+                continue;
+            }
+            else if (h == SetDelta)
+            {
+                // One code point follows; the state is unchanged.
+                continue;
+            }
+            else
+            {
+                if (h != SetNum || state != SetDelta)
+                {
+                    v = readVCode(r);
+                    if (v == invalid)
+                    {
+                        break;
+                    }
+                }
+                if (h == SetNum && v == 0)
+                {
+                    if (!readNumber(r, o))
+                    {
+                        return -1;
+                    }
+                    continue;
+                }
+            }
+        }
+        if (upper && v == 1)
+        {
+            // Shifted space enters continuous delta coding.
+            h = state = SetDelta;
+            continue;
+        }
+
+        uint8_t c = h < SetDict ? sets[h][v] : 0;
+        if (c >= 'a' && c <= 'z')
+        {
+            o.put(upper ? c - ('a' - 'A') : c);
+        }
+        else if (c)
+        {
+            o.put(c);
+        }
+        else if (h == SetSym && v == 8)
+        {
+            o.put('\r');
+            o.put('\n');
+        }
+        else if (h == SetNum && v == 26)
+        {
+            int32_t count = readCount(r);
+            if (count < 0 || !o.length)
+            {
+                return -1;
+            }
+            uint8_t repeated = o.bytes[o.length - 1];
+            for (count += 4; count-- && o.put(repeated);)
+            {
+            }
+        }
+        else if (h == SetSym && v > 24)
+        {
+            o.text(frequentSequences[v - 25]);
+        }
+        else if (h == SetNum && v > 22 && v < 26)
+        {
+            o.text(frequentSequences[v - 20]);
+        }
+        else
+        {
+            // Terminator.
+            break;
+        }
+        if (state == SetDelta)
+        {
+            h = SetDelta;
+        }
+    }
+    return static_cast<int>(o.length);
+}
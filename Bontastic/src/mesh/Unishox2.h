@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Prints TEXT_MESSAGE_COMPRESSED_APP payloads through the decoder below when
+// 1. Off by default: the decoder follows the published format and is tested
+// against hand-assembled streams, but not yet against output of the
+// reference compressor. When off, those payloads are hex-dumped like any other
+// unknown port.
+#ifndef UNISHOX2_TEXT
+#define UNISHOX2_TEXT 0
+#endif
+
+// Decompresses a TEXT_MESSAGE_COMPRESSED_APP payload: Unishox2 with the
+// default preset, as the Meshtastic firmware compresses it. Output stops at
+// capacity, so an oversized message is truncated rather than rejected.
+// Returns the bytes written, or -1 when the input is not valid Unishox2.
+int unishox2Decompress(const uint8_t *in, size_t size, uint8_t *out, size_t capacity);
@@ -0,0 +1,294 @@
+#include "Pipeline.h"
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "../mesh/DuplicateFilter.h"
+#include "../printer/PrintHelpers.h"
+#include "../printer/PrintQueue.h"
+#include "../radio/FrameCapture.h"
+#include "../radio/FromNumQueue.h"
+
+static const uint32_t ingestStack = 4096;
+static const uint32_t decodeStack = 8192;
+static const uint32_t printStack = 6144;
+
+static const UBaseType_t ingestPriority = 3;
+static const UBaseType_t decodePriority = 2;
+static const UBaseType_t printPriority = 1;
+
+// How often an empty FromRadio is re-read while announced packets are missing.
+static const int maxEmptyRetries = 3;
+static const TickType_t emptyRetryDelay = pdMS_TO_TICKS(10);
+
+// The decode task runs its idle hook at least this often for housekeeping.
+static const TickType_t decodeIdlePeriod = pdMS_TO_TICKS(5000);
+
+// Longest pause a recorded-speed replay keeps between two frames.
+static const uint32_t replayMaxGap = 10UL * 1000UL;
+
+static PipelineHooks pipelineHooks;
+static FromRadioRing fromRadioRing;
+static TaskHandle_t ingestTask;
+static TaskHandle_t decodeTask;
+static TaskHandle_t printTask;
+static SemaphoreHandle_t decodeMutex;
+static FromNumQueue fromNumQueue;
+static uint32_t announcedNum;
+static uint32_t consumedNum;
+static bool numSynced;
+
+enum ReplayRequest : uint8_t
+{
+    NoReplay,
+    ReplayRecorded,
+    ReplayFast
+};
+
+static volatile uint8_t replayRequest;
+
+static bool behindAnnounced()
+{
+    return numSynced && static_cast<int32_t>(announcedNum - consumedNum) > 0;
+}
+
+static void collectAnnouncements()
+{
+    uint32_t value;
+    uint32_t popped = 0;
+    while (fromNumQueue.pop(value))
+    {
+        announcedNum = value;
+        popped++;
+    }
+    if (fromNumQueue.overflowed())
+    {
+        announcedNum = fromNumQueue.newest();
+    }
+    if (popped)
+    {
+        Serial.print("FromNum ");
+        Serial.print(announcedNum);
+        Serial.print(" (");
+        Serial.print(popped);
+        Serial.println(" notifies)");
+    }
+}
+
+static FromRadioFrame *acquireFrame()
+{
+    FromRadioFrame *frame;
+    while (!(frame = fromRadioRing.acquire()))
+    {
+        // Decode is behind; the radio keeps the rest in its FIFO meanwhile.
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    return frame;
+}
+
+static void drainFromRadio()
+{
+    int retries = 0;
+    while (true)
+    {
+        FromRadioFrame *frame = acquireFrame();
+        if (!pipelineHooks.readFrame(*frame))
+        {
+            collectAnnouncements();
+            if (behindAnnounced() && retries++ < maxEmptyRetries)
+            {
+                vTaskDelay(emptyRetryDelay);
+                continue;
+            }
+            if (behindAnnounced())
+            {
+                Serial.print("FromNum gap ");
+                Serial.println(announcedNum - consumedNum);
+            }
+            consumedNum = announcedNum;
+            numSynced = fromNumQueue.pushed() > 0;
+            Serial.print("FromRadio empty, free heap ");
+            Serial.println(ESP.getFreeHeap());
+            break;
+        }
+        captureFrame(*frame);
+        if (peekFromRadioVariant(*frame) == meshtastic_FromRadio_packet_tag)
+        {
+            consumedNum++;
+        }
+        Serial.print("FromRadio bytes ");
+        Serial.println(frame->size);
+        fromRadioRing.publish();
+        xTaskNotifyGive(decodeTask);
+    }
+}
+
+// Runs on the ingest task so the ring keeps a single producer; live reads
+// wait until the replay is done and the radio's FIFO holds them meanwhile.
+static void replayCapture(bool recordedSpeed)
+{
+    if (frameCaptureActive())
+    {
+        Serial.println("Replay: stop capture first");
+        return;
+    }
+    CaptureReader reader;
+    if (!reader.open(captureFilePath))
+    {
+        Serial.println("Replay: no capture");
+        return;
+    }
+    // The recorded packets were most likely seen live already; without this
+    // the filter would drop them all. Locked so no frame is mid-decode.
+    pipelineLockDecode();
+    duplicateFilterReset();
+    pipelineUnlockDecode();
+    uint32_t started = millis();
+    uint32_t lastStamp = 0;
+    uint32_t due = 0;
+    uint32_t frames = 0;
+    while (true)
+    {
+        FromRadioFrame *frame = acquireFrame();
+        uint32_t stamp;
+        if (!reader.next(*frame, stamp))
+        {
+            break;
+        }
+        if (recordedSpeed)
+        {
+            // Stamps restart at every recorded boot and may jump across a
+            // long idle stretch; neither should stall the replay.
+            uint32_t gap = stamp - lastStamp;
+            if (!frames || reader.startsSession() || static_cast<int32_t>(gap) < 0)
+            {
+                gap = 0;
+            }
+            due += gap < replayMaxGap ? gap : replayMaxGap;
+            uint32_t elapsed = millis() - started;
+            if (due > elapsed)
+            {
+                vTaskDelay(pdMS_TO_TICKS(due - elapsed));
+            }
+        }
+        lastStamp = stamp;
+        fromRadioRing.publish();
+        xTaskNotifyGive(decodeTask);
+        frames++;
+    }
+    reader.close();
+    Serial.print("Replay: ");
+    Serial.print(frames);
+    Serial.print(" frames in ");
+    Serial.print(millis() - started);
+    Serial.println(" ms");
+}
+
+static void ingestLoop(void *)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint8_t replay = replayRequest;
+        if (replay != NoReplay)
+        {
+            replayRequest = NoReplay;
+            replayCapture(replay == ReplayRecorded);
+        }
+        collectAnnouncements();
+        drainFromRadio();
+    }
+}
+
+static void decodeLoop(void *)
+{
+    while (true)
+    {
+        bool woken = ulTaskNotifyTake(pdTRUE, decodeIdlePeriod);
+        pipelineLockDecode();
+        if (!woken && pipelineHooks.decodeIdle)
+        {
+            pipelineHooks.decodeIdle();
+        }
+        while (const FromRadioFrame *frame = fromRadioRing.front())
+        {
+            pipelineHooks.decodeFrame(*frame);
+            fromRadioRing.release();
+        }
+        pipelineUnlockDecode();
+    }
+}
+
+static void printLoop(void *)
+{
+    PrintJob job;
+    while (true)
+    {
+        if (!takePrintJob(job, portMAX_DELAY))
+        {
+            continue;
+        }
+        if (digestWanted(job))
+        {
+            // 0 when an alert cut the hold short; it is taken next.
+            completePrintJobs(printDigest(job));
+        }
+        else if (job.kind == TelemetryJob)
+        {
+            completePrintJobs(printTelemetry(job));
+        }
+        else
+        {
+            printJob(job);
+            completePrintJob();
+        }
+    }
+}
+
+void startPipeline(const PipelineHooks &hooks)
+{
+    if (ingestTask)
+    {
+        return;
+    }
+    pipelineHooks = hooks;
+    decodeMutex = xSemaphoreCreateMutex();
+    printQueueBegin();
+    xTaskCreatePinnedToCore(printLoop, "print", printStack, nullptr, printPriority, &printTask, PIPELINE_PRINT_CORE);
+    xTaskCreatePinnedToCore(decodeLoop, "decode", decodeStack, nullptr, decodePriority, &decodeTask, PIPELINE_DECODE_CORE);
+    xTaskCreatePinnedToCore(ingestLoop, "ingest", ingestStack, nullptr, ingestPriority, &ingestTask, PIPELINE_INGEST_CORE);
+}
+
+void pipelineWake()
+{
+    if (ingestTask)
+    {
+        xTaskNotifyGive(ingestTask);
+    }
+}
+
+void pipelineAnnounce(uint32_t fromNum)
+{
+    fromNumQueue.push(fromNum);
+    pipelineWake();
+}
+
+void pipelineReplay(bool recordedSpeed)
+{
+    replayRequest = recordedSpeed ? ReplayRecorded : ReplayFast;
+    pipelineWake();
+}
+
+void pipelineLockDecode()
+{
+    if (decodeMutex)
+    {
+        xSemaphoreTake(decodeMutex, portMAX_DELAY);
+    }
+}
+
+void pipelineUnlockDecode()
+{
+    if (decodeMutex)
+    {
+        xSemaphoreGive(decodeMutex);
+    }
+}
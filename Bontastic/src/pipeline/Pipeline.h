@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../radio/FromRadioRing.h"
+
+// Core affinity of the three pipeline stages. NimBLE's host runs on core 0,
+// so by default ingest sits next to it and decode/print share the app core.
+#ifndef PIPELINE_INGEST_CORE
+#define PIPELINE_INGEST_CORE 0
+#endif
+#ifndef PIPELINE_DECODE_CORE
+#define PIPELINE_DECODE_CORE 1
+#endif
+#ifndef PIPELINE_PRINT_CORE
+#define PIPELINE_PRINT_CORE 1
+#endif
+
+struct PipelineHooks
+{
+    bool (*readFrame)(FromRadioFrame &frame);
+    void (*decodeFrame)(const FromRadioFrame &frame);
+    void (*decodeIdle)();
+};
+
+void startPipeline(const PipelineHooks &hooks);
+void pipelineWake();
+void pipelineAnnounce(uint32_t fromNum);
+// Feeds the capture file through the decoder from the ingest task, either
+// with the recorded inter-frame timing or as fast as decode keeps up.
+void pipelineReplay(bool recordedSpeed);
+// Held by the decode task while it runs the decode hooks, whose state is
+// otherwise unsynchronised; anyone else calling them takes it first.
+void pipelineLockDecode();
+void pipelineUnlockDecode();
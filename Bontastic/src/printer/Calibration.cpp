@@ -0,0 +1,210 @@
+#include "Calibration.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include "Adafruit_Thermal.h"
+#include "PrintHelpers.h"
+#include "PrintQueue.h"
+
+extern Adafruit_Thermal printer;
+
+static const uint8_t patternLines = 16;
+// How long past the pattern's slowest print time a GS r reply may take.
+static const uint32_t statusSlackMs = 300;
+
+static PrintRate rates[calibrationProfiles];
+static uint8_t rateCount;
+static Preferences calibPrefs;
+
+static bool sameProfile(const PrintRate &rate, uint8_t dots, uint8_t time, uint8_t interval)
+{
+    return rate.heatDots == dots && rate.heatTime == time && rate.heatInterval == interval;
+}
+
+void calibrationBegin()
+{
+    rateCount = 0;
+    if (!calibPrefs.begin("calib", true))
+    {
+        return;
+    }
+    size_t bytes = calibPrefs.getBytes("rates", rates, sizeof(rates));
+    calibPrefs.end();
+    rateCount = bytes / sizeof(PrintRate);
+}
+
+static void storeRate(const PrintRate &rate)
+{
+    uint8_t slot = 0;
+    while (slot < rateCount && !sameProfile(rates[slot], rate.heatDots, rate.heatTime, rate.heatInterval))
+    {
+        slot++;
+    }
+    if (slot == calibrationProfiles)
+    {
+        // Full: forget the oldest measurement.
+        memmove(rates, rates + 1, sizeof(PrintRate) * (calibrationProfiles - 1));
+        slot = calibrationProfiles - 1;
+    }
+    else if (slot == rateCount)
+    {
+        rateCount++;
+    }
+    rates[slot] = rate;
+    if (calibPrefs.begin("calib", false))
+    {
+        calibPrefs.putBytes("rates", rates, sizeof(PrintRate) * rateCount);
+        calibPrefs.end();
+    }
+}
+
+bool measuredPrintRate(const PrinterSettings &settings, PrintRate &rate)
+{
+    for (uint8_t i = 0; i < rateCount; ++i)
+    {
+        if (sameProfile(rates[i], settings.heatDots, settings.heatTime, settings.heatInterval))
+        {
+            rate = rates[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t estimatePrintMillis(uint32_t lines)
+{
+    PrintRate rate;
+    uint16_t perMinute = defaultLinesPerMinute;
+    if (measuredPrintRate(getPrinterSettings(), rate) && rate.linesPerMinute)
+    {
+        perMinute = rate.linesPerMinute;
+    }
+    return lines * 60000UL / perMinute;
+}
+
+void printCalibration()
+{
+    PrintJob job = {};
+    job.kind = CalibrationJob;
+    submitPrintJob(job);
+}
+
+// Waits for the reply to GS r. The printer handles it in order with the
+// pattern, so the reply marks the moment the last line left the head.
+static bool waitForStatus(Stream &port, uint32_t start, uint32_t timeoutMs)
+{
+    while (millis() - start < timeoutMs)
+    {
+        if (port.available())
+        {
+            while (port.available())
+            {
+                port.read();
+            }
+            return true;
+        }
+        delay(1);
+    }
+    return false;
+}
+
+static void reportRates(const PrintRate &measured)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%u lines/min %u B/s", measured.linesPerMinute, measured.bytesPerSecond);
+    printInfo("CALIB", text);
+
+    const PrintRate *fastest = nullptr;
+    for (uint8_t i = 0; i < rateCount; ++i)
+    {
+        if (!fastest || rates[i].linesPerMinute > fastest->linesPerMinute)
+        {
+            fastest = &rates[i];
+        }
+    }
+    if (fastest)
+    {
+        snprintf(text, sizeof(text), "dots=%u time=%u int=%u %u l/m", fastest->heatDots, fastest->heatTime,
+                 fastest->heatInterval, fastest->linesPerMinute);
+        printInfo("FASTEST", text);
+    }
+}
+
+// Prints a fixed full-width pattern with the current heat settings and times
+// it. Called with the printer locked; the lock is dropped while waiting. The end of printing comes from the GS r reply when the printer's TX line
+// is wired, otherwise from the UART draining under BUSY flow control. Without
+// either the printer just buffers the bytes and nothing meaningful is measured.
+void renderCalibration(ReceiptBuilder &receipt)
+{
+    const PrinterSettings &settings = getPrinterSettings();
+    char line[48];
+    snprintf(line, sizeof(line), "CAL dots=%u time=%u int=%u", settings.heatDots, settings.heatTime,
+             settings.heatInterval);
+    receipt.line(line);
+    for (uint8_t i = 0; i < patternLines; ++i)
+    {
+        // Rotating printable ASCII, like the library's test page, so every
+        // line has a similar dot count.
+        uint8_t n = 0;
+        for (; n < 32 && n < sizeof(line) - 1; ++n)
+        {
+            line[n] = ' ' + 1 + (i * 3 + n) % 94;
+        }
+        line[n] = '\0';
+        receipt.line(line);
+    }
+    receipt.command(0x1D, 'r', 1);
+
+    Stream &port = printerStream();
+    printer.timeoutWait();
+    while (port.available())
+    {
+        port.read();
+    }
+    uint32_t start = millis();
+    port.write(receipt.data(), receipt.size());
+    port.flush();
+    uint32_t drained = millis() - start;
+    uint32_t elapsed = 0;
+    if (printerStatusLine())
+    {
+        // Under BUSY the UART drains as the last line prints; without it the
+        // printer buffers the whole pattern, which can take as long as the
+        // default rate allows. Nothing else needs the port meanwhile, so let
+        // settings changes through.
+        uint32_t timeout = printerFlowControlled() ? drained + statusSlackMs
+                                                   : receipt.lines() * 60000UL / defaultLinesPerMinute + statusSlackMs;
+        unlockPrinter();
+        bool replied = waitForStatus(port, start, timeout);
+        lockPrinter();
+        if (replied)
+        {
+            elapsed = millis() - start;
+        }
+    }
+    if (!elapsed && printerFlowControlled())
+    {
+        elapsed = drained;
+    }
+    printer.feed(2);
+
+    if (!elapsed)
+    {
+        printInfo("CALIB", "needs printer TX or BUSY");
+        return;
+    }
+    PrintRate rate = {};
+    rate.heatDots = settings.heatDots;
+    rate.heatTime = settings.heatTime;
+    rate.heatInterval = settings.heatInterval;
+    rate.bytesPerSecond = receipt.size() * 1000UL / elapsed;
+    rate.linesPerMinute = receipt.lines() * 60000UL / elapsed;
+    storeRate(rate);
+    Serial.print("Calibration: ");
+    Serial.print(receipt.lines());
+    Serial.print(" lines in ");
+    Serial.print(elapsed);
+    Serial.print(" ms, UART drained in ");
+    Serial.print(drained);
+    Serial.println(" ms");
+    reportRates(rate);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include "PrinterControl.h"
+#include "ReceiptBuilder.h"
+
+// Measured throughput for one heat profile (heatDots/heatTime/heatInterval).
+struct PrintRate
+{
+    uint8_t heatDots;
+    uint8_t heatTime;
+    uint8_t heatInterval;
+    uint8_t reserved;
+    uint16_t bytesPerSecond;
+    uint16_t linesPerMinute;
+};
+
+static const uint8_t calibrationProfiles = 8;
+// Roughly what Adafruit_Thermal's worst-case dot timings allow; used until a
+// profile has been measured.
+static const uint16_t defaultLinesPerMinute = 80;
+
+void calibrationBegin();
+void printCalibration();
+void renderCalibration(ReceiptBuilder &receipt);
+bool measuredPrintRate(const PrinterSettings &settings, PrintRate &rate);
+uint32_t estimatePrintMillis(uint32_t lines);
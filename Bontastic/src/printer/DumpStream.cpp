@@ -0,0 +1,39 @@
+#include "DumpStream.h"
+
+size_t DumpStream::write(uint8_t c)
+{
+    row[rowLength++] = c;
+    if (rowLength == sizeof(row) || c == '\n')
+    {
+        flush();
+    }
+    return 1;
+}
+
+void DumpStream::flush()
+{
+    if (!rowLength)
+    {
+        return;
+    }
+    static const char hex[] = "0123456789ABCDEF";
+    char text[sizeof(row) * 3 + sizeof(row) + 6];
+    size_t n = 0;
+    text[n++] = '>';
+    text[n++] = ' ';
+    for (uint8_t i = 0; i < sizeof(row); ++i)
+    {
+        text[n++] = i < rowLength ? hex[row[i] >> 4] : ' ';
+        text[n++] = i < rowLength ? hex[row[i] & 0x0F] : ' ';
+        text[n++] = ' ';
+    }
+    text[n++] = '|';
+    for (uint8_t i = 0; i < rowLength; ++i)
+    {
+        text[n++] = row[i] >= 0x20 && row[i] < 0x7F ? (char)row[i] : '.';
+    }
+    text[n++] = '|';
+    text[n] = '\0';
+    console.println(text);
+    rowLength = 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Printer stand-in that records the ESC/POS byte stream as a hex dump on a
+// console port, one printed line (or 16 bytes) per row. Never has input, so
+// status requests simply time out.
+class DumpStream : public Stream
+{
+public:
+    explicit DumpStream(Print &out) : console(out) {}
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void flush() override;
+
+private:
+    Print &console;
+    uint8_t row[16];
+    uint8_t rowLength = 0;
+};
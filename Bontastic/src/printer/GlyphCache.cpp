@@ -0,0 +1,197 @@
+#include "GlyphCache.h"
+#include <string.h>
+#include "RasterText.h"
+#include "Transcoder.h"
+
+static const uint8_t asciiEsc = 0x1B;
+
+GlyphCache::GlyphCache() : downloadCount(0)
+{
+    clear();
+}
+
+void GlyphCache::clear()
+{
+    memset(codepoints, 0, sizeof(codepoints));
+    memset(lastUse, 0, sizeof(lastUse));
+    clock = 0;
+    batchStart = 1;
+}
+
+void GlyphCache::beginBatch()
+{
+    batchStart = clock + 1;
+}
+
+bool GlyphCache::pinned() const
+{
+    for (uint8_t slot = 0; slot < slotCount; ++slot)
+    {
+        if (isPinned(slot))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int GlyphCache::find(uint32_t cp) const
+{
+    for (int slot = 0; slot < slotCount; ++slot)
+    {
+        if (codepoints[slot] == cp)
+        {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+// ESC & y c1 c2 x d1..d(y*x), defining the single code c1 = c2.
+bool GlyphCache::define(uint8_t slot, uint32_t cp, GlyphSink sink)
+{
+    uint8_t code = firstCode + slot;
+    uint8_t command[6 + rasterCellWidth * rasterCellBytes] = {asciiEsc, '&', rasterCellBytes, code, code, rasterCellWidth};
+    if (!rasterGlyphCell(cp, command + 6))
+    {
+        return false;
+    }
+    sink(command, sizeof(command));
+    codepoints[slot] = cp;
+    downloadCount++;
+    return true;
+}
+
+bool GlyphCache::prepare(const uint8_t *utf8, size_t size, uint8_t codePage, GlyphSink sink)
+{
+    uint32_t pending[slotCount];
+    uint8_t pendingCount = 0;
+    uint32_t stamp = ++clock;
+    size_t i = 0;
+    while (i < size)
+    {
+        uint32_t cp;
+        i += decodeUtf8(utf8 + i, size - i, cp);
+        if (cp < 0x80 || codePageHas(cp, codePage))
+        {
+            continue;
+        }
+        // Characters the font lacks share the one box slot.
+        cp = rasterGlyphFor(cp);
+        if (!cp)
+        {
+            continue;
+        }
+        int slot = find(cp);
+        if (slot >= 0)
+        {
+            lastUse[slot] = stamp;
+            continue;
+        }
+        bool seen = false;
+        for (uint8_t k = 0; k < pendingCount && !seen; ++k)
+        {
+            seen = pending[k] == cp;
+        }
+        if (seen)
+        {
+            continue;
+        }
+        if (pendingCount == slotCount)
+        {
+            return false;
+        }
+        pending[pendingCount++] = cp;
+    }
+
+    // Slots stamped above hold glyphs this text uses, and pinned ones those
+    // of unsent text before it; both must stay.
+    uint8_t spare = 0;
+    for (uint8_t slot = 0; slot < slotCount; ++slot)
+    {
+        spare += !isPinned(slot);
+    }
+    if (pendingCount > spare)
+    {
+        return false;
+    }
+    for (uint8_t k = 0; k < pendingCount; ++k)
+    {
+        uint8_t victim = 0;
+        uint32_t oldest = UINT32_MAX;
+        for (uint8_t slot = 0; slot < slotCount; ++slot)
+        {
+            if (!isPinned(slot) && lastUse[slot] < oldest)
+            {
+                oldest = lastUse[slot];
+                victim = slot;
+            }
+        }
+        codepoints[victim] = 0;
+        lastUse[victim] = stamp;
+        define(victim, pending[k], sink);
+    }
+    return true;
+}
+
+size_t GlyphCache::transcode(const uint8_t *utf8, size_t size, uint8_t codePage, uint8_t *out,
+                             size_t capacity) const
+{
+    static const size_t switchSize = 3;
+    if (capacity < switchSize)
+    {
+        return 0;
+    }
+    // Keep room to switch the user-defined set back off at the end.
+    size_t limit = capacity - switchSize;
+    size_t written = 0;
+    bool userSet = false;
+    size_t i = 0;
+    while (i < size && written < limit)
+    {
+        uint32_t cp;
+        size_t length = decodeUtf8(utf8 + i, size - i, cp);
+        uint32_t glyph = cp >= 0x80 && !codePageHas(cp, codePage) ? rasterGlyphFor(cp) : 0;
+        int slot = glyph ? find(glyph) : -1;
+        // Undefined codes print the ROM glyph even with the user set on, so
+        // blanks between cached characters need no switching.
+        bool blank = cp == ' ' || cp == '\t' || cp == '\n';
+        if (slot >= 0 || (userSet && !blank))
+        {
+            if (written + switchSize + 1 > limit)
+            {
+                break;
+            }
+            if (slot >= 0 && !userSet)
+            {
+                out[written++] = asciiEsc;
+                out[written++] = '%';
+                out[written++] = 1;
+                userSet = true;
+            }
+            else if (slot < 0)
+            {
+                out[written++] = asciiEsc;
+                out[written++] = '%';
+                out[written++] = 0;
+                userSet = false;
+            }
+        }
+        if (slot >= 0)
+        {
+            out[written++] = firstCode + slot;
+        }
+        else
+        {
+            written += transcodeUtf8(utf8 + i, length, codePage, out + written, limit - written);
+        }
+        i += length;
+    }
+    if (userSet)
+    {
+        out[written++] = asciiEsc;
+        out[written++] = '%';
+        out[written++] = 0;
+    }
+    return written;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Receives ESC & definitions; they must reach the printer before the text
+// that uses them.
+typedef void (*GlyphSink)(const uint8_t *bytes, size_t size);
+
+// Tracks which raster-font glyphs are resident in the printer's
+// user-defined character slots so text that keeps repeating non-ROM
+// characters (a group chatting in Greek) costs one byte per character
+// instead of a bitmap band. Slots are recycled least recently used first.
+// Cells are font A sized, so the cache is only usable with font A.
+class GlyphCache
+{
+public:
+    GlyphCache();
+
+    // Forgets every slot; the printer drops its definitions on ESC @.
+    void clear();
+    // Pins every glyph prepared from now on until the next batch, so a
+    // later prepare cannot redefine a slot text still waiting to be sent
+    // refers to. Called when a receipt starts.
+    void beginBatch();
+    // True when the current batch holds any slot.
+    bool pinned() const;
+    // Makes every character of text the code page lacks resident, as its
+    // raster font glyph or as the shared box, downloading missing ones
+    // through sink. Returns false, before sending anything, when the text
+    // needs more glyphs than fit beside the pinned ones.
+    bool prepare(const uint8_t *utf8, size_t size, uint8_t codePage, GlyphSink sink);
+    // transcodeUtf8 that prints resident glyphs from their slots, switching
+    // the user-defined set on (ESC % 1) only around them.
+    size_t transcode(const uint8_t *utf8, size_t size, uint8_t codePage, uint8_t *out, size_t capacity) const;
+
+    uint32_t downloads() const { return downloadCount; }
+
+private:
+    static const uint8_t firstCode = 0x21;
+    static const uint8_t slotCount = 0x7F - firstCode;
+
+    int find(uint32_t cp) const;
+    bool isPinned(uint8_t slot) const { return lastUse[slot] >= batchStart; }
+    bool define(uint8_t slot, uint32_t cp, GlyphSink sink);
+
+    uint32_t codepoints[slotCount];
+    uint32_t lastUse[slotCount];
+    uint32_t clock;
+    // First stamp of the current batch; slots used since are pinned.
+    uint32_t batchStart;
+    uint32_t downloadCount;
+};
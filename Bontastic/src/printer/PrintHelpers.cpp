@@ -1,107 +1,381 @@
 #include "PrintHelpers.h"
 #include "Adafruit_Thermal.h"
+#include "Calibration.h"
+#include "DumpStream.h"
 #include "PrinterControl.h"
+#include "PrintQueue.h"
+#include "GlyphCache.h"
+#include "QrRaster.h"
+#include "RasterText.h"
+#include "ReceiptBuilder.h"
+#include <freertos/semphr.h>
 #include <time.h>
 
-Adafruit_Thermal printer(&Serial2);
+#if PRINTER_DRY_RUN
+static DumpStream printerPort(Serial);
+static bool discardJobs;
+#else
+static HardwareSerial &printerPort = Serial2;
+#endif
 
-void updatePrinterPins(int rx, int tx)
+Adafruit_Thermal printer(&printerPort);
+
+static SemaphoreHandle_t printerMutex;
+static ReceiptBuilder receipt;
+static GlyphCache glyphCache;
+
+// Mechanism timings matching Adafruit_Thermal's defaults, used to pace a
+// receipt that bypasses the library's per-byte write path.
+static const unsigned long dotPrintMicros = 30000;
+static const unsigned long dotFeedMicros = 2100;
+static unsigned long byteMicros = (11UL * 1000000UL + 9600 / 2) / 9600;
+// Set when the printer's BUSY line drives the UART's CTS input; the
+// hardware then holds transmission while the mechanism catches up.
+static bool flowControlled;
+// Set when the printer's TX line reaches our RX pin, so GS r replies arrive.
+static bool statusLine;
+// Dots per QR module for native codes; a geo: URI is 29-33 modules wide.
+static const uint8_t qrModuleDots = 6;
+// Set when an alert cut a digest hold short; only the print task uses it.
+static bool digestFlushPending;
+
+void lockPrinter()
+{
+    if (printerMutex)
+    {
+        xSemaphoreTakeRecursive(printerMutex, portMAX_DELAY);
+    }
+}
+
+void unlockPrinter()
+{
+    if (printerMutex)
+    {
+        xSemaphoreGiveRecursive(printerMutex);
+    }
+}
+
+// The baud rate must match the one the printer was configured for (self-test
+// page / DIP switches); ESC/POS has no command to change it from the host.
+void updatePrinterPort(const PrinterSettings &settings)
 {
+    uint8_t baudIndex = settings.printerBaud < printerBaudCount ? settings.printerBaud : 0;
+    uint32_t baud = printerBaudRates[baudIndex];
+
+    lockPrinter();
+#if !PRINTER_DRY_RUN
     Serial2.end();
-    Serial2.begin(9600, SERIAL_8N1, rx, tx);
+    // Large enough to hold a whole receipt so the burst never blocks on the FIFO.
+    Serial2.setTxBufferSize(receiptCapacity);
+    int8_t rxPin = settings.printerRxPin ? settings.printerRxPin : -1;
+    Serial2.begin(baud, SERIAL_8N1, rxPin, settings.printerTxPin);
+    statusLine = settings.printerRxPin != 0;
+    flowControlled = false;
+    if (settings.printerBusyPin)
+    {
+        // BUSY is high while the printer cannot accept data, which matches
+        // the UART's active-low CTS: transmission pauses while it is high.
+        flowControlled = Serial2.setPins(rxPin, settings.printerTxPin, settings.printerBusyPin, -1) &&
+                         Serial2.setHwFlowCtrlMode(UART_HW_FLOWCTRL_CTS);
+        if (!flowControlled)
+        {
+            Serial.println("Printer BUSY flow control unavailable");
+        }
+    }
+#endif
+    byteMicros = (11UL * 1000000UL + baud / 2) / baud;
     printer.begin();
+    glyphCache.clear();
+    if (flowControlled || PRINTER_DRY_RUN)
+    {
+        // Let BUSY (or nothing, in a dry run) pace the library's own writes.
+        printer.setTimes(0, 0);
+    }
+    unlockPrinter();
+}
+
+bool printerFlowControlled()
+{
+    return flowControlled;
+}
+
+bool printerStatusLine()
+{
+    return statusLine;
+}
+
+Stream &printerStream()
+{
+    return printerPort;
 }
 
 void printerSetup()
 {
+    if (!printerMutex)
+    {
+        printerMutex = xSemaphoreCreateRecursiveMutex();
+    }
+    calibrationBegin();
+    printQueueBegin();
     const PrinterSettings &settings = getPrinterSettings();
-    updatePrinterPins(settings.printerRxPin, settings.printerTxPin);
+    updatePrinterPort(settings);
+    lockPrinter();
     printer.print(F("Bontastic Printer Ready"));
     printer.feed(2);
+    unlockPrinter();
 }
 
-std::string utf8ToIso88591(const std::string &utf8)
+#if PRINTER_DRY_RUN
+void printerDiscardJobs(bool discard)
 {
-    std::string iso;
-    iso.reserve(utf8.size());
-    for (size_t i = 0; i < utf8.size(); ++i)
+    discardJobs = discard;
+}
+#endif
+
+static void queueJob(const PrintJob &job)
+{
+#if PRINTER_DRY_RUN
+    if (discardJobs)
     {
-        uint8_t c = utf8[i];
-        if (c < 0x80)
+        return;
+    }
+#endif
+    submitPrintJob(job);
+}
+
+static void copyLabel(PrintJob &job, const char *label)
+{
+    strlcpy(job.label, label ? label : "", sizeof(job.label));
+}
+
+static void copyText(PrintJob &job, const uint8_t *data, size_t size)
+{
+    if (size > sizeof(job.text))
+    {
+        size = sizeof(job.text);
+    }
+    memcpy(job.text, data, size);
+    job.length = size;
+}
+
+void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp,
+                      PrintPriority priority)
+{
+    Serial.write(data, size);
+    Serial.println();
+
+    PrintJob job = {};
+    job.kind = TextJob;
+    job.priority = priority;
+    job.timestamp = timestamp;
+    copyLabel(job, sender);
+    copyText(job, data, size);
+    queueJob(job);
+}
+
+static uint8_t receiptColumns()
+{
+    const PrinterSettings &settings = getPrinterSettings();
+    uint8_t columns = settings.font ? 42 : 32;
+    if (settings.size == 2 || (settings.decorations & 0x08))
+    {
+        columns /= 2;
+    }
+    return columns;
+}
+
+// Glyphs the receipt's text uses stay pinned in the cache until it is sent.
+static void beginReceipt()
+{
+    receipt.reset(receiptColumns());
+    glyphCache.beginBatch();
+}
+
+static unsigned long receiptMicros(const ReceiptBuilder &built)
+{
+    if (flowControlled || PRINTER_DRY_RUN)
+    {
+        return 0;
+    }
+    const PrinterSettings &settings = getPrinterSettings();
+    unsigned long charHeight = settings.font ? 17 : 24;
+    if (settings.size > 0)
+    {
+        charHeight *= 2;
+    }
+    unsigned long lineSpacing = settings.lineHeight > 24 ? settings.lineHeight - 24 : 0;
+    return built.size() * byteMicros +
+           built.lines() * (charHeight * dotPrintMicros + lineSpacing * dotFeedMicros) +
+           built.feeds() * charHeight * dotFeedMicros;
+}
+
+// Hands the composed receipt to the UART in one write, then tells the
+// library how long the mechanism needs before the next job may start. With
+// BUSY flow control the estimate is zero and the hardware paces the bytes.
+static void sendReceipt()
+{
+    if (receipt.truncated())
+    {
+        Serial.println("Receipt truncated");
+    }
+    printer.timeoutWait();
+    printerPort.write(receipt.data(), receipt.size());
+    printer.timeoutSet(receiptMicros(receipt));
+}
+
+static void sendBand(const uint8_t *bytes, size_t size, uint16_t rows, uint16_t feedRows)
+{
+    printer.timeoutWait();
+    printerPort.write(bytes, size);
+    printer.timeoutSet(flowControlled || PRINTER_DRY_RUN
+                           ? 0
+                           : size * byteMicros + rows * dotPrintMicros + feedRows * dotFeedMicros);
+}
+
+static void sendGlyph(const uint8_t *bytes, size_t size)
+{
+    sendBand(bytes, size, 0, 0);
+}
+
+// Adds message text to the receipt. Text the ROM code page cannot show is
+// printed through the glyph cache when its characters fit the user-defined
+// slots (font A only), otherwise with the raster font; the receipt so far
+// goes out first and a fresh one is started after the bands.
+static void appendBody(const uint8_t *text, size_t length)
+{
+    const PrinterSettings &settings = getPrinterSettings();
+    bool raster = settings.rasterMode == RasterAlways ||
+                  (settings.rasterMode == RasterAuto && rasterImproves(text, length, settings.codePage));
+    if (!raster)
+    {
+        receipt.utf8(text, length, settings.codePage).line();
+        return;
+    }
+    if (settings.rasterMode == RasterAuto && !settings.font)
+    {
+        bool cached = glyphCache.prepare(text, length, settings.codePage, sendGlyph);
+        if (!cached && glyphCache.pinned())
         {
-            iso += (char)c;
+            // Earlier text of this receipt (a digest) holds the slots this
+            // one needs; once it is out they can be redefined.
+            sendReceipt();
+            beginReceipt();
+            cached = glyphCache.prepare(text, length, settings.codePage, sendGlyph);
         }
-        else if ((c & 0xE0) == 0xC0) // 2-byte sequence
+        if (cached)
         {
-            if (i + 1 < utf8.size())
-            {
-                uint8_t c2 = utf8[i + 1];
-                if ((c2 & 0xC0) == 0x80)
-                {
-                    uint16_t cp = ((c & 0x1F) << 6) | (c2 & 0x3F);
-                    if (cp <= 0xFF)
-                    {
-                        iso += (char)cp;
-                    }
-                    else
-                    {
-                        iso += '?'; // Character not in ISO-8859-1
-                    }
-                    i++; // Skip next byte
-                }
-            }
+            receipt.utf8(text, length, settings.codePage, glyphCache).line();
+            return;
+        }
+    }
+    sendReceipt();
+    RasterStats before = rasterStats();
+    rasterizeText(text, length, sendBand);
+    const RasterStats &after = rasterStats();
+    Serial.print("Raster: ");
+    Serial.print(after.sentBytes - before.sentBytes);
+    Serial.print(" bytes, ");
+    Serial.print((after.rawBytes - before.rawBytes) - (after.sentBytes - before.sentBytes));
+    Serial.println(" saved");
+    beginReceipt();
+}
+
+// Adds a QR code of data to the receipt: the printer draws it from a few
+// dozen bytes when it supports GS ( k, otherwise it goes out as raster bands
+// between two receipts. Returns false when it could not be encoded.
+static bool appendQr(const uint8_t *data, size_t size)
+{
+    const PrinterSettings &settings = getPrinterSettings();
+    if (settings.nativeQr)
+    {
+        receipt.qrCode(data, size, qrModuleDots, settings.justify);
+        return !receipt.truncated();
+    }
+    char text[printJobTextSize + 1];
+    size = size < printJobTextSize ? size : printJobTextSize;
+    memcpy(text, data, size);
+    text[size] = '\0';
+    sendReceipt();
+    bool drawn = rasterizeQr(text, sendBand);
+    beginReceipt();
+    return drawn;
+}
+
+// First http(s) link in text, up to the next blank.
+static bool findUrl(const uint8_t *text, size_t length, size_t &start, size_t &size)
+{
+    for (size_t i = 0; i + 7 < length; ++i)
+    {
+        if (memcmp(text + i, "http://", 7) && (i + 8 > length || memcmp(text + i, "https://", 8)))
+        {
+            continue;
         }
-        else
+        size_t end = i;
+        while (end < length && text[end] > ' ')
         {
-            // 3+ byte sequences or invalid UTF-8, skip or replace
-            // For now, just ignore or maybe add '?'
-            // If we just skip, we might miss characters.
-            // But ISO-8859-1 only supports up to U+00FF.
-            // So 3-byte sequences (U+0800+) are definitely out.
+            end++;
         }
+        start = i;
+        size = end - i;
+        return true;
     }
-    return iso;
+    return false;
 }
 
-void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp)
+static void renderTextMessage(const PrintJob &job)
 {
-    Serial.write(data, size);
-    Serial.println();
-
     // Format time
-    time_t t = (time_t)timestamp;
+    time_t t = (time_t)job.timestamp;
     struct tm *tm = localtime(&t);
     char timeBuf[32];
     strftime(timeBuf, sizeof(timeBuf), "%Y-%m-%d %H:%M:%S", tm);
 
-    printer.println(F("----------------"));
-    printer.print(F("From: "));
-    printer.println(sender);
-    printer.print(F("Time: "));
-    printer.println(timeBuf);
+    uint8_t codePage = getPrinterSettings().codePage;
 
-    std::string utf8((const char *)data, size);
-    std::string iso = utf8ToIso88591(utf8);
-    printer.println(iso.c_str());
-    printer.println(F("----------------"));
-    printer.feed(2);
+    beginReceipt();
+    receipt.rule();
+    if (job.priority == PriorityAlert)
+    {
+        receipt.line("*** ALERT ***");
+    }
+    receipt.text("From: ").utf8((const uint8_t *)job.label, strlen(job.label), codePage).line();
+    receipt.text("Time: ").line(timeBuf);
+    appendBody(job.text, job.length);
+    size_t urlStart;
+    size_t urlSize;
+    if (findUrl(job.text, job.length, urlStart, urlSize))
+    {
+        appendQr(job.text + urlStart, urlSize);
+    }
+    receipt.rule();
+    receipt.feed(2);
+    sendReceipt();
 }
 
-void printPosition(double lat, double lon, int32_t alt)
+// alt is null when the report carries no altitude; the geo: URI then has
+// two coordinates.
+void printPosition(double lat, double lon, const int32_t *alt, const char *sender)
 {
     Serial.print("POS lat=");
     Serial.print(lat, 7);
     Serial.print(" lon=");
     Serial.print(lon, 7);
-    Serial.print(" alt=");
-    Serial.println(alt);
+    if (alt)
+    {
+        Serial.print(" alt=");
+        Serial.print(*alt);
+    }
+    Serial.println();
 
-    // printer.print("POS lat=");
-    // printer.print(lat, 7);
-    // printer.print(" lon=");
-    // printer.print(lon, 7);
-    // printer.print(" alt=");
-    // printer.println(alt);
+    char uri[64];
+    int length = alt ? snprintf(uri, sizeof(uri), "geo:%.6f,%.6f,%ld", lat, lon, (long)*alt)
+                     : snprintf(uri, sizeof(uri), "geo:%.6f,%.6f", lat, lon);
+
+    PrintJob job = {};
+    job.kind = PositionJob;
+    copyLabel(job, sender);
+    copyText(job, (const uint8_t *)uri, length);
+    queueJob(job);
 }
 
 void printNodeInfo(uint32_t num, const char *name)
@@ -111,10 +385,20 @@ void printNodeInfo(uint32_t num, const char *name)
     Serial.print(" ");
     Serial.println(name);
 
-    printer.print("NODE ");
-    printer.print(num);
-    printer.print(" ");
-    printer.println(name);
+    PrintJob job = {};
+    job.kind = NodeInfoJob;
+    job.from = num;
+    copyLabel(job, name);
+    queueJob(job);
+}
+
+static void renderNodeInfo(const PrintJob &job)
+{
+    char line[24];
+    snprintf(line, sizeof(line), "NODE %lu ", (unsigned long)job.from);
+    beginReceipt();
+    receipt.text(line).utf8((const uint8_t *)job.label, strlen(job.label), getPrinterSettings().codePage).line();
+    sendReceipt();
 }
 
 void printBinaryPayload(const uint8_t *data, size_t size)
@@ -137,7 +421,296 @@ void printInfo(const char *label, const char *value)
     Serial.print(": ");
     Serial.println(value);
 
-    printer.print(label);
-    printer.print(": ");
-    printer.println(value);
+    PrintJob job = {};
+    job.kind = InfoJob;
+    copyLabel(job, label);
+    copyText(job, (const uint8_t *)value, strlen(value));
+    queueJob(job);
+}
+
+static void renderInfo(const PrintJob &job)
+{
+    beginReceipt();
+    receipt.text(job.label).text(": ");
+    receipt.append(job.text, job.length);
+    receipt.line();
+    sendReceipt();
+}
+
+// Text longer than one job is queued as consecutive parts, each ending at
+// its last line break where there is one, otherwise between two UTF-8
+// sequences; only the last part feeds the paper out.
+void printRawText(const std::string &utf8)
+{
+    const uint8_t *text = (const uint8_t *)utf8.data();
+    size_t left = utf8.size();
+    while (left)
+    {
+        PrintJob job = {};
+        job.kind = RawTextJob;
+        size_t size = left;
+        size_t next = left;
+        if (left > sizeof(job.text))
+        {
+            job.kind = RawTextPartJob;
+            size = sizeof(job.text);
+            while (size && (text[size] & 0xC0) == 0x80)
+            {
+                size--;
+            }
+            if (!size)
+            {
+                size = sizeof(job.text);
+            }
+            next = size;
+            for (size_t i = size; i > size / 2; --i)
+            {
+                if (text[i - 1] == '\n')
+                {
+                    // The receipt ends every part with a line break already.
+                    size = i - 1;
+                    next = i;
+                    break;
+                }
+            }
+        }
+        copyText(job, text, size);
+        queueJob(job);
+        text += next;
+        left -= next;
+    }
+}
+
+static void renderRawText(const PrintJob &job)
+{
+    beginReceipt();
+    appendBody(job.text, job.length);
+    if (job.kind == RawTextJob)
+    {
+        receipt.feed(2);
+    }
+    sendReceipt();
+}
+
+void printTelemetrySummary(uint32_t window, const char *name, uint16_t reports, const char *text, size_t size)
+{
+    Serial.print("Telemetry summary ");
+    Serial.print(name);
+    Serial.print(", ");
+    Serial.print(reports);
+    Serial.println(" reports");
+
+    char label[printJobLabelSize];
+    snprintf(label, sizeof(label), "%s (%u)", name, reports);
+
+    PrintJob job = {};
+    job.kind = TelemetryJob;
+    job.timestamp = window;
+    copyLabel(job, label);
+    copyText(job, (const uint8_t *)text, size);
+    queueJob(job);
+}
+
+// The text is ASCII lines already formatted by telemetrySummarize.
+static void appendTelemetry(const PrintJob &job)
+{
+    receipt.utf8((const uint8_t *)job.label, strlen(job.label), getPrinterSettings().codePage).line();
+    receipt.append(job.text, job.length);
+}
+
+static void beginTelemetry()
+{
+    beginReceipt();
+    receipt.rule();
+    receipt.line("Telemetry");
+    receipt.line("         min   mean    max");
+}
+
+static void renderTelemetry(const PrintJob &job)
+{
+    beginTelemetry();
+    appendTelemetry(job);
+    receipt.feed(2);
+    sendReceipt();
+}
+
+// Positions: the sender, a QR code of the geo: URI and the URI in clear.
+static void renderPosition(const PrintJob &job)
+{
+    beginReceipt();
+    receipt.rule();
+    receipt.text("Position: ").utf8((const uint8_t *)job.label, strlen(job.label), getPrinterSettings().codePage).line();
+    if (!appendQr(job.text, job.length))
+    {
+        Serial.println("QR encode failed");
+    }
+    receipt.append(job.text, job.length).line();
+    receipt.feed(2);
+    sendReceipt();
+}
+
+void printJob(const PrintJob &job)
+{
+    lockPrinter();
+    switch (job.kind)
+    {
+    case TextJob:
+        renderTextMessage(job);
+        break;
+    case NodeInfoJob:
+        renderNodeInfo(job);
+        break;
+    case InfoJob:
+        renderInfo(job);
+        break;
+    case RawTextJob:
+    case RawTextPartJob:
+        renderRawText(job);
+        break;
+    case CalibrationJob:
+        beginReceipt();
+        renderCalibration(receipt);
+        break;
+    case TelemetryJob:
+        renderTelemetry(job);
+        break;
+    case PositionJob:
+        renderPosition(job);
+        break;
+    default:
+        break;
+    }
+    unlockPrinter();
+}
+
+bool digestWanted(const PrintJob &job)
+{
+    return getPrinterSettings().digestWindow && job.kind == TextJob && job.priority == PriorityNormal;
+}
+
+// Holds first, the oldest normal text message, until the digest window since
+// it was queued runs out, digestCount jobs are waiting or an alert arrives.
+// Then prints the run of text messages at the head of the normal queue as
+// one receipt with a line header each and a single closing feed. Returns
+// how many jobs it printed, for completePrintJobs(); 0 when an alert is
+// waiting, which goes first while the messages stay queued. The held run
+// then prints as soon as the alerts are out, without holding again.
+size_t printDigest(const PrintJob &first)
+{
+    const PrinterSettings &settings = getPrinterSettings();
+    uint32_t window = settings.digestWindow * 1000UL;
+    while (!digestFlushPending)
+    {
+        uint32_t held = millis() - first.queuedAt;
+        // A stamp from before a reset reads as in the future; print at once.
+        if (held >= window || held > millis() || printQueueDepth(PriorityNormal) >= settings.digestCount ||
+            printQueueDepth(PriorityAlert))
+        {
+            break;
+        }
+        waitPrintQueue(pdMS_TO_TICKS(window - held));
+    }
+    if (printQueueDepth(PriorityAlert))
+    {
+        digestFlushPending = true;
+        return 0;
+    }
+    digestFlushPending = false;
+
+    lockPrinter();
+    uint8_t codePage = settings.codePage;
+    beginReceipt();
+    receipt.rule();
+    size_t count = 0;
+    PrintJob job;
+    while (count < settings.digestCount && peekPrintJob(PriorityNormal, count, job) && digestWanted(job))
+    {
+        // Leave the rest for the next digest rather than truncate one.
+        if (count && receipt.size() + job.length + printJobLabelSize + 16 > receiptCapacity)
+        {
+            break;
+        }
+        time_t t = (time_t)job.timestamp;
+        char timeBuf[8];
+        strftime(timeBuf, sizeof(timeBuf), "%H:%M ", localtime(&t));
+        receipt.text(timeBuf).utf8((const uint8_t *)job.label, strlen(job.label), codePage).text(": ");
+        appendBody(job.text, job.length);
+        count++;
+    }
+    if (!count)
+    {
+        unlockPrinter();
+        printJob(first);
+        return 1;
+    }
+    receipt.rule();
+    receipt.feed(2);
+    sendReceipt();
+    unlockPrinter();
+
+    Serial.print("Digest: ");
+    Serial.print(count);
+    Serial.println(" messages");
+    return count;
+}
+
+// Prints first and the telemetry summaries queued right behind it from the
+// same window as one receipt: a single header, then each node's name and
+// metric lines. Returns how many jobs it printed, for completePrintJobs().
+size_t printTelemetry(const PrintJob &first)
+{
+    lockPrinter();
+    beginTelemetry();
+    size_t count = 0;
+    PrintJob job;
+    while (peekPrintJob(first.priority, count, job) && job.kind == TelemetryJob && job.timestamp == first.timestamp)
+    {
+        // Leave the rest for a second receipt rather than truncate a node.
+        if (count && receipt.size() + job.length + printJobLabelSize + 16 > receiptCapacity)
+        {
+            break;
+        }
+        appendTelemetry(job);
+        count++;
+    }
+    if (!count)
+    {
+        unlockPrinter();
+        printJob(first);
+        return 1;
+    }
+    receipt.feed(2);
+    sendReceipt();
+    unlockPrinter();
+    return count;
+}
+
+// Printed lines a job will take, including its feeds; good enough to turn a
+// queue depth into a drain time with the calibrated lines per minute.
+uint16_t estimateJobLines(const PrintJob &job)
+{
+    uint8_t columns = receiptColumns();
+    uint16_t bodyLines = (job.length + columns - 1) / columns;
+    switch (job.kind)
+    {
+    case TextJob:
+        return 5 + (job.priority == PriorityAlert) + bodyLines + 2;
+    case NodeInfoJob:
+        return 1;
+    case InfoJob:
+        return (strlen(job.label) + 2 + job.length) / columns + 1;
+    case RawTextJob:
+        return bodyLines + 2;
+    case RawTextPartJob:
+        return bodyLines;
+    case CalibrationJob:
+        return 20;
+    case TelemetryJob:
+        // One node's share; the header and feeds are shared by the window.
+        return 1 + job.length / 27;
+    case PositionJob:
+        return 2 + qrModuleDots * 37 / 24 + 3;
+    default:
+        return 0;
+    }
 }
@@ -2,12 +2,40 @@
 
 #include <Arduino.h>
 #include <string>
+#include "PrintJob.h"
+#include "PrinterControl.h"
 
-void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp);
-void printPosition(double lat, double lon, int32_t alt);
+// Set to 1 to run the whole decode/print path without a printer: the byte
+// stream that would go to Serial2 is hex-dumped on the console instead.
+// Set it in build_opt.h next to the sketch (-DPRINTER_DRY_RUN=1), or with
+// -DPRINTER_DRY_RUN=ON for the host build.
+#ifndef PRINTER_DRY_RUN
+#define PRINTER_DRY_RUN 0
+#endif
+
+#if PRINTER_DRY_RUN
+// Drops jobs instead of queueing them while set, so the decode benchmark can
+// drive the sketch's real packet handler without printing anything.
+void printerDiscardJobs(bool discard);
+#endif
+
+void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp,
+                      PrintPriority priority = PriorityNormal);
+void printPosition(double lat, double lon, const int32_t *alt, const char *sender);
 void printNodeInfo(uint32_t num, const char *name);
 void printBinaryPayload(const uint8_t *data, size_t size);
 void printInfo(const char *label, const char *value);
+void printRawText(const std::string &utf8);
+void printTelemetrySummary(uint32_t window, const char *name, uint16_t reports, const char *text, size_t size);
+void printJob(const PrintJob &job);
+bool digestWanted(const PrintJob &job);
+size_t printDigest(const PrintJob &first);
+size_t printTelemetry(const PrintJob &first);
+uint16_t estimateJobLines(const PrintJob &job);
 void printerSetup();
-void updatePrinterPins(int rx, int tx);
-std::string utf8ToIso88591(const std::string &utf8);
+void updatePrinterPort(const PrinterSettings &settings);
+bool printerFlowControlled();
+bool printerStatusLine();
+Stream &printerStream();
+void lockPrinter();
+void unlockPrinter();
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum PrintJobKind : uint8_t
+{
+    TextJob,
+    NodeInfoJob,
+    InfoJob,
+    RawTextJob,
+    CalibrationJob,
+    TelemetryJob,
+    PositionJob,
+    RawTextPartJob // a RawTextJob more text follows: no closing feed
+};
+
+enum PrintPriority : uint8_t
+{
+    PriorityNormal,
+    PriorityAlert, // alert and detection-sensor traffic, printed first
+    PriorityCount
+};
+
+static const size_t printJobLabelSize = 40;
+static const size_t printJobTextSize = 256;
+
+// Everything the printer task needs to render one receipt, copied out of the
+// decoder so the source frame can be released immediately.
+struct PrintJob
+{
+    uint8_t kind;
+    uint8_t priority;
+    uint16_t length;
+    uint32_t from;
+    uint32_t timestamp;
+    uint32_t queuedAt; // millis() at submit, for print latency
+    char label[printJobLabelSize];
+    uint8_t text[printJobTextSize];
+};
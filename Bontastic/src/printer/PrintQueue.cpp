@@ -0,0 +1,237 @@
+#include "PrintQueue.h"
+#include <freertos/semphr.h>
+#include "Calibration.h"
+#include "PrintHelpers.h"
+#include "SpoolQueue.h"
+
+// One journal per PrintPriority; the normal class keeps the original files.
+static const char *const spoolJournalPaths[PriorityCount] = {"/spool.bin", "/alert.bin"};
+static const char *const spoolCursorPaths[PriorityCount] = {"/spool.cur", "/alert.cur"};
+
+static SpoolQueue spools[PriorityCount];
+static PrintLatency latency[PriorityCount];
+// Class of the job takePrintJob last handed out, popped by completePrintJob.
+static uint8_t takenPriority;
+static SemaphoreHandle_t spoolMutex;
+static SemaphoreHandle_t spoolReady;
+// Estimated printed lines still in the spool, for drain-time estimates.
+static uint32_t pendingLines;
+
+void printQueueBegin()
+{
+    if (spoolMutex)
+    {
+        return;
+    }
+    spoolMutex = xSemaphoreCreateMutex();
+    spoolReady = xSemaphoreCreateBinary();
+    bool queued = false;
+    for (uint8_t priority = 0; priority < PriorityCount; ++priority)
+    {
+        SpoolQueue &spool = spools[priority];
+        spool.begin(spoolJournalPaths[priority], spoolCursorPaths[priority]);
+        PrintJob job;
+        for (size_t i = 0; i < spool.size() && spool.peek(i, job); ++i)
+        {
+            pendingLines += estimateJobLines(job);
+        }
+        queued |= spool.size() > 0;
+    }
+    if (queued)
+    {
+        xSemaphoreGive(spoolReady);
+    }
+}
+
+static size_t queuedJobs()
+{
+    size_t depth = 0;
+    for (SpoolQueue &spool : spools)
+    {
+        depth += spool.size();
+    }
+    return depth;
+}
+
+bool submitPrintJob(const PrintJob &job)
+{
+    if (!spoolMutex)
+    {
+        return false;
+    }
+    // Flash is the only thing a producer can wait on here, never paper.
+    PrintJob queuedJob = job;
+    if (queuedJob.priority >= PriorityCount)
+    {
+        queuedJob.priority = PriorityNormal;
+    }
+    queuedJob.queuedAt = millis();
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    bool queued = spools[queuedJob.priority].push(queuedJob);
+    if (queued)
+    {
+        pendingLines += estimateJobLines(queuedJob);
+    }
+    size_t depth = queuedJobs();
+    xSemaphoreGive(spoolMutex);
+    if (!queued)
+    {
+        Serial.println("Print spool full, job dropped");
+        return false;
+    }
+    if (depth > 1)
+    {
+        Serial.print("Print spool ");
+        Serial.print(depth);
+        Serial.print(" jobs, ~");
+        Serial.print(printQueueDrainMillis() / 1000);
+        Serial.println(" s to drain");
+    }
+    xSemaphoreGive(spoolReady);
+    return true;
+}
+
+static void recordLatency(const PrintJob &job)
+{
+    PrintLatency &stats = latency[takenPriority];
+    uint32_t waited = millis() - job.queuedAt;
+    // Jobs replayed from the journal after a reset carry a stale stamp.
+    if (waited > millis())
+    {
+        return;
+    }
+    stats.jobs++;
+    stats.totalMillis += waited;
+    stats.maxMillis = waited > stats.maxMillis ? waited : stats.maxMillis;
+    if (takenPriority != PriorityNormal || waited > 1000)
+    {
+        Serial.print("Print wait ");
+        Serial.print(takenPriority == PriorityAlert ? "alert " : "normal ");
+        Serial.print(waited);
+        Serial.print(" ms, avg ");
+        Serial.print(stats.totalMillis / stats.jobs);
+        Serial.print(", max ");
+        Serial.println(stats.maxMillis);
+    }
+}
+
+// Returns the oldest job of the most urgent class without removing it;
+// completePrintJob() removes it once it is on paper, so a reset mid-print
+// prints it again. Classes are checked at every job boundary, so an alert
+// goes next however long the normal backlog is.
+bool takePrintJob(PrintJob &job, TickType_t wait)
+{
+    if (!spoolMutex)
+    {
+        return false;
+    }
+    while (true)
+    {
+        xSemaphoreTake(spoolMutex, portMAX_DELAY);
+        bool found = false;
+        for (uint8_t priority = PriorityCount; priority-- > 0 && !found;)
+        {
+            found = spools[priority].peek(0, job);
+            takenPriority = priority;
+        }
+        xSemaphoreGive(spoolMutex);
+        if (found)
+        {
+            return true;
+        }
+        if (xSemaphoreTake(spoolReady, wait) != pdTRUE)
+        {
+            return false;
+        }
+    }
+}
+
+void completePrintJob()
+{
+    completePrintJobs(1);
+}
+
+// Removes the first count jobs of the class takePrintJob last served and
+// records how long each waited, so jobs held for a digest count too and a
+// job taken but not printed yet does not.
+void completePrintJobs(size_t count)
+{
+    if (!spoolMutex)
+    {
+        return;
+    }
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    SpoolQueue &spool = spools[takenPriority];
+    PrintJob job;
+    while (count-- && spool.peek(0, job))
+    {
+        uint16_t lines = estimateJobLines(job);
+        pendingLines = pendingLines > lines ? pendingLines - lines : 0;
+        spool.pop();
+        recordLatency(job);
+    }
+    if (!queuedJobs())
+    {
+        // Settings changes skew the per-job estimates; start clean.
+        pendingLines = 0;
+    }
+    xSemaphoreGive(spoolMutex);
+}
+
+bool peekPrintJob(uint8_t priority, size_t index, PrintJob &job)
+{
+    if (!spoolMutex || priority >= PriorityCount)
+    {
+        return false;
+    }
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    bool found = spools[priority].peek(index, job);
+    xSemaphoreGive(spoolMutex);
+    return found;
+}
+
+size_t printQueueDepth(uint8_t priority)
+{
+    if (!spoolMutex || priority >= PriorityCount)
+    {
+        return 0;
+    }
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    size_t depth = spools[priority].size();
+    xSemaphoreGive(spoolMutex);
+    return depth;
+}
+
+// Blocks until a job is submitted or wait runs out.
+void waitPrintQueue(TickType_t wait)
+{
+    if (spoolReady)
+    {
+        xSemaphoreTake(spoolReady, wait);
+    }
+}
+
+// Journals whatever the spools hold only in RAM, for the idle path to call.
+void printQueueCheckpoint()
+{
+    if (!spoolMutex)
+    {
+        return;
+    }
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    for (SpoolQueue &spool : spools)
+    {
+        spool.checkpoint();
+    }
+    xSemaphoreGive(spoolMutex);
+}
+
+uint32_t printQueueDrainMillis()
+{
+    return estimatePrintMillis(pendingLines);
+}
+
+const PrintLatency &printQueueLatency(uint8_t priority)
+{
+    return latency[priority < PriorityCount ? priority : 0];
+}
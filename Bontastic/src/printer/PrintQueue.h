@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+#include "PrintJob.h"
+
+// Time from submit until printed of jobs completed so far, per PrintPriority.
+struct PrintLatency
+{
+    uint32_t jobs;
+    uint32_t totalMillis;
+    uint32_t maxMillis;
+};
+
+void printQueueBegin();
+bool submitPrintJob(const PrintJob &job);
+bool takePrintJob(PrintJob &job, TickType_t wait);
+void completePrintJob();
+void completePrintJobs(size_t count);
+bool peekPrintJob(uint8_t priority, size_t index, PrintJob &job);
+size_t printQueueDepth(uint8_t priority);
+void waitPrintQueue(TickType_t wait);
+void printQueueCheckpoint();
+uint32_t printQueueDrainMillis();
+const PrintLatency &printQueueLatency(uint8_t priority);
@@ -4,8 +4,11 @@
 #include <NimBLEDevice.h>
 #include <Preferences.h>
 #include <string>
+#include "Calibration.h"
 #include "PrintHelpers.h"
 #include "Adafruit_Thermal.h"
+#include "../pipeline/Pipeline.h"
+#include "../radio/FrameCapture.h"
 
 extern const char *localDeviceName;
 extern Adafruit_Thermal printer;
@@ -29,7 +32,16 @@ static const char *fieldUuids[] = {
     "5a1a0010-8f19-4a86-9a9e-7b4f7f9b0002",
     "5a1a0011-8f19-4a86-9a9e-7b4f7f9b0002",
     "5a1a0012-8f19-4a86-9a9e-7b4f7f9b0002",
-    "5a1a0013-8f19-4a86-9a9e-7b4f7f9b0002"};
+    "5a1a0013-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0014-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0015-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0016-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0017-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0018-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a0019-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001a-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001b-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001c-8f19-4a86-9a9e-7b4f7f9b0002"};
 
 enum SettingField : uint8_t
 {
@@ -51,6 +63,15 @@ enum SettingField : uint8_t
     MeshPin,
     PrinterRxPin,
     PrinterTxPin,
+    PrinterBusyPin,
+    PrinterBaud,
+    Calibrate,
+    Capture,
+    Replay,
+    RasterSelect,
+    NativeQr,
+    DigestWindow,
+    DigestCount,
     FieldCount
 };
 
@@ -58,7 +79,7 @@ static const uint16_t printerAppearance = 0x03C0;
 
 static NimBLEServer *printerServer;
 static NimBLECharacteristic *characteristics[FieldCount];
-static const PrinterSettings defaultSettings{11, 120, 40, 10, 2, 30, 0, 0, 0, 0, 0, 2, 23, "MO1_1dfd", "123456", 1, 2};
+static const PrinterSettings defaultSettings{11, 120, 40, 10, 2, 30, 0, 0, 0, 0, 0, 2, 23, "MO1_1dfd", "123456", 1, 2, 0, 0, 0, RasterAuto, 1, 0, 8};
 static PrinterSettings printerSettings = defaultSettings;
 static Preferences printerPrefs;
 static bool prefsReady;
@@ -103,6 +124,24 @@ static const char *fieldLabel(uint8_t field)
         return "PRINTER_RX";
     case PrinterTxPin:
         return "PRINTER_TX";
+    case PrinterBusyPin:
+        return "PRINTER_BUSY";
+    case PrinterBaud:
+        return "PRINTER_BAUD";
+    case Calibrate:
+        return "CALIBRATE";
+    case Capture:
+        return "CAPTURE";
+    case Replay:
+        return "REPLAY";
+    case RasterSelect:
+        return "RASTER";
+    case NativeQr:
+        return "NATIVE_QR";
+    case DigestWindow:
+        return "DIGEST_WINDOW";
+    case DigestCount:
+        return "DIGEST_COUNT";
     default:
         return nullptr;
     }
@@ -126,7 +165,16 @@ static const char *fieldKeys[] = {
     "meshName",
     "meshPin",
     "printerRxPin",
-    "printerTxPin"};
+    "printerTxPin",
+    "printerBusyPin",
+    "printerBaud",
+    nullptr,
+    "capture",
+    nullptr,
+    "rasterMode",
+    "nativeQr",
+    "digestWindow",
+    "digestCount"};
 
 static void *fieldSlot(uint8_t field);
 
@@ -235,7 +283,23 @@ static void *fieldSlot(uint8_t field)
         return &printerSettings.printerRxPin;
     case PrinterTxPin:
         return &printerSettings.printerTxPin;
+    case PrinterBusyPin:
+        return &printerSettings.printerBusyPin;
+    case PrinterBaud:
+        return &printerSettings.printerBaud;
+    case Capture:
+        return &printerSettings.capture;
+    case RasterSelect:
+        return &printerSettings.rasterMode;
+    case NativeQr:
+        return &printerSettings.nativeQr;
+    case DigestWindow:
+        return &printerSettings.digestWindow;
+    case DigestCount:
+        return &printerSettings.digestCount;
     case PrintText:
+    case Calibrate:
+    case Replay:
         return nullptr;
     default:
         return nullptr;
@@ -274,8 +338,22 @@ static uint16_t clampField(uint8_t field, int value)
         return constrain(value, 0, 47);
     case PrinterRxPin:
     case PrinterTxPin:
+    case PrinterBusyPin:
         return constrain(value, 0, 40);
+    case PrinterBaud:
+        return constrain(value, 0, printerBaudCount - 1);
+    case Capture:
+    case NativeQr:
+        return constrain(value, 0, 1);
+    case DigestWindow:
+        return constrain(value, 0, 255);
+    case DigestCount:
+        return constrain(value, 2, 16);
+    case Replay:
+    case RasterSelect:
+        return constrain(value, 0, 2);
     case PrintText:
+    case Calibrate:
         return 0;
     default:
         return value < 0 ? 0 : value;
@@ -338,6 +416,7 @@ static void logField(uint8_t field, uint16_t value)
 
 static void applyPrinterConfig()
 {
+    lockPrinter();
     printer.setHeatConfig(printerSettings.heatDots, printerSettings.heatTime, printerSettings.heatInterval);
     printer.setPrintDensity(printerSettings.density, printerSettings.breakTime);
     printer.setLineHeight(printerSettings.lineHeight);
@@ -382,6 +461,7 @@ static void applyPrinterConfig()
     {
         printer.doubleWidthOff();
     }
+    unlockPrinter();
 }
 
 static void applyFeed()
@@ -391,7 +471,9 @@ static void applyFeed()
     {
         return;
     }
+    lockPrinter();
     printer.feed(rows);
+    unlockPrinter();
     printerSettings.feedRows = 0;
     syncField(Feed, true);
 }
@@ -404,9 +486,12 @@ static void handleWrite(uint8_t field, const std::string &payload)
     }
     if (field == PrintText)
     {
-        std::string iso = utf8ToIso88591(payload);
-        printer.println(iso.c_str());
-        printer.feed(2);
+        printRawText(payload);
+        return;
+    }
+    if (field == Calibrate)
+    {
+        printCalibration();
         return;
     }
     if (field == MeshName || field == MeshPin)
@@ -422,6 +507,15 @@ static void handleWrite(uint8_t field, const std::string &payload)
 
     int value = atoi(payload.c_str());
     uint16_t clamped = clampField(field, value);
+    if (field == Replay)
+    {
+        // 1 replays the capture at recorded speed, 2 as fast as possible.
+        if (clamped)
+        {
+            pipelineReplay(clamped == 1);
+        }
+        return;
+    }
     if (field == Feed)
     {
         printerSettings.feedRows = static_cast<uint8_t>(clamped);
@@ -441,9 +535,22 @@ static void handleWrite(uint8_t field, const std::string &payload)
     }
     *slot = static_cast<uint8_t>(clamped);
     syncField(field, true);
-    if (field == PrinterRxPin || field == PrinterTxPin)
+    if (field == PrinterRxPin || field == PrinterTxPin || field == PrinterBusyPin || field == PrinterBaud)
     {
-        updatePrinterPins(printerSettings.printerRxPin, printerSettings.printerTxPin);
+        updatePrinterPort(printerSettings);
+        applyPrinterConfig();
+    }
+    else if (field == Capture)
+    {
+        if (printerSettings.capture)
+        {
+            // A new recording replaces the last one.
+            frameCaptureStart(false);
+        }
+        else
+        {
+            frameCaptureStop();
+        }
     }
     else
     {
@@ -503,6 +610,11 @@ void setupPrinterControl()
     service->start();
     loadSettings();
     applyPrinterConfig();
+    if (printerSettings.capture)
+    {
+        // Recording survives a reboot; this boot's frames follow the last.
+        frameCaptureStart(true);
+    }
     for (uint8_t i = 0; i < FieldCount; ++i)
     {
         syncField(i, false);
@@ -19,10 +19,27 @@ struct PrinterSettings
     uint8_t codePage;
     char meshName[32];
     char meshPin[16];
-    uint8_t printerRxPin;
+    uint8_t printerRxPin;   // 0 = printer TX not wired, no status replies
     uint8_t printerTxPin;
+    uint8_t printerBusyPin; // 0 = no BUSY line, pace by time estimate
+    uint8_t printerBaud;    // index into printerBaudRates
+    uint8_t capture;        // record raw FromRadio frames to flash
+    uint8_t rasterMode;     // RasterMode
+    uint8_t nativeQr;       // printer renders QR codes itself (GS ( k)
+    uint8_t digestWindow;   // seconds text messages are batched; 0 = off
+    uint8_t digestCount;    // messages that flush a digest early
 };
 
+enum RasterMode : uint8_t
+{
+    RasterAuto,  // raster font only for text the code page cannot show
+    RasterOff,   // always ROM text, transliterating what is missing
+    RasterAlways // always the raster font
+};
+
+static const uint32_t printerBaudRates[] = {9600, 19200, 38400, 57600, 115200};
+static const uint8_t printerBaudCount = sizeof(printerBaudRates) / sizeof(printerBaudRates[0]);
+
 void setupPrinterControl();
 void printerControlLoop();
 const PrinterSettings &getPrinterSettings();
@@ -0,0 +1,68 @@
+#include "QrRaster.h"
+#include <string.h>
+#include <qrcode.h>
+
+static const int quietModules = 4;
+static const int maxModuleDots = 6;
+static const int bandRows = 24;
+
+static uint8_t band[rasterHeaderSize + rasterRowBytes * bandRows];
+// esp_qrcode_generate's callback takes no context.
+static RasterSink qrSink;
+static bool qrDrawn;
+
+static void drawQr(esp_qrcode_handle_t qrcode)
+{
+    int modules = esp_qrcode_get_size(qrcode);
+    int scale = rasterWidth / (modules + 2 * quietModules);
+    if (scale > maxModuleDots)
+    {
+        scale = maxModuleDots;
+    }
+    if (scale < 1)
+    {
+        return;
+    }
+    int left = (rasterWidth - modules * scale) / 2;
+    int top = quietModules * scale;
+    int height = (modules + 2 * quietModules) * scale;
+    uint8_t *bitmap = band + rasterHeaderSize;
+    for (int bandTop = 0; bandTop < height; bandTop += bandRows)
+    {
+        int rows = height - bandTop < bandRows ? height - bandTop : bandRows;
+        memset(bitmap, 0, rasterRowBytes * bandRows);
+        for (int row = 0; row < rows; ++row)
+        {
+            int y = (bandTop + row - top) / scale;
+            if (bandTop + row < top || y >= modules)
+            {
+                continue;
+            }
+            uint8_t *line = bitmap + row * rasterRowBytes;
+            for (int x = 0; x < modules; ++x)
+            {
+                if (!esp_qrcode_get_module(qrcode, x, y))
+                {
+                    continue;
+                }
+                for (int dot = left + x * scale; dot < left + (x + 1) * scale; ++dot)
+                {
+                    line[dot / 8] |= 0x80 >> (dot % 8);
+                }
+            }
+        }
+        sendRasterBand(band, rows, qrSink);
+    }
+    qrDrawn = true;
+}
+
+bool rasterizeQr(const char *text, RasterSink sink)
+{
+    esp_qrcode_config_t config = {};
+    config.display_func = drawQr;
+    config.max_qrcode_version = 10;
+    config.qrcode_ecc_level = ESP_QRCODE_ECC_MED;
+    qrSink = sink;
+    qrDrawn = false;
+    return esp_qrcode_generate(&config, text) == ESP_OK && qrDrawn;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "RasterText.h"
+
+// Encodes text as a QR code on the ESP32 and sends it through sink as
+// centred raster bands, for printers without native GS ( k support. The
+// quiet zone is left to sendRasterBand, which turns it into paper feeds.
+// Returns false when the text does not fit a QR code.
+bool rasterizeQr(const char *text, RasterSink sink);
@@ -0,0 +1,5064 @@
+// Generated by tools/gen_font.c from /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf (DejaVu Sans Book, 20 px); do not edit.
+#pragma once
+
+#include <stdint.h>
+
+static const uint8_t rasterFontHeight = 24;
+static const uint8_t rasterFontBaseline = 19;
+
+struct RasterGlyph
+{
+    uint32_t codepoint;
+    uint8_t advance;
+    uint8_t width;
+    uint8_t height;
+    int8_t left;
+    int8_t top;
+    uint32_t offset;
+};
+
+// Sorted by code point.
+static const RasterGlyph rasterGlyphs[] = {
+    {0x0020, 6, 1, 1, 0, 18, 0},
+    {0x0021, 8, 2, 15, 3, 4, 0},
+    {0x0022, 10, 6, 5, 2, 4, 3},
+    {0x0023, 17, 14, 15, 2, 4, 9},
+    {0x0024, 13, 9, 18, 2, 4, 35},
+    {0x0025, 19, 17, 15, 0, 4, 60},
+    {0x0026, 15, 14, 15, 1, 4, 103},
+    {0x0027, 6, 2, 5, 2, 4, 129},
+    {0x0028, 8, 4, 18, 2, 4, 130},
+    {0x0029, 8, 4, 18, 2, 4, 148},
+    {0x002A, 10, 9, 10, 0, 4, 166},
+    {0x002B, 17, 12, 12, 2, 7, 184},
+    {0x002C, 6, 3, 5, 1, 17, 196},
+    {0x002D, 7, 5, 2, 1, 12, 200},
+    {0x002E, 6, 2, 2, 2, 17, 201},
+    {0x002F, 7, 7, 16, 0, 4, 202},
+    {0x0030, 13, 10, 15, 1, 4, 218},
+    {0x0031, 13, 9, 15, 2, 4, 238},
+    {0x0032, 13, 9, 15, 1, 4, 254},
+    {0x0033, 13, 10, 15, 1, 4, 270},
+    {0x0034, 13, 11, 15, 1, 4, 285},
+    {0x0035, 13, 9, 15, 1, 4, 308},
+    {0x0036, 13, 10, 15, 1, 4, 324},
+    {0x0037, 13, 10, 15, 1, 4, 343},
+    {0x0038, 13, 10, 15, 1, 4, 358},
+    {0x0039, 13, 10, 15, 1, 4, 377},
+    {0x003A, 7, 2, 10, 2, 9, 396},
+    {0x003B, 7, 3, 13, 1, 9, 398},
+    {0x003C, 17, 13, 11, 2, 7, 405},
+    {0x003D, 17, 13, 6, 2, 10, 416},
+    {0x003E, 17, 13, 11, 2, 7, 420},
+    {0x003F, 11, 8, 15, 1, 4, 431},
+    {0x0040, 20, 18, 18, 1, 4, 446},
+    {0x0041, 14, 13, 15, 0, 4, 485},
+    {0x0042, 14, 10, 15, 2, 4, 510},
+    {0x0043, 14, 12, 15, 1, 4, 530},
+    {0x0044, 15, 12, 15, 2, 4, 547},
+    {0x0045, 13, 9, 15, 2, 4, 566},
+    {0x0046, 12, 8, 15, 2, 4, 578},
+    {0x0047, 16, 13, 15, 1, 4, 592},
+    {0x0048, 15, 11, 15, 2, 4, 611},
+    {0x0049, 6, 2, 15, 2, 4, 626},
+    {0x004A, 6, 5, 19, -1, 4, 628},
+    {0x004B, 13, 12, 15, 2, 4, 646},
+    {0x004C, 11, 9, 15, 2, 4, 672},
+    {0x004D, 17, 13, 15, 2, 4, 687},
+    {0x004E, 15, 11, 15, 2, 4, 718},
+    {0x004F, 16, 14, 15, 1, 4, 741},
+    {0x0050, 12, 9, 15, 2, 4, 761},
+    {0x0051, 16, 14, 18, 1, 4, 776},
+    {0x0052, 14, 11, 15, 2, 4, 799},
+    {0x0053, 13, 10, 15, 1, 4, 825},
+    {0x0054, 12, 12, 15, 0, 4, 840},
+    {0x0055, 15, 11, 15, 2, 4, 855},
+    {0x0056, 14, 13, 15, 0, 4, 872},
+    {0x0057, 20, 18, 15, 1, 4, 899},
+    {0x0058, 14, 12, 15, 1, 4, 944},
+    {0x0059, 12, 12, 15, 0, 4, 969},
+    {0x005A, 14, 12, 15, 1, 4, 989},
+    {0x005B, 8, 4, 18, 2, 4, 1003},
+    {0x005C, 7, 7, 16, 0, 4, 1018},
+    {0x005D, 8, 4, 18, 2, 4, 1034},
+    {0x005E, 17, 13, 5, 2, 4, 1049},
+    {0x005F, 10, 10, 2, 0, 22, 1058},
+    {0x0060, 10, 5, 4, 1, 3, 1060},
+    {0x0061, 12, 9, 11, 1, 8, 1064},
+    {0x0062, 13, 10, 15, 2, 4, 1076},
+    {0x0063, 11, 9, 11, 1, 8, 1095},
+    {0x0064, 13, 10, 15, 1, 4, 1107},
+    {0x0065, 12, 10, 11, 1, 8, 1126},
+    {0x0066, 7, 7, 15, 0, 4, 1137},
+    {0x0067, 13, 10, 15, 1, 8, 1151},
+    {0x0068, 13, 9, 15, 2, 4, 1171},
+    {0x0069, 6, 2, 15, 2, 4, 1188},
+    {0x006A, 6, 4, 19, 0, 4, 1191},
+    {0x006B, 12, 10, 15, 2, 4, 1207},
+    {0x006C, 6, 2, 15, 2, 4, 1230},
+    {0x006D, 20, 16, 11, 2, 8, 1232},
+    {0x006E, 13, 9, 11, 2, 8, 1256},
+    {0x006F, 12, 10, 11, 1, 8, 1269},
+    {0x0070, 13, 10, 15, 2, 8, 1283},
+    {0x0071, 13, 10, 15, 1, 8, 1302},
+    {0x0072, 8, 6, 11, 2, 8, 1321},
+    {0x0073, 10, 8, 11, 1, 8, 1331},
+    {0x0074, 8, 7, 14, 1, 5, 1340},
+    {0x0075, 13, 9, 11, 2, 8, 1353},
+    {0x0076, 11, 11, 11, 0, 8, 1366},
+    {0x0077, 17, 15, 11, 1, 8, 1386},
+    {0x0078, 11, 11, 11, 0, 8, 1419},
+    {0x0079, 11, 11, 15, 0, 8, 1438},
+    {0x007A, 11, 9, 11, 1, 8, 1461},
+    {0x007B, 13, 8, 18, 3, 4, 1471},
+    {0x007C, 7, 2, 20, 3, 4, 1489},
+    {0x007D, 13, 8, 18, 2, 4, 1491},
+    {0x007E, 17, 13, 4, 2, 11, 1509},
+    {0x00A0, 6, 1, 1, 0, 18, 1513},
+    {0x00A1, 8, 2, 15, 3, 8, 1513},
+    {0x00A2, 13, 9, 17, 2, 5, 1516},
+    {0x00A3, 13, 9, 15, 2, 4, 1541},
+    {0x00A4, 13, 10, 10, 1, 8, 1557},
+    {0x00A5, 13, 12, 15, 0, 4, 1577},
+    {0x00A6, 7, 2, 17, 3, 5, 1598},
+    {0x00A7, 10, 8, 17, 1, 4, 1600},
+    {0x00A8, 10, 6, 2, 2, 4, 1621},
+    {0x00A9, 20, 14, 15, 3, 4, 1624},
+    {0x00AA, 9, 8, 10, 1, 4, 1659},
+    {0x00AB, 12, 10, 9, 2, 9, 1669},
+    {0x00AC, 17, 13, 6, 2, 11, 1687},
+    {0x00AD, 7, 5, 2, 1, 12, 1693},
+    {0x00AE, 20, 15, 15, 3, 4, 1694},
+    {0x00AF, 10, 6, 2, 2, 4, 1734},
+    {0x00B0, 10, 6, 6, 2, 4, 1735},
+    {0x00B1, 17, 12, 13, 3, 6, 1742},
+    {0x00B2, 8, 6, 8, 1, 4, 1754},
+    {0x00B3, 8, 6, 8, 1, 4, 1763},
+    {0x00B4, 10, 5, 4, 3, 3, 1770},
+    {0x00B5, 13, 10, 15, 2, 8, 1774},
+    {0x00B6, 13, 9, 17, 2, 4, 1798},
+    {0x00B7, 6, 2, 2, 2, 11, 1827},
+    {0x00B8, 10, 4, 4, 3, 19, 1828},
+    {0x00B9, 8, 5, 8, 2, 4, 1831},
+    {0x00BA, 9, 8, 10, 1, 4, 1839},
+    {0x00BB, 12, 10, 9, 2, 9, 1851},
+    {0x00BC, 19, 16, 15, 2, 4, 1869},
+    {0x00BD, 19, 16, 15, 2, 4, 1902},
+    {0x00BE, 19, 17, 15, 1, 4, 1934},
+    {0x00BF, 11, 8, 15, 1, 8, 1967},
+    {0x00C0, 14, 13, 19, 0, 0, 1982},
+    {0x00C1, 14, 13, 19, 0, 0, 2011},
+    {0x00C2, 14, 13, 19, 0, 0, 2040},
+    {0x00C3, 14, 13, 18, 0, 1, 2071},
+    {0x00C4, 14, 13, 19, 0, 0, 2101},
+    {0x00C5, 14, 13, 19, 0, 0, 2131},
+    {0x00C6, 20, 18, 15, 0, 4, 2163},
+    {0x00C7, 14, 12, 19, 1, 4, 2188},
+    {0x00C8, 13, 9, 19, 2, 0, 2209},
+    {0x00C9, 13, 9, 19, 2, 0, 2224},
+    {0x00CA, 13, 9, 19, 2, 0, 2239},
+    {0x00CB, 13, 9, 19, 2, 0, 2256},
+    {0x00CC, 6, 4, 19, 1, 0, 2272},
+    {0x00CD, 6, 4, 19, 2, 0, 2290},
+    {0x00CE, 6, 6, 19, 0, 0, 2308},
+    {0x00CF, 6, 6, 19, 0, 0, 2327},
+    {0x00D0, 15, 14, 15, 0, 4, 2345},
+    {0x00D1, 15, 11, 18, 2, 1, 2369},
+    {0x00D2, 16, 14, 19, 1, 0, 2396},
+    {0x00D3, 16, 14, 19, 1, 0, 2420},
+    {0x00D4, 16, 14, 19, 1, 0, 2444},
+    {0x00D5, 16, 14, 18, 1, 1, 2469},
+    {0x00D6, 16, 14, 19, 1, 0, 2494},
+    {0x00D7, 17, 11, 11, 3, 7, 2519},
+    {0x00D8, 16, 14, 15, 1, 4, 2538},
+    {0x00D9, 15, 11, 19, 2, 0, 2569},
+    {0x00DA, 15, 11, 19, 2, 0, 2590},
+    {0x00DB, 15, 11, 19, 2, 0, 2611},
+    {0x00DC, 15, 11, 19, 2, 0, 2633},
+    {0x00DD, 12, 12, 19, 0, 0, 2655},
+    {0x00DE, 12, 9, 15, 2, 4, 2679},
+    {0x00DF, 13, 10, 15, 2, 4, 2694},
+    {0x00E0, 12, 9, 16, 1, 3, 2720},
+    {0x00E1, 12, 9, 16, 1, 3, 2737},
+    {0x00E2, 12, 9, 16, 1, 3, 2754},
+    {0x00E3, 12, 9, 16, 1, 3, 2773},
+    {0x00E4, 12, 9, 15, 1, 4, 2793},
+    {0x00E5, 12, 9, 17, 1, 2, 2810},
+    {0x00E6, 19, 17, 11, 1, 8, 2830},
+    {0x00E7, 11, 9, 15, 1, 8, 2851},
+    {0x00E8, 12, 10, 16, 1, 3, 2867},
+    {0x00E9, 12, 10, 16, 1, 3, 2882},
+    {0x00EA, 12, 10, 16, 1, 3, 2897},
+    {0x00EB, 12, 10, 15, 1, 4, 2914},
+    {0x00EC, 6, 5, 16, -1, 3, 2929},
+    {0x00ED, 6, 5, 16, 1, 3, 2944},
+    {0x00EE, 6, 6, 16, 0, 3, 2959},
+    {0x00EF, 6, 6, 15, 0, 4, 2976},
+    {0x00F0, 12, 10, 15, 1, 4, 2990},
+    {0x00F1, 13, 9, 16, 2, 3, 3009},
+    {0x00F2, 12, 10, 16, 1, 3, 3030},
+    {0x00F3, 12, 10, 16, 1, 3, 3049},
+    {0x00F4, 12, 10, 16, 1, 3, 3068},
+    {0x00F5, 12, 10, 16, 1, 3, 3089},
+    {0x00F6, 12, 10, 15, 1, 4, 3111},
+    {0x00F7, 17, 12, 10, 2, 8, 3130},
+    {0x00F8, 12, 10, 13, 1, 7, 3137},
+    {0x00F9, 13, 9, 16, 2, 3, 3158},
+    {0x00FA, 13, 9, 16, 2, 3, 3175},
+    {0x00FB, 13, 9, 16, 2, 3, 3192},
+    {0x00FC, 13, 9, 15, 2, 4, 3212},
+    {0x00FD, 11, 11, 20, 0, 3, 3230},
+    {0x00FE, 13, 10, 19, 2, 4, 3258},
+    {0x00FF, 11, 11, 19, 0, 4, 3281},
+    {0x0100, 14, 13, 18, 0, 1, 3309},
+    {0x0101, 12, 9, 15, 1, 4, 3337},
+    {0x0102, 14, 13, 19, 0, 0, 3352},
+    {0x0103, 12, 9, 16, 1, 3, 3382},
+    {0x0104, 14, 14, 19, 0, 4, 3399},
+    {0x0105, 12, 10, 15, 1, 8, 3428},
+    {0x0106, 14, 12, 19, 1, 0, 3448},
+    {0x0107, 11, 9, 16, 1, 3, 3469},
+    {0x0108, 14, 12, 19, 1, 0, 3486},
+    {0x0109, 11, 9, 16, 1, 3, 3509},
+    {0x010A, 14, 12, 19, 1, 0, 3527},
+    {0x010B, 11, 9, 15, 1, 4, 3547},
+    {0x010C, 14, 12, 19, 1, 0, 3562},
+    {0x010D, 11, 9, 16, 1, 3, 3584},
+    {0x010E, 15, 12, 19, 2, 0, 3603},
+    {0x010F, 13, 14, 16, 1, 3, 3628},
+    {0x0110, 16, 14, 15, 0, 4, 3656},
+    {0x0111, 13, 12, 15, 1, 4, 3680},
+    {0x0112, 13, 9, 18, 2, 1, 3704},
+    {0x0113, 12, 10, 15, 1, 4, 3718},
+    {0x0114, 13, 9, 18, 2, 1, 3731},
+    {0x0115, 12, 10, 16, 1, 3, 3746},
+    {0x0116, 13, 9, 19, 2, 0, 3761},
+    {0x0117, 12, 10, 15, 1, 4, 3775},
+    {0x0118, 13, 10, 19, 2, 4, 3788},
+    {0x0119, 12, 10, 15, 1, 8, 3807},
+    {0x011A, 13, 9, 19, 2, 0, 3822},
+    {0x011B, 12, 10, 16, 1, 3, 3839},
+    {0x011C, 16, 13, 19, 1, 0, 3856},
+    {0x011D, 13, 10, 20, 1, 3, 3880},
+    {0x011E, 16, 13, 18, 1, 1, 3906},
+    {0x011F, 13, 10, 20, 1, 3, 3929},
+    {0x0120, 16, 13, 19, 1, 0, 3954},
+    {0x0121, 13, 10, 19, 1, 4, 3976},
+    {0x0122, 16, 13, 20, 1, 4, 3999},
+    {0x0123, 13, 10, 20, 1, 3, 4022},
+    {0x0124, 15, 11, 19, 2, 0, 4046},
+    {0x0125, 13, 11, 19, 0, 0, 4066},
+    {0x0126, 18, 15, 15, 2, 4, 4096},
+    {0x0127, 14, 10, 15, 1, 4, 4122},
+    {0x0128, 6, 6, 18, 0, 1, 4147},
+    {0x0129, 6, 6, 16, 0, 3, 4165},
+    {0x012A, 6, 6, 18, 0, 1, 4182},
+    {0x012B, 6, 6, 15, 0, 4, 4198},
+    {0x012C, 6, 6, 18, 0, 1, 4210},
+    {0x012D, 6, 6, 16, 0, 3, 4228},
+    {0x012E, 6, 4, 19, 1, 4, 4243},
+    {0x012F, 6, 4, 19, 1, 4, 4262},
+    {0x0130, 6, 2, 19, 2, 0, 4279},
+    {0x0131, 6, 2, 11, 2, 8, 4282},
+    {0x0132, 12, 8, 19, 2, 4, 4284},
+    {0x0133, 12, 8, 19, 2, 4, 4304},
+    {0x0134, 6, 7, 23, -1, 0, 4324},
+    {0x0135, 6, 6, 20, 0, 3, 4347},
+    {0x0136, 13, 12, 20, 2, 4, 4368},
+    {0x0137, 12, 10, 20, 2, 4, 4398},
+    {0x0138, 12, 10, 11, 2, 8, 4425},
+    {0x0139, 11, 9, 19, 2, 0, 4444},
+    {0x013A, 6, 4, 19, 2, 0, 4462},
+    {0x013B, 11, 9, 20, 2, 4, 4480},
+    {0x013C, 6, 3, 20, 1, 4, 4498},
+    {0x013D, 11, 9, 15, 2, 4, 4516},
+    {0x013E, 8, 6, 16, 2, 3, 4535},
+    {0x013F, 11, 9, 15, 2, 4, 4554},
+    {0x0140, 7, 5, 15, 2, 4, 4571},
+    {0x0141, 11, 11, 15, 0, 4, 4586},
+    {0x0142, 6, 6, 15, 0, 4, 4604},
+    {0x0143, 15, 11, 19, 2, 0, 4619},
+    {0x0144, 13, 9, 16, 2, 3, 4646},
+    {0x0145, 15, 11, 20, 2, 4, 4663},
+    {0x0146, 13, 9, 16, 2, 8, 4690},
+    {0x0147, 15, 11, 19, 2, 0, 4707},
+    {0x0148, 13, 9, 16, 2, 3, 4736},
+    {0x0149, 16, 12, 15, 2, 4, 4756},
+    {0x014A, 15, 11, 19, 2, 4, 4783},
+    {0x014B, 13, 9, 15, 2, 8, 4806},
+    {0x014C, 16, 14, 18, 1, 1, 4823},
+    {0x014D, 12, 10, 15, 1, 4, 4846},
+    {0x014E, 16, 14, 18, 1, 1, 4863},
+    {0x014F, 12, 10, 16, 1, 3, 4887},
+    {0x0150, 16, 14, 19, 1, 0, 4906},
+    {0x0151, 12, 11, 16, 1, 3, 4933},
+    {0x0152, 21, 19, 15, 1, 4, 4960},
+    {0x0153, 20, 18, 11, 1, 8, 4985},
+    {0x0154, 14, 11, 19, 2, 0, 5005},
+    {0x0155, 8, 7, 16, 2, 3, 5035},
+    {0x0156, 14, 11, 20, 2, 4, 5051},
+    {0x0157, 8, 7, 16, 1, 8, 5081},
+    {0x0158, 14, 11, 19, 2, 0, 5097},
+    {0x0159, 8, 6, 16, 2, 3, 5129},
+    {0x015A, 13, 10, 19, 1, 0, 5145},
+    {0x015B, 10, 8, 16, 1, 3, 5164},
+    {0x015C, 13, 10, 19, 1, 0, 5177},
+    {0x015D, 10, 8, 16, 1, 3, 5196},
+    {0x015E, 13, 10, 19, 1, 4, 5211},
+    {0x015F, 10, 8, 15, 1, 8, 5230},
+    {0x0160, 13, 10, 19, 1, 0, 5243},
+    {0x0161, 10, 8, 16, 1, 3, 5263},
+    {0x0162, 12, 12, 19, 0, 4, 5278},
+    {0x0163, 8, 7, 18, 1, 5, 5297},
+    {0x0164, 12, 12, 19, 0, 0, 5314},
+    {0x0165, 8, 7, 17, 1, 2, 5333},
+    {0x0166, 12, 12, 15, 0, 4, 5350},
+    {0x0167, 8, 7, 14, 1, 5, 5365},
+    {0x0168, 15, 11, 18, 2, 1, 5377},
+    {0x0169, 13, 9, 16, 2, 3, 5398},
+    {0x016A, 15, 11, 18, 2, 1, 5419},
+    {0x016B, 13, 9, 15, 2, 4, 5438},
+    {0x016C, 15, 11, 18, 2, 1, 5454},
+    {0x016D, 13, 9, 16, 2, 3, 5475},
+    {0x016E, 15, 11, 18, 2, 1, 5493},
+    {0x016F, 13, 9, 16, 2, 3, 5518},
+    {0x0170, 15, 11, 19, 2, 0, 5539},
+    {0x0171, 13, 10, 16, 2, 3, 5563},
+    {0x0172, 15, 11, 19, 2, 4, 5592},
+    {0x0173, 13, 10, 15, 2, 8, 5613},
+    {0x0174, 20, 18, 19, 1, 0, 5638},
+    {0x0175, 17, 15, 16, 1, 3, 5688},
+    {0x0176, 12, 12, 19, 0, 0, 5729},
+    {0x0177, 11, 11, 20, 0, 3, 5754},
+    {0x0178, 12, 12, 19, 0, 0, 5784},
+    {0x0179, 14, 12, 19, 1, 0, 5809},
+    {0x017A, 11, 9, 16, 1, 3, 5827},
+    {0x017B, 14, 12, 19, 1, 0, 5841},
+    {0x017C, 11, 9, 15, 1, 4, 5858},
+    {0x017D, 14, 12, 19, 1, 0, 5871},
+    {0x017E, 11, 9, 16, 1, 3, 5891},
+    {0x017F, 7, 7, 15, 0, 4, 5908},
+    {0x0218, 13, 10, 20, 1, 4, 5923},
+    {0x0219, 10, 8, 16, 1, 8, 5942},
+    {0x021A, 12, 12, 20, 0, 4, 5955},
+    {0x021B, 8, 7, 19, 1, 5, 5974},
+    {0x0300, 0, 5, 5, -9, 3, 5991},
+    {0x0301, 0, 5, 5, -7, 3, 5995},
+    {0x0302, 0, 6, 5, -8, 3, 5999},
+    {0x0303, 0, 6, 3, -8, 3, 6005},
+    {0x0304, 0, 6, 2, -8, 4, 6010},
+    {0x0305, 0, 10, 2, -10, 4, 6011},
+    {0x0306, 0, 6, 3, -8, 3, 6013},
+    {0x0307, 0, 2, 4, -6, 4, 6016},
+    {0x0308, 0, 6, 4, -8, 4, 6017},
+    {0x0309, 0, 4, 4, -6, 3, 6020},
+    {0x030A, 0, 5, 5, -8, 2, 6024},
+    {0x030B, 0, 8, 4, -8, 3, 6030},
+    {0x030C, 0, 6, 5, -8, 3, 6038},
+    {0x030D, 0, 1, 4, -5, 3, 6044},
+    {0x030E, 0, 5, 4, -7, 3, 6045},
+    {0x030F, 0, 8, 4, -10, 3, 6050},
+    {0x0310, 0, 6, 5, -8, 1, 6058},
+    {0x0311, 0, 6, 3, -8, 3, 6063},
+    {0x0312, 0, 3, 3, -5, 6, 6066},
+    {0x0313, 0, 2, 5, -6, 2, 6069},
+    {0x0314, 0, 2, 5, -6, 2, 6071},
+    {0x0315, 0, 2, 4, -1, 4, 6073},
+    {0x0316, 0, 5, 4, -9, 21, 6075},
+    {0x0317, 0, 5, 4, -7, 21, 6079},
+    {0x0318, 0, 3, 5, -7, 19, 6083},
+    {0x0319, 0, 3, 5, -6, 19, 6087},
+    {0x031A, 0, 5, 5, -4, 0, 6091},
+    {0x031B, 0, 4, 3, -3, 7, 6095},
+    {0x031C, 0, 2, 4, -6, 20, 6097},
+    {0x031D, 0, 4, 3, -7, 21, 6100},
+    {0x031E, 0, 4, 3, -7, 21, 6102},
+    {0x031F, 0, 4, 5, -7, 19, 6105},
+    {0x0320, 0, 4, 2, -7, 21, 6110},
+    {0x0321, 0, 6, 5, -6, 18, 6111},
+    {0x0322, 0, 6, 5, -6, 18, 6116},
+    {0x0323, 0, 2, 3, -6, 20, 6121},
+    {0x0324, 0, 6, 2, -8, 21, 6122},
+    {0x0325, 0, 4, 4, -7, 20, 6125},
+    {0x0326, 0, 2, 3, -6, 21, 6130},
+    {0x0327, 0, 4, 4, -7, 19, 6131},
+    {0x0328, 0, 4, 4, -7, 19, 6134},
+    {0x0329, 0, 1, 4, -5, 20, 6138},
+    {0x032A, 0, 6, 3, -8, 20, 6139},
+    {0x032B, 0, 8, 2, -9, 21, 6142},
+    {0x032C, 0, 6, 4, -8, 20, 6145},
+    {0x032D, 0, 6, 4, -8, 20, 6151},
+    {0x032E, 0, 6, 3, -8, 20, 6157},
+    {0x032F, 0, 6, 2, -8, 21, 6160},
+    {0x0330, 0, 6, 3, -8, 20, 6163},
+    {0x0331, 0, 6, 2, -8, 21, 6168},
+    {0x0332, 0, 10, 2, -10, 22, 6169},
+    {0x0333, 0, 10, 5, -10, 19, 6171},
+    {0x0334, 0, 10, 3, -11, 11, 6174},
+    {0x0335, 0, 5, 2, -6, 13, 6178},
+    {0x0336, 0, 13, 2, -13, 13, 6179},
+    {0x0337, 0, 10, 13, -11, 7, 6181},
+    {0x0338, 0, 14, 16, -15, 4, 6194},
+    {0x0339, 0, 2, 4, -6, 20, 6209},
+    {0x033A, 0, 6, 3, -8, 20, 6212},
+    {0x033B, 0, 4, 5, -7, 19, 6215},
+    {0x033C, 0, 8, 2, -9, 21, 6218},
+    {0x033D, 0, 4, 5, -7, 2, 6222},
+    {0x033E, 0, 3, 5, -5, 2, 6225},
+    {0x033F, 0, 10, 5, -10, 4, 6228},
+    {0x0340, 0, 5, 4, -9, 3, 6231},
+    {0x0341, 0, 5, 4, -7, 3, 6235},
+    {0x0342, 0, 6, 3, -8, 3, 6239},
+    {0x0343, 0, 2, 5, -6, 2, 6244},
+    {0x0344, 0, 6, 7, -8, -1, 6246},
+    {0x0345, 0, 3, 3, -6, 20, 6253},
+    {0x0346, 0, 6, 3, -8, 3, 6256},
+    {0x0347, 0, 4, 4, -7, 20, 6258},
+    {0x0348, 0, 4, 4, -7, 20, 6260},
+    {0x0349, 0, 4, 5, -7, 19, 6265},
+    {0x034A, 0, 6, 4, -8, 3, 6269},
+    {0x034B, 0, 6, 6, -8, 2, 6275},
+    {0x034C, 0, 6, 5, -8, 3, 6281},
+    {0x034D, 0, 8, 4, -9, 20, 6287},
+    {0x034E, 0, 4, 4, -7, 20, 6294},
+    {0x034F, 0, 1, 1, 0, 18, 6297},
+    {0x0351, 0, 2, 6, -6, 1, 6297},
+    {0x0352, 0, 6, 6, -8, 2, 6301},
+    {0x0353, 0, 4, 5, -7, 19, 6306},
+    {0x0357, 0, 2, 6, -6, 1, 6309},
+    {0x0358, 0, 2, 2, -2, 4, 6312},
+    {0x035A, 0, 8, 4, -9, 20, 6313},
+    {0x035C, 0, 18, 3, -9, 21, 6321},
+    {0x035D, 0, 18, 3, -9, 0, 6326},
+    {0x035E, 0, 18, 2, -9, 0, 6331},
+    {0x035F, 0, 18, 1, -9, 21, 6333},
+    {0x0360, 0, 14, 3, -7, 1, 6335},
+    {0x0361, 0, 18, 3, -9, 0, 6340},
+    {0x0362, 0, 18, 4, -9, 20, 6345},
+    {0x0370, 13, 9, 15, 2, 4, 6351},
+    {0x0371, 11, 8, 11, 2, 8, 6365},
+    {0x0372, 17, 13, 15, 2, 4, 6375},
+    {0x0373, 13, 9, 15, 2, 4, 6396},
+    {0x0374, 6, 2, 5, 2, 3, 6417},
+    {0x0375, 6, 2, 5, 2, 18, 6419},
+    {0x0376, 15, 11, 15, 2, 4, 6421},
+    {0x0377, 13, 9, 11, 2, 8, 6444},
+    {0x037A, 10, 2, 3, 4, 20, 6459},
+    {0x037B, 11, 9, 11, 1, 8, 6460},
+    {0x037C, 11, 9, 11, 1, 8, 6472},
+    {0x037D, 11, 9, 11, 1, 8, 6486},
+    {0x037E, 7, 3, 13, 1, 9, 6500},
+    {0x037F, 6, 5, 19, -1, 4, 6507},
+    {0x0384, 10, 5, 4, 3, 3, 6525},
+    {0x0385, 10, 6, 7, 2, -1, 6529},
+    {0x0386, 14, 13, 16, 0, 3, 6536},
+    {0x0387, 6, 2, 2, 2, 11, 6565},
+    {0x0388, 15, 14, 16, -1, 3, 6566},
+    {0x0389, 17, 16, 16, -1, 3, 6584},
+    {0x038A, 8, 7, 16, -1, 3, 6616},
+    {0x038C, 16, 16, 16, -1, 3, 6635},
+    {0x038E, 17, 17, 16, -1, 3, 6665},
+    {0x038F, 17, 16, 16, -1, 3, 6693},
+    {0x0390, 8, 7, 20, 0, -1, 6725},
+    {0x0391, 14, 13, 15, 0, 4, 6745},
+    {0x0392, 14, 10, 15, 2, 4, 6770},
+    {0x0393, 11, 9, 15, 2, 4, 6790},
+    {0x0394, 14, 13, 15, 0, 4, 6804},
+    {0x0395, 13, 9, 15, 2, 4, 6829},
+    {0x0396, 14, 12, 15, 1, 4, 6841},
+    {0x0397, 15, 11, 15, 2, 4, 6855},
+    {0x0398, 16, 14, 15, 1, 4, 6870},
+    {0x0399, 6, 2, 15, 2, 4, 6892},
+    {0x039A, 13, 12, 15, 2, 4, 6894},
+    {0x039B, 14, 13, 15, 0, 4, 6920},
+    {0x039C, 17, 13, 15, 2, 4, 6947},
+    {0x039D, 15, 11, 15, 2, 4, 6978},
+    {0x039E, 13, 9, 15, 2, 4, 7001},
+    {0x039F, 16, 14, 15, 1, 4, 7009},
+    {0x03A0, 15, 11, 15, 2, 4, 7029},
+    {0x03A1, 12, 9, 15, 2, 4, 7044},
+    {0x03A3, 12, 9, 15, 2, 4, 7059},
+    {0x03A4, 12, 12, 15, 0, 4, 7072},
+    {0x03A5, 12, 12, 15, 0, 4, 7087},
+    {0x03A6, 16, 14, 15, 1, 4, 7107},
+    {0x03A7, 14, 12, 15, 1, 4, 7132},
+    {0x03A8, 16, 14, 15, 1, 4, 7157},
+    {0x03A9, 15, 13, 15, 1, 4, 7186},
+    {0x03AA, 6, 6, 19, 0, 0, 7208},
+    {0x03AB, 12, 12, 19, 0, 0, 7226},
+    {0x03AC, 13, 11, 16, 1, 3, 7251},
+    {0x03AD, 10, 8, 16, 1, 3, 7276},
+    {0x03AE, 13, 9, 20, 2, 3, 7291},
+    {0x03AF, 8, 6, 16, 1, 3, 7312},
+    {0x03B0, 12, 9, 20, 2, -1, 7327},
+    {0x03B1, 13, 11, 11, 1, 8, 7351},
+    {0x03B2, 12, 9, 19, 2, 4, 7371},
+    {0x03B3, 12, 11, 15, 0, 8, 7396},
+    {0x03B4, 12, 10, 15, 1, 4, 7417},
+    {0x03B5, 10, 8, 11, 1, 8, 7436},
+    {0x03B6, 11, 9, 19, 1, 4, 7447},
+    {0x03B7, 13, 9, 15, 2, 8, 7466},
+    {0x03B8, 12, 10, 15, 1, 4, 7483},
+    {0x03B9, 8, 5, 11, 2, 8, 7502},
+    {0x03BA, 11, 9, 11, 2, 8, 7513},
+    {0x03BB, 13, 11, 15, 1, 4, 7532},
+    {0x03BC, 13, 10, 15, 2, 8, 7553},
+    {0x03BD, 12, 10, 11, 1, 8, 7577},
+    {0x03BE, 12, 10, 19, 1, 4, 7597},
+    {0x03BF, 12, 10, 11, 1, 8, 7616},
+    {0x03C0, 12, 11, 11, 1, 8, 7630},
+    {0x03C1, 13, 10, 15, 2, 8, 7650},
+    {0x03C2, 12, 9, 15, 1, 8, 7668},
+    {0x03C3, 13, 11, 11, 1, 8, 7683},
+    {0x03C4, 12, 10, 11, 1, 8, 7701},
+    {0x03C5, 12, 9, 11, 2, 8, 7712},
+    {0x03C6, 14, 12, 15, 1, 8, 7727},
+    {0x03C7, 12, 10, 15, 1, 8, 7754},
+    {0x03C8, 14, 12, 15, 1, 8, 7775},
+    {0x03C9, 16, 14, 11, 1, 8, 7800},
+    {0x03CA, 8, 7, 15, 0, 4, 7821},
+    {0x03CB, 12, 9, 15, 2, 4, 7837},
+    {0x03CC, 12, 10, 16, 1, 3, 7857},
+    {0x03CD, 12, 9, 16, 2, 3, 7876},
+    {0x03CE, 16, 14, 16, 1, 3, 7896},
+    {0x03CF, 13, 12, 19, 2, 4, 7922},
+    {0x03D0, 12, 9, 15, 2, 4, 7953},
+    {0x03D1, 12, 10, 15, 1, 4, 7975},
+    {0x03D2, 14, 12, 15, 1, 4, 7996},
+    {0x03D3, 17, 17, 16, -1, 3, 8015},
+    {0x03D4, 14, 12, 19, 1, 0, 8041},
+    {0x03D5, 14, 12, 19, 1, 4, 8065},
+    {0x03D6, 16, 16, 11, 0, 8, 8094},
+    {0x03D7, 13, 11, 15, 1, 8, 8118},
+    {0x03D8, 16, 14, 19, 1, 4, 8142},
+    {0x03D9, 12, 10, 15, 1, 8, 8166},
+    {0x03DA, 13, 10, 19, 1, 4, 8184},
+    {0x03DB, 12, 10, 15, 1, 8, 8203},
+    {0x03DC, 12, 8, 15, 2, 4, 8218},
+    {0x03DD, 9, 10, 19, -2, 4, 8232},
+    {0x03DE, 13, 10, 15, 2, 4, 8251},
+    {0x03DF, 13, 9, 15, 2, 4, 8271},
+    {0x03E0, 17, 15, 19, 1, 4, 8286},
+    {0x03E1, 13, 10, 15, 1, 8, 8321},
+    {0x03E2, 18, 16, 19, 1, 4, 8344},
+    {0x03E3, 16, 14, 15, 1, 8, 8378},
+    {0x03E4, 15, 12, 19, 1, 4, 8402},
+    {0x03E5, 13, 10, 15, 1, 8, 8430},
+    {0x03E6, 16, 13, 19, 2, 4, 8450},
+    {0x03E7, 12, 11, 12, 0, 7, 8475},
+    {0x03E8, 14, 12, 19, 1, 4, 8492},
+    {0x03E9, 12, 10, 15, 1, 8, 8515},
+    {0x03EA, 15, 13, 15, 1, 4, 8533},
+    {0x03EB, 13, 11, 11, 1, 8, 8556},
+    {0x03EC, 14, 12, 15, 1, 4, 8572},
+    {0x03ED, 12, 10, 15, 1, 4, 8593},
+    {0x03EE, 12, 12, 19, 0, 4, 8614},
+    {0x03EF, 11, 10, 19, 0, 4, 8634},
+    {0x03F0, 13, 11, 11, 1, 8, 8654},
+    {0x03F1, 13, 10, 15, 2, 8, 8673},
+    {0x03F2, 11, 9, 11, 1, 8, 8691},
+    {0x03F3, 6, 4, 19, 0, 4, 8703},
+    {0x03F4, 16, 14, 15, 1, 4, 8719},
+    {0x03F5, 12, 9, 11, 1, 8, 8738},
+    {0x03F6, 12, 8, 11, 2, 8, 8750},
+    {0x03F7, 12, 9, 15, 2, 4, 8761},
+    {0x03F8, 13, 10, 19, 2, 4, 8776},
+    {0x03F9, 14, 12, 15, 1, 4, 8799},
+    {0x03FA, 17, 13, 15, 2, 4, 8816},
+    {0x03FB, 14, 11, 15, 1, 8, 8838},
+    {0x03FC, 13, 11, 15, 1, 8, 8856},
+    {0x03FD, 14, 12, 15, 1, 4, 8881},
+    {0x03FE, 14, 12, 15, 1, 4, 8898},
+    {0x03FF, 14, 12, 15, 1, 4, 8917},
+    {0x0400, 13, 9, 19, 2, 0, 8936},
+    {0x0401, 13, 9, 19, 2, 0, 8951},
+    {0x0402, 16, 14, 19, 0, 4, 8967},
+    {0x0403, 12, 9, 19, 2, 0, 8993},
+    {0x0404, 14, 12, 15, 1, 4, 9010},
+    {0x0405, 13, 10, 15, 1, 4, 9027},
+    {0x0406, 6, 2, 15, 2, 4, 9042},
+    {0x0407, 6, 6, 19, 0, 0, 9044},
+    {0x0408, 6, 5, 19, -1, 4, 9062},
+    {0x0409, 22, 20, 15, 1, 4, 9080},
+    {0x040A, 21, 17, 15, 2, 4, 9112},
+    {0x040B, 16, 14, 15, 0, 4, 9141},
+    {0x040C, 14, 12, 19, 2, 0, 9163},
+    {0x040D, 15, 11, 19, 2, 0, 9195},
+    {0x040E, 12, 12, 18, 0, 1, 9222},
+    {0x040F, 14, 10, 18, 2, 4, 9249},
+    {0x0410, 14, 13, 15, 0, 4, 9267},
+    {0x0411, 13, 10, 15, 2, 4, 9292},
+    {0x0412, 14, 10, 15, 2, 4, 9307},
+    {0x0413, 12, 9, 15, 2, 4, 9327},
+    {0x0414, 16, 14, 18, 1, 4, 9341},
+    {0x0415, 13, 9, 15, 2, 4, 9370},
+    {0x0416, 22, 20, 15, 1, 4, 9382},
+    {0x0417, 13, 10, 15, 2, 4, 9425},
+    {0x0418, 15, 11, 15, 2, 4, 9440},
+    {0x0419, 15, 11, 18, 2, 1, 9463},
+    {0x041A, 14, 12, 15, 2, 4, 9490},
+    {0x041B, 16, 13, 15, 1, 4, 9518},
+    {0x041C, 17, 13, 15, 2, 4, 9544},
+    {0x041D, 15, 11, 15, 2, 4, 9575},
+    {0x041E, 16, 14, 15, 1, 4, 9590},
+    {0x041F, 15, 11, 15, 2, 4, 9610},
+    {0x0420, 12, 9, 15, 2, 4, 9625},
+    {0x0421, 14, 12, 15, 1, 4, 9640},
+    {0x0422, 12, 12, 15, 0, 4, 9657},
+    {0x0423, 12, 12, 15, 0, 4, 9672},
+    {0x0424, 16, 14, 15, 1, 4, 9695},
+    {0x0425, 14, 12, 15, 1, 4, 9721},
+    {0x0426, 16, 13, 18, 2, 4, 9746},
+    {0x0427, 14, 10, 15, 2, 4, 9777},
+    {0x0428, 22, 18, 15, 2, 4, 9793},
+    {0x0429, 23, 20, 18, 2, 4, 9821},
+    {0x042A, 17, 14, 15, 1, 4, 9867},
+    {0x042B, 18, 14, 15, 2, 4, 9887},
+    {0x042C, 13, 10, 15, 2, 4, 9908},
+    {0x042D, 14, 12, 15, 1, 4, 9923},
+    {0x042E, 21, 18, 15, 2, 4, 9940},
+    {0x042F, 14, 11, 15, 1, 4, 9972},
+    {0x0430, 12, 9, 11, 1, 8, 9997},
+    {0x0431, 12, 10, 15, 1, 4, 10009},
+    {0x0432, 12, 9, 11, 2, 8, 10028},
+    {0x0433, 11, 8, 11, 2, 8, 10041},
+    {0x0434, 14, 12, 14, 1, 8, 10051},
+    {0x0435, 12, 10, 11, 1, 8, 10072},
+    {0x0436, 18, 16, 11, 1, 8, 10083},
+    {0x0437, 10, 8, 11, 1, 8, 10112},
+    {0x0438, 13, 9, 11, 2, 8, 10122},
+    {0x0439, 13, 9, 15, 2, 4, 10137},
+    {0x043A, 12, 10, 11, 2, 8, 10156},
+    {0x043B, 13, 10, 11, 1, 8, 10176},
+    {0x043C, 15, 11, 11, 2, 8, 10194},
+    {0x043D, 13, 9, 11, 2, 8, 10214},
+    {0x043E, 12, 10, 11, 1, 8, 10225},
+    {0x043F, 13, 9, 11, 2, 8, 10239},
+    {0x0440, 13, 10, 15, 2, 8, 10250},
+    {0x0441, 11, 9, 11, 1, 8, 10269},
+    {0x0442, 12, 10, 11, 1, 8, 10281},
+    {0x0443, 11, 11, 15, 0, 8, 10292},
+    {0x0444, 16, 14, 19, 1, 4, 10315},
+    {0x0445, 11, 11, 11, 0, 8, 10346},
+    {0x0446, 14, 11, 14, 2, 8, 10365},
+    {0x0447, 12, 9, 11, 1, 8, 10388},
+    {0x0448, 18, 14, 11, 2, 8, 10400},
+    {0x0449, 19, 16, 14, 2, 8, 10420},
+    {0x044A, 14, 12, 11, 1, 8, 10452},
+    {0x044B, 16, 12, 11, 2, 8, 10465},
+    {0x044C, 12, 9, 11, 2, 8, 10479},
+    {0x044D, 11, 9, 11, 1, 8, 10489},
+    {0x044E, 17, 14, 11, 2, 8, 10501},
+    {0x044F, 12, 10, 11, 1, 8, 10523},
+    {0x0450, 12, 10, 16, 1, 3, 10540},
+    {0x0451, 12, 10, 15, 1, 4, 10555},
+    {0x0452, 13, 11, 19, 0, 4, 10570},
+    {0x0453, 11, 8, 16, 2, 3, 10596},
+    {0x0454, 11, 9, 11, 1, 8, 10610},
+    {0x0455, 10, 8, 11, 1, 8, 10622},
+    {0x0456, 6, 2, 15, 2, 4, 10631},
+    {0x0457, 6, 6, 15, 0, 4, 10634},
+    {0x0458, 6, 4, 19, 0, 4, 10648},
+    {0x0459, 18, 16, 11, 1, 8, 10664},
+    {0x045A, 18, 15, 11, 2, 8, 10684},
+    {0x045B, 13, 11, 15, 0, 4, 10703},
+    {0x045C, 12, 10, 16, 2, 3, 10725},
+    {0x045D, 13, 9, 16, 2, 3, 10750},
+    {0x045E, 11, 11, 19, 0, 4, 10769},
+    {0x045F, 12, 8, 14, 2, 8, 10796},
+    {0x0460, 18, 16, 15, 1, 4, 10810},
+    {0x0461, 17, 14, 11, 1, 8, 10840},
+    {0x0462, 15, 14, 15, 0, 4, 10861},
+    {0x0463, 13, 12, 15, 0, 4, 10881},
+    {0x0464, 19, 16, 15, 2, 4, 10898},
+    {0x0465, 15, 12, 11, 2, 8, 10925},
+    {0x0466, 18, 17, 15, 0, 4, 10945},
+    {0x0467, 16, 15, 11, 0, 8, 10974},
+    {0x0468, 23, 21, 15, 2, 4, 10997},
+    {0x0469, 20, 18, 11, 2, 8, 11040},
+    {0x046A, 16, 14, 15, 1, 4, 11073},
+    {0x046B, 12, 10, 11, 1, 8, 11102},
+    {0x046C, 21, 17, 15, 2, 4, 11121},
+    {0x046D, 16, 13, 11, 2, 8, 11163},
+    {0x046E, 13, 10, 23, 1, 0, 11190},
+    {0x046F, 11, 8, 19, 1, 4, 11216},
+    {0x0470, 17, 17, 15, 0, 4, 11238},
+    {0x0471, 18, 17, 19, 0, 4, 11272},
+    {0x0472, 16, 14, 15, 1, 4, 11312},
+    {0x0473, 12, 10, 11, 1, 8, 11331},
+    {0x0474, 16, 15, 15, 0, 4, 11344},
+    {0x0475, 13, 13, 11, 0, 8, 11371},
+    {0x0476, 16, 15, 19, 0, 0, 11390},
+    {0x0477, 13, 13, 16, 0, 3, 11424},
+    {0x0478, 20, 18, 19, 1, 4, 11452},
+    {0x0479, 18, 16, 15, 1, 8, 11499},
+    {0x047A, 19, 17, 15, 1, 4, 11538},
+    {0x047B, 15, 13, 11, 1, 8, 11562},
+    {0x047C, 24, 21, 19, 1, 0, 11576},
+    {0x047D, 21, 18, 15, 1, 4, 11614},
+    {0x047E, 19, 16, 18, 1, 1, 11639},
+    {0x047F, 17, 14, 15, 1, 4, 11674},
+    {0x0480, 14, 12, 19, 1, 4, 11700},
+    {0x0481, 11, 9, 15, 1, 8, 11720},
+    {0x0482, 10, 8, 10, 1, 10, 11735},
+    {0x0483, 0, 8, 4, -10, 3, 11748},
+    {0x0484, 0, 7, 3, -7, 3, 11751},
+    {0x0485, 0, 3, 4, -6, 3, 11754},
+    {0x0486, 0, 3, 4, -6, 3, 11756},
+    {0x0487, 0, 16, 4, -16, 3, 11758},
+    {0x0488, 8, 28, 22, -20, 1, 11763},
+    {0x0489, 8, 26, 26, -19, -1, 11807},
+    {0x048A, 15, 13, 22, 2, 1, 11849},
+    {0x048B, 14, 11, 19, 2, 4, 11893},
+    {0x048C, 13, 12, 15, 0, 4, 11926},
+    {0x048D, 12, 11, 14, 0, 5, 11946},
+    {0x048E, 12, 10, 15, 2, 4, 11963},
+    {0x048F, 13, 10, 15, 2, 8, 11985},
+    {0x0490, 12, 9, 18, 2, 1, 12011},
+    {0x0491, 11, 8, 14, 2, 5, 12027},
+    {0x0492, 13, 12, 15, 0, 4, 12039},
+    {0x0493, 12, 11, 11, 0, 8, 12054},
+    {0x0494, 13, 10, 19, 2, 4, 12065},
+    {0x0495, 12, 9, 15, 2, 8, 12085},
+    {0x0496, 22, 21, 18, 0, 4, 12100},
+    {0x0497, 18, 17, 14, 1, 8, 12148},
+    {0x0498, 13, 10, 19, 2, 4, 12183},
+    {0x0499, 10, 8, 15, 1, 8, 12202},
+    {0x049A, 14, 12, 18, 2, 4, 12216},
+    {0x049B, 12, 10, 14, 2, 8, 12247},
+    {0x049C, 14, 12, 15, 2, 4, 12269},
+    {0x049D, 12, 9, 11, 2, 8, 12301},
+    {0x049E, 14, 14, 15, 0, 4, 12322},
+    {0x049F, 12, 10, 15, 1, 4, 12351},
+    {0x04A0, 17, 16, 15, 0, 4, 12375},
+    {0x04A1, 17, 14, 11, 0, 8, 12403},
+    {0x04A2, 15, 13, 18, 2, 4, 12423},
+    {0x04A3, 13, 11, 14, 2, 8, 12453},
+    {0x04A4, 20, 18, 15, 2, 4, 12475},
+    {0x04A5, 18, 15, 11, 2, 8, 12501},
+    {0x04A6, 22, 19, 19, 2, 4, 12519},
+    {0x04A7, 19, 16, 16, 2, 8, 12554},
+    {0x04A8, 18, 16, 15, 1, 4, 12580},
+    {0x04A9, 14, 13, 11, 1, 8, 12617},
+    {0x04AA, 14, 12, 19, 1, 4, 12645},
+    {0x04AB, 11, 9, 15, 1, 8, 12666},
+    {0x04AC, 12, 12, 18, 0, 4, 12682},
+    {0x04AD, 12, 10, 14, 1, 8, 12700},
+    {0x04AE, 12, 12, 15, 0, 4, 12714},
+    {0x04AF, 12, 10, 15, 1, 8, 12734},
+    {0x04B0, 12, 12, 15, 0, 4, 12755},
+    {0x04B1, 12, 10, 15, 1, 8, 12776},
+    {0x04B2, 14, 12, 18, 1, 4, 12798},
+    {0x04B3, 12, 10, 14, 1, 8, 12826},
+    {0x04B4, 19, 18, 18, 0, 4, 12846},
+    {0x04B5, 16, 15, 14, 0, 8, 12879},
+    {0x04B6, 14, 12, 18, 2, 4, 12902},
+    {0x04B7, 12, 11, 14, 1, 8, 12926},
+    {0x04B8, 14, 10, 15, 2, 4, 12945},
+    {0x04B9, 12, 9, 11, 1, 8, 12966},
+    {0x04BA, 14, 10, 15, 2, 4, 12983},
+    {0x04BB, 13, 9, 15, 2, 4, 12999},
+    {0x04BC, 19, 18, 15, 0, 4, 13016},
+    {0x04BD, 14, 13, 11, 0, 8, 13042},
+    {0x04BE, 19, 18, 19, 0, 4, 13058},
+    {0x04BF, 15, 14, 14, 0, 8, 13091},
+    {0x04C0, 6, 2, 15, 2, 4, 13112},
+    {0x04C1, 22, 20, 18, 1, 1, 13114},
+    {0x04C2, 18, 16, 16, 1, 3, 13161},
+    {0x04C3, 13, 11, 19, 2, 4, 13195},
+    {0x04C4, 12, 9, 15, 2, 8, 13226},
+    {0x04C5, 16, 14, 19, 1, 4, 13249},
+    {0x04C6, 13, 13, 15, 0, 8, 13280},
+    {0x04C7, 15, 11, 19, 2, 4, 13303},
+    {0x04C8, 13, 9, 16, 2, 8, 13322},
+    {0x04C9, 16, 13, 19, 2, 4, 13338},
+    {0x04CA, 14, 11, 15, 2, 8, 13369},
+    {0x04CB, 14, 10, 18, 2, 4, 13393},
+    {0x04CC, 12, 9, 14, 1, 8, 13412},
+    {0x04CD, 18, 15, 19, 2, 4, 13427},
+    {0x04CE, 15, 13, 15, 2, 8, 13473},
+    {0x04CF, 6, 2, 15, 2, 4, 13506},
+    {0x04D0, 14, 13, 19, 0, 0, 13508},
+    {0x04D1, 12, 9, 16, 1, 3, 13538},
+    {0x04D2, 14, 13, 19, 0, 0, 13555},
+    {0x04D3, 12, 9, 15, 1, 4, 13585},
+    {0x04D4, 20, 18, 15, 0, 4, 13602},
+    {0x04D5, 19, 17, 11, 1, 8, 13627},
+    {0x04D6, 13, 9, 18, 2, 1, 13648},
+    {0x04D7, 12, 10, 16, 1, 3, 13663},
+    {0x04D8, 16, 13, 15, 1, 4, 13678},
+    {0x04D9, 12, 10, 11, 1, 8, 13695},
+    {0x04DA, 16, 13, 19, 1, 0, 13707},
+    {0x04DB, 12, 10, 15, 1, 4, 13729},
+    {0x04DC, 22, 20, 19, 1, 0, 13745},
+    {0x04DD, 18, 16, 15, 1, 4, 13794},
+    {0x04DE, 13, 10, 19, 2, 0, 13828},
+    {0x04DF, 10, 8, 15, 1, 4, 13848},
+    {0x04E0, 13, 11, 15, 2, 4, 13863},
+    {0x04E1, 12, 10, 15, 1, 8, 13877},
+    {0x04E2, 15, 11, 18, 2, 1, 13891},
+    {0x04E3, 13, 9, 15, 2, 4, 13916},
+    {0x04E4, 15, 11, 19, 2, 0, 13934},
+    {0x04E5, 13, 9, 15, 2, 4, 13962},
+    {0x04E6, 16, 14, 19, 1, 0, 13982},
+    {0x04E7, 12, 10, 15, 1, 4, 14007},
+    {0x04E8, 16, 14, 15, 1, 4, 14026},
+    {0x04E9, 12, 10, 11, 1, 8, 14045},
+    {0x04EA, 16, 14, 19, 1, 0, 14058},
+    {0x04EB, 12, 10, 15, 1, 4, 14082},
+    {0x04EC, 14, 12, 19, 1, 0, 14099},
+    {0x04ED, 11, 9, 15, 1, 4, 14121},
+    {0x04EE, 12, 12, 18, 0, 1, 14138},
+    {0x04EF, 11, 11, 19, 0, 4, 14164},
+    {0x04F0, 12, 12, 19, 0, 0, 14190},
+    {0x04F1, 11, 11, 19, 0, 4, 14218},
+    {0x04F2, 12, 12, 19, 0, 0, 14246},
+    {0x04F3, 11, 11, 20, 0, 3, 14276},
+    {0x04F4, 14, 10, 19, 2, 0, 14307},
+    {0x04F5, 12, 9, 15, 1, 4, 14328},
+    {0x04F6, 12, 9, 18, 2, 4, 14345},
+    {0x04F7, 11, 8, 14, 2, 8, 14362},
+    {0x04F8, 18, 14, 19, 2, 0, 14375},
+    {0x04F9, 16, 12, 15, 2, 4, 14401},
+    {0x04FA, 13, 12, 20, 0, 4, 14420},
+    {0x04FB, 12, 11, 16, 0, 8, 14440},
+    {0x04FC, 14, 12, 19, 1, 4, 14456},
+    {0x04FD, 12, 10, 15, 1, 8, 14486},
+    {0x04FE, 14, 12, 15, 1, 4, 14508},
+    {0x04FF, 12, 10, 11, 1, 8, 14534},
+    {0x0531, 15, 12, 16, 2, 4, 14552},
+    {0x0532, 15, 11, 15, 2, 4, 14582},
+    {0x0533, 15, 14, 15, 1, 4, 14597},
+    {0x0534, 15, 13, 15, 1, 4, 14619},
+    {0x0535, 15, 11, 15, 2, 4, 14638},
+    {0x0536, 15, 12, 15, 2, 4, 14654},
+    {0x0537, 13, 10, 15, 2, 4, 14673},
+    {0x0538, 15, 11, 15, 2, 4, 14687},
+    {0x0539, 17, 15, 15, 2, 4, 14703},
+    {0x053A, 15, 14, 15, 1, 4, 14735},
+    {0x053B, 14, 11, 15, 2, 4, 14758},
+    {0x053C, 11, 9, 15, 2, 4, 14776},
+    {0x053D, 18, 15, 15, 2, 4, 14791},
+    {0x053E, 17, 12, 15, 3, 4, 14816},
+    {0x053F, 15, 11, 15, 2, 4, 14837},
+    {0x0540, 14, 12, 16, 1, 4, 14855},
+    {0x0541, 15, 12, 15, 2, 4, 14870},
+    {0x0542, 15, 14, 15, 1, 4, 14894},
+    {0x0543, 15, 13, 15, 1, 4, 14913},
+    {0x0544, 16, 13, 15, 2, 4, 14938},
+    {0x0545, 15, 12, 15, 1, 4, 14965},
+    {0x0546, 15, 14, 15, 0, 4, 14985},
+    {0x0547, 15, 12, 15, 2, 4, 15005},
+    {0x0548, 15, 11, 15, 2, 4, 15024},
+    {0x0549, 14, 12, 16, 1, 4, 15041},
+    {0x054A, 16, 13, 15, 1, 4, 15059},
+    {0x054B, 15, 12, 15, 2, 4, 15084},
+    {0x054C, 16, 13, 15, 2, 4, 15105},
+    {0x054D, 15, 11, 15, 2, 4, 15131},
+    {0x054E, 15, 14, 15, 1, 4, 15148},
+    {0x054F, 14, 12, 15, 1, 4, 15170},
+    {0x0550, 14, 11, 15, 2, 4, 15190},
+    {0x0551, 15, 12, 15, 2, 4, 15206},
+    {0x0552, 11, 9, 15, 2, 4, 15228},
+    {0x0553, 16, 14, 15, 1, 4, 15242},
+    {0x0554, 15, 14, 15, 0, 4, 15269},
+    {0x0555, 16, 14, 15, 1, 4, 15292},
+    {0x0556, 16, 14, 15, 1, 4, 15312},
+    {0x0559, 6, 3, 5, 1, 4, 15340},
+    {0x055A, 6, 3, 5, 2, 4, 15344},
+    {0x055B, 5, 5, 4, 0, 3, 15348},
+    {0x055C, 7, 7, 6, 0, 1, 15352},
+    {0x055D, 5, 5, 4, -1, 3, 15358},
+    {0x055E, 8, 8, 5, 0, 2, 15362},
+    {0x055F, 10, 8, 3, 1, 4, 15369},
+    {0x0561, 19, 16, 11, 2, 8, 15372},
+    {0x0562, 13, 9, 15, 2, 8, 15396},
+    {0x0563, 13, 12, 15, 1, 8, 15412},
+    {0x0564, 13, 11, 15, 2, 8, 15438},
+    {0x0565, 13, 9, 15, 2, 4, 15463},
+    {0x0566, 13, 12, 15, 1, 8, 15479},
+    {0x0567, 10, 8, 15, 2, 4, 15505},
+    {0x0568, 13, 9, 15, 2, 8, 15519},
+    {0x0569, 15, 13, 15, 2, 8, 15536},
+    {0x056A, 13, 12, 15, 1, 4, 15564},
+    {0x056B, 13, 9, 19, 2, 4, 15587},
+    {0x056C, 5, 4, 15, 2, 8, 15608},
+    {0x056D, 20, 16, 19, 2, 4, 15623},
+    {0x056E, 12, 10, 15, 1, 4, 15653},
+    {0x056F, 13, 9, 19, 2, 4, 15672},
+    {0x0570, 13, 9, 15, 2, 4, 15693},
+    {0x0571, 12, 9, 15, 1, 4, 15710},
+    {0x0572, 13, 11, 15, 2, 8, 15731},
+    {0x0573, 13, 10, 15, 1, 4, 15757},
+    {0x0574, 13, 11, 15, 2, 4, 15780},
+    {0x0575, 5, 4, 15, 0, 8, 15806},
+    {0x0576, 13, 11, 15, 0, 4, 15821},
+    {0x0577, 10, 9, 15, 0, 8, 15847},
+    {0x0578, 13, 9, 11, 2, 8, 15863},
+    {0x0579, 8, 7, 15, 0, 8, 15876},
+    {0x057A, 19, 16, 15, 2, 8, 15891},
+    {0x057B, 11, 9, 15, 1, 8, 15919},
+    {0x057C, 13, 10, 11, 2, 8, 15939},
+    {0x057D, 13, 9, 11, 2, 8, 15959},
+    {0x057E, 13, 11, 19, 2, 4, 15972},
+    {0x057F, 19, 16, 11, 2, 8, 16002},
+    {0x0580, 13, 9, 15, 2, 8, 16028},
+    {0x0581, 13, 10, 15, 1, 8, 16045},
+    {0x0582, 9, 7, 11, 2, 8, 16065},
+    {0x0583, 19, 16, 19, 2, 4, 16075},
+    {0x0584, 13, 12, 15, 0, 8, 16109},
+    {0x0585, 12, 10, 11, 1, 8, 16135},
+    {0x0586, 16, 14, 19, 1, 4, 16149},
+    {0x0587, 16, 14, 15, 2, 4, 16179},
+    {0x0589, 7, 2, 8, 2, 11, 16205},
+    {0x058A, 7, 5, 2, 1, 13, 16207},
+    {0x05D0, 13, 9, 11, 2, 8, 16209},
+    {0x05D1, 12, 10, 11, 1, 8, 16232},
+    {0x05D2, 8, 6, 11, 1, 8, 16243},
+    {0x05D3, 12, 10, 11, 1, 8, 16255},
+    {0x05D4, 14, 10, 11, 2, 8, 16266},
+    {0x05D5, 6, 2, 11, 2, 8, 16278},
+    {0x05D6, 7, 5, 11, 1, 8, 16280},
+    {0x05D7, 14, 10, 11, 2, 8, 16290},
+    {0x05D8, 14, 11, 11, 2, 8, 16302},
+    {0x05D9, 4, 2, 7, 1, 8, 16317},
+    {0x05DA, 11, 8, 15, 1, 8, 16318},
+    {0x05DB, 11, 9, 11, 1, 8, 16333},
+    {0x05DC, 12, 9, 15, 1, 4, 16344},
+    {0x05DD, 14, 10, 11, 2, 8, 16359},
+    {0x05DE, 15, 12, 11, 1, 8, 16370},
+    {0x05DF, 6, 2, 15, 2, 8, 16392},
+    {0x05E0, 8, 5, 11, 1, 8, 16394},
+    {0x05E1, 13, 10, 11, 2, 8, 16403},
+    {0x05E2, 13, 10, 13, 1, 8, 16416},
+    {0x05E3, 13, 9, 15, 2, 8, 16437},
+    {0x05E4, 12, 9, 11, 2, 8, 16454},
+    {0x05E5, 12, 10, 15, 1, 8, 16468},
+    {0x05E6, 12, 9, 11, 1, 8, 16488},
+    {0x05E7, 15, 11, 15, 2, 8, 16504},
+    {0x05E8, 12, 9, 11, 1, 8, 16525},
+    {0x05E9, 16, 14, 11, 1, 8, 16536},
+    {0x05EA, 14, 11, 11, 1, 8, 16559},
+    {0x10A0, 17, 15, 17, 1, 2, 16577},
+    {0x10A1, 15, 13, 17, 1, 2, 16599},
+    {0x10A2, 14, 12, 20, 1, 2, 16626},
+    {0x10A3, 17, 15, 17, 1, 2, 16651},
+    {0x10A4, 12, 10, 17, 1, 2, 16677},
+    {0x10A5, 15, 13, 17, 1, 2, 16697},
+    {0x10A6, 15, 13, 17, 1, 2, 16724},
+    {0x10A7, 18, 17, 17, 1, 2, 16750},
+    {0x10A8, 9, 7, 17, 1, 2, 16781},
+    {0x10A9, 12, 10, 17, 1, 2, 16797},
+    {0x10AA, 17, 15, 17, 1, 2, 16818},
+    {0x10AB, 18, 15, 17, 1, 2, 16850},
+    {0x10AC, 12, 10, 17, 1, 2, 16881},
+    {0x10AD, 17, 15, 20, 1, 2, 16901},
+    {0x10AE, 16, 14, 17, 0, 2, 16931},
+    {0x10AF, 13, 10, 17, 1, 2, 16963},
+    {0x10B0, 18, 16, 17, 1, 2, 16986},
+    {0x10B1, 12, 10, 17, 1, 2, 17016},
+    {0x10B2, 12, 10, 17, 1, 2, 17038},
+    {0x10B3, 17, 15, 21, 1, 2, 17057},
+    {0x10B4, 17, 15, 17, 1, 2, 17087},
+    {0x10B5, 14, 13, 17, 1, 2, 17117},
+    {0x10B6, 13, 10, 17, 1, 2, 17140},
+    {0x10B7, 12, 10, 17, 1, 2, 17159},
+    {0x10B8, 13, 10, 17, 1, 2, 17179},
+    {0x10B9, 12, 10, 17, 1, 2, 17200},
+    {0x10BA, 16, 14, 17, 1, 2, 17219},
+    {0x10BB, 17, 15, 17, 1, 2, 17244},
+    {0x10BC, 12, 10, 17, 1, 2, 17275},
+    {0x10BD, 12, 10, 17, 1, 2, 17295},
+    {0x10BE, 13, 10, 17, 1, 2, 17317},
+    {0x10BF, 15, 13, 17, 1, 2, 17334},
+    {0x10C0, 17, 15, 17, 1, 2, 17359},
+    {0x10C1, 12, 10, 17, 1, 2, 17391},
+    {0x10C2, 14, 12, 17, 1, 2, 17411},
+    {0x10C3, 12, 10, 17, 1, 2, 17434},
+    {0x10C4, 12, 10, 17, 1, 2, 17454},
+    {0x10C5, 15, 13, 17, 1, 2, 17473},
+    {0x10D0, 10, 8, 12, 1, 7, 17499},
+    {0x10D1, 10, 8, 17, 1, 2, 17512},
+    {0x10D2, 12, 10, 16, 1, 8, 17532},
+    {0x10D3, 16, 14, 16, 1, 8, 17554},
+    {0x10D4, 10, 8, 16, 1, 8, 17584},
+    {0x10D5, 10, 8, 16, 1, 8, 17605},
+    {0x10D6, 10, 9, 17, 0, 2, 17623},
+    {0x10D7, 16, 14, 11, 1, 8, 17652},
+    {0x10D8, 10, 8, 11, 1, 8, 17677},
+    {0x10D9, 10, 8, 16, 1, 8, 17692},
+    {0x10DA, 21, 19, 16, 1, 8, 17708},
+    {0x10DB, 10, 8, 17, 1, 2, 17744},
+    {0x10DC, 10, 8, 17, 1, 2, 17766},
+    {0x10DD, 16, 14, 11, 1, 8, 17785},
+    {0x10DE, 10, 8, 17, 1, 2, 17810},
+    {0x10DF, 10, 8, 16, 1, 8, 17828},
+    {0x10E0, 16, 14, 17, 1, 2, 17847},
+    {0x10E1, 10, 8, 17, 1, 2, 17878},
+    {0x10E2, 13, 11, 19, 1, 5, 17902},
+    {0x10E3, 10, 9, 16, 0, 8, 17933},
+    {0x10E4, 17, 14, 16, 1, 8, 17960},
+    {0x10E5, 10, 8, 22, 1, 2, 17990},
+    {0x10E6, 16, 14, 16, 1, 8, 18016},
+    {0x10E7, 10, 8, 16, 1, 8, 18045},
+    {0x10E8, 10, 8, 17, 1, 2, 18066},
+    {0x10E9, 10, 8, 17, 1, 2, 18090},
+    {0x10EA, 11, 10, 16, 1, 8, 18112},
+    {0x10EB, 10, 8, 17, 1, 2, 18140},
+    {0x10EC, 10, 9, 17, 1, 2, 18160},
+    {0x10ED, 10, 8, 22, 1, 2, 18190},
+    {0x10EE, 10, 8, 17, 1, 2, 18215},
+    {0x10EF, 9, 9, 16, 0, 8, 18235},
+    {0x10F0, 10, 8, 17, 1, 2, 18254},
+    {0x10F1, 10, 8, 17, 1, 2, 18271},
+    {0x10F2, 10, 8, 14, 1, 8, 18293},
+    {0x10F3, 10, 8, 16, 1, 8, 18312},
+    {0x10F4, 10, 8, 22, 1, 2, 18328},
+    {0x10F5, 11, 9, 17, 1, 2, 18351},
+    {0x10F6, 17, 15, 16, 1, 8, 18377},
+    {0x10F7, 11, 9, 16, 1, 8, 18412},
+    {0x10F8, 10, 8, 16, 1, 8, 18433},
+    {0x10F9, 11, 10, 16, 1, 8, 18453},
+    {0x10FA, 10, 8, 13, 1, 8, 18476},
+    {0x10FB, 9, 7, 10, 1, 9, 18489},
+    {0x10FC, 6, 4, 9, 1, 2, 18496},
+    {0x1E00, 14, 13, 20, 0, 4, 18504},
+    {0x1E01, 12, 9, 16, 1, 8, 18536},
+    {0x1E02, 14, 10, 19, 2, 0, 18554},
+    {0x1E03, 13, 10, 18, 2, 1, 18577},
+    {0x1E04, 14, 10, 19, 2, 4, 18599},
+    {0x1E05, 13, 10, 19, 2, 4, 18623},
+    {0x1E06, 14, 10, 19, 2, 4, 18646},
+    {0x1E07, 13, 10, 19, 2, 4, 18669},
+    {0x1E08, 14, 12, 23, 1, 0, 18691},
+    {0x1E09, 11, 9, 20, 1, 3, 18716},
+    {0x1E0A, 15, 12, 19, 2, 0, 18737},
+    {0x1E0B, 13, 10, 19, 1, 0, 18759},
+    {0x1E0C, 15, 12, 19, 2, 4, 18781},
+    {0x1E0D, 13, 10, 19, 1, 4, 18804},
+    {0x1E0E, 15, 12, 19, 2, 4, 18826},
+    {0x1E0F, 13, 10, 19, 1, 4, 18848},
+    {0x1E10, 15, 12, 19, 2, 4, 18870},
+    {0x1E11, 13, 10, 19, 1, 4, 18893},
+    {0x1E12, 15, 12, 20, 2, 4, 18916},
+    {0x1E13, 13, 10, 20, 1, 4, 18942},
+    {0x1E14, 13, 9, 21, 2, -2, 18967},
+    {0x1E15, 12, 10, 19, 1, 0, 18984},
+    {0x1E16, 13, 9, 21, 2, -2, 19001},
+    {0x1E17, 12, 10, 19, 1, 0, 19018},
+    {0x1E18, 13, 9, 19, 2, 4, 19035},
+    {0x1E19, 12, 10, 15, 1, 8, 19053},
+    {0x1E1A, 13, 9, 19, 2, 4, 19070},
+    {0x1E1B, 12, 10, 15, 1, 8, 19089},
+    {0x1E1C, 13, 9, 22, 2, 1, 19107},
+    {0x1E1D, 12, 10, 20, 1, 3, 19126},
+    {0x1E1E, 12, 8, 19, 2, 0, 19145},
+    {0x1E1F, 7, 7, 19, 0, 0, 19161},
+    {0x1E20, 16, 13, 18, 1, 1, 19178},
+    {0x1E21, 13, 10, 19, 1, 4, 19200},
+    {0x1E22, 15, 11, 19, 2, 0, 19223},
+    {0x1E23, 13, 9, 18, 2, 1, 19240},
+    {0x1E24, 15, 11, 19, 2, 4, 19260},
+    {0x1E25, 13, 9, 19, 2, 4, 19278},
+    {0x1E26, 15, 11, 18, 2, 1, 19298},
+    {0x1E27, 13, 11, 18, 0, 1, 19317},
+    {0x1E28, 15, 13, 19, 0, 4, 19347},
+    {0x1E29, 13, 11, 19, 0, 4, 19379},
+    {0x1E2A, 15, 11, 19, 2, 4, 19408},
+    {0x1E2B, 13, 9, 19, 2, 4, 19427},
+    {0x1E2C, 6, 6, 19, 0, 4, 19448},
+    {0x1E2D, 6, 6, 19, 0, 4, 19468},
+    {0x1E2E, 6, 6, 21, 0, -2, 19487},
+    {0x1E2F, 6, 6, 18, 0, 1, 19508},
+    {0x1E30, 13, 12, 19, 2, 0, 19525},
+    {0x1E31, 12, 10, 19, 2, 0, 19555},
+    {0x1E32, 13, 12, 19, 2, 4, 19582},
+    {0x1E33, 12, 10, 19, 2, 4, 19612},
+    {0x1E34, 13, 12, 19, 2, 4, 19638},
+    {0x1E35, 12, 10, 19, 2, 4, 19667},
+    {0x1E36, 11, 9, 19, 2, 4, 19693},
+    {0x1E37, 6, 2, 19, 2, 4, 19711},
+    {0x1E38, 11, 11, 23, 0, 0, 19714},
+    {0x1E39, 6, 6, 22, 0, 1, 19735},
+    {0x1E3A, 11, 9, 19, 2, 4, 19754},
+    {0x1E3B, 6, 6, 19, 0, 4, 19771},
+    {0x1E3C, 11, 9, 20, 2, 4, 19787},
+    {0x1E3D, 6, 6, 20, 0, 4, 19809},
+    {0x1E3E, 17, 13, 19, 2, 0, 19830},
+    {0x1E3F, 20, 16, 16, 2, 3, 19865},
+    {0x1E40, 17, 13, 19, 2, 0, 19894},
+    {0x1E41, 20, 16, 15, 2, 4, 19928},
+    {0x1E42, 17, 13, 19, 2, 4, 19955},
+    {0x1E43, 19, 16, 15, 2, 8, 19990},
+    {0x1E44, 15, 11, 19, 2, 0, 20018},
+    {0x1E45, 13, 9, 15, 2, 4, 20044},
+    {0x1E46, 15, 11, 19, 2, 4, 20060},
+    {0x1E47, 13, 9, 15, 2, 8, 20087},
+    {0x1E48, 15, 11, 19, 2, 4, 20103},
+    {0x1E49, 13, 9, 15, 2, 8, 20129},
+    {0x1E4A, 15, 11, 20, 2, 4, 20145},
+    {0x1E4B, 13, 9, 16, 2, 8, 20176},
+    {0x1E4C, 16, 14, 21, 1, -2, 20196},
+    {0x1E4D, 12, 10, 18, 1, 1, 20224},
+    {0x1E4E, 16, 14, 21, 1, -2, 20246},
+    {0x1E4F, 12, 10, 17, 1, 2, 20275},
+    {0x1E50, 16, 14, 21, 1, -2, 20298},
+    {0x1E51, 12, 10, 19, 1, 0, 20324},
+    {0x1E52, 16, 14, 21, 1, -2, 20344},
+    {0x1E53, 12, 10, 19, 1, 0, 20370},
+    {0x1E54, 12, 9, 19, 2, 0, 20390},
+    {0x1E55, 13, 10, 20, 2, 3, 20408},
+    {0x1E56, 12, 9, 19, 2, 0, 20432},
+    {0x1E57, 13, 10, 19, 2, 4, 20450},
+    {0x1E58, 14, 11, 19, 2, 0, 20472},
+    {0x1E59, 8, 6, 15, 2, 4, 20501},
+    {0x1E5A, 14, 11, 19, 2, 4, 20513},
+    {0x1E5B, 8, 6, 15, 2, 8, 20542},
+    {0x1E5C, 14, 11, 22, 2, 1, 20555},
+    {0x1E5D, 8, 6, 19, 2, 4, 20587},
+    {0x1E5E, 14, 11, 19, 2, 4, 20601},
+    {0x1E5F, 8, 7, 15, 1, 8, 20630},
+    {0x1E60, 13, 10, 19, 1, 0, 20645},
+    {0x1E61, 10, 8, 15, 1, 4, 20663},
+    {0x1E62, 13, 10, 19, 1, 4, 20675},
+    {0x1E63, 10, 8, 15, 1, 8, 20694},
+    {0x1E64, 13, 10, 19, 1, 0, 20706},
+    {0x1E65, 10, 8, 16, 1, 3, 20727},
+    {0x1E66, 13, 10, 21, 1, -2, 20742},
+    {0x1E67, 10, 8, 19, 1, 0, 20765},
+    {0x1E68, 13, 10, 23, 1, 0, 20782},
+    {0x1E69, 10, 8, 18, 1, 5, 20803},
+    {0x1E6A, 12, 12, 19, 0, 0, 20817},
+    {0x1E6B, 8, 7, 19, 1, 0, 20834},
+    {0x1E6C, 12, 12, 19, 0, 4, 20850},
+    {0x1E6D, 8, 7, 18, 1, 5, 20868},
+    {0x1E6E, 12, 12, 19, 0, 4, 20884},
+    {0x1E6F, 8, 7, 18, 1, 5, 20902},
+    {0x1E70, 12, 12, 20, 0, 4, 20918},
+    {0x1E71, 8, 7, 19, 1, 5, 20939},
+    {0x1E72, 15, 11, 19, 2, 4, 20958},
+    {0x1E73, 13, 9, 15, 2, 8, 20980},
+    {0x1E74, 15, 11, 19, 2, 4, 20998},
+    {0x1E75, 13, 9, 15, 2, 8, 21023},
+    {0x1E76, 15, 11, 19, 2, 4, 21043},
+    {0x1E77, 13, 9, 15, 2, 8, 21066},
+    {0x1E78, 15, 11, 21, 2, -2, 21085},
+    {0x1E79, 13, 9, 20, 2, -1, 21110},
+    {0x1E7A, 15, 11, 21, 2, -2, 21135},
+    {0x1E7B, 13, 9, 18, 2, 1, 21159},
+    {0x1E7C, 14, 13, 19, 0, 0, 21179},
+    {0x1E7D, 11, 11, 16, 0, 3, 21214},
+    {0x1E7E, 14, 13, 19, 0, 4, 21242},
+    {0x1E7F, 12, 11, 15, 0, 8, 21273},
+    {0x1E80, 20, 18, 19, 1, 0, 21297},
+    {0x1E81, 17, 15, 16, 1, 3, 21347},
+    {0x1E82, 20, 18, 19, 1, 0, 21385},
+    {0x1E83, 17, 15, 16, 1, 3, 21435},
+    {0x1E84, 20, 18, 18, 1, 1, 21473},
+    {0x1E85, 17, 15, 15, 1, 4, 21523},
+    {0x1E86, 20, 18, 19, 1, 0, 21561},
+    {0x1E87, 17, 15, 15, 1, 4, 21610},
+    {0x1E88, 20, 18, 19, 1, 4, 21646},
+    {0x1E89, 17, 15, 15, 1, 8, 21696},
+    {0x1E8A, 14, 12, 19, 1, 0, 21733},
+    {0x1E8B, 11, 11, 15, 0, 4, 21761},
+    {0x1E8C, 14, 12, 18, 1, 1, 21783},
+    {0x1E8D, 11, 11, 15, 0, 4, 21813},
+    {0x1E8E, 12, 12, 19, 0, 0, 21837},
+    {0x1E8F, 11, 11, 19, 0, 4, 21860},
+    {0x1E90, 14, 12, 19, 1, 0, 21886},
+    {0x1E91, 11, 9, 16, 1, 3, 21906},
+    {0x1E92, 14, 12, 19, 1, 4, 21922},
+    {0x1E93, 11, 9, 15, 1, 8, 21940},
+    {0x1E94, 14, 12, 19, 1, 4, 21953},
+    {0x1E95, 11, 9, 15, 1, 8, 21970},
+    {0x1E96, 13, 9, 19, 2, 4, 21983},
+    {0x1E97, 8, 8, 18, 0, 1, 22003},
+    {0x1E98, 17, 15, 17, 1, 2, 22022},
+    {0x1E99, 11, 11, 21, 0, 2, 22064},
+    {0x1E9A, 12, 13, 15, 1, 4, 22096},
+    {0x1E9B, 7, 7, 19, 0, 0, 22117},
+    {0x1E9C, 7, 7, 15, 0, 4, 22135},
+    {0x1E9D, 7, 7, 15, 0, 4, 22151},
+    {0x1E9E, 15, 12, 15, 2, 4, 22166},
+    {0x1E9F, 12, 10, 15, 1, 4, 22190},
+    {0x1EA0, 14, 13, 19, 0, 4, 22209},
+    {0x1EA1, 12, 9, 15, 1, 8, 22238},
+    {0x1EA2, 14, 13, 20, 0, -1, 22253},
+    {0x1EA3, 12, 9, 16, 1, 3, 22283},
+    {0x1EA4, 14, 13, 21, 0, -2, 22299},
+    {0x1EA5, 12, 11, 17, 1, 2, 22333},
+    {0x1EA6, 14, 13, 21, 0, -2, 22358},
+    {0x1EA7, 12, 9, 17, 1, 2, 22392},
+    {0x1EA8, 14, 13, 21, 0, -2, 22412},
+    {0x1EA9, 12, 11, 17, 1, 2, 22447},
+    {0x1EAA, 14, 13, 20, 0, -1, 22473},
+    {0x1EAB, 12, 9, 16, 1, 3, 22507},
+    {0x1EAC, 14, 13, 23, 0, 0, 22527},
+    {0x1EAD, 12, 9, 20, 1, 3, 22561},
+    {0x1EAE, 14, 13, 21, 0, -2, 22583},
+    {0x1EAF, 12, 9, 18, 1, 1, 22615},
+    {0x1EB0, 14, 13, 21, 0, -2, 22633},
+    {0x1EB1, 12, 9, 18, 1, 1, 22665},
+    {0x1EB2, 14, 13, 21, 0, -2, 22683},
+    {0x1EB3, 12, 9, 18, 1, 1, 22715},
+    {0x1EB4, 14, 13, 20, 0, -1, 22734},
+    {0x1EB5, 12, 9, 17, 1, 2, 22767},
+    {0x1EB6, 14, 13, 23, 0, 0, 22786},
+    {0x1EB7, 12, 9, 20, 1, 3, 22819},
+    {0x1EB8, 13, 9, 19, 2, 4, 22839},
+    {0x1EB9, 12, 10, 15, 1, 8, 22854},
+    {0x1EBA, 13, 9, 20, 2, -1, 22868},
+    {0x1EBB, 12, 10, 16, 1, 3, 22884},
+    {0x1EBC, 13, 9, 18, 2, 1, 22899},
+    {0x1EBD, 12, 10, 16, 1, 3, 22915},
+    {0x1EBE, 13, 11, 21, 2, -2, 22933},
+    {0x1EBF, 12, 12, 17, 1, 2, 22957},
+    {0x1EC0, 13, 9, 21, 2, -2, 22980},
+    {0x1EC1, 12, 10, 17, 1, 2, 23000},
+    {0x1EC2, 13, 11, 21, 2, -2, 23019},
+    {0x1EC3, 12, 12, 17, 1, 2, 23044},
+    {0x1EC4, 13, 9, 20, 2, -1, 23068},
+    {0x1EC5, 12, 10, 16, 1, 3, 23087},
+    {0x1EC6, 13, 9, 23, 2, 0, 23106},
+    {0x1EC7, 12, 10, 20, 1, 3, 23126},
+    {0x1EC8, 6, 4, 20, 2, -1, 23147},
+    {0x1EC9, 6, 4, 16, 2, 3, 23166},
+    {0x1ECA, 6, 2, 19, 2, 4, 23181},
+    {0x1ECB, 6, 2, 19, 2, 4, 23184},
+    {0x1ECC, 16, 14, 19, 1, 4, 23188},
+    {0x1ECD, 12, 10, 15, 1, 8, 23212},
+    {0x1ECE, 16, 14, 20, 1, -1, 23230},
+    {0x1ECF, 12, 10, 16, 1, 3, 23255},
+    {0x1ED0, 16, 14, 21, 1, -2, 23274},
+    {0x1ED1, 12, 11, 17, 1, 2, 23302},
+    {0x1ED2, 16, 14, 21, 1, -2, 23329},
+    {0x1ED3, 12, 10, 17, 1, 2, 23358},
+    {0x1ED4, 16, 14, 21, 1, -2, 23381},
+    {0x1ED5, 12, 11, 17, 1, 2, 23411},
+    {0x1ED6, 16, 14, 20, 1, -1, 23439},
+    {0x1ED7, 12, 10, 16, 1, 3, 23468},
+    {0x1ED8, 16, 14, 23, 1, 0, 23491},
+    {0x1ED9, 12, 10, 20, 1, 3, 23519},
+    {0x1EDA, 18, 14, 19, 1, 0, 23543},
+    {0x1EDB, 12, 11, 16, 1, 3, 23570},
+    {0x1EDC, 18, 14, 19, 1, 0, 23595},
+    {0x1EDD, 12, 11, 16, 1, 3, 23622},
+    {0x1EDE, 18, 14, 20, 1, -1, 23647},
+    {0x1EDF, 12, 11, 16, 1, 3, 23675},
+    {0x1EE0, 18, 14, 18, 1, 1, 23700},
+    {0x1EE1, 12, 11, 16, 1, 3, 23728},
+    {0x1EE2, 18, 14, 19, 1, 4, 23756},
+    {0x1EE3, 12, 11, 16, 1, 7, 23783},
+    {0x1EE4, 15, 11, 19, 2, 4, 23807},
+    {0x1EE5, 13, 9, 15, 2, 8, 23828},
+    {0x1EE6, 15, 11, 20, 2, -1, 23844},
+    {0x1EE7, 13, 9, 16, 2, 3, 23866},
+    {0x1EE8, 17, 14, 19, 2, 0, 23883},
+    {0x1EE9, 13, 11, 16, 2, 3, 23915},
+    {0x1EEA, 17, 14, 19, 2, 0, 23940},
+    {0x1EEB, 13, 11, 16, 2, 3, 23972},
+    {0x1EEC, 17, 14, 20, 2, -1, 23997},
+    {0x1EED, 13, 11, 16, 2, 3, 24030},
+    {0x1EEE, 17, 14, 18, 2, 1, 24055},
+    {0x1EEF, 13, 11, 16, 2, 3, 24088},
+    {0x1EF0, 17, 14, 19, 2, 4, 24116},
+    {0x1EF1, 13, 11, 16, 2, 7, 24148},
+    {0x1EF2, 12, 12, 19, 0, 0, 24172},
+    {0x1EF3, 11, 11, 20, 0, 3, 24196},
+    {0x1EF4, 12, 12, 19, 0, 4, 24224},
+    {0x1EF5, 11, 11, 15, 0, 8, 24248},
+    {0x1EF6, 12, 12, 20, 0, -1, 24274},
+    {0x1EF7, 11, 11, 20, 0, 3, 24299},
+    {0x1EF8, 12, 12, 18, 0, 1, 24327},
+    {0x1EF9, 11, 11, 20, 0, 3, 24352},
+    {0x1EFA, 15, 13, 15, 2, 4, 24383},
+    {0x1EFB, 10, 9, 15, 0, 4, 24411},
+    {0x2010, 7, 5, 2, 1, 12, 24440},
+    {0x2011, 7, 5, 2, 1, 12, 24441},
+    {0x2012, 13, 11, 2, 1, 13, 24442},
+    {0x2013, 10, 8, 2, 1, 13, 24444},
+    {0x2014, 20, 18, 2, 1, 13, 24446},
+    {0x2015, 20, 20, 2, 0, 13, 24448},
+    {0x2016, 10, 5, 20, 3, 4, 24450},
+    {0x2017, 10, 10, 5, 0, 19, 24471},
+    {0x2018, 6, 3, 5, 2, 4, 24474},
+    {0x2019, 6, 3, 5, 2, 4, 24478},
+    {0x201A, 6, 3, 5, 2, 17, 24483},
+    {0x201B, 6, 3, 5, 2, 4, 24487},
+    {0x201C, 10, 7, 5, 2, 4, 24492},
+    {0x201D, 10, 7, 5, 2, 4, 24501},
+    {0x201E, 10, 7, 5, 2, 17, 24510},
+    {0x201F, 10, 7, 5, 2, 4, 24519},
+    {0x2020, 10, 10, 17, 0, 4, 24529},
+    {0x2021, 10, 10, 17, 0, 4, 24546},
+    {0x2022, 12, 6, 6, 3, 9, 24562},
+    {0x2023, 12, 7, 7, 3, 8, 24566},
+    {0x2024, 7, 2, 2, 2, 17, 24573},
+    {0x2025, 13, 9, 2, 2, 17, 24574},
+    {0x2026, 20, 16, 2, 2, 17, 24577},
+    {0x2027, 6, 2, 3, 2, 10, 24582},
+    {0x2028, 0, 1, 1, 0, 18, 24583},
+    {0x2029, 0, 1, 1, 0, 18, 24583},
+    {0x202A, 0, 1, 1, 0, 18, 24583},
+    {0x202B, 0, 1, 1, 0, 18, 24583},
+    {0x202C, 0, 1, 1, 0, 18, 24583},
+    {0x202D, 0, 1, 1, 0, 18, 24583},
+    {0x202E, 0, 1, 1, 0, 18, 24583},
+    {0x202F, 4, 1, 1, 0, 18, 24583},
+    {0x2030, 27, 25, 15, 0, 4, 24583},
+    {0x2031, 35, 33, 15, 1, 4, 24641},
+    {0x2032, 5, 4, 4, 0, 4, 24713},
+    {0x2033, 7, 7, 4, 0, 4, 24717},
+    {0x2034, 10, 10, 4, 0, 4, 24725},
+    {0x2035, 5, 4, 4, 0, 4, 24737},
+    {0x2036, 7, 7, 4, 0, 4, 24741},
+    {0x2037, 10, 10, 4, 0, 4, 24749},
+    {0x2038, 7, 7, 4, 0, 20, 24761},
+    {0x2039, 8, 5, 9, 2, 9, 24768},
+    {0x203A, 8, 5, 9, 2, 9, 24777},
+    {0x203B, 17, 13, 14, 2, 5, 24786},
+    {0x203C, 10, 7, 15, 1, 4, 24812},
+    {0x203D, 11, 8, 15, 1, 4, 24829},
+    {0x203E, 10, 10, 2, 0, 4, 24846},
+    {0x203F, 16, 18, 3, -1, 21, 24848},
+    {0x2040, 16, 18, 3, -1, 0, 24853},
+    {0x2041, 5, 7, 10, -1, 14, 24858},
+    {0x2042, 20, 19, 17, 0, 3, 24872},
+    {0x2043, 10, 6, 2, 2, 11, 24923},
+    {0x2044, 3, 11, 15, -4, 4, 24924},
+    {0x2045, 8, 4, 18, 2, 4, 24939},
+    {0x2046, 8, 4, 18, 2, 4, 24954},
+    {0x2047, 18, 18, 15, 0, 4, 24969},
+    {0x2048, 15, 12, 15, 1, 4, 25000},
+    {0x2049, 15, 12, 15, 1, 4, 25027},
+    {0x204A, 10, 8, 13, 1, 8, 25052},
+    {0x204B, 13, 9, 17, 2, 4, 25065},
+    {0x204C, 10, 6, 6, 2, 9, 25092},
+    {0x204D, 10, 6, 6, 2, 9, 25101},
+    {0x204E, 10, 9, 10, 0, 10, 25110},
+    {0x204F, 7, 3, 12, 3, 9, 25128},
+    {0x2050, 16, 18, 24, -1, 0, 25135},
+    {0x2051, 10, 9, 20, 0, 0, 25155},
+    {0x2052, 9, 7, 16, 1, 4, 25191},
+    {0x2053, 20, 18, 3, 1, 11, 25211},
+    {0x2054, 16, 18, 3, -1, 20, 25215},
+    {0x2055, 17, 11, 11, 3, 6, 25220},
+    {0x2056, 12, 7, 9, 2, 7, 25239},
+    {0x2057, 13, 13, 4, 0, 4, 25246},
+    {0x2058, 17, 10, 10, 3, 7, 25262},
+    {0x2059, 17, 10, 10, 3, 7, 25270},
+    {0x205A, 6, 2, 15, 2, 4, 25280},
+    {0x205B, 16, 14, 20, 1, 2, 25283},
+    {0x205C, 17, 15, 15, 1, 4, 25298},
+    {0x205D, 6, 2, 12, 2, 6, 25321},
+    {0x205E, 6, 2, 14, 2, 5, 25324},
+    {0x20A0, 18, 16, 15, 1, 4, 25328},
+    {0x20A1, 13, 11, 17, 1, 3, 25353},
+    {0x20A2, 13, 11, 15, 1, 4, 25394},
+    {0x20A3, 13, 11, 15, 1, 4, 25420},
+    {0x20A4, 13, 10, 15, 1, 4, 25435},
+    {0x20A5, 19, 16, 15, 2, 6, 25450},
+    {0x20A6, 13, 12, 15, 0, 4, 25481},
+    {0x20A7, 25, 23, 15, 2, 4, 25510},
+    {0x20A8, 21, 19, 15, 2, 4, 25556},
+    {0x20A9, 20, 18, 15, 1, 4, 25593},
+    {0x20AA, 16, 14, 15, 1, 4, 25634},
+    {0x20AB, 13, 12, 19, 1, 4, 25666},
+    {0x20AC, 13, 12, 15, 0, 4, 25693},
+    {0x20AD, 13, 13, 15, 0, 4, 25710},
+    {0x20AE, 13, 13, 15, 0, 4, 25737},
+    {0x20AF, 25, 22, 19, 2, 4, 25758},
+    {0x20B0, 13, 11, 15, 0, 4, 25806},
+    {0x20B1, 13, 11, 15, 1, 4, 25828},
+    {0x20B2, 13, 11, 18, 1, 3, 25845},
+    {0x20B3, 13, 13, 15, 0, 4, 25879},
+    {0x20B4, 15, 13, 15, 1, 4, 25903},
+    {0x20B5, 13, 9, 18, 2, 4, 25921},
+    {0x20B8, 13, 13, 15, 0, 4, 25951},
+    {0x20B9, 13, 11, 15, 1, 4, 25964},
+    {0x20BA, 13, 12, 15, 0, 4, 25979},
+    {0x20BD, 13, 11, 15, 1, 4, 26002},
+    {0x2100, 20, 19, 15, 1, 4, 26023},
+    {0x2101, 20, 19, 15, 1, 4, 26060},
+    {0x2102, 14, 12, 15, 1, 4, 26097},
+    {0x2103, 22, 19, 15, 2, 4, 26123},
+    {0x2104, 13, 13, 15, 0, 4, 26152},
+    {0x2105, 20, 19, 15, 1, 4, 26176},
+    {0x2106, 21, 20, 15, 1, 4, 26217},
+    {0x2107, 12, 9, 15, 1, 4, 26258},
+    {0x2108, 14, 12, 15, 1, 7, 26273},
+    {0x2109, 19, 16, 15, 2, 4, 26290},
+    {0x210B, 20, 18, 15, 1, 4, 26313},
+    {0x210C, 15, 14, 18, 0, 4, 26350},
+    {0x210D, 17, 13, 15, 2, 4, 26383},
+    {0x210E, 13, 10, 15, 1, 4, 26424},
+    {0x210F, 13, 11, 15, 1, 4, 26449},
+    {0x2110, 9, 8, 15, 1, 4, 26476},
+    {0x2111, 14, 12, 15, 1, 4, 26496},
+    {0x2112, 14, 13, 15, 1, 4, 26513},
+    {0x2113, 8, 7, 15, 0, 4, 26535},
+    {0x2114, 16, 15, 15, 0, 4, 26558},
+    {0x2115, 16, 12, 15, 2, 4, 26598},
+    {0x2116, 21, 18, 15, 1, 4, 26635},
+    {0x2117, 20, 14, 14, 3, 5, 26683},
+    {0x2118, 14, 12, 14, 1, 9, 26715},
+    {0x2119, 14, 11, 15, 2, 4, 26745},
+    {0x211A, 16, 14, 18, 1, 4, 26781},
+    {0x211B, 16, 14, 15, 1, 4, 26828},
+    {0x211C, 16, 15, 15, 1, 4, 26862},
+    {0x211D, 16, 13, 15, 2, 4, 26901},
+    {0x211E, 18, 14, 15, 2, 4, 26951},
+    {0x211F, 14, 11, 19, 2, 2, 26981},
+    {0x2120, 20, 12, 6, 3, 4, 27016},
+    {0x2121, 21, 20, 11, 0, 8, 27034},
+    {0x2122, 20, 13, 6, 3, 4, 27064},
+    {0x2123, 14, 14, 19, 0, 2, 27085},
+    {0x2124, 15, 13, 15, 1, 4, 27125},
+    {0x2125, 12, 9, 19, 1, 4, 27153},
+    {0x2126, 15, 13, 15, 1, 4, 27171},
+    {0x2127, 15, 13, 15, 1, 4, 27193},
+    {0x2128, 12, 11, 19, 0, 3, 27215},
+    {0x2129, 7, 4, 11, 1, 8, 27237},
+    {0x212A, 13, 12, 15, 2, 4, 27248},
+    {0x212B, 14, 13, 19, 0, 0, 27274},
+    {0x212C, 16, 14, 15, 1, 4, 27306},
+    {0x212D, 14, 12, 16, 1, 4, 27339},
+    {0x212E, 17, 15, 13, 1, 6, 27363},
+    {0x212F, 12, 10, 11, 1, 8, 27382},
+    {0x2130, 12, 9, 15, 2, 4, 27397},
+    {0x2131, 16, 14, 15, 1, 4, 27416},
+    {0x2132, 12, 8, 15, 2, 4, 27439},
+    {0x2133, 21, 20, 16, 1, 4, 27453},
+    {0x2134, 9, 7, 8, 1, 11, 27508},
+    {0x2135, 15, 13, 15, 1, 4, 27517},
+    {0x2136, 13, 13, 15, 0, 4, 27545},
+    {0x2137, 9, 8, 16, 0, 4, 27560},
+    {0x2138, 13, 11, 16, 1, 4, 27576},
+    {0x2139, 8, 6, 15, 1, 4, 27592},
+    {0x213A, 19, 17, 13, 1, 6, 27606},
+    {0x213B, 24, 22, 11, 1, 8, 27629},
+    {0x213C, 14, 14, 11, 0, 8, 27670},
+    {0x213D, 15, 13, 15, 0, 8, 27711},
+    {0x213E, 13, 11, 15, 2, 4, 27746},
+    {0x213F, 17, 13, 15, 2, 4, 27773},
+    {0x2140, 16, 16, 18, 0, 5, 27814},
+    {0x2141, 16, 12, 15, 2, 4, 27849},
+    {0x2142, 11, 9, 15, 1, 4, 27868},
+    {0x2143, 11, 9, 15, 1, 4, 27883},
+    {0x2144, 12, 12, 15, 0, 4, 27897},
+    {0x2145, 16, 15, 15, 1, 4, 27917},
+    {0x2146, 14, 13, 15, 1, 4, 27968},
+    {0x2147, 12, 10, 11, 1, 8, 28015},
+    {0x2148, 7, 5, 15, 1, 4, 28034},
+    {0x2149, 7, 8, 19, -2, 4, 28056},
+    {0x214B, 16, 13, 15, 1, 4, 28087},
+    {0x214E, 11, 8, 11, 1, 8, 28114},
+    {0x2190, 17, 15, 8, 1, 9, 28124},
+    {0x2191, 17, 8, 15, 5, 4, 28132},
+    {0x2192, 17, 15, 8, 1, 9, 28149},
+    {0x2193, 17, 8, 15, 5, 4, 28157},
+    {0x2194, 17, 15, 8, 1, 9, 28174},
+    {0x2195, 17, 8, 15, 5, 4, 28188},
+    {0x2196, 17, 11, 11, 3, 7, 28207},
+    {0x2197, 17, 11, 11, 3, 7, 28221},
+    {0x2198, 17, 11, 11, 3, 7, 28234},
+    {0x2199, 17, 11, 11, 3, 7, 28247},
+    {0x219A, 17, 15, 9, 1, 8, 28262},
+    {0x219B, 17, 15, 9, 1, 8, 28277},
+    {0x219C, 17, 17, 6, 0, 11, 28291},
+    {0x219D, 17, 16, 6, 0, 11, 28305},
+    {0x219E, 17, 15, 9, 1, 8, 28320},
+    {0x219F, 17, 9, 15, 4, 4, 28335},
+    {0x21A0, 17, 15, 9, 1, 8, 28358},
+    {0x21A1, 17, 9, 15, 4, 4, 28372},
+    {0x21A2, 17, 15, 9, 1, 8, 28395},
+    {0x21A3, 17, 15, 9, 1, 8, 28410},
+    {0x21A4, 17, 15, 9, 1, 8, 28425},
+    {0x21A5, 17, 9, 15, 4, 4, 28439},
+    {0x21A6, 17, 15, 8, 1, 9, 28458},
+    {0x21A7, 17, 9, 15, 4, 4, 28471},
+    {0x21A8, 17, 9, 15, 4, 4, 28490},
+    {0x21A9, 17, 15, 9, 1, 8, 28513},
+    {0x21AA, 17, 15, 9, 1, 8, 28525},
+    {0x21AB, 17, 15, 9, 1, 8, 28537},
+    {0x21AC, 17, 15, 9, 1, 8, 28554},
+    {0x21AD, 17, 15, 9, 1, 8, 28571},
+    {0x21AE, 17, 15, 9, 1, 8, 28589},
+    {0x21AF, 17, 11, 15, 3, 4, 28609},
+    {0x21B0, 17, 10, 15, 3, 4, 28635},
+    {0x21B1, 17, 9, 15, 4, 4, 28653},
+    {0x21B2, 17, 10, 15, 3, 4, 28669},
+    {0x21B3, 17, 9, 15, 4, 4, 28686},
+    {0x21B4, 17, 10, 12, 5, 7, 28704},
+    {0x21B5, 17, 12, 11, 1, 6, 28719},
+    {0x21B6, 17, 16, 9, 0, 6, 28732},
+    {0x21B7, 17, 15, 9, 1, 6, 28749},
+    {0x21B8, 17, 14, 14, 2, 4, 28765},
+    {0x21B9, 17, 15, 14, 1, 6, 28781},
+    {0x21BA, 17, 13, 13, 2, 5, 28806},
+    {0x21BB, 17, 13, 13, 2, 5, 28829},
+    {0x21BC, 17, 15, 5, 1, 9, 28852},
+    {0x21BD, 17, 15, 5, 1, 12, 28857},
+    {0x21BE, 17, 5, 15, 8, 4, 28862},
+    {0x21BF, 17, 5, 15, 4, 4, 28879},
+    {0x21C0, 17, 15, 5, 1, 9, 28895},
+    {0x21C1, 17, 15, 5, 1, 12, 28900},
+    {0x21C2, 17, 5, 15, 8, 4, 28905},
+    {0x21C3, 17, 5, 15, 4, 4, 28922},
+    {0x21C4, 17, 15, 14, 1, 6, 28938},
+    {0x21C5, 17, 14, 15, 2, 4, 28954},
+    {0x21C6, 17, 15, 14, 1, 6, 28988},
+    {0x21C7, 17, 15, 14, 1, 6, 29004},
+    {0x21C8, 17, 15, 15, 1, 4, 29018},
+    {0x21C9, 17, 15, 14, 1, 6, 29053},
+    {0x21CA, 17, 15, 15, 1, 4, 29067},
+    {0x21CB, 17, 15, 12, 1, 7, 29101},
+    {0x21CC, 17, 15, 12, 1, 7, 29112},
+    {0x21CD, 17, 15, 9, 1, 8, 29123},
+    {0x21CE, 17, 15, 9, 1, 8, 29137},
+    {0x21CF, 17, 15, 9, 1, 8, 29157},
+    {0x21D0, 17, 15, 9, 1, 8, 29172},
+    {0x21D1, 17, 9, 15, 4, 4, 29180},
+    {0x21D2, 17, 15, 9, 1, 8, 29208},
+    {0x21D3, 17, 9, 15, 4, 4, 29217},
+    {0x21D4, 17, 15, 9, 1, 8, 29245},
+    {0x21D5, 17, 9, 15, 4, 4, 29259},
+    {0x21D6, 17, 12, 12, 3, 7, 29285},
+    {0x21D7, 17, 12, 12, 2, 7, 29306},
+    {0x21D8, 17, 12, 12, 2, 6, 29326},
+    {0x21D9, 17, 12, 12, 3, 6, 29347},
+    {0x21DA, 17, 15, 9, 1, 8, 29369},
+    {0x21DB, 17, 15, 9, 1, 8, 29377},
+    {0x21DC, 17, 15, 9, 1, 8, 29386},
+    {0x21DD, 17, 15, 9, 1, 8, 29400},
+    {0x21DE, 17, 9, 15, 4, 4, 29416},
+    {0x21DF, 17, 9, 15, 4, 4, 29435},
+    {0x21E0, 17, 15, 9, 1, 8, 29454},
+    {0x21E1, 17, 9, 15, 4, 4, 29466},
+    {0x21E2, 17, 15, 9, 1, 8, 29484},
+    {0x21E3, 17, 9, 15, 4, 4, 29496},
+    {0x21E4, 17, 15, 9, 1, 8, 29512},
+    {0x21E5, 17, 15, 9, 1, 8, 29525},
+    {0x21E6, 17, 15, 10, 1, 8, 29539},
+    {0x21E7, 17, 10, 15, 3, 4, 29552},
+    {0x21E8, 17, 15, 10, 1, 8, 29580},
+    {0x21E9, 17, 10, 16, 3, 4, 29592},
+    {0x21EA, 17, 10, 15, 3, 4, 29620},
+    {0x21EB, 17, 10, 15, 3, 4, 29643},
+    {0x21EC, 17, 11, 15, 3, 4, 29671},
+    {0x21ED, 17, 10, 15, 3, 4, 29698},
+    {0x21EE, 17, 10, 15, 3, 4, 29737},
+    {0x21EF, 17, 10, 15, 3, 4, 29766},
+    {0x21F0, 17, 15, 10, 1, 8, 29795},
+    {0x21F1, 17, 15, 15, 1, 4, 29816},
+    {0x21F2, 17, 15, 15, 1, 4, 29844},
+    {0x21F3, 17, 10, 16, 3, 4, 29873},
+    {0x21F4, 17, 15, 9, 1, 8, 29901},
+    {0x21F5, 17, 14, 15, 2, 4, 29916},
+    {0x21F6, 17, 15, 20, 1, 3, 29950},
+    {0x21F7, 17, 15, 9, 1, 8, 29969},
+    {0x21F8, 17, 15, 9, 1, 8, 29984},
+    {0x21F9, 17, 15, 9, 1, 8, 29999},
+    {0x21FA, 17, 15, 9, 1, 8, 30020},
+    {0x21FB, 17, 15, 9, 1, 8, 30042},
+    {0x21FC, 17, 15, 9, 1, 8, 30064},
+    {0x21FD, 17, 15, 9, 1, 8, 30092},
+    {0x21FE, 17, 15, 9, 1, 8, 30104},
+    {0x21FF, 17, 15, 9, 1, 8, 30116},
+    {0x2200, 14, 14, 15, 0, 4, 30138},
+    {0x2201, 13, 10, 15, 1, 4, 30163},
+    {0x2202, 10, 8, 13, 1, 6, 30182},
+    {0x2203, 13, 9, 15, 2, 4, 30200},
+    {0x2204, 13, 9, 17, 2, 3, 30212},
+    {0x2205, 17, 14, 14, 2, 5, 30235},
+    {0x2206, 13, 14, 14, 0, 5, 30268},
+    {0x2207, 13, 13, 14, 0, 5, 30291},
+    {0x2208, 17, 14, 14, 2, 5, 30315},
+    {0x2209, 17, 14, 20, 2, 2, 30328},
+    {0x220A, 14, 10, 9, 2, 8, 30356},
+    {0x220B, 17, 14, 14, 2, 5, 30364},
+    {0x220C, 17, 14, 20, 2, 2, 30377},
+    {0x220D, 14, 10, 9, 2, 8, 30404},
+    {0x220E, 13, 7, 10, 3, 9, 30412},
+    {0x220F, 15, 12, 18, 2, 4, 30415},
+    {0x2210, 15, 12, 18, 2, 4, 30433},
+    {0x2211, 13, 13, 18, 0, 5, 30451},
+    {0x2212, 17, 13, 2, 2, 12, 30468},
+    {0x2213, 17, 13, 13, 2, 6, 30470},
+    {0x2214, 17, 13, 15, 2, 4, 30482},
+    {0x2215, 7, 7, 16, 0, 4, 30496},
+    {0x2216, 13, 7, 16, 4, 3, 30512},
+    {0x2217, 17, 11, 13, 3, 6, 30528},
+    {0x2218, 13, 6, 6, 3, 9, 30548},
+    {0x2219, 13, 6, 6, 3, 10, 30556},
+    {0x221A, 13, 12, 17, 1, 3, 30561},
+    {0x221B, 13, 12, 20, 1, 0, 30584},
+    {0x221C, 13, 12, 20, 1, 0, 30615},
+    {0x221D, 14, 10, 8, 2, 9, 30649},
+    {0x221E, 17, 13, 8, 2, 9, 30664},
+    {0x221F, 17, 11, 11, 3, 6, 30684},
+    {0x2220, 18, 14, 15, 2, 4, 30695},
+    {0x2221, 18, 14, 16, 2, 4, 30710},
+    {0x2222, 17, 13, 15, 2, 4, 30731},
+    {0x2223, 10, 2, 19, 4, 4, 30751},
+    {0x2224, 10, 8, 19, 1, 4, 30753},
+    {0x2225, 10, 4, 19, 3, 4, 30774},
+    {0x2226, 10, 8, 19, 1, 4, 30794},
+    {0x2227, 15, 9, 12, 3, 7, 30813},
+    {0x2228, 15, 9, 12, 3, 7, 30833},
+    {0x2229, 15, 9, 12, 3, 7, 30852},
+    {0x222A, 15, 9, 12, 3, 7, 30866},
+    {0x222B, 10, 8, 19, 1, 4, 30879},
+    {0x222C, 16, 14, 19, 1, 4, 30900},
+    {0x222D, 21, 19, 19, 1, 4, 30943},
+    {0x222E, 10, 8, 19, 1, 4, 31007},
+    {0x222F, 16, 14, 19, 1, 4, 31036},
+    {0x2230, 21, 19, 19, 1, 4, 31085},
+    {0x2231, 10, 9, 19, 1, 4, 31152},
+    {0x2232, 10, 9, 19, 1, 4, 31180},
+    {0x2233, 10, 9, 19, 1, 4, 31208},
+    {0x2234, 13, 10, 10, 1, 7, 31237},
+    {0x2235, 13, 10, 10, 1, 7, 31244},
+    {0x2236, 5, 2, 10, 1, 7, 31251},
+    {0x2237, 13, 10, 10, 1, 7, 31253},
+    {0x2238, 17, 13, 6, 2, 8, 31261},
+    {0x2239, 17, 13, 9, 2, 8, 31266},
+    {0x223A, 17, 13, 9, 2, 8, 31273},
+    {0x223B, 17, 13, 9, 2, 8, 31283},
+    {0x223C, 17, 13, 3, 2, 11, 31292},
+    {0x223D, 17, 13, 3, 2, 11, 31296},
+    {0x223E, 17, 13, 7, 2, 9, 31302},
+    {0x223F, 17, 13, 11, 2, 7, 31315},
+    {0x2240, 8, 3, 13, 2, 6, 31334},
+    {0x2241, 17, 13, 9, 2, 8, 31347},
+    {0x2242, 17, 13, 6, 2, 10, 31358},
+    {0x2243, 17, 13, 7, 2, 9, 31364},
+    {0x2244, 17, 13, 11, 2, 7, 31371},
+    {0x2245, 17, 13, 10, 2, 7, 31385},
+    {0x2246, 17, 13, 12, 2, 7, 31394},
+    {0x2247, 17, 13, 13, 2, 6, 31406},
+    {0x2248, 17, 13, 8, 2, 9, 31422},
+    {0x2249, 17, 13, 12, 2, 7, 31430},
+    {0x224A, 17, 13, 10, 2, 7, 31446},
+    {0x224B, 17, 13, 11, 2, 7, 31456},
+    {0x224C, 17, 13, 10, 2, 7, 31469},
+    {0x224D, 17, 13, 8, 2, 9, 31479},
+    {0x224E, 17, 13, 11, 2, 7, 31488},
+    {0x224F, 17, 13, 9, 2, 7, 31502},
+    {0x2250, 17, 13, 9, 2, 7, 31511},
+    {0x2251, 17, 13, 12, 2, 7, 31517},
+    {0x2252, 17, 13, 12, 2, 7, 31526},
+    {0x2253, 17, 13, 12, 2, 7, 31535},
+    {0x2254, 20, 16, 6, 2, 10, 31543},
+    {0x2255, 20, 16, 6, 2, 10, 31551},
+    {0x2256, 17, 13, 6, 2, 10, 31559},
+    {0x2257, 17, 13, 12, 2, 4, 31566},
+    {0x2258, 17, 13, 10, 2, 6, 31578},
+    {0x2259, 17, 13, 13, 2, 3, 31585},
+    {0x225A, 17, 13, 13, 2, 3, 31599},
+    {0x225B, 17, 13, 14, 2, 2, 31613},
+    {0x225C, 17, 13, 14, 2, 2, 31625},
+    {0x225D, 17, 13, 12, 2, 4, 31640},
+    {0x225E, 17, 13, 12, 2, 4, 31660},
+    {0x225F, 17, 13, 14, 2, 2, 31679},
+    {0x2260, 17, 13, 12, 2, 7, 31690},
+    {0x2261, 17, 13, 10, 2, 7, 31701},
+    {0x2262, 17, 13, 13, 2, 6, 31707},
+    {0x2263, 17, 13, 14, 2, 5, 31719},
+    {0x2264, 17, 13, 12, 2, 7, 31727},
+    {0x2265, 17, 13, 12, 2, 7, 31738},
+    {0x2266, 17, 13, 15, 2, 6, 31749},
+    {0x2267, 17, 13, 15, 2, 6, 31761},
+    {0x2268, 17, 13, 16, 2, 6, 31774},
+    {0x2269, 17, 13, 16, 2, 6, 31789},
+    {0x226A, 21, 19, 12, 1, 7, 31805},
+    {0x226B, 21, 19, 12, 1, 7, 31829},
+    {0x226C, 9, 6, 18, 2, 4, 31852},
+    {0x226D, 17, 13, 12, 2, 7, 31877},
+    {0x226E, 17, 13, 13, 2, 6, 31892},
+    {0x226F, 17, 13, 13, 2, 7, 31911},
+    {0x2270, 17, 13, 15, 2, 6, 31928},
+    {0x2271, 17, 13, 15, 2, 6, 31946},
+    {0x2272, 17, 13, 13, 2, 7, 31965},
+    {0x2273, 17, 13, 13, 2, 7, 31978},
+    {0x2274, 17, 13, 15, 2, 6, 31993},
+    {0x2275, 17, 13, 15, 2, 6, 32013},
+    {0x2276, 17, 13, 16, 2, 5, 32035},
+    {0x2277, 17, 13, 16, 2, 5, 32052},
+    {0x2278, 17, 13, 20, 2, 3, 32069},
+    {0x2279, 17, 13, 20, 2, 3, 32094},
+    {0x227A, 17, 13, 14, 2, 6, 32121},
+    {0x227B, 17, 13, 14, 2, 6, 32135},
+    {0x227C, 17, 13, 15, 2, 6, 32148},
+    {0x227D, 17, 13, 15, 2, 6, 32166},
+    {0x227E, 17, 13, 15, 2, 6, 32183},
+    {0x227F, 17, 13, 15, 2, 6, 32198},
+    {0x2280, 17, 13, 16, 2, 4, 32214},
+    {0x2281, 17, 13, 17, 2, 5, 32237},
+    {0x2282, 17, 13, 9, 2, 8, 32260},
+    {0x2283, 17, 13, 9, 2, 8, 32269},
+    {0x2284, 17, 13, 17, 2, 4, 32278},
+    {0x2285, 17, 13, 16, 2, 5, 32301},
+    {0x2286, 17, 13, 12, 2, 7, 32323},
+    {0x2287, 17, 13, 12, 2, 7, 32334},
+    {0x2288, 17, 13, 17, 2, 4, 32345},
+    {0x2289, 17, 13, 17, 2, 4, 32369},
+    {0x228A, 17, 13, 13, 2, 7, 32393},
+    {0x228B, 17, 13, 13, 2, 7, 32406},
+    {0x228C, 15, 9, 12, 3, 7, 32419},
+    {0x228D, 15, 9, 12, 3, 7, 32435},
+    {0x228E, 15, 9, 12, 3, 7, 32450},
+    {0x228F, 17, 13, 12, 2, 7, 32468},
+    {0x2290, 17, 13, 12, 2, 7, 32478},
+    {0x2291, 17, 13, 15, 2, 6, 32488},
+    {0x2292, 17, 13, 15, 2, 6, 32500},
+    {0x2293, 16, 11, 13, 2, 6, 32512},
+    {0x2294, 16, 11, 13, 2, 6, 32525},
+    {0x2295, 17, 13, 13, 2, 6, 32538},
+    {0x2296, 17, 13, 13, 2, 6, 32563},
+    {0x2297, 17, 13, 13, 2, 6, 32581},
+    {0x2298, 17, 13, 13, 2, 6, 32609},
+    {0x2299, 17, 13, 13, 2, 6, 32634},
+    {0x229A, 17, 13, 13, 2, 6, 32655},
+    {0x229B, 17, 13, 13, 2, 6, 32683},
+    {0x229C, 17, 13, 13, 2, 6, 32713},
+    {0x229D, 17, 13, 13, 2, 6, 32734},
+    {0x229E, 17, 13, 13, 2, 6, 32754},
+    {0x229F, 17, 13, 13, 2, 6, 32773},
+    {0x22A0, 17, 13, 13, 2, 6, 32785},
+    {0x22A1, 17, 13, 13, 2, 6, 32810},
+    {0x22A2, 17, 14, 13, 2, 6, 32825},
+    {0x22A3, 17, 14, 14, 2, 5, 32838},
+    {0x22A4, 17, 14, 14, 2, 5, 32851},
+    {0x22A5, 17, 14, 14, 2, 5, 32865},
+    {0x22A6, 10, 7, 14, 2, 5, 32879},
+    {0x22A7, 10, 7, 14, 2, 5, 32892},
+    {0x22A8, 17, 14, 14, 2, 5, 32904},
+    {0x22A9, 17, 14, 14, 2, 5, 32917},
+    {0x22AA, 17, 14, 14, 2, 5, 32943},
+    {0x22AB, 17, 14, 14, 2, 5, 32983},
+    {0x22AC, 17, 14, 16, 2, 4, 33009},
+    {0x22AD, 17, 14, 16, 2, 4, 33035},
+    {0x22AE, 17, 14, 16, 2, 4, 33061},
+    {0x22AF, 17, 14, 16, 2, 4, 33100},
+    {0x22B0, 17, 12, 14, 2, 6, 33139},
+    {0x22B1, 17, 12, 14, 2, 6, 33154},
+    {0x22B2, 17, 13, 12, 2, 7, 33169},
+    {0x22B3, 17, 13, 12, 2, 7, 33186},
+    {0x22B4, 17, 13, 14, 2, 6, 33202},
+    {0x22B5, 17, 13, 14, 2, 6, 33221},
+    {0x22B6, 20, 18, 6, 1, 10, 33240},
+    {0x22B7, 20, 18, 6, 1, 10, 33250},
+    {0x22B8, 17, 15, 6, 1, 10, 33260},
+    {0x22B9, 17, 15, 14, 1, 6, 33266},
+    {0x22BA, 10, 6, 14, 2, 5, 33280},
+    {0x22BB, 15, 11, 15, 2, 4, 33294},
+    {0x22BC, 15, 11, 15, 2, 4, 33317},
+    {0x22BD, 15, 11, 15, 2, 4, 33340},
+    {0x22BE, 17, 11, 11, 3, 8, 33363},
+    {0x22BF, 17, 11, 11, 3, 8, 33379},
+    {0x22C0, 16, 16, 18, 0, 5, 33396},
+    {0x22C1, 16, 16, 18, 0, 5, 33428},
+    {0x22C2, 16, 14, 19, 1, 4, 33461},
+    {0x22C3, 16, 14, 19, 1, 4, 33483},
+    {0x22C4, 13, 10, 10, 1, 8, 33503},
+    {0x22C5, 6, 2, 2, 2, 11, 33518},
+    {0x22C6, 13, 8, 7, 2, 9, 33519},
+    {0x22C7, 17, 13, 12, 2, 7, 33528},
+    {0x22C8, 20, 16, 14, 2, 6, 33552},
+    {0x22C9, 20, 16, 14, 2, 6, 33575},
+    {0x22CA, 20, 16, 14, 2, 6, 33601},
+    {0x22CB, 20, 16, 14, 2, 6, 33627},
+    {0x22CC, 20, 16, 14, 2, 6, 33646},
+    {0x22CD, 17, 13, 7, 2, 9, 33664},
+    {0x22CE, 15, 13, 12, 1, 7, 33672},
+    {0x22CF, 15, 13, 12, 1, 7, 33692},
+    {0x22D0, 17, 13, 13, 2, 6, 33711},
+    {0x22D1, 17, 13, 13, 2, 6, 33728},
+    {0x22D2, 17, 13, 13, 2, 6, 33745},
+    {0x22D3, 17, 13, 13, 2, 6, 33780},
+    {0x22D4, 17, 9, 15, 4, 4, 33815},
+    {0x22D5, 17, 13, 17, 2, 4, 33840},
+    {0x22D6, 17, 13, 11, 2, 7, 33869},
+    {0x22D7, 17, 13, 11, 2, 7, 33883},
+    {0x22D8, 28, 26, 12, 1, 7, 33896},
+    {0x22D9, 28, 26, 12, 1, 7, 33931},
+    {0x22DA, 17, 13, 22, 2, 2, 33966},
+    {0x22DB, 17, 13, 22, 2, 2, 33985},
+    {0x22DC, 17, 13, 12, 2, 7, 34006},
+    {0x22DD, 17, 13, 12, 2, 7, 34017},
+    {0x22DE, 17, 13, 15, 2, 6, 34028},
+    {0x22DF, 17, 13, 15, 2, 6, 34044},
+    {0x22E0, 17, 13, 19, 2, 4, 34062},
+    {0x22E1, 17, 13, 19, 2, 4, 34090},
+    {0x22E2, 17, 13, 18, 2, 4, 34115},
+    {0x22E3, 17, 13, 18, 2, 4, 34138},
+    {0x22E4, 17, 13, 14, 2, 7, 34160},
+    {0x22E5, 17, 13, 14, 2, 7, 34173},
+    {0x22E6, 17, 13, 15, 2, 7, 34185},
+    {0x22E7, 17, 13, 15, 2, 7, 34202},
+    {0x22E8, 17, 13, 16, 2, 6, 34219},
+    {0x22E9, 17, 13, 16, 2, 6, 34238},
+    {0x22EA, 17, 13, 18, 2, 4, 34258},
+    {0x22EB, 17, 13, 18, 2, 4, 34285},
+    {0x22EC, 17, 13, 20, 2, 3, 34313},
+    {0x22ED, 17, 13, 20, 2, 3, 34344},
+    {0x22EE, 20, 2, 16, 9, 5, 34375},
+    {0x22EF, 20, 15, 2, 2, 12, 34378},
+    {0x22F0, 20, 15, 16, 2, 5, 34383},
+    {0x22F1, 20, 15, 16, 2, 5, 34394},
+    {0x22F2, 20, 18, 14, 1, 5, 34406},
+    {0x22F3, 17, 14, 14, 2, 5, 34424},
+    {0x22F4, 14, 10, 9, 2, 8, 34439},
+    {0x22F5, 17, 14, 18, 2, 1, 34448},
+    {0x22F6, 17, 14, 17, 2, 2, 34464},
+    {0x22F7, 14, 10, 12, 2, 5, 34479},
+    {0x22F8, 17, 14, 17, 2, 5, 34489},
+    {0x22F9, 17, 14, 14, 2, 5, 34503},
+    {0x22FA, 20, 18, 14, 1, 5, 34516},
+    {0x22FB, 17, 14, 14, 2, 5, 34534},
+    {0x22FC, 14, 10, 9, 2, 8, 34550},
+    {0x22FD, 17, 14, 17, 2, 2, 34559},
+    {0x22FE, 14, 10, 12, 2, 5, 34575},
+    {0x22FF, 17, 13, 14, 2, 5, 34585},
+    {0x2500, 12, 12, 2, 0, 11, 34597},
+    {0x2501, 12, 12, 4, 0, 10, 34599},
+    {0x2502, 12, 2, 24, 5, 0, 34602},
+    {0x2503, 12, 4, 24, 4, 0, 34605},
+    {0x2504, 12, 10, 2, 1, 11, 34609},
+    {0x2505, 12, 10, 4, 1, 10, 34614},
+    {0x2506, 12, 2, 22, 5, 1, 34623},
+    {0x2507, 12, 4, 22, 4, 1, 34626},
+    {0x2508, 12, 10, 2, 1, 11, 34631},
+    {0x2509, 12, 10, 4, 1, 10, 34638},
+    {0x250A, 12, 2, 22, 5, 1, 34651},
+    {0x250B, 12, 4, 22, 4, 1, 34655},
+    {0x250C, 12, 7, 13, 5, 11, 34661},
+    {0x250D, 12, 7, 14, 5, 10, 34673},
+    {0x250E, 12, 8, 13, 4, 11, 34684},
+    {0x250F, 12, 8, 14, 4, 10, 34696},
+    {0x2510, 12, 7, 13, 0, 11, 34707},
+    {0x2511, 12, 7, 14, 0, 10, 34719},
+    {0x2512, 12, 8, 13, 0, 11, 34731},
+    {0x2513, 12, 8, 14, 0, 10, 34744},
+    {0x2514, 12, 7, 13, 5, 0, 34756},
+    {0x2515, 12, 7, 14, 5, 0, 34768},
+    {0x2516, 12, 8, 13, 4, 0, 34780},
+    {0x2517, 12, 8, 14, 4, 0, 34793},
+    {0x2518, 12, 7, 13, 0, 0, 34805},
+    {0x2519, 12, 7, 14, 0, 0, 34817},
+    {0x251A, 12, 8, 13, 0, 0, 34828},
+    {0x251B, 12, 8, 14, 0, 0, 34840},
+    {0x251C, 12, 7, 24, 5, 0, 34851},
+    {0x251D, 12, 7, 24, 5, 0, 34874},
+    {0x251E, 12, 8, 24, 4, 0, 34895},
+    {0x251F, 12, 8, 24, 4, 0, 34919},
+    {0x2520, 12, 8, 24, 4, 0, 34942},
+    {0x2521, 12, 8, 24, 4, 0, 34965},
+    {0x2522, 12, 8, 24, 4, 0, 34987},
+    {0x2523, 12, 8, 24, 4, 0, 35008},
+    {0x2524, 12, 7, 24, 0, 0, 35029},
+    {0x2525, 12, 7, 24, 0, 0, 35052},
+    {0x2526, 12, 8, 24, 0, 0, 35073},
+    {0x2527, 12, 8, 24, 0, 0, 35096},
+    {0x2528, 12, 8, 24, 0, 0, 35120},
+    {0x2529, 12, 8, 24, 0, 0, 35143},
+    {0x252A, 12, 8, 24, 0, 0, 35164},
+    {0x252B, 12, 8, 24, 0, 0, 35186},
+    {0x252C, 12, 12, 13, 0, 11, 35207},
+    {0x252D, 12, 12, 14, 0, 10, 35220},
+    {0x252E, 12, 12, 14, 0, 10, 35233},
+    {0x252F, 12, 12, 14, 0, 10, 35246},
+    {0x2530, 12, 12, 13, 0, 11, 35259},
+    {0x2531, 12, 12, 14, 0, 10, 35272},
+    {0x2532, 12, 12, 14, 0, 10, 35285},
+    {0x2533, 12, 12, 14, 0, 10, 35298},
+    {0x2534, 12, 12, 13, 0, 0, 35311},
+    {0x2535, 12, 12, 14, 0, 0, 35324},
+    {0x2536, 12, 12, 14, 0, 0, 35337},
+    {0x2537, 12, 12, 14, 0, 0, 35350},
+    {0x2538, 12, 12, 13, 0, 0, 35363},
+    {0x2539, 12, 12, 14, 0, 0, 35376},
+    {0x253A, 12, 12, 14, 0, 0, 35389},
+    {0x253B, 12, 12, 14, 0, 0, 35402},
+    {0x253C, 12, 12, 24, 0, 0, 35415},
+    {0x253D, 12, 12, 24, 0, 0, 35439},
+    {0x253E, 12, 12, 24, 0, 0, 35462},
+    {0x253F, 12, 12, 24, 0, 0, 35485},
+    {0x2540, 12, 12, 24, 0, 0, 35508},
+    {0x2541, 12, 12, 24, 0, 0, 35532},
+    {0x2542, 12, 12, 24, 0, 0, 35556},
+    {0x2543, 12, 12, 24, 0, 0, 35580},
+    {0x2544, 12, 12, 24, 0, 0, 35603},
+    {0x2545, 12, 12, 24, 0, 0, 35626},
+    {0x2546, 12, 12, 24, 0, 0, 35649},
+    {0x2547, 12, 12, 24, 0, 0, 35672},
+    {0x2548, 12, 12, 24, 0, 0, 35695},
+    {0x2549, 12, 12, 24, 0, 0, 35718},
+    {0x254A, 12, 12, 24, 0, 0, 35741},
+    {0x254B, 12, 12, 24, 0, 0, 35764},
+    {0x254C, 12, 10, 2, 1, 11, 35787},
+    {0x254D, 12, 10, 4, 1, 10, 35790},
+    {0x254E, 12, 2, 20, 5, 2, 35795},
+    {0x254F, 12, 4, 20, 4, 2, 35798},
+    {0x2550, 12, 12, 5, 0, 10, 35803},
+    {0x2551, 12, 4, 24, 4, 0, 35806},
+    {0x2552, 12, 7, 14, 5, 10, 35831},
+    {0x2553, 12, 8, 13, 4, 11, 35843},
+    {0x2554, 12, 8, 14, 4, 10, 35866},
+    {0x2555, 12, 7, 14, 0, 10, 35888},
+    {0x2556, 12, 8, 13, 0, 11, 35901},
+    {0x2557, 12, 8, 14, 0, 10, 35925},
+    {0x2558, 12, 7, 15, 5, 0, 35948},
+    {0x2559, 12, 8, 13, 4, 0, 35961},
+    {0x255A, 12, 8, 15, 4, 0, 35985},
+    {0x255B, 12, 7, 15, 0, 0, 36010},
+    {0x255C, 12, 8, 13, 0, 0, 36023},
+    {0x255D, 12, 8, 15, 0, 0, 36046},
+    {0x255E, 12, 7, 24, 5, 0, 36070},
+    {0x255F, 12, 8, 24, 4, 0, 36092},
+    {0x2560, 12, 8, 24, 4, 0, 36138},
+    {0x2561, 12, 7, 24, 0, 0, 36181},
+    {0x2562, 12, 8, 24, 0, 0, 36203},
+    {0x2563, 12, 8, 24, 0, 0, 36249},
+    {0x2564, 12, 12, 14, 0, 10, 36292},
+    {0x2565, 12, 12, 13, 0, 11, 36304},
+    {0x2566, 12, 12, 14, 0, 10, 36328},
+    {0x2567, 12, 12, 15, 0, 0, 36351},
+    {0x2568, 12, 12, 13, 0, 0, 36364},
+    {0x2569, 12, 12, 15, 0, 0, 36388},
+    {0x256A, 12, 12, 24, 0, 0, 36412},
+    {0x256B, 12, 12, 24, 0, 0, 36436},
+    {0x256C, 12, 12, 24, 0, 0, 36482},
+    {0x256D, 12, 7, 13, 5, 11, 36526},
+    {0x256E, 12, 7, 13, 0, 11, 36539},
+    {0x256F, 12, 7, 13, 0, 0, 36552},
+    {0x2570, 12, 7, 13, 5, 0, 36564},
+    {0x2571, 12, 14, 24, -1, 0, 36577},
+    {0x2572, 12, 14, 24, -1, 0, 36601},
+    {0x2573, 12, 14, 24, -1, 0, 36625},
+    {0x2574, 12, 6, 2, 0, 11, 36667},
+    {0x2575, 12, 2, 12, 5, 0, 36668},
+    {0x2576, 12, 6, 2, 6, 11, 36670},
+    {0x2577, 12, 2, 12, 5, 12, 36671},
+    {0x2578, 12, 6, 4, 0, 10, 36673},
+    {0x2579, 12, 4, 12, 4, 0, 36675},
+    {0x257A, 12, 6, 4, 6, 10, 36678},
+    {0x257B, 12, 4, 12, 4, 12, 36680},
+    {0x257C, 12, 12, 4, 0, 10, 36683},
+    {0x257D, 12, 4, 24, 4, 0, 36686},
+    {0x257E, 12, 12, 4, 0, 10, 36701},
+    {0x257F, 12, 4, 24, 4, 0, 36704},
+    {0x2580, 15, 16, 12, 0, 0, 36719},
+    {0x2581, 15, 16, 3, 0, 21, 36726},
+    {0x2582, 15, 16, 6, 0, 18, 36729},
+    {0x2583, 15, 16, 9, 0, 15, 36733},
+    {0x2584, 15, 16, 12, 0, 12, 36739},
+    {0x2585, 15, 16, 15, 0, 9, 36746},
+    {0x2586, 15, 16, 18, 0, 6, 36755},
+    {0x2587, 15, 16, 21, 0, 3, 36766},
+    {0x2588, 15, 16, 24, 0, 0, 36778},
+    {0x2589, 15, 14, 24, 0, 0, 36792},
+    {0x258A, 15, 12, 24, 0, 0, 36804},
+    {0x258B, 15, 10, 24, 0, 0, 36815},
+    {0x258C, 15, 8, 24, 0, 0, 36824},
+    {0x258D, 15, 6, 24, 0, 0, 36831},
+    {0x258E, 15, 4, 24, 0, 0, 36837},
+    {0x258F, 15, 2, 24, 0, 0, 36841},
+    {0x2590, 15, 8, 24, 8, 0, 36844},
+    {0x2591, 15, 13, 24, 0, 0, 36851},
+    {0x2592, 15, 15, 24, 0, 0, 36890},
+    {0x2593, 15, 15, 24, 0, 0, 36982},
+    {0x2594, 15, 16, 3, 0, 0, 37021},
+    {0x2595, 15, 2, 24, 14, 0, 37024},
+    {0x2596, 15, 8, 12, 0, 12, 37027},
+    {0x2597, 15, 8, 12, 8, 12, 37031},
+    {0x2598, 15, 8, 12, 0, 0, 37035},
+    {0x2599, 15, 16, 24, 0, 0, 37039},
+    {0x259A, 15, 16, 24, 0, 0, 37058},
+    {0x259B, 15, 16, 24, 0, 0, 37083},
+    {0x259C, 15, 16, 24, 0, 0, 37102},
+    {0x259D, 15, 8, 12, 8, 0, 37121},
+    {0x259E, 15, 16, 24, 0, 0, 37125},
+    {0x259F, 15, 16, 24, 0, 0, 37149},
+    {0x25A0, 19, 15, 15, 2, 6, 37168},
+    {0x25A1, 19, 15, 15, 2, 6, 37177},
+    {0x25A2, 19, 15, 15, 2, 6, 37192},
+    {0x25A3, 19, 15, 15, 2, 6, 37208},
+    {0x25A4, 19, 15, 15, 2, 6, 37233},
+    {0x25A5, 19, 15, 15, 2, 6, 37246},
+    {0x25A6, 19, 15, 15, 2, 6, 37313},
+    {0x25A7, 19, 15, 15, 2, 6, 37362},
+    {0x25A8, 19, 15, 15, 2, 6, 37410},
+    {0x25A9, 19, 15, 15, 2, 6, 37458},
+    {0x25AA, 14, 10, 10, 2, 9, 37506},
+    {0x25AB, 14, 10, 10, 2, 9, 37510},
+    {0x25AC, 19, 15, 8, 2, 10, 37519},
+    {0x25AD, 19, 15, 8, 2, 10, 37524},
+    {0x25AE, 11, 7, 15, 2, 6, 37532},
+    {0x25AF, 11, 7, 15, 2, 6, 37537},
+    {0x25B0, 15, 15, 8, 0, 10, 37551},
+    {0x25B1, 15, 15, 8, 0, 10, 37559},
+    {0x25B2, 15, 15, 15, 0, 6, 37572},
+    {0x25B3, 15, 15, 15, 0, 6, 37587},
+    {0x25B4, 10, 10, 10, 0, 9, 37613},
+    {0x25B5, 10, 10, 10, 0, 9, 37623},
+    {0x25B6, 15, 15, 15, 0, 6, 37639},
+    {0x25B7, 15, 15, 15, 0, 6, 37654},
+    {0x25B8, 10, 10, 10, 0, 9, 37680},
+    {0x25B9, 10, 10, 10, 0, 9, 37690},
+    {0x25BA, 15, 15, 10, 0, 9, 37706},
+    {0x25BB, 15, 15, 10, 0, 9, 37716},
+    {0x25BC, 15, 15, 15, 0, 6, 37732},
+    {0x25BD, 15, 15, 15, 0, 6, 37748},
+    {0x25BE, 10, 10, 10, 0, 9, 37776},
+    {0x25BF, 10, 10, 10, 0, 9, 37785},
+    {0x25C0, 15, 15, 15, 0, 6, 37800},
+    {0x25C1, 15, 15, 15, 0, 6, 37815},
+    {0x25C2, 10, 10, 10, 0, 9, 37841},
+    {0x25C3, 10, 10, 10, 0, 9, 37851},
+    {0x25C4, 15, 15, 10, 0, 9, 37867},
+    {0x25C5, 15, 15, 10, 0, 9, 37877},
+    {0x25C6, 15, 15, 15, 0, 6, 37893},
+    {0x25C7, 15, 15, 15, 0, 6, 37909},
+    {0x25C8, 15, 15, 15, 0, 6, 37936},
+    {0x25C9, 17, 15, 16, 1, 6, 37972},
+    {0x25CA, 10, 10, 21, 0, 3, 38006},
+    {0x25CB, 17, 15, 16, 1, 6, 38037},
+    {0x25CC, 17, 15, 15, 1, 6, 38061},
+    {0x25CD, 17, 15, 16, 1, 6, 38080},
+    {0x25CE, 17, 15, 16, 1, 6, 38142},
+    {0x25CF, 17, 15, 15, 1, 6, 38177},
+    {0x25D0, 17, 15, 15, 1, 6, 38191},
+    {0x25D1, 17, 15, 15, 1, 6, 38214},
+    {0x25D2, 17, 15, 15, 1, 6, 38237},
+    {0x25D3, 17, 15, 15, 1, 6, 38255},
+    {0x25D4, 17, 15, 15, 1, 6, 38273},
+    {0x25D5, 17, 15, 15, 1, 6, 38296},
+    {0x25D6, 11, 8, 16, 1, 6, 38314},
+    {0x25D7, 11, 7, 16, 2, 6, 38327},
+    {0x25D8, 16, 12, 15, 2, 4, 38336},
+    {0x25D9, 19, 16, 20, 2, 4, 38346},
+    {0x25DA, 19, 16, 10, 2, 4, 38376},
+    {0x25DB, 19, 16, 10, 2, 14, 38393},
+    {0x25DC, 8, 8, 8, 0, 6, 38408},
+    {0x25DD, 8, 8, 8, 0, 6, 38416},
+    {0x25DE, 8, 8, 8, 0, 14, 38424},
+    {0x25DF, 8, 8, 8, 0, 14, 38431},
+    {0x25E0, 17, 15, 8, 1, 6, 38439},
+    {0x25E1, 17, 15, 8, 1, 14, 38451},
+    {0x25E2, 15, 15, 15, 0, 6, 38464},
+    {0x25E3, 15, 15, 15, 0, 6, 38479},
+    {0x25E4, 15, 15, 15, 0, 6, 38494},
+    {0x25E5, 15, 15, 15, 0, 6, 38509},
+    {0x25E6, 12, 6, 5, 3, 9, 38525},
+    {0x25E7, 19, 15, 15, 2, 6, 38531},
+    {0x25E8, 19, 15, 15, 2, 6, 38546},
+    {0x25E9, 19, 15, 15, 2, 6, 38561},
+    {0x25EA, 19, 15, 15, 2, 6, 38576},
+    {0x25EB, 19, 15, 15, 2, 6, 38591},
+    {0x25EC, 15, 15, 15, 0, 6, 38619},
+    {0x25ED, 15, 15, 15, 0, 6, 38648},
+    {0x25EE, 15, 15, 15, 0, 6, 38673},
+    {0x25EF, 22, 20, 20, 1, 4, 38699},
+    {0x25F0, 19, 15, 15, 2, 6, 38736},
+    {0x25F1, 19, 15, 15, 2, 6, 38757},
+    {0x25F2, 19, 15, 15, 2, 6, 38778},
+    {0x25F3, 19, 15, 15, 2, 6, 38799},
+    {0x25F4, 17, 15, 15, 1, 6, 38820},
+    {0x25F5, 17, 15, 15, 1, 6, 38849},
+    {0x25F6, 17, 15, 15, 1, 6, 38878},
+    {0x25F7, 17, 15, 15, 1, 6, 38907},
+    {0x25F8, 15, 15, 15, 0, 6, 38936},
+    {0x25F9, 15, 15, 15, 0, 6, 38962},
+    {0x25FA, 15, 15, 15, 0, 6, 38989},
+    {0x25FB, 17, 13, 13, 2, 7, 39015},
+    {0x25FC, 17, 13, 13, 2, 7, 39027},
+    {0x25FD, 15, 11, 11, 2, 8, 39034},
+    {0x25FE, 15, 11, 11, 2, 8, 39044},
+    {0x25FF, 15, 15, 15, 0, 6, 39049},
+    {0x2600, 18, 14, 15, 2, 4, 39074},
+    {0x2601, 20, 18, 7, 1, 12, 39099},
+    {0x2602, 18, 16, 15, 1, 4, 39107},
+    {0x2603, 18, 14, 19, 2, 0, 39127},
+    {0x2604, 18, 16, 18, 1, 1, 39166},
+    {0x2605, 18, 16, 14, 1, 5, 39190},
+    {0x2606, 18, 16, 14, 1, 5, 39208},
+    {0x2607, 11, 8, 15, 2, 4, 39237},
+    {0x2608, 18, 14, 15, 2, 4, 39253},
+    {0x2609, 18, 14, 15, 2, 4, 39277},
+    {0x260A, 18, 16, 15, 1, 4, 39302},
+    {0x260B, 18, 16, 14, 1, 5, 39337},
+    {0x260C, 13, 11, 14, 1, 5, 39368},
+    {0x260D, 20, 18, 14, 1, 5, 39388},
+    {0x260E, 25, 23, 15, 1, 4, 39417},
+    {0x260F, 25, 23, 15, 1, 4, 39456},
+    {0x2610, 18, 14, 15, 2, 4, 39512},
+    {0x2611, 18, 14, 15, 2, 4, 39526},
+    {0x2612, 18, 14, 15, 2, 4, 39549},
+    {0x2613, 11, 8, 11, 1, 6, 39578},
+    {0x2614, 18, 16, 19, 1, 0, 39597},
+    {0x2615, 18, 15, 15, 1, 4, 39625},
+    {0x2616, 18, 14, 15, 2, 4, 39651},
+    {0x2617, 18, 14, 15, 2, 4, 39669},
+    {0x2618, 18, 14, 15, 2, 4, 39680},
+    {0x2619, 18, 14, 8, 2, 8, 39704},
+    {0x261A, 18, 14, 9, 2, 8, 39719},
+    {0x261B, 18, 14, 9, 2, 8, 39728},
+    {0x261C, 18, 14, 9, 2, 8, 39736},
+    {0x261D, 12, 10, 14, 1, 5, 39752},
+    {0x261E, 18, 14, 9, 2, 8, 39782},
+    {0x261F, 12, 10, 14, 1, 5, 39797},
+    {0x2620, 18, 16, 15, 1, 4, 39825},
+    {0x2621, 18, 14, 15, 2, 4, 39871},
+    {0x2622, 18, 14, 15, 2, 4, 39890},
+    {0x2623, 18, 16, 15, 1, 4, 39922},
+    {0x2624, 13, 11, 15, 1, 4, 39956},
+    {0x2625, 15, 11, 15, 2, 4, 39985},
+    {0x2626, 13, 9, 15, 2, 4, 40005},
+    {0x2627, 16, 12, 18, 2, 1, 40022},
+    {0x2628, 11, 7, 15, 2, 4, 40053},
+    {0x2629, 18, 14, 15, 2, 4, 40068},
+    {0x262A, 18, 14, 15, 2, 4, 40087},
+    {0x262B, 18, 14, 15, 2, 4, 40108},
+    {0x262C, 14, 11, 15, 2, 4, 40152},
+    {0x262D, 18, 14, 15, 2, 4, 40187},
+    {0x262E, 18, 14, 15, 2, 4, 40210},
+    {0x262F, 18, 14, 15, 2, 4, 40247},
+    {0x2630, 18, 14, 15, 2, 4, 40271},
+    {0x2631, 18, 14, 15, 2, 4, 40279},
+    {0x2632, 18, 14, 15, 2, 4, 40289},
+    {0x2633, 18, 14, 15, 2, 4, 40299},
+    {0x2634, 18, 14, 15, 2, 4, 40310},
+    {0x2635, 18, 14, 15, 2, 4, 40320},
+    {0x2636, 18, 14, 15, 2, 4, 40331},
+    {0x2637, 18, 14, 15, 2, 4, 40342},
+    {0x2638, 18, 16, 15, 1, 4, 40355},
+    {0x2639, 21, 17, 17, 2, 3, 40393},
+    {0x263A, 21, 17, 17, 2, 3, 40429},
+    {0x263B, 21, 17, 17, 2, 3, 40465},
+    {0x263C, 18, 14, 15, 2, 4, 40487},
+    {0x263D, 18, 9, 15, 7, 4, 40516},
+    {0x263E, 18, 9, 15, 2, 4, 40543},
+    {0x263F, 12, 9, 17, 2, 4, 40570},
+    {0x2640, 15, 11, 18, 2, 4, 40593},
+    {0x2641, 15, 11, 17, 2, 2, 40615},
+    {0x2642, 18, 15, 14, 2, 5, 40636},
+    {0x2643, 18, 12, 15, 3, 4, 40662},
+    {0x2644, 18, 10, 15, 4, 4, 40685},
+    {0x2645, 18, 13, 15, 2, 4, 40708},
+    {0x2646, 18, 12, 15, 3, 4, 40743},
+    {0x2647, 18, 8, 15, 5, 4, 40771},
+    {0x2648, 18, 16, 15, 1, 4, 40786},
+    {0x2649, 18, 14, 15, 2, 4, 40812},
+    {0x264A, 18, 14, 15, 2, 4, 40837},
+    {0x264B, 18, 14, 13, 2, 5, 40862},
+    {0x264C, 18, 12, 15, 3, 4, 40888},
+    {0x264D, 18, 16, 19, 1, 4, 40920},
+    {0x264E, 18, 14, 12, 2, 6, 40980},
+    {0x264F, 18, 16, 17, 1, 4, 40997},
+    {0x2650, 18, 14, 15, 2, 4, 41045},
+    {0x2651, 18, 14, 15, 2, 4, 41070},
+    {0x2652, 18, 14, 9, 2, 7, 41102},
+    {0x2653, 18, 12, 15, 3, 4, 41121},
+    {0x2654, 18, 14, 15, 2, 4, 41149},
+    {0x2655, 18, 14, 15, 2, 4, 41180},
+    {0x2656, 18, 12, 15, 3, 4, 41219},
+    {0x2657, 18, 10, 15, 4, 4, 41247},
+    {0x2658, 18, 12, 15, 3, 4, 41273},
+    {0x2659, 18, 12, 15, 3, 4, 41303},
+    {0x265A, 18, 14, 15, 2, 4, 41325},
+    {0x265B, 18, 14, 15, 2, 4, 41353},
+    {0x265C, 18, 12, 15, 3, 4, 41392},
+    {0x265D, 18, 10, 15, 4, 4, 41412},
+    {0x265E, 18, 12, 15, 3, 4, 41431},
+    {0x265F, 18, 12, 15, 3, 4, 41455},
+    {0x2660, 18, 12, 15, 3, 4, 41469},
+    {0x2661, 18, 14, 15, 2, 4, 41486},
+    {0x2662, 18, 12, 15, 3, 4, 41516},
+    {0x2663, 18, 14, 15, 2, 4, 41543},
+    {0x2664, 18, 12, 15, 3, 4, 41561},
+    {0x2665, 18, 14, 15, 2, 4, 41588},
+    {0x2666, 18, 12, 15, 3, 4, 41604},
+    {0x2667, 18, 14, 15, 2, 4, 41619},
+    {0x2668, 18, 14, 15, 2, 4, 41653},
+    {0x2669, 9, 5, 15, 2, 4, 41686},
+    {0x266A, 13, 9, 15, 2, 4, 41699},
+    {0x266B, 18, 10, 17, 4, 4, 41717},
+    {0x266C, 18, 14, 15, 2, 4, 41743},
+    {0x266D, 9, 6, 15, 2, 4, 41766},
+    {0x266E, 7, 3, 15, 2, 4, 41782},
+    {0x266F, 10, 6, 15, 2, 4, 41793},
+    {0x2670, 15, 11, 15, 2, 4, 41813},
+    {0x2671, 15, 13, 15, 1, 4, 41834},
+    {0x2672, 18, 14, 14, 2, 5, 41860},
+    {0x2673, 18, 14, 15, 2, 4, 41896},
+    {0x2674, 18, 14, 15, 2, 4, 41922},
+    {0x2675, 18, 14, 15, 2, 4, 41948},
+    {0x2676, 18, 14, 15, 2, 4, 41976},
+    {0x2677, 18, 14, 15, 2, 4, 42004},
+    {0x2678, 18, 14, 15, 2, 4, 42032},
+    {0x2679, 18, 14, 15, 2, 4, 42063},
+    {0x267A, 18, 14, 15, 2, 4, 42090},
+    {0x267B, 18, 14, 14, 2, 5, 42111},
+    {0x267C, 18, 14, 15, 2, 4, 42135},
+    {0x267D, 18, 14, 15, 2, 4, 42166},
+    {0x267E, 18, 14, 15, 2, 4, 42204},
+    {0x267F, 18, 12, 15, 3, 4, 42239},
+    {0x2680, 17, 15, 15, 1, 4, 42262},
+    {0x2681, 17, 15, 15, 1, 4, 42279},
+    {0x2682, 17, 15, 15, 1, 4, 42299},
+    {0x2683, 17, 15, 15, 1, 4, 42322},
+    {0x2684, 17, 15, 15, 1, 4, 42348},
+    {0x2685, 17, 15, 15, 1, 4, 42377},
+    {0x2686, 18, 14, 15, 2, 4, 42409},
+    {0x2687, 18, 14, 15, 2, 4, 42434},
+    {0x2688, 18, 14, 15, 2, 4, 42462},
+    {0x2689, 18, 14, 15, 2, 4, 42476},
+    {0x268A, 18, 14, 2, 2, 17, 42493},
+    {0x268B, 18, 14, 2, 2, 17, 42495},
+    {0x268C, 18, 14, 8, 2, 11, 42498},
+    {0x268D, 18, 14, 8, 2, 11, 42503},
+    {0x268E, 18, 14, 8, 2, 11, 42509},
+    {0x268F, 18, 14, 8, 2, 11, 42515},
+    {0x2690, 18, 12, 15, 3, 4, 42523},
+    {0x2691, 18, 12, 15, 3, 4, 42548},
+    {0x2692, 18, 16, 15, 1, 4, 42565},
+    {0x2693, 18, 14, 15, 2, 4, 42594},
+    {0x2694, 18, 12, 15, 3, 4, 42618},
+    {0x2695, 11, 9, 15, 1, 4, 42643},
+    {0x2696, 18, 16, 15, 1, 4, 42663},
+    {0x2697, 18, 16, 15, 1, 4, 42704},
+    {0x2698, 18, 12, 15, 3, 4, 42731},
+    {0x2699, 18, 14, 15, 2, 4, 42753},
+    {0x269A, 18, 12, 15, 3, 4, 42781},
+    {0x269B, 18, 12, 15, 3, 4, 42802},
+    {0x269C, 18, 12, 15, 3, 4, 42837},
+    {0x269E, 18, 13, 13, 2, 5, 42865},
+    {0x269F, 18, 13, 13, 2, 5, 42876},
+    {0x26A0, 18, 16, 15, 1, 4, 42887},
+    {0x26A1, 14, 10, 15, 2, 4, 42919},
+    {0x26A2, 20, 16, 18, 2, 4, 42934},
+    {0x26A3, 22, 18, 18, 2, 5, 42974},
+    {0x26A4, 24, 20, 21, 2, 2, 43014},
+    {0x26A5, 18, 15, 21, 2, 1, 43065},
+    {0x26A6, 17, 12, 17, 3, 2, 43098},
+    {0x26A7, 17, 13, 21, 2, 1, 43127},
+    {0x26A8, 17, 9, 17, 4, 2, 43163},
+    {0x26A9, 17, 17, 9, 0, 7, 43186},
+    {0x26AA, 17, 9, 9, 4, 7, 43210},
+    {0x26AB, 17, 9, 9, 4, 7, 43220},
+    {0x26AC, 17, 7, 7, 5, 8, 43227},
+    {0x26AD, 17, 9, 7, 3, 8, 43237},
+    {0x26AE, 17, 15, 8, 1, 8, 43255},
+    {0x26AF, 17, 17, 7, 0, 8, 43277},
+    {0x26B0, 17, 13, 6, 2, 8, 43297},
+    {0x26B1, 17, 9, 13, 4, 5, 43304},
+    {0x26B2, 15, 11, 18, 2, 4, 43325},
+    {0x26B3, 15, 10, 18, 3, 4, 43347},
+    {0x26B4, 15, 11, 18, 2, 4, 43366},
+    {0x26B5, 15, 11, 18, 2, 4, 43390},
+    {0x26B6, 17, 15, 15, 1, 6, 43414},
+    {0x26B7, 15, 8, 16, 4, 5, 43436},
+    {0x26B8, 15, 8, 18, 3, 4, 43459},
+    {0x26C0, 17, 15, 11, 1, 8, 43477},
+    {0x26C1, 17, 15, 14, 1, 5, 43494},
+    {0x26C2, 17, 15, 11, 1, 8, 43515},
+    {0x26C3, 17, 15, 14, 1, 5, 43537},
+    {0x26E2, 15, 11, 17, 2, 2, 43564},
+    {0x2701, 17, 16, 9, 0, 6, 43591},
+    {0x2702, 17, 15, 9, 1, 7, 43606},
+    {0x2703, 17, 16, 9, 0, 8, 43622},
+    {0x2704, 17, 15, 10, 1, 7, 43635},
+    {0x2706, 17, 15, 15, 1, 4, 43658},
+    {0x2707, 17, 15, 15, 1, 4, 43693},
+    {0x2708, 17, 15, 14, 1, 5, 43729},
+    {0x2709, 17, 14, 10, 1, 7, 43747},
+    {0x270C, 17, 7, 15, 4, 4, 43766},
+    {0x270D, 17, 16, 12, 0, 5, 43798},
+    {0x270E, 17, 12, 13, 2, 5, 43830},
+    {0x270F, 17, 15, 7, 1, 8, 43864},
+    {0x2710, 17, 12, 13, 2, 5, 43877},
+    {0x2711, 17, 14, 7, 1, 8, 43913},
+    {0x2712, 17, 14, 6, 1, 9, 43926},
+    {0x2713, 17, 10, 11, 3, 6, 43934},
+    {0x2714, 17, 12, 11, 2, 6, 43946},
+    {0x2715, 17, 11, 12, 3, 6, 43959},
+    {0x2716, 17, 13, 13, 2, 5, 43977},
+    {0x2717, 17, 12, 15, 2, 4, 43996},
+    {0x2718, 17, 13, 15, 2, 4, 44017},
+    {0x2719, 17, 15, 15, 1, 4, 44039},
+    {0x271A, 17, 15, 15, 1, 4, 44073},
+    {0x271B, 17, 15, 15, 1, 4, 44087},
+    {0x271C, 17, 15, 15, 1, 4, 44103},
+    {0x271D, 17, 10, 15, 3, 4, 44119},
+    {0x271E, 17, 11, 15, 3, 4, 44133},
+    {0x271F, 17, 11, 15, 3, 4, 44158},
+    {0x2720, 17, 15, 15, 1, 4, 44186},
+    {0x2721, 17, 13, 15, 2, 4, 44211},
+    {0x2722, 17, 15, 15, 1, 4, 44240},
+    {0x2723, 17, 15, 15, 1, 4, 44259},
+    {0x2724, 17, 15, 15, 1, 4, 44279},
+    {0x2725, 17, 15, 15, 1, 4, 44301},
+    {0x2726, 17, 15, 15, 1, 4, 44328},
+    {0x2727, 17, 15, 15, 1, 4, 44344},
+    {0x2729, 17, 16, 15, 0, 4, 44367},
+    {0x272A, 17, 15, 15, 1, 4, 44398},
+    {0x272B, 17, 16, 15, 0, 4, 44422},
+    {0x272C, 17, 16, 15, 0, 4, 44447},
+    {0x272D, 17, 16, 15, 0, 4, 44481},
+    {0x272E, 17, 16, 15, 0, 4, 44513},
+    {0x272F, 17, 16, 15, 0, 4, 44543},
+    {0x2730, 17, 16, 14, 0, 5, 44571},
+    {0x2731, 17, 14, 15, 1, 4, 44600},
+    {0x2732, 17, 14, 15, 1, 4, 44621},
+    {0x2733, 17, 15, 15, 1, 4, 44648},
+    {0x2734, 17, 15, 15, 1, 4, 44678},
+    {0x2735, 17, 15, 15, 1, 4, 44703},
+    {0x2736, 17, 13, 15, 2, 4, 44739},
+    {0x2737, 17, 15, 15, 1, 4, 44760},
+    {0x2738, 17, 15, 15, 1, 4, 44784},
+    {0x2739, 17, 15, 15, 1, 4, 44804},
+    {0x273A, 17, 15, 15, 1, 4, 44826},
+    {0x273B, 17, 13, 15, 2, 4, 44863},
+    {0x273C, 17, 13, 15, 2, 4, 44886},
+    {0x273D, 17, 13, 15, 2, 4, 44911},
+    {0x273E, 17, 13, 15, 2, 4, 44936},
+    {0x273F, 17, 15, 14, 1, 5, 44969},
+    {0x2740, 17, 15, 14, 1, 5, 44992},
+    {0x2741, 17, 15, 15, 1, 4, 45027},
+    {0x2742, 17, 15, 15, 1, 4, 45076},
+    {0x2743, 17, 13, 15, 2, 4, 45114},
+    {0x2744, 17, 13, 15, 2, 4, 45152},
+    {0x2745, 17, 13, 15, 2, 4, 45186},
+    {0x2746, 17, 14, 15, 1, 4, 45223},
+    {0x2747, 17, 13, 15, 2, 4, 45261},
+    {0x2748, 17, 15, 15, 1, 4, 45284},
+    {0x2749, 17, 15, 15, 1, 4, 45317},
+    {0x274A, 17, 15, 15, 1, 4, 45349},
+    {0x274B, 17, 15, 15, 1, 4, 45381},
+    {0x274D, 18, 16, 15, 1, 4, 45415},
+    {0x274F, 18, 16, 16, 1, 4, 45438},
+    {0x2750, 18, 16, 16, 1, 3, 45456},
+    {0x2751, 18, 16, 16, 1, 4, 45472},
+    {0x2752, 18, 16, 16, 1, 3, 45490},
+    {0x2756, 18, 14, 15, 2, 4, 45506},
+    {0x2758, 17, 1, 20, 8, 4, 45529},
+    {0x2759, 17, 3, 20, 7, 4, 45531},
+    {0x275A, 17, 7, 20, 5, 4, 45534},
+    {0x275B, 6, 3, 7, 2, 4, 45540},
+    {0x275C, 6, 4, 7, 1, 4, 45544},
+    {0x275D, 11, 8, 7, 2, 4, 45549},
+    {0x275E, 11, 8, 7, 1, 4, 45560},
+    {0x2761, 17, 12, 19, 3, 2, 45568},
+    {0x2762, 17, 9, 15, 4, 4, 45597},
+    {0x2763, 17, 11, 15, 3, 4, 45611},
+    {0x2764, 17, 15, 11, 1, 6, 45628},
+    {0x2765, 17, 12, 15, 3, 4, 45642},
+    {0x2766, 17, 13, 14, 1, 5, 45657},
+    {0x2767, 17, 13, 8, 2, 8, 45682},
+    {0x2768, 17, 9, 18, 4, 4, 45695},
+    {0x2769, 17, 9, 18, 4, 4, 45713},
+    {0x276A, 17, 6, 18, 5, 4, 45731},
+    {0x276B, 17, 6, 18, 5, 4, 45749},
+    {0x276C, 17, 8, 20, 4, 4, 45767},
+    {0x276D, 17, 7, 20, 5, 4, 45787},
+    {0x276E, 17, 11, 20, 3, 4, 45807},
+    {0x276F, 17, 11, 20, 3, 4, 45827},
+    {0x2770, 17, 10, 20, 3, 4, 45847},
+    {0x2771, 17, 9, 20, 4, 4, 45867},
+    {0x2772, 17, 4, 20, 7, 4, 45887},
+    {0x2773, 17, 4, 20, 6, 4, 45907},
+    {0x2774, 17, 10, 18, 3, 4, 45926},
+    {0x2775, 17, 9, 18, 4, 4, 45944},
+    {0x2776, 18, 15, 15, 1, 4, 45962},
+    {0x2777, 18, 15, 15, 1, 4, 45985},
+    {0x2778, 18, 15, 15, 1, 4, 46009},
+    {0x2779, 18, 15, 15, 1, 4, 46034},
+    {0x277A, 18, 15, 15, 1, 4, 46060},
+    {0x277B, 18, 15, 15, 1, 4, 46084},
+    {0x277C, 18, 15, 15, 1, 4, 46109},
+    {0x277D, 18, 15, 15, 1, 4, 46132},
+    {0x277E, 18, 15, 15, 2, 4, 46162},
+    {0x277F, 18, 15, 15, 1, 4, 46187},
+    {0x2780, 17, 17, 17, 0, 3, 46223},
+    {0x2781, 17, 17, 17, 0, 3, 46265},
+    {0x2782, 17, 17, 17, 0, 3, 46307},
+    {0x2783, 17, 17, 17, 0, 3, 46348},
+    {0x2784, 17, 17, 17, 0, 3, 46394},
+    {0x2785, 17, 17, 17, 0, 3, 46436},
+    {0x2786, 17, 17, 17, 0, 3, 46482},
+    {0x2787, 17, 17, 17, 0, 3, 46523},
+    {0x2788, 17, 17, 17, 0, 3, 46573},
+    {0x2789, 17, 17, 17, 0, 3, 46620},
+    {0x278A, 17, 17, 17, 0, 3, 46681},
+    {0x278B, 17, 17, 17, 0, 3, 46710},
+    {0x278C, 17, 17, 17, 0, 3, 46737},
+    {0x278D, 17, 17, 17, 0, 3, 46764},
+    {0x278E, 17, 17, 17, 0, 3, 46795},
+    {0x278F, 17, 17, 17, 0, 3, 46823},
+    {0x2790, 17, 17, 17, 0, 3, 46855},
+    {0x2791, 17, 17, 17, 0, 3, 46883},
+    {0x2792, 17, 17, 17, 0, 3, 46918},
+    {0x2793, 17, 17, 17, 0, 3, 46950},
+    {0x2794, 17, 15, 10, 1, 8, 46999},
+    {0x2798, 17, 12, 11, 2, 7, 47009},
+    {0x2799, 17, 15, 9, 1, 8, 47022},
+    {0x279A, 17, 12, 11, 2, 8, 47032},
+    {0x279B, 17, 15, 7, 1, 9, 47044},
+    {0x279C, 17, 14, 10, 1, 8, 47051},
+    {0x279D, 17, 15, 9, 1, 8, 47060},
+    {0x279E, 17, 15, 9, 1, 8, 47070},
+    {0x279F, 17, 15, 9, 1, 8, 47079},
+    {0x27A0, 17, 15, 9, 1, 8, 47095},
+    {0x27A1, 17, 15, 10, 1, 8, 47116},
+    {0x27A2, 17, 14, 9, 2, 8, 47125},
+    {0x27A3, 17, 14, 9, 2, 8, 47136},
+    {0x27A4, 17, 14, 13, 2, 6, 47147},
+    {0x27A5, 17, 15, 9, 1, 8, 47160},
+    {0x27A6, 17, 15, 9, 1, 8, 47170},
+    {0x27A7, 17, 7, 13, 5, 6, 47180},
+    {0x27A8, 17, 15, 9, 1, 8, 47192},
+    {0x27A9, 17, 14, 10, 1, 8, 47200},
+    {0x27AA, 17, 14, 10, 1, 8, 47215},
+    {0x27AB, 17, 16, 12, 0, 7, 47231},
+    {0x27AC, 17, 16, 12, 0, 7, 47248},
+    {0x27AD, 17, 12, 11, 3, 8, 47267},
+    {0x27AE, 17, 12, 11, 3, 8, 47282},
+    {0x27AF, 17, 15, 10, 1, 8, 47298},
+    {0x27B1, 17, 15, 10, 1, 8, 47315},
+    {0x27B2, 17, 11, 12, 3, 7, 47333},
+    {0x27B3, 17, 15, 6, 1, 10, 47346},
+    {0x27B4, 17, 12, 12, 2, 6, 47358},
+    {0x27B5, 17, 15, 6, 1, 10, 47374},
+    {0x27B6, 17, 12, 12, 2, 8, 47384},
+    {0x27B7, 17, 12, 12, 2, 6, 47399},
+    {0x27B8, 17, 15, 6, 1, 10, 47412},
+    {0x27B9, 17, 12, 12, 2, 8, 47421},
+    {0x27BA, 17, 15, 9, 1, 8, 47434},
+    {0x27BB, 17, 15, 7, 1, 9, 47447},
+    {0x27BC, 17, 13, 6, 2, 10, 47459},
+    {0x27BD, 17, 13, 8, 2, 9, 47468},
+    {0x27BE, 17, 15, 9, 1, 8, 47481},
+    {0x1F311, 21, 17, 17, 2, 3, 47498},
+    {0x1F312, 21, 17, 17, 2, 3, 47514},
+    {0x1F313, 21, 17, 17, 2, 3, 47539},
+    {0x1F314, 21, 17, 17, 2, 3, 47564},
+    {0x1F315, 21, 17, 17, 2, 3, 47589},
+    {0x1F316, 21, 17, 17, 2, 3, 47617},
+    {0x1F317, 21, 17, 17, 2, 3, 47642},
+    {0x1F318, 21, 17, 17, 2, 3, 47667},
+    {0x1F42D, 21, 18, 19, 1, 1, 47692},
+    {0x1F42E, 24, 22, 17, 1, 3, 47753},
+    {0x1F431, 21, 19, 19, 1, 1, 47809},
+    {0x1F435, 23, 19, 19, 2, 1, 47867},
+    {0x1F600, 21, 17, 17, 2, 3, 47916},
+    {0x1F601, 21, 17, 17, 2, 3, 47960},
+    {0x1F602, 23, 21, 17, 1, 3, 48010},
+    {0x1F603, 21, 17, 17, 2, 3, 48068},
+    {0x1F604, 21, 17, 17, 2, 3, 48108},
+    {0x1F605, 21, 17, 17, 2, 3, 48154},
+    {0x1F606, 21, 17, 17, 2, 3, 48200},
+    {0x1F607, 21, 18, 19, 1, 1, 48244},
+    {0x1F608, 21, 17, 19, 2, 1, 48294},
+    {0x1F609, 21, 17, 17, 2, 3, 48340},
+    {0x1F60A, 21, 17, 17, 2, 3, 48378},
+    {0x1F60B, 21, 17, 17, 2, 3, 48420},
+    {0x1F60C, 21, 17, 17, 2, 3, 48468},
+    {0x1F60D, 21, 17, 17, 2, 3, 48510},
+    {0x1F60E, 21, 17, 17, 2, 3, 48551},
+    {0x1F60F, 21, 17, 17, 2, 3, 48586},
+    {0x1F610, 21, 17, 17, 2, 3, 48618},
+    {0x1F611, 21, 17, 17, 2, 3, 48650},
+    {0x1F612, 21, 17, 17, 2, 3, 48680},
+    {0x1F613, 21, 17, 17, 2, 3, 48712},
+    {0x1F614, 21, 17, 17, 2, 3, 48753},
+    {0x1F615, 21, 17, 17, 2, 3, 48791},
+    {0x1F616, 21, 17, 17, 2, 3, 48826},
+    {0x1F617, 21, 17, 17, 2, 3, 48866},
+    {0x1F618, 21, 17, 17, 2, 3, 48901},
+    {0x1F619, 21, 17, 17, 2, 3, 48942},
+    {0x1F61A, 21, 17, 17, 2, 3, 48983},
+    {0x1F61B, 21, 17, 17, 2, 3, 49024},
+    {0x1F61C, 21, 17, 17, 2, 3, 49062},
+    {0x1F61D, 21, 17, 17, 2, 3, 49101},
+    {0x1F61E, 21, 17, 17, 2, 3, 49142},
+    {0x1F61F, 21, 17, 17, 2, 3, 49184},
+    {0x1F620, 21, 17, 17, 2, 3, 49228},
+    {0x1F621, 21, 17, 17, 2, 3, 49269},
+    {0x1F622, 21, 17, 17, 2, 3, 49312},
+    {0x1F623, 21, 17, 17, 2, 3, 49354},
+    {0x1F625, 21, 17, 17, 2, 3, 49393},
+    {0x1F626, 21, 17, 17, 2, 3, 49432},
+    {0x1F627, 21, 17, 17, 2, 3, 49470},
+    {0x1F628, 21, 17, 17, 2, 3, 49515},
+    {0x1F629, 21, 17, 17, 2, 3, 49567},
+    {0x1F62A, 21, 17, 17, 2, 3, 49611},
+    {0x1F62B, 21, 17, 17, 2, 3, 49656},
+    {0x1F62D, 23, 21, 17, 1, 3, 49698},
+    {0x1F62E, 21, 17, 17, 2, 3, 49744},
+    {0x1F62F, 21, 17, 17, 2, 3, 49779},
+    {0x1F630, 21, 17, 17, 2, 3, 49819},
+    {0x1F631, 21, 21, 18, 0, 3, 49863},
+    {0x1F632, 21, 17, 17, 2, 3, 49932},
+    {0x1F633, 21, 17, 17, 2, 3, 49983},
+    {0x1F634, 32, 29, 20, 2, 0, 50026},
+    {0x1F635, 21, 17, 17, 2, 3, 50091},
+    {0x1F636, 21, 17, 17, 2, 3, 50134},
+    {0x1F637, 21, 17, 17, 2, 3, 50165},
+    {0x1F638, 21, 19, 19, 1, 1, 50201},
+    {0x1F639, 23, 21, 19, 1, 1, 50268},
+    {0x1F63A, 21, 19, 19, 1, 1, 50336},
+    {0x1F63B, 21, 19, 19, 1, 1, 50397},
+    {0x1F63C, 21, 19, 19, 1, 1, 50456},
+    {0x1F63D, 21, 19, 19, 1, 1, 50516},
+    {0x1F63E, 21, 19, 19, 1, 1, 50575},
+    {0x1F63F, 21, 19, 19, 1, 1, 50639},
+    {0x1F640, 21, 19, 19, 1, 1, 50700},
+    {0x1F643, 21, 17, 17, 2, 3, 50758},
+};
+
+// Nibble-packed run lengths, alternating white/black from white, row-major per glyph.
+static const uint8_t rasterGlyphRuns[] = {
+    15, 116, 64, 2, 36, 36, 36, 36, 34, 97, 50, 114, 50, 114, 49, 129, 50, 77, 29, 66,
+    49, 130, 34, 129, 50, 77, 29, 66, 49, 129, 50, 114, 50, 114, 49, 65, 129, 101, 55, 19,
+    17, 33, 18, 33, 66, 33, 85, 86, 81, 19, 65, 34, 65, 35, 49, 27, 38, 97, 129, 129,
+    35, 113, 82, 18, 97, 66, 50, 65, 82, 50, 50, 82, 50, 49, 98, 50, 33, 130, 18, 49,
+    147, 49, 51, 145, 50, 18, 129, 34, 50, 97, 50, 50, 82, 50, 50, 81, 66, 50, 65, 98,
+    18, 81, 115, 68, 150, 115, 49, 114, 194, 195, 180, 150, 66, 19, 35, 35, 18, 67, 18, 34,
+    85, 34, 99, 67, 53, 56, 19, 68, 67, 10, 34, 33, 34, 34, 33, 34, 34, 34, 34, 34,
+    34, 34, 34, 50, 34, 34, 49, 50, 2, 49, 50, 34, 49, 50, 34, 34, 34, 34, 34, 34,
+    34, 18, 34, 34, 33, 34, 65, 129, 65, 49, 49, 18, 17, 18, 67, 99, 66, 17, 18, 17,
+    49, 49, 65, 129, 82, 162, 162, 162, 162, 95, 149, 42, 42, 42, 42, 32, 18, 18, 20, 17,
+    10, 4, 82, 67, 66, 82, 82, 66, 82, 82, 66, 82, 82, 66, 82, 82, 67, 66, 52, 86,
+    50, 66, 34, 66, 18, 100, 100, 100, 100, 100, 100, 98, 18, 66, 34, 66, 54, 84, 36, 54,
+    50, 34, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 72, 24, 22, 40, 17, 83, 114, 114,
+    114, 98, 99, 83, 98, 83, 83, 83, 111, 48, 22, 56, 33, 83, 130, 130, 115, 68, 101, 146,
+    146, 130, 131, 108, 38, 99, 116, 113, 18, 98, 18, 97, 34, 82, 34, 66, 50, 65, 66, 50,
+    66, 34, 82, 47, 119, 41, 41, 32, 23, 39, 34, 114, 114, 118, 55, 33, 67, 114, 114, 114,
+    115, 82, 24, 37, 68, 71, 35, 65, 34, 115, 114, 130, 36, 41, 19, 69, 100, 100, 98, 18,
+    67, 24, 69, 15, 87, 40, 40, 39, 40, 40, 39, 40, 40, 39, 40, 40, 39, 32, 38, 56,
+    19, 69, 100, 98, 18, 66, 54, 56, 34, 66, 18, 100, 100, 101, 67, 24, 54, 37, 72, 19,
+    66, 18, 100, 100, 101, 67, 25, 36, 34, 130, 115, 114, 33, 67, 39, 68, 4, 196, 18, 18,
+    244, 33, 33, 65, 16, 193, 148, 102, 70, 70, 116, 150, 166, 166, 164, 193, 15, 191, 191, 176,
+    1, 196, 166, 166, 166, 148, 118, 70, 70, 100, 145, 21, 39, 17, 67, 98, 98, 83, 67, 67,
+    67, 82, 98, 98, 226, 98, 102, 171, 100, 84, 67, 147, 35, 178, 34, 67, 18, 52, 71, 52,
+    51, 35, 52, 50, 66, 52, 50, 66, 37, 51, 35, 19, 18, 74, 50, 67, 19, 83, 241, 56,
+    23, 53, 56, 155, 80, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82,
+    66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 7, 56, 34, 67, 18, 82, 18, 82, 18, 67,
+    24, 40, 34, 82, 18, 100, 100, 100, 92, 24, 71, 58, 35, 97, 18, 147, 146, 162, 162, 162,
+    162, 163, 162, 179, 97, 42, 71, 8, 74, 34, 84, 18, 114, 18, 117, 132, 132, 132, 132, 132,
+    117, 114, 18, 84, 26, 40, 15, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 15, 54,
+    38, 38, 38, 113, 113, 38, 38, 38, 38, 38, 38, 32, 71, 74, 36, 97, 34, 163, 162, 178,
+    178, 103, 103, 149, 130, 18, 130, 35, 98, 57, 86, 2, 116, 116, 116, 116, 116, 127, 183, 71,
+    71, 71, 71, 71, 71, 32, 15, 240, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 39, 19, 2, 83, 34, 67, 50, 51, 66, 35, 82, 19, 101, 116, 132, 133,
+    114, 19, 98, 35, 82, 51, 66, 67, 50, 83, 34, 99, 2, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 127, 48, 4, 88, 88, 86, 18, 50, 20, 18, 50, 20, 18, 50, 20,
+    34, 18, 36, 34, 18, 36, 34, 18, 36, 51, 52, 51, 52, 51, 52, 148, 148, 146, 3, 102,
+    86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36, 51, 20, 66, 20, 71, 86, 101,
+    99, 70, 106, 67, 67, 50, 130, 19, 133, 164, 164, 164, 164, 165, 131, 18, 130, 51, 67, 74,
+    102, 7, 40, 18, 69, 84, 84, 84, 75, 23, 34, 114, 114, 114, 114, 114, 70, 106, 67, 68,
+    34, 130, 19, 133, 164, 164, 164, 164, 165, 131, 18, 130, 51, 67, 73, 118, 195, 195, 194, 7,
+    72, 50, 67, 34, 82, 34, 82, 34, 67, 40, 55, 66, 51, 50, 67, 34, 82, 34, 82, 34,
+    98, 18, 98, 18, 114, 38, 56, 19, 81, 18, 130, 131, 133, 102, 131, 146, 130, 131, 108, 39,
+    15, 149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 2, 116, 116, 116, 116,
+    116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 2, 146, 18, 114, 34, 114, 34, 114,
+    50, 82, 66, 82, 66, 82, 82, 50, 98, 50, 99, 19, 114, 18, 130, 18, 147, 163, 163, 2,
+    84, 84, 84, 82, 18, 68, 66, 34, 68, 66, 34, 50, 34, 50, 34, 50, 34, 50, 50, 34,
+    34, 34, 66, 34, 34, 34, 66, 18, 66, 18, 66, 18, 66, 18, 69, 68, 100, 68, 100, 68,
+    99, 99, 99, 99, 19, 83, 34, 82, 51, 50, 82, 35, 98, 18, 116, 147, 147, 132, 133, 98,
+    34, 83, 50, 66, 67, 34, 98, 19, 99, 3, 99, 18, 98, 50, 66, 67, 35, 82, 34, 102,
+    116, 146, 162, 162, 162, 162, 162, 162, 162, 15, 153, 41, 41, 56, 56, 57, 41, 41, 56, 57,
+    41, 41, 249, 10, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 40, 2, 83,
+    82, 82, 82, 98, 82, 82, 98, 82, 82, 98, 82, 82, 83, 82, 8, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 42, 83, 146, 18, 114, 50, 82, 82, 50, 114, 15, 80,
+    2, 66, 66, 66, 37, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 2, 130, 130, 130,
+    130, 21, 41, 19, 66, 18, 100, 100, 100, 100, 101, 66, 25, 18, 21, 53, 40, 19, 68, 98,
+    114, 114, 115, 115, 65, 24, 53, 130, 130, 130, 130, 37, 18, 25, 18, 69, 100, 100, 100, 100,
+    98, 18, 67, 25, 37, 18, 53, 56, 34, 69, 111, 152, 41, 53, 18, 131, 96, 52, 37, 34,
+    82, 62, 34, 82, 82, 82, 82, 82, 82, 82, 82, 37, 18, 25, 18, 69, 100, 100, 100, 100,
+    98, 18, 67, 25, 37, 18, 130, 17, 82, 40, 53, 2, 114, 114, 114, 114, 20, 40, 19, 53,
+    84, 84, 84, 84, 84, 84, 84, 82, 4, 79, 112, 34, 34, 162, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 37, 19, 2, 130, 130, 130, 130, 67, 18, 51, 34, 35, 50, 19, 69,
+    84, 101, 82, 19, 66, 35, 50, 51, 34, 67, 15, 240, 2, 20, 52, 40, 22, 19, 52, 53,
+    82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 82, 2, 20, 40, 19,
+    53, 84, 84, 84, 84, 84, 84, 84, 82, 52, 72, 34, 66, 18, 100, 100, 100, 100, 98, 18,
+    66, 40, 68, 2, 21, 41, 19, 66, 18, 100, 100, 100, 100, 101, 66, 25, 18, 21, 34, 130,
+    130, 130, 37, 18, 25, 18, 69, 100, 100, 100, 100, 98, 18, 67, 25, 37, 18, 130, 130, 130,
+    130, 2, 28, 50, 66, 66, 66, 66, 66, 66, 66, 37, 26, 83, 102, 69, 99, 99, 90, 21,
+    18, 82, 82, 78, 18, 82, 82, 82, 82, 82, 82, 86, 37, 2, 84, 84, 84, 84, 84, 84,
+    84, 85, 51, 24, 36, 18, 2, 114, 18, 82, 34, 82, 34, 82, 50, 50, 66, 50, 82, 18,
+    98, 18, 98, 18, 115, 131, 2, 67, 68, 67, 66, 18, 49, 17, 50, 34, 34, 18, 34, 34,
+    34, 18, 34, 34, 34, 18, 34, 50, 17, 49, 18, 68, 52, 68, 52, 82, 82, 98, 82, 3,
+    83, 19, 51, 51, 19, 82, 18, 115, 131, 117, 98, 18, 82, 50, 51, 51, 19, 83, 2, 114,
+    18, 82, 34, 82, 35, 50, 66, 50, 67, 19, 82, 18, 98, 18, 115, 131, 130, 146, 131, 100,
+    115, 15, 54, 38, 38, 53, 53, 54, 38, 53, 243, 68, 53, 50, 98, 98, 98, 98, 98, 52,
+    68, 99, 98, 98, 98, 98, 98, 101, 68, 15, 250, 4, 69, 98, 98, 98, 98, 98, 98, 116,
+    68, 51, 82, 98, 98, 98, 98, 53, 52, 37, 95, 20, 80, 4, 79, 112, 81, 129, 129, 101,
+    40, 19, 17, 35, 49, 50, 49, 50, 49, 50, 49, 50, 49, 67, 17, 33, 24, 53, 97, 129,
+    129, 68, 70, 35, 49, 34, 114, 114, 114, 88, 24, 50, 114, 114, 114, 95, 48, 1, 114, 18,
+    18, 18, 40, 50, 34, 50, 66, 34, 66, 50, 34, 56, 34, 18, 18, 17, 129, 3, 99, 18,
+    98, 35, 67, 50, 66, 82, 34, 98, 34, 74, 84, 146, 106, 98, 162, 162, 162, 162, 14, 110,
+    37, 38, 34, 98, 114, 84, 50, 35, 18, 53, 66, 18, 50, 34, 18, 67, 98, 114, 98, 38,
+    37, 2, 36, 34, 70, 114, 66, 81, 129, 49, 52, 49, 33, 34, 49, 33, 17, 34, 130, 34,
+    130, 34, 130, 34, 130, 34, 129, 17, 34, 49, 33, 33, 52, 49, 49, 129, 82, 66, 118, 22,
+    114, 113, 25, 82, 99, 66, 21, 17, 136, 65, 65, 50, 50, 34, 50, 33, 65, 49, 65, 81,
+    65, 82, 50, 66, 50, 65, 65, 15, 187, 43, 43, 43, 32, 10, 85, 130, 82, 81, 145, 49,
+    38, 49, 33, 34, 50, 33, 17, 50, 50, 50, 50, 50, 50, 54, 66, 50, 33, 82, 50, 34,
+    65, 17, 34, 50, 33, 33, 34, 66, 17, 49, 145, 82, 82, 133, 12, 20, 18, 35, 66, 67,
+    34, 20, 82, 162, 162, 162, 95, 149, 42, 42, 42, 47, 47, 144, 20, 17, 65, 81, 66, 50,
+    50, 49, 70, 5, 97, 81, 35, 97, 81, 86, 50, 34, 34, 34, 2, 82, 18, 82, 18, 82,
+    18, 82, 18, 82, 18, 82, 18, 82, 18, 82, 19, 51, 28, 19, 36, 130, 130, 130, 39, 21,
+    39, 39, 39, 39, 33, 21, 33, 36, 33, 81, 33, 81, 33, 81, 33, 81, 33, 81, 33, 81,
+    33, 81, 33, 81, 33, 81, 33, 4, 33, 50, 37, 3, 65, 65, 65, 65, 65, 65, 37, 36,
+    49, 65, 17, 98, 98, 98, 97, 17, 65, 52, 168, 1, 65, 66, 50, 66, 50, 81, 65, 81,
+    65, 49, 65, 34, 50, 34, 50, 49, 65, 3, 130, 81, 129, 97, 113, 113, 113, 113, 97, 129,
+    81, 145, 81, 117, 33, 97, 113, 98, 113, 83, 97, 82, 17, 81, 97, 33, 81, 86, 49, 161,
+    50, 161, 3, 130, 81, 129, 97, 113, 113, 113, 113, 97, 129, 81, 145, 81, 117, 33, 52, 113,
+    49, 65, 97, 129, 81, 145, 65, 145, 81, 114, 81, 114, 82, 102, 5, 114, 129, 97, 145, 81,
+    115, 97, 161, 65, 177, 49, 193, 49, 117, 49, 97, 129, 98, 129, 83, 113, 82, 17, 97, 97,
+    33, 97, 86, 65, 161, 66, 161, 66, 98, 226, 98, 98, 83, 67, 67, 82, 82, 98, 99, 65,
+    23, 37, 82, 194, 193, 248, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37,
+    36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 114, 177, 178, 248, 58, 58, 57, 33, 40,
+    33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32,
+    83, 161, 17, 145, 49, 247, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37,
+    36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 67, 17, 129, 19, 247, 58, 58, 57, 33,
+    40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41,
+    32, 66, 18, 130, 18, 255, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82,
+    82, 66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 83, 145, 49, 129, 49, 129, 49, 147, 163,
+    149, 130, 18, 130, 18, 114, 50, 98, 50, 98, 50, 82, 82, 66, 82, 73, 59, 34, 114, 34,
+    114, 18, 146, 108, 108, 82, 34, 194, 34, 179, 34, 178, 50, 178, 57, 50, 73, 50, 66, 146,
+    82, 153, 138, 130, 98, 130, 107, 121, 71, 58, 35, 97, 18, 147, 146, 162, 162, 162, 162, 163,
+    162, 179, 97, 42, 71, 129, 178, 162, 131, 50, 129, 130, 207, 87, 39, 39, 39, 245, 114, 114,
+    114, 114, 127, 48, 82, 98, 113, 223, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 51,
+    97, 18, 65, 49, 191, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 34, 34, 50, 34,
+    244, 245, 114, 114, 114, 127, 87, 39, 39, 39, 39, 243, 2, 50, 49, 98, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 18, 98, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 52, 18, 34, 130, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 2, 36, 34, 226, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 40, 106, 66, 84, 50, 114, 50, 115, 34, 137, 89, 82, 34, 130, 34,
+    130, 34, 115, 34, 114, 50, 84, 58, 72, 51, 17, 97, 19, 227, 102, 86, 87, 68, 18, 68,
+    19, 52, 34, 52, 35, 36, 50, 36, 51, 20, 66, 20, 71, 86, 101, 99, 82, 210, 209, 249,
+    102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96,
+    114, 193, 194, 249, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35,
+    52, 52, 166, 96, 98, 180, 146, 34, 247, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74,
+    74, 88, 49, 40, 35, 52, 52, 166, 96, 82, 33, 129, 34, 248, 102, 164, 52, 51, 40, 33,
+    56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 66, 34, 130, 34, 255, 102,
+    106, 67, 67, 50, 130, 19, 133, 164, 164, 164, 164, 165, 131, 18, 130, 51, 67, 74, 102, 17,
+    113, 19, 83, 19, 51, 51, 19, 85, 115, 117, 83, 19, 51, 51, 19, 83, 17, 113, 70, 49,
+    41, 17, 36, 68, 34, 115, 19, 100, 18, 98, 36, 82, 52, 66, 68, 50, 84, 34, 98, 20,
+    99, 19, 114, 36, 68, 33, 25, 33, 54, 65, 162, 162, 240, 39, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 98, 130, 145, 241, 39, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 67, 129, 17, 113, 49, 226, 116, 116, 116,
+    116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 50, 18, 98, 18, 250, 39, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 113, 162, 146, 242, 54,
+    49, 38, 35, 36, 36, 50, 53, 34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 2,
+    114, 114, 119, 40, 18, 69, 84, 84, 84, 75, 23, 34, 114, 114, 37, 71, 35, 51, 18, 82,
+    18, 52, 18, 34, 66, 34, 66, 35, 50, 51, 34, 82, 18, 100, 100, 17, 53, 22, 18, 36,
+    18, 130, 130, 129, 240, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 82, 114, 98,
+    98, 240, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 65, 113, 17, 97, 17, 81,
+    49, 213, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 50, 17, 65, 17, 17, 65, 18,
+    248, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 34, 18, 66, 18, 247, 83, 114,
+    20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 51, 81, 49, 65, 49, 65, 49, 83, 229, 55,
+    33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 37, 53, 55, 23, 33, 68, 66, 130, 98, 47,
+    1, 243, 82, 130, 82, 130, 69, 88, 25, 36, 70, 53, 40, 19, 68, 98, 114, 114, 115, 115,
+    65, 24, 53, 98, 114, 114, 84, 34, 146, 130, 146, 242, 83, 130, 36, 86, 249, 130, 147, 81,
+    40, 54, 98, 114, 114, 129, 243, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 66, 116, 97,
+    33, 82, 34, 240, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 34, 34, 66, 34, 250, 83,
+    130, 36, 86, 249, 130, 147, 81, 40, 54, 2, 66, 66, 65, 146, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 34, 50, 34, 34, 146, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 34,
+    52, 33, 33, 18, 34, 130, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 2, 36, 34, 226,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 49, 65, 69, 53, 146, 101, 56, 34, 66, 18,
+    100, 100, 100, 100, 98, 18, 66, 40, 68, 35, 17, 65, 17, 17, 65, 19, 245, 33, 66, 129,
+    51, 85, 69, 69, 69, 69, 69, 69, 69, 32, 34, 130, 146, 146, 242, 68, 130, 36, 33, 38,
+    70, 70, 70, 70, 33, 36, 34, 132, 64, 98, 114, 114, 114, 243, 68, 130, 36, 33, 38, 70,
+    70, 70, 70, 33, 36, 34, 132, 64, 66, 116, 97, 33, 82, 34, 240, 68, 130, 36, 33, 38,
+    70, 70, 70, 70, 33, 36, 34, 132, 64, 50, 33, 65, 18, 17, 65, 34, 251, 68, 130, 36,
+    33, 38, 70, 70, 70, 70, 33, 36, 34, 132, 64, 34, 34, 66, 34, 250, 68, 130, 36, 33,
+    38, 70, 70, 70, 70, 33, 36, 34, 132, 64, 82, 162, 254, 249, 254, 42, 32, 145, 52, 33,
+    24, 34, 66, 18, 70, 50, 20, 34, 36, 18, 54, 66, 18, 66, 40, 17, 36, 49, 18, 114,
+    130, 130, 210, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 82, 98, 98, 113, 226,
+    84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 65, 113, 17, 97, 17, 81, 49, 178,
+    84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 34, 18, 66, 18, 245, 37, 69, 69,
+    69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 98, 146, 130, 130, 241, 39, 33, 37, 34, 37,
+    34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39, 56, 56, 41, 40, 54, 71, 48, 2, 130,
+    130, 130, 130, 21, 41, 19, 66, 18, 100, 100, 100, 100, 101, 66, 25, 18, 21, 34, 130, 130,
+    130, 50, 18, 98, 18, 250, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38,
+    33, 39, 56, 56, 41, 40, 54, 71, 48, 69, 133, 247, 58, 58, 57, 33, 40, 33, 39, 49,
+    54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 37, 69, 247,
+    83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 65, 49, 133, 147, 248, 58, 58, 57,
+    33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33,
+    41, 32, 33, 49, 69, 83, 248, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 83,
+    179, 179, 162, 18, 146, 18, 131, 19, 114, 50, 114, 50, 98, 82, 82, 82, 89, 75, 50, 114,
+    50, 114, 34, 146, 193, 194, 194, 211, 37, 71, 49, 67, 130, 55, 40, 18, 82, 18, 82, 18,
+    67, 25, 37, 18, 129, 130, 130, 147, 129, 162, 146, 245, 115, 162, 54, 17, 41, 57, 42, 42,
+    42, 42, 42, 58, 43, 54, 18, 164, 112, 98, 98, 98, 113, 241, 82, 129, 52, 70, 39, 39,
+    39, 55, 52, 17, 131, 80, 99, 145, 17, 129, 49, 243, 115, 162, 54, 17, 41, 57, 42, 42,
+    42, 42, 42, 58, 43, 54, 18, 164, 112, 82, 99, 82, 18, 65, 49, 213, 40, 19, 68, 98,
+    114, 114, 115, 115, 65, 24, 53, 98, 162, 255, 39, 58, 35, 97, 18, 147, 146, 162, 162, 162,
+    162, 163, 162, 179, 97, 42, 71, 82, 114, 248, 82, 129, 52, 70, 39, 39, 39, 55, 52, 17,
+    131, 80, 66, 34, 116, 146, 245, 115, 162, 54, 17, 41, 57, 42, 42, 42, 42, 42, 58, 43,
+    54, 18, 164, 112, 49, 49, 66, 17, 99, 98, 240, 82, 129, 52, 70, 39, 39, 39, 55, 52,
+    17, 131, 80, 49, 49, 114, 17, 147, 242, 132, 162, 37, 65, 39, 33, 39, 88, 72, 72, 72,
+    72, 71, 87, 33, 37, 65, 162, 128, 193, 146, 18, 146, 18, 146, 18, 146, 101, 18, 89, 82,
+    67, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 82, 67, 89, 101, 18, 40, 106, 66, 84,
+    50, 114, 50, 115, 34, 137, 89, 82, 34, 130, 34, 130, 34, 115, 34, 114, 50, 84, 58, 72,
+    130, 162, 119, 130, 69, 18, 57, 50, 67, 34, 98, 34, 98, 34, 98, 34, 98, 34, 98, 50,
+    67, 57, 69, 18, 38, 54, 175, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 38, 70,
+    250, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 33, 49, 69, 191, 87, 39, 39, 39, 245,
+    114, 114, 114, 114, 127, 48, 49, 49, 85, 99, 251, 83, 130, 36, 86, 249, 130, 147, 81, 40,
+    54, 66, 114, 246, 245, 114, 114, 114, 127, 87, 39, 39, 39, 39, 243, 66, 130, 252, 83, 130,
+    36, 86, 249, 130, 147, 81, 40, 54, 9, 25, 18, 130, 130, 130, 137, 25, 18, 130, 130, 130,
+    130, 137, 25, 114, 130, 130, 132, 53, 56, 34, 69, 111, 152, 41, 53, 18, 131, 103, 40, 40,
+    40, 64, 33, 49, 81, 18, 83, 207, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 34,
+    34, 81, 33, 100, 114, 242, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 98, 164, 130, 34,
+    245, 116, 162, 70, 18, 42, 58, 43, 43, 38, 118, 121, 88, 33, 40, 34, 54, 35, 149, 96,
+    66, 116, 97, 33, 82, 34, 229, 18, 25, 18, 69, 100, 100, 100, 100, 98, 18, 67, 25, 37,
+    18, 130, 17, 82, 40, 53, 65, 50, 132, 246, 116, 162, 70, 18, 42, 58, 43, 43, 38, 118,
+    121, 88, 33, 40, 34, 54, 35, 149, 96, 34, 49, 85, 99, 250, 81, 33, 145, 36, 86, 70,
+    70, 70, 70, 33, 36, 49, 146, 81, 40, 33, 21, 34, 131, 80, 98, 178, 255, 87, 74, 36,
+    97, 34, 163, 162, 178, 178, 103, 103, 149, 130, 18, 130, 35, 98, 57, 86, 66, 130, 251, 81,
+    33, 145, 36, 86, 70, 70, 70, 70, 33, 36, 49, 146, 81, 40, 33, 21, 34, 131, 80, 71,
+    74, 36, 97, 34, 163, 162, 178, 178, 103, 103, 149, 130, 18, 130, 35, 98, 57, 86, 255, 98,
+    162, 177, 82, 129, 130, 251, 81, 33, 145, 36, 86, 70, 70, 70, 70, 33, 36, 49, 146, 81,
+    40, 33, 21, 34, 131, 80, 67, 129, 17, 113, 49, 226, 116, 116, 116, 116, 116, 127, 183, 71,
+    71, 71, 71, 71, 71, 32, 34, 132, 98, 34, 243, 41, 41, 41, 41, 33, 68, 131, 51, 50,
+    37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 32, 34, 114, 66, 114,
+    47, 240, 34, 114, 66, 114, 75, 75, 66, 114, 66, 114, 66, 114, 66, 114, 66, 114, 66, 114,
+    66, 114, 18, 118, 70, 82, 130, 20, 56, 35, 51, 18, 82, 18, 82, 18, 82, 18, 82, 18,
+    82, 18, 82, 18, 82, 18, 82, 18, 34, 34, 146, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 18, 34, 18, 18, 34, 240, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 32, 12, 130, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 12, 226,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 1, 65, 20, 146, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 1, 71, 20, 240, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 32, 18, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 49,
+    35, 35, 18, 34, 162, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 34, 51, 4,
+    79, 240, 15, 112, 2, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 66,
+    98, 83, 52, 67, 2, 68, 66, 241, 36, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 38,
+    37, 37, 53, 32, 50, 68, 34, 34, 162, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 67, 36, 51, 34, 52, 33, 33, 18, 34, 130, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 35, 51, 2, 83, 34, 67, 50, 51, 66, 35, 82, 19, 101, 116,
+    132, 133, 114, 19, 98, 35, 82, 51, 66, 67, 50, 83, 34, 99, 255, 2, 161, 162, 2, 130,
+    130, 130, 130, 67, 18, 51, 34, 35, 50, 19, 69, 84, 101, 82, 19, 66, 35, 50, 51, 34,
+    67, 250, 40, 24, 32, 2, 67, 18, 51, 34, 35, 50, 19, 69, 84, 101, 82, 19, 66, 35,
+    50, 51, 34, 67, 34, 113, 113, 241, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 243, 33, 34, 18, 98, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    2, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 127, 63, 114, 98, 114, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 114, 17, 18, 2, 34, 50, 34,
+    50, 34, 50, 33, 66, 114, 114, 114, 114, 114, 114, 114, 114, 127, 48, 50, 18, 18, 18, 18,
+    18, 18, 18, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 2, 114, 114, 114, 114, 114,
+    114, 50, 34, 50, 34, 114, 114, 114, 114, 127, 48, 2, 50, 50, 50, 50, 50, 50, 20, 20,
+    50, 50, 50, 50, 50, 50, 34, 146, 146, 146, 146, 34, 82, 18, 100, 114, 131, 113, 18, 146,
+    146, 146, 153, 41, 34, 66, 66, 66, 66, 68, 35, 35, 36, 66, 66, 66, 66, 66, 66, 97,
+    146, 130, 241, 54, 101, 101, 116, 65, 36, 65, 51, 66, 35, 66, 50, 67, 34, 67, 49, 68,
+    33, 68, 117, 102, 86, 48, 66, 98, 114, 98, 226, 20, 40, 19, 53, 84, 84, 84, 84, 84,
+    84, 84, 82, 3, 102, 86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36, 51, 20,
+    66, 20, 71, 86, 101, 99, 252, 40, 41, 32, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84,
+    84, 84, 82, 247, 38, 39, 16, 49, 49, 113, 17, 131, 240, 54, 101, 101, 116, 65, 36, 65,
+    51, 66, 35, 66, 50, 67, 34, 67, 49, 68, 33, 68, 117, 102, 86, 48, 33, 49, 81, 17,
+    97, 17, 113, 210, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 18, 162, 162, 161,
+    162, 18, 36, 66, 22, 51, 66, 51, 66, 50, 82, 50, 82, 50, 82, 50, 82, 50, 82, 50,
+    82, 50, 82, 2, 37, 34, 23, 20, 66, 19, 100, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 114, 146, 146, 116, 115, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 114,
+    114, 54, 53, 70, 134, 247, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49,
+    40, 35, 52, 52, 166, 96, 38, 70, 250, 68, 130, 36, 33, 38, 70, 70, 70, 70, 33, 36,
+    34, 132, 64, 65, 65, 148, 248, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88,
+    49, 40, 35, 52, 52, 166, 96, 33, 65, 70, 84, 251, 68, 130, 36, 33, 38, 70, 70, 70,
+    70, 33, 36, 34, 132, 64, 97, 33, 146, 18, 130, 18, 248, 102, 164, 52, 51, 40, 33, 56,
+    90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 81, 34, 82, 34, 66, 34, 81,
+    49, 242, 69, 131, 36, 34, 38, 33, 38, 33, 38, 33, 38, 33, 38, 34, 36, 35, 133, 64,
+    94, 63, 18, 53, 40, 54, 39, 55, 39, 40, 39, 40, 184, 184, 39, 40, 39, 55, 40, 54,
+    41, 53, 42, 241, 94, 52, 69, 63, 18, 36, 68, 86, 38, 70, 198, 198, 40, 38, 41, 36,
+    85, 17, 242, 52, 70, 82, 130, 145, 242, 116, 131, 36, 50, 37, 34, 37, 34, 36, 50, 131,
+    116, 35, 51, 36, 50, 37, 34, 37, 34, 38, 33, 38, 33, 39, 32, 66, 66, 82, 66, 162,
+    19, 22, 19, 66, 82, 82, 82, 82, 82, 82, 82, 7, 72, 50, 67, 34, 82, 34, 82, 34,
+    67, 40, 55, 66, 51, 50, 67, 34, 82, 34, 82, 34, 98, 18, 98, 18, 114, 252, 41, 25,
+    32, 18, 19, 22, 19, 66, 82, 82, 82, 82, 82, 82, 82, 244, 37, 21, 32, 33, 34, 98,
+    17, 130, 242, 116, 131, 36, 50, 37, 34, 37, 34, 36, 50, 131, 116, 35, 51, 36, 50, 37,
+    34, 37, 34, 38, 33, 38, 33, 39, 32, 2, 34, 17, 33, 36, 50, 130, 28, 50, 66, 66,
+    66, 66, 66, 66, 66, 98, 114, 129, 241, 99, 129, 53, 17, 40, 40, 56, 86, 104, 57, 40,
+    40, 54, 194, 112, 82, 82, 98, 82, 213, 26, 83, 102, 69, 99, 99, 90, 21, 66, 116, 82,
+    34, 230, 56, 19, 81, 18, 130, 131, 133, 102, 131, 146, 130, 131, 108, 39, 50, 84, 65, 33,
+    50, 34, 181, 26, 83, 102, 69, 99, 99, 90, 21, 38, 56, 19, 81, 18, 130, 131, 133, 102,
+    131, 146, 130, 131, 108, 39, 114, 130, 130, 100, 37, 26, 83, 102, 69, 99, 99, 90, 21, 98,
+    98, 98, 68, 34, 34, 84, 114, 241, 99, 129, 53, 17, 40, 40, 56, 86, 104, 57, 40, 40,
+    54, 194, 112, 18, 34, 49, 33, 68, 82, 213, 26, 83, 102, 69, 99, 99, 90, 21, 15, 149,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 27, 42, 40, 48, 18, 82, 82,
+    78, 18, 82, 82, 82, 82, 82, 82, 86, 37, 65, 98, 82, 51, 50, 34, 116, 146, 242, 249,
+    82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 66, 82, 82, 34, 17, 50, 82,
+    78, 18, 82, 82, 82, 82, 82, 82, 86, 37, 15, 149, 42, 42, 42, 42, 42, 39, 132, 135,
+    42, 42, 42, 42, 32, 18, 82, 82, 78, 18, 82, 78, 18, 82, 82, 86, 37, 51, 17, 97,
+    19, 226, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 35, 33,
+    33, 33, 33, 33, 35, 245, 37, 69, 69, 69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 53,
+    101, 226, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 23, 39,
+    244, 37, 69, 69, 69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 49, 49, 115, 240, 39, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 17, 66, 39, 53, 245,
+    37, 69, 69, 69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 51, 129, 33, 97, 49, 66, 17,
+    33, 36, 19, 52, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 35, 82,
+    33, 65, 49, 66, 33, 83, 66, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 66,
+    18, 97, 33, 97, 33, 240, 39, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 85, 49, 37,
+    34, 148, 80, 65, 34, 66, 34, 65, 34, 66, 33, 210, 82, 18, 82, 18, 82, 18, 82, 18,
+    82, 18, 82, 18, 82, 18, 82, 19, 51, 40, 52, 18, 2, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 116, 117, 83, 18, 82, 41, 69, 113, 161, 147, 147, 2, 82, 18, 82, 18, 82, 18,
+    82, 18, 82, 18, 82, 18, 82, 18, 82, 19, 51, 40, 52, 18, 129, 130, 130, 147, 130, 240,
+    77, 34, 47, 146, 84, 84, 84, 82, 18, 68, 66, 34, 68, 66, 34, 50, 34, 50, 34, 50,
+    34, 50, 50, 34, 34, 34, 66, 34, 34, 34, 66, 18, 66, 18, 66, 18, 66, 18, 69, 68,
+    100, 68, 100, 68, 99, 99, 99, 99, 113, 209, 17, 193, 17, 177, 49, 245, 36, 52, 68, 52,
+    33, 35, 17, 19, 34, 34, 33, 34, 34, 34, 33, 34, 34, 34, 33, 34, 35, 33, 19, 17,
+    36, 67, 68, 67, 69, 37, 38, 37, 32, 82, 148, 114, 34, 240, 54, 49, 38, 35, 36, 36,
+    50, 53, 34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 81, 145, 17, 129, 17, 113,
+    49, 226, 114, 18, 82, 34, 82, 35, 50, 66, 50, 67, 19, 82, 18, 98, 18, 115, 131, 130,
+    146, 131, 100, 115, 50, 34, 98, 34, 252, 54, 49, 38, 35, 36, 36, 50, 53, 34, 38, 103,
+    73, 42, 42, 42, 42, 42, 42, 42, 32, 98, 146, 161, 243, 249, 146, 146, 147, 131, 131, 146,
+    146, 147, 131, 146, 146, 159, 144, 82, 98, 114, 98, 223, 54, 38, 38, 53, 53, 54, 38, 53,
+    243, 82, 162, 254, 249, 146, 146, 147, 131, 131, 146, 146, 147, 131, 146, 146, 159, 144, 50, 114,
+    247, 243, 98, 98, 99, 83, 83, 98, 99, 95, 48, 50, 34, 113, 18, 146, 242, 249, 146, 146,
+    147, 131, 131, 146, 146, 147, 131, 146, 146, 159, 144, 33, 49, 81, 17, 97, 17, 113, 223, 54,
+    38, 38, 53, 53, 54, 38, 53, 243, 52, 37, 34, 82, 52, 52, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 38, 56, 19, 81, 18, 130, 131, 133, 102, 131, 146, 130, 131, 108, 39, 251, 40,
+    40, 16, 37, 26, 83, 102, 69, 99, 99, 90, 21, 247, 37, 38, 32, 15, 149, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 47, 244, 42, 26, 32, 18, 82, 82, 78, 18, 82,
+    82, 82, 82, 82, 82, 86, 37, 242, 37, 37, 16, 2, 66, 66, 66, 50, 34, 34, 34, 34,
+    52, 33, 33, 18, 34, 18, 34, 18, 18, 34, 12, 15, 80, 1, 71, 20, 4, 2, 36, 34,
+    4, 49, 33, 33, 19, 17, 50, 50, 49, 19, 34, 34, 33, 34, 33, 49, 34, 34, 2, 34,
+    17, 33, 36, 50, 4, 1, 50, 50, 50, 49, 2, 34, 50, 34, 49, 49, 50, 34, 34, 66,
+    33, 71, 20, 20, 23, 65, 33, 18, 17, 6, 19, 7, 33, 5, 17, 2, 66, 66, 66, 50,
+    34, 34, 34, 18, 21, 18, 18, 2, 18, 21, 18, 10, 50, 50, 50, 49, 53, 18, 17, 33,
+    18, 24, 4, 18, 34, 18, 34, 20, 18, 34, 8, 66, 66, 65, 66, 20, 1, 81, 82, 66,
+    85, 6, 2, 36, 34, 18, 17, 34, 33, 18, 5, 33, 50, 37, 17, 34, 34, 51, 4, 8,
+    36, 34, 1, 34, 41, 2, 34, 17, 33, 36, 50, 34, 52, 33, 33, 18, 34, 1, 71, 20,
+    20, 17, 50, 18, 34, 18, 18, 34, 12, 15, 80, 15, 90, 245, 34, 103, 19, 69, 10, 15,
+    176, 145, 130, 114, 129, 129, 130, 114, 114, 129, 129, 129, 130, 129, 194, 178, 193, 194, 178, 178,
+    178, 178, 193, 193, 194, 178, 178, 178, 178, 1, 33, 18, 2, 36, 40, 9, 34, 37, 7, 17,
+    34, 33, 68, 18, 20, 19, 49, 51, 15, 90, 245, 2, 66, 66, 66, 50, 34, 34, 34, 18,
+    34, 18, 18, 34, 6, 19, 66, 50, 50, 65, 146, 36, 34, 2, 18, 18, 14, 34, 4, 72,
+    1, 34, 34, 34, 33, 8, 49, 49, 49, 17, 17, 21, 18, 20, 17, 50, 116, 18, 35, 18,
+    66, 17, 50, 20, 100, 18, 34, 17, 65, 24, 17, 65, 49, 33, 18, 20, 17, 35, 17, 18,
+    17, 20, 23, 18, 17, 34, 68, 18, 20, 34, 17, 20, 4, 22, 18, 18, 18, 17, 18, 17,
+    38, 3, 195, 31, 21, 144, 3, 195, 31, 21, 144, 15, 246, 15, 48, 36, 101, 36, 37, 100,
+    73, 111, 17, 60, 48, 240, 33, 243, 241, 31, 17, 2, 114, 114, 114, 114, 114, 127, 87, 39,
+    39, 39, 39, 39, 32, 2, 98, 98, 98, 98, 106, 98, 98, 98, 98, 15, 212, 35, 68, 35,
+    68, 35, 68, 35, 68, 35, 68, 35, 38, 43, 43, 43, 43, 43, 43, 32, 15, 82, 18, 66,
+    18, 66, 18, 66, 18, 66, 18, 66, 18, 36, 24, 24, 24, 24, 24, 24, 16, 7, 17, 17,
+    23, 2, 101, 86, 86, 71, 66, 20, 51, 20, 50, 36, 35, 36, 34, 52, 19, 52, 18, 71,
+    70, 85, 101, 98, 2, 69, 69, 54, 39, 34, 20, 19, 20, 18, 38, 54, 53, 69, 66, 6,
+    21, 56, 17, 67, 115, 114, 114, 114, 100, 67, 24, 37, 53, 40, 19, 68, 98, 34, 50, 34,
+    50, 115, 115, 65, 24, 53, 21, 56, 17, 67, 115, 34, 50, 34, 50, 114, 100, 67, 24, 37,
+    18, 18, 244, 33, 33, 65, 16, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 39, 19, 50, 34, 34, 34, 66, 50, 50, 50, 146, 36, 34, 50, 162, 19, 98,
+    35, 82, 51, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82, 66, 82, 73, 59, 34,
+    114, 34, 114, 18, 146, 4, 50, 178, 25, 18, 43, 50, 194, 194, 194, 201, 89, 82, 194, 194,
+    194, 194, 201, 89, 50, 210, 18, 114, 18, 34, 114, 17, 50, 114, 82, 114, 82, 114, 82, 114,
+    91, 91, 82, 114, 82, 114, 82, 114, 82, 114, 82, 114, 82, 114, 82, 114, 50, 66, 18, 18,
+    34, 17, 50, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 50, 210, 53, 82, 41,
+    49, 35, 83, 67, 115, 50, 146, 50, 146, 34, 162, 34, 162, 34, 162, 50, 146, 50, 146, 51,
+    115, 67, 83, 105, 149, 50, 226, 19, 99, 18, 50, 98, 18, 82, 67, 131, 50, 162, 34, 197,
+    196, 226, 240, 47, 2, 240, 47, 2, 240, 47, 2, 240, 32, 50, 210, 38, 82, 40, 50, 35,
+    67, 83, 99, 66, 130, 66, 130, 66, 146, 50, 146, 50, 130, 66, 130, 67, 99, 82, 98, 115,
+    35, 102, 22, 54, 22, 66, 66, 66, 66, 178, 34, 18, 34, 242, 37, 37, 37, 37, 37, 37,
+    37, 37, 38, 68, 48, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82,
+    66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 7, 56, 34, 67, 18, 82, 18, 82, 18, 67,
+    24, 40, 34, 82, 18, 100, 100, 100, 92, 24, 15, 87, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 32, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82, 66,
+    82, 66, 82, 50, 114, 34, 114, 43, 29, 15, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127,
+    48, 15, 153, 41, 41, 56, 56, 57, 41, 41, 56, 57, 41, 41, 249, 2, 116, 116, 116, 116,
+    116, 127, 183, 71, 71, 71, 71, 71, 71, 32, 70, 106, 67, 67, 50, 130, 19, 133, 164, 24,
+    20, 24, 20, 164, 165, 131, 18, 130, 51, 67, 74, 102, 15, 240, 2, 83, 34, 67, 50, 51,
+    66, 35, 82, 19, 101, 116, 132, 133, 114, 19, 98, 35, 82, 51, 66, 67, 50, 83, 34, 99,
+    83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82, 66, 82, 66, 82, 50,
+    114, 34, 114, 34, 114, 18, 146, 4, 88, 88, 86, 18, 50, 20, 18, 50, 20, 18, 50, 20,
+    34, 18, 36, 34, 18, 36, 34, 18, 36, 51, 52, 51, 52, 51, 52, 148, 148, 146, 3, 102,
+    86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36, 51, 20, 66, 20, 71, 86, 101,
+    99, 15, 63, 247, 114, 127, 255, 31, 48, 70, 106, 67, 67, 50, 130, 19, 133, 164, 164, 164,
+    164, 165, 131, 18, 130, 51, 67, 74, 102, 15, 151, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 32, 7, 40, 18, 69, 84, 84, 84, 75, 23, 34, 114, 114, 114, 114, 114, 15,
+    103, 55, 55, 55, 54, 54, 38, 38, 53, 53, 54, 243, 15, 149, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 32, 3, 99, 18, 98, 50, 66, 67, 35, 82, 34, 102, 116, 146,
+    162, 162, 162, 162, 162, 162, 162, 98, 194, 166, 106, 51, 34, 35, 19, 50, 53, 66, 68, 66,
+    68, 66, 69, 50, 51, 19, 34, 35, 58, 102, 162, 194, 19, 83, 34, 82, 51, 50, 82, 35,
+    98, 18, 116, 147, 147, 132, 133, 98, 34, 83, 50, 66, 67, 34, 98, 19, 99, 2, 66, 68,
+    66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 66, 18, 50, 50, 34, 50, 50, 51, 18,
+    19, 88, 118, 162, 194, 194, 69, 105, 51, 83, 34, 114, 18, 148, 148, 148, 148, 148, 131, 18,
+    114, 50, 82, 67, 51, 38, 28, 22, 2, 36, 34, 226, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 50, 34, 98, 34, 252, 54, 49, 38, 35, 36, 36, 50, 53, 34,
+    38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 98, 130, 130, 130, 244, 82, 33, 146, 35,
+    65, 36, 65, 36, 50, 37, 34, 36, 50, 36, 50, 50, 67, 162, 66, 48, 82, 98, 82, 82,
+    223, 22, 39, 83, 82, 53, 38, 52, 17, 114, 80, 83, 98, 98, 98, 210, 20, 40, 19, 53,
+    84, 84, 84, 84, 84, 84, 84, 82, 114, 114, 114, 114, 50, 50, 50, 65, 178, 66, 66, 66,
+    66, 66, 66, 66, 66, 84, 36, 66, 98, 98, 113, 240, 34, 35, 34, 47, 98, 66, 18, 81,
+    18, 84, 84, 84, 84, 84, 66, 19, 35, 38, 68, 37, 34, 25, 34, 52, 18, 68, 18, 67,
+    34, 82, 34, 67, 34, 67, 35, 36, 58, 36, 35, 36, 71, 19, 50, 18, 66, 18, 66, 18,
+    51, 18, 20, 34, 21, 18, 69, 84, 84, 85, 59, 23, 34, 114, 114, 114, 3, 102, 66, 50,
+    66, 50, 66, 66, 34, 82, 34, 82, 34, 100, 116, 116, 130, 146, 146, 146, 146, 53, 56, 34,
+    81, 34, 133, 117, 50, 51, 33, 85, 100, 100, 100, 98, 18, 66, 40, 68, 47, 22, 39, 83,
+    82, 53, 38, 52, 17, 114, 80, 15, 52, 68, 53, 53, 54, 38, 39, 39, 39, 39, 55, 54,
+    116, 103, 39, 38, 54, 32, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 114,
+    114, 114, 114, 52, 86, 50, 66, 34, 66, 18, 100, 111, 150, 70, 70, 33, 36, 34, 51, 35,
+    101, 64, 2, 50, 50, 50, 50, 50, 50, 50, 50, 68, 20, 2, 66, 18, 35, 34, 19, 53,
+    69, 70, 50, 34, 50, 35, 34, 50, 34, 66, 18, 67, 35, 132, 146, 147, 146, 146, 132, 116,
+    102, 82, 34, 67, 34, 66, 66, 35, 66, 34, 82, 19, 98, 2, 82, 18, 82, 18, 82, 18,
+    82, 18, 82, 18, 82, 18, 82, 18, 82, 19, 51, 28, 19, 36, 130, 130, 130, 2, 82, 18,
+    82, 34, 82, 18, 82, 18, 82, 19, 66, 34, 50, 50, 35, 50, 19, 84, 99, 24, 40, 51,
+    99, 114, 130, 131, 134, 70, 50, 114, 130, 131, 136, 71, 130, 130, 115, 114, 52, 72, 34, 66,
+    18, 100, 100, 100, 100, 98, 18, 66, 40, 68, 10, 26, 34, 66, 50, 66, 50, 66, 50, 66,
+    50, 66, 50, 66, 50, 66, 50, 68, 18, 83, 53, 56, 34, 66, 18, 100, 100, 100, 100, 101,
+    66, 25, 18, 21, 34, 130, 130, 130, 53, 40, 19, 68, 98, 114, 114, 115, 115, 103, 70, 114,
+    114, 99, 98, 41, 26, 18, 66, 34, 98, 18, 98, 18, 98, 18, 98, 18, 98, 34, 66, 56,
+    84, 15, 84, 40, 40, 40, 40, 40, 40, 40, 86, 64, 2, 66, 18, 81, 18, 84, 84, 84,
+    84, 84, 66, 19, 35, 38, 68, 34, 36, 51, 22, 34, 34, 34, 18, 50, 52, 50, 52, 50,
+    52, 50, 52, 50, 50, 18, 34, 34, 42, 70, 130, 162, 162, 162, 3, 71, 50, 50, 35, 66,
+    18, 85, 84, 115, 114, 115, 116, 85, 82, 18, 67, 34, 50, 55, 67, 2, 50, 52, 50, 52,
+    50, 52, 50, 52, 50, 52, 50, 52, 50, 52, 50, 53, 34, 35, 26, 70, 130, 162, 162, 162,
+    34, 98, 50, 130, 34, 130, 18, 164, 66, 68, 66, 68, 66, 68, 66, 69, 36, 35, 28, 52,
+    36, 2, 34, 18, 34, 242, 37, 37, 37, 37, 37, 37, 37, 37, 38, 68, 48, 2, 34, 50,
+    34, 246, 36, 33, 37, 17, 37, 69, 69, 69, 69, 68, 33, 50, 50, 100, 64, 98, 114, 114,
+    129, 243, 68, 130, 36, 33, 38, 70, 70, 70, 70, 33, 36, 34, 132, 64, 66, 98, 98, 113,
+    240, 36, 33, 37, 17, 37, 69, 69, 69, 69, 68, 33, 50, 50, 100, 64, 130, 178, 178, 193,
+    248, 38, 35, 40, 34, 40, 33, 42, 68, 36, 68, 36, 68, 36, 68, 36, 82, 66, 49, 195,
+    66, 64, 2, 99, 18, 83, 34, 67, 50, 51, 66, 35, 82, 19, 101, 116, 133, 114, 19, 98,
+    35, 82, 51, 66, 67, 50, 83, 34, 99, 162, 161, 161, 162, 51, 70, 50, 50, 18, 66, 18,
+    66, 18, 50, 39, 39, 34, 66, 18, 84, 85, 66, 18, 51, 23, 68, 67, 102, 51, 34, 50,
+    66, 34, 66, 35, 52, 25, 40, 100, 100, 98, 18, 66, 35, 50, 54, 84, 4, 67, 21, 37,
+    51, 17, 19, 68, 131, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 50, 226, 20, 83, 18,
+    37, 54, 99, 18, 18, 148, 227, 227, 226, 240, 47, 2, 240, 47, 2, 240, 47, 2, 240, 47,
+    2, 50, 34, 98, 34, 252, 68, 49, 82, 83, 49, 17, 52, 72, 58, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 32, 82, 162, 162, 162, 134, 74, 34, 34, 34, 18, 50, 52, 50, 52, 50,
+    52, 50, 52, 50, 50, 18, 34, 34, 42, 70, 130, 162, 162, 162, 15, 242, 34, 130, 50, 162,
+    34, 66, 66, 34, 66, 66, 34, 66, 66, 34, 66, 66, 35, 36, 35, 60, 84, 36, 4, 87,
+    51, 50, 35, 81, 35, 66, 19, 85, 98, 18, 82, 34, 67, 34, 51, 70, 84, 145, 146, 97,
+    19, 100, 70, 106, 67, 67, 50, 130, 19, 133, 164, 164, 164, 164, 165, 131, 18, 130, 36, 68,
+    58, 102, 162, 194, 194, 194, 52, 72, 34, 66, 18, 100, 100, 100, 100, 98, 18, 66, 40, 54,
+    98, 130, 130, 130, 55, 40, 19, 114, 114, 130, 130, 130, 130, 130, 130, 146, 131, 134, 86, 130,
+    130, 115, 114, 55, 25, 18, 114, 130, 130, 130, 131, 131, 118, 101, 130, 130, 115, 114, 15, 54,
+    38, 38, 38, 113, 113, 38, 38, 38, 38, 38, 38, 32, 100, 85, 67, 114, 130, 130, 130, 133,
+    85, 82, 130, 130, 130, 130, 130, 130, 115, 69, 84, 1, 147, 131, 130, 129, 97, 18, 67, 18,
+    36, 40, 20, 50, 18, 81, 130, 130, 130, 132, 115, 35, 98, 114, 99, 98, 114, 111, 54, 39,
+    39, 38, 39, 39, 38, 48, 54, 122, 69, 67, 49, 34, 98, 82, 99, 66, 84, 66, 66, 18,
+    66, 50, 50, 130, 50, 130, 50, 130, 50, 130, 50, 130, 50, 130, 50, 130, 50, 194, 210, 195,
+    194, 3, 132, 146, 146, 131, 115, 98, 18, 66, 19, 50, 18, 17, 34, 33, 34, 17, 34, 34,
+    145, 145, 145, 145, 34, 130, 50, 162, 34, 162, 34, 162, 18, 196, 196, 82, 84, 82, 84, 82,
+    84, 82, 84, 82, 84, 82, 82, 18, 52, 50, 38, 38, 52, 68, 195, 195, 164, 194, 18, 130,
+    34, 130, 18, 164, 164, 66, 68, 66, 68, 66, 68, 66, 69, 36, 35, 28, 52, 36, 179, 163,
+    147, 162, 66, 66, 36, 66, 19, 98, 18, 114, 18, 116, 132, 132, 132, 132, 133, 114, 18, 99,
+    19, 68, 39, 18, 53, 34, 162, 162, 162, 162, 50, 50, 20, 50, 18, 85, 84, 100, 100, 100,
+    98, 18, 67, 25, 37, 18, 130, 130, 130, 130, 2, 178, 178, 178, 178, 37, 66, 24, 36, 83,
+    19, 114, 18, 148, 148, 148, 148, 148, 130, 18, 130, 147, 147, 116, 115, 229, 33, 35, 21, 33,
+    82, 34, 68, 41, 52, 34, 146, 146, 146, 20, 50, 40, 53, 104, 51, 67, 34, 98, 19, 99,
+    147, 146, 162, 147, 131, 131, 131, 115, 131, 131, 131, 163, 97, 57, 85, 38, 51, 35, 34, 82,
+    130, 130, 130, 114, 114, 114, 99, 98, 99, 130, 147, 35, 53, 3, 134, 99, 35, 66, 82, 50,
+    114, 34, 117, 147, 163, 164, 130, 18, 115, 34, 98, 51, 66, 82, 47, 176, 3, 83, 34, 50,
+    66, 34, 101, 115, 131, 116, 98, 34, 82, 50, 47, 112, 87, 42, 19, 146, 162, 21, 53, 35,
+    35, 98, 18, 117, 132, 132, 132, 115, 18, 98, 36, 36, 70, 69, 55, 34, 129, 130, 21, 36,
+    35, 19, 66, 18, 100, 100, 100, 100, 98, 18, 66, 35, 35, 54, 82, 162, 162, 162, 95, 179,
+    35, 37, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 66, 130, 130, 130, 79, 114,
+    34, 36, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 32, 4, 87, 51, 50, 35, 81,
+    35, 66, 19, 85, 98, 18, 82, 34, 67, 34, 51, 55, 84, 53, 56, 34, 66, 18, 100, 100,
+    100, 100, 101, 66, 25, 18, 21, 34, 146, 137, 55, 53, 40, 19, 68, 98, 114, 114, 115, 115,
+    65, 24, 53, 34, 34, 162, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 37, 19, 70,
+    106, 67, 67, 50, 130, 19, 148, 175, 242, 164, 165, 131, 18, 130, 51, 67, 74, 102, 54, 20,
+    49, 18, 98, 114, 123, 114, 130, 115, 65, 54, 6, 33, 51, 114, 98, 106, 98, 98, 99, 51,
+    22, 2, 114, 114, 119, 40, 18, 69, 84, 84, 84, 75, 23, 34, 114, 114, 2, 130, 130, 130,
+    130, 21, 41, 19, 66, 18, 100, 100, 100, 100, 101, 66, 25, 18, 21, 34, 130, 130, 130, 71,
+    58, 35, 97, 18, 147, 146, 162, 162, 162, 162, 163, 162, 179, 97, 42, 71, 3, 119, 89, 55,
+    19, 19, 20, 34, 18, 36, 51, 52, 51, 52, 148, 148, 148, 148, 148, 148, 148, 146, 4, 56,
+    57, 23, 21, 20, 35, 36, 35, 36, 116, 116, 116, 116, 116, 146, 146, 146, 53, 83, 34, 50,
+    82, 34, 82, 34, 98, 18, 98, 18, 98, 18, 82, 34, 82, 35, 51, 34, 21, 50, 135, 71,
+    82, 23, 74, 33, 99, 178, 163, 162, 162, 162, 162, 162, 147, 146, 17, 99, 42, 55, 71, 58,
+    35, 97, 18, 147, 146, 162, 162, 67, 50, 67, 50, 163, 162, 179, 97, 42, 71, 23, 74, 33,
+    99, 178, 163, 162, 162, 50, 82, 50, 82, 162, 147, 146, 17, 99, 42, 55, 65, 130, 130, 191,
+    87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 18, 50, 34, 50, 244, 245, 114, 114, 114,
+    127, 87, 39, 39, 39, 39, 243, 11, 59, 114, 194, 194, 194, 200, 105, 82, 83, 66, 98, 66,
+    98, 66, 98, 66, 98, 66, 98, 66, 98, 194, 179, 148, 163, 82, 113, 114, 207, 87, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 32, 71, 58, 34, 113, 18, 146, 162, 170, 42, 34,
+    162, 163, 162, 179, 97, 42, 71, 38, 56, 19, 81, 18, 130, 131, 133, 102, 131, 146, 130, 131,
+    108, 39, 15, 240, 2, 36, 34, 226, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 39, 19,
+    73, 185, 178, 82, 178, 82, 178, 82, 178, 82, 178, 87, 98, 88, 82, 82, 67, 51, 82, 82,
+    50, 98, 82, 50, 98, 82, 20, 98, 71, 120, 18, 151, 2, 98, 114, 98, 114, 98, 114, 98,
+    114, 98, 114, 98, 127, 2, 241, 18, 98, 69, 98, 84, 98, 84, 98, 84, 98, 69, 104, 18,
+    103, 11, 59, 114, 194, 194, 194, 200, 105, 82, 83, 66, 98, 66, 98, 66, 98, 66, 98, 66,
+    98, 66, 98, 98, 146, 161, 243, 39, 86, 49, 37, 50, 36, 51, 35, 52, 34, 53, 33, 54,
+    117, 65, 52, 51, 36, 37, 35, 37, 50, 38, 34, 39, 33, 39, 48, 65, 162, 162, 240, 38,
+    85, 101, 100, 116, 33, 67, 49, 67, 34, 66, 50, 66, 35, 65, 51, 65, 36, 116, 101, 86,
+    86, 32, 49, 65, 116, 241, 40, 33, 38, 34, 38, 35, 36, 51, 36, 37, 35, 37, 34, 38,
+    49, 39, 72, 73, 57, 41, 55, 72, 48, 2, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 111, 116, 40, 40, 32, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50,
+    82, 82, 66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 9, 25, 18, 130, 130, 130, 136, 41,
+    18, 85, 100, 100, 100, 92, 24, 7, 56, 34, 67, 18, 82, 18, 82, 18, 67, 24, 40, 34,
+    82, 18, 100, 100, 100, 92, 24, 15, 87, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    32, 57, 89, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 66,
+    98, 66, 98, 51, 98, 47, 240, 164, 164, 162, 15, 87, 39, 39, 39, 245, 114, 114, 114, 114,
+    127, 48, 3, 98, 99, 19, 82, 83, 51, 66, 67, 83, 50, 51, 115, 34, 35, 147, 18, 19,
+    163, 18, 19, 156, 130, 36, 34, 115, 36, 35, 98, 66, 66, 82, 82, 82, 51, 82, 83, 34,
+    98, 98, 19, 98, 99, 22, 57, 18, 83, 130, 130, 115, 53, 86, 131, 130, 130, 131, 108, 38,
+    2, 101, 86, 86, 71, 66, 20, 51, 20, 50, 36, 35, 36, 34, 52, 19, 52, 18, 71, 70,
+    85, 101, 98, 49, 49, 115, 240, 38, 85, 101, 100, 116, 33, 67, 49, 67, 34, 66, 50, 66,
+    35, 65, 51, 65, 36, 116, 101, 86, 86, 32, 2, 117, 99, 18, 83, 34, 67, 50, 51, 66,
+    35, 82, 19, 103, 84, 19, 67, 50, 66, 82, 50, 83, 34, 98, 34, 114, 18, 115, 73, 73,
+    66, 82, 66, 82, 66, 82, 66, 82, 66, 82, 66, 82, 66, 82, 51, 82, 50, 98, 50, 98,
+    35, 102, 116, 146, 4, 88, 88, 86, 18, 50, 20, 18, 50, 20, 18, 50, 20, 34, 18, 36,
+    34, 18, 36, 34, 18, 36, 51, 52, 51, 52, 51, 52, 148, 148, 146, 2, 116, 116, 116, 116,
+    116, 127, 183, 71, 71, 71, 71, 71, 71, 32, 70, 106, 67, 67, 50, 130, 19, 133, 164, 164,
+    164, 164, 165, 131, 18, 130, 51, 67, 74, 102, 15, 151, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 32, 7, 40, 18, 69, 84, 84, 84, 75, 23, 34, 114, 114, 114, 114, 114,
+    71, 58, 35, 97, 18, 147, 146, 162, 162, 162, 162, 163, 162, 179, 97, 42, 71, 15, 149, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 2, 130, 18, 98, 34, 98, 50, 67,
+    50, 66, 82, 50, 82, 34, 99, 18, 116, 132, 147, 146, 147, 116, 131, 98, 166, 106, 51, 34,
+    35, 19, 50, 53, 66, 68, 66, 68, 66, 68, 66, 69, 50, 51, 19, 34, 35, 58, 102, 162,
+    194, 19, 83, 34, 82, 51, 50, 82, 35, 98, 18, 116, 147, 147, 132, 133, 98, 34, 83, 50,
+    66, 67, 34, 98, 19, 99, 2, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114,
+    34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 47, 187, 43, 43, 32, 2, 100, 100,
+    100, 100, 100, 101, 82, 25, 40, 130, 130, 130, 130, 130, 130, 2, 98, 100, 98, 100, 98, 100,
+    98, 100, 98, 100, 98, 100, 98, 100, 98, 100, 98, 100, 98, 100, 98, 100, 98, 100, 98, 111,
+    248, 2, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34,
+    98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98, 34, 98, 98,
+    47, 250, 243, 47, 50, 243, 32, 6, 134, 194, 194, 194, 194, 200, 105, 82, 83, 66, 98, 66,
+    98, 66, 98, 66, 83, 73, 88, 2, 164, 164, 164, 164, 164, 170, 75, 52, 83, 36, 98, 36,
+    98, 36, 98, 36, 83, 43, 58, 66, 2, 130, 130, 130, 130, 130, 136, 41, 18, 85, 100, 100,
+    100, 92, 24, 23, 74, 33, 114, 178, 178, 162, 42, 42, 162, 162, 147, 146, 17, 99, 42, 55,
+    2, 117, 66, 89, 34, 82, 83, 18, 66, 114, 18, 51, 117, 50, 148, 50, 153, 153, 148, 50,
+    148, 51, 117, 66, 114, 18, 67, 83, 18, 89, 34, 117, 56, 41, 19, 82, 18, 98, 18, 98,
+    18, 98, 19, 82, 56, 71, 66, 50, 50, 66, 35, 66, 34, 82, 18, 101, 98, 37, 55, 33,
+    67, 114, 39, 26, 84, 84, 76, 21, 18, 53, 71, 35, 99, 114, 20, 57, 19, 66, 18, 100,
+    100, 100, 100, 98, 18, 66, 40, 68, 7, 40, 18, 66, 18, 66, 18, 65, 39, 43, 84, 95,
+    48, 15, 54, 38, 38, 38, 38, 38, 38, 38, 32, 55, 87, 82, 50, 82, 50, 82, 50, 82,
+    50, 82, 50, 66, 66, 66, 66, 47, 184, 72, 72, 32, 53, 56, 34, 69, 111, 152, 41, 53,
+    18, 131, 96, 19, 50, 51, 51, 34, 35, 83, 18, 19, 114, 18, 18, 136, 136, 114, 20, 18,
+    83, 34, 35, 66, 50, 50, 50, 66, 66, 19, 66, 67, 21, 41, 82, 98, 37, 53, 99, 99,
+    74, 37, 2, 69, 69, 54, 39, 34, 20, 19, 20, 18, 38, 54, 53, 69, 66, 17, 66, 39,
+    53, 178, 69, 69, 54, 39, 34, 20, 19, 20, 18, 38, 54, 53, 69, 66, 2, 67, 18, 51,
+    34, 35, 50, 19, 69, 86, 67, 19, 50, 50, 50, 66, 34, 67, 18, 83, 55, 55, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 35, 50, 19, 70, 68, 98, 4, 56, 56, 54, 18, 18,
+    20, 18, 18, 20, 21, 20, 35, 36, 35, 36, 49, 52, 116, 114, 2, 84, 84, 84, 84, 95,
+    117, 69, 69, 69, 32, 52, 72, 34, 66, 18, 100, 100, 100, 100, 98, 18, 66, 40, 68, 15,
+    85, 69, 69, 69, 69, 69, 69, 69, 69, 32, 2, 21, 41, 19, 66, 18, 100, 100, 100, 100,
+    101, 66, 25, 18, 21, 34, 130, 130, 130, 53, 40, 19, 68, 98, 114, 114, 115, 115, 65, 24,
+    53, 15, 84, 40, 40, 40, 40, 40, 40, 40, 40, 32, 2, 114, 18, 82, 34, 82, 35, 50,
+    66, 50, 67, 19, 82, 18, 98, 18, 115, 131, 130, 146, 131, 100, 115, 98, 194, 194, 194, 131,
+    18, 19, 60, 19, 36, 37, 66, 68, 66, 68, 66, 68, 66, 68, 66, 69, 36, 35, 28, 51,
+    18, 19, 130, 194, 194, 194, 3, 83, 19, 51, 51, 19, 82, 18, 115, 131, 117, 98, 18, 82,
+    50, 51, 51, 19, 83, 2, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34,
+    82, 34, 82, 47, 121, 41, 41, 32, 2, 84, 84, 84, 85, 66, 24, 39, 114, 114, 114, 114,
+    2, 66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 79, 240,
+    2, 66, 66, 34, 66, 66, 34, 66, 66, 34, 66, 66, 34, 66, 66, 34, 66, 66, 34, 66,
+    66, 34, 66, 66, 34, 66, 66, 47, 242, 226, 226, 226, 5, 117, 162, 162, 162, 167, 89, 50,
+    82, 50, 82, 57, 55, 2, 132, 132, 132, 132, 137, 59, 20, 82, 20, 82, 27, 25, 50, 2,
+    114, 114, 114, 114, 119, 43, 84, 95, 48, 21, 55, 33, 82, 130, 24, 24, 114, 115, 82, 24,
+    37, 2, 69, 50, 56, 18, 35, 66, 18, 34, 104, 104, 100, 34, 100, 34, 100, 50, 66, 18,
+    56, 18, 84, 55, 25, 18, 82, 18, 82, 19, 66, 40, 55, 50, 50, 34, 66, 19, 69, 82,
+    18, 146, 146, 146, 242, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 34, 34, 66, 34, 250,
+    83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 34, 146, 146, 146, 121, 41, 66, 146, 20, 72,
+    51, 51, 34, 82, 34, 82, 34, 82, 34, 82, 34, 66, 146, 115, 115, 130, 82, 82, 82, 97,
+    207, 54, 38, 38, 38, 38, 38, 38, 38, 32, 53, 55, 18, 83, 119, 39, 34, 114, 130, 81,
+    24, 53, 37, 26, 83, 102, 69, 99, 99, 90, 21, 4, 79, 112, 2, 36, 34, 226, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 34, 34, 162, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 37, 19, 55, 151, 146, 50, 146, 50, 146, 50, 146, 54, 82, 56, 35, 50, 66, 19,
+    66, 70, 74, 102, 2, 82, 98, 82, 98, 82, 98, 82, 98, 82, 109, 47, 37, 36, 69, 36,
+    69, 165, 96, 34, 146, 146, 146, 121, 41, 66, 146, 20, 72, 51, 51, 34, 82, 34, 82, 34,
+    82, 34, 82, 34, 82, 82, 114, 114, 114, 241, 36, 49, 35, 50, 34, 51, 33, 52, 85, 100,
+    49, 51, 35, 35, 36, 34, 36, 49, 37, 48, 2, 130, 130, 130, 210, 69, 69, 54, 39, 34,
+    20, 19, 20, 18, 38, 54, 53, 69, 66, 49, 65, 86, 100, 226, 114, 18, 82, 34, 82, 35,
+    50, 66, 50, 67, 19, 82, 18, 98, 18, 115, 131, 130, 146, 131, 100, 115, 2, 68, 68, 68,
+    68, 68, 68, 68, 68, 79, 51, 38, 38, 32, 34, 130, 50, 162, 34, 162, 34, 162, 18, 196,
+    196, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 82, 18, 52, 50, 38, 38, 52, 68,
+    34, 98, 50, 130, 34, 130, 18, 164, 66, 68, 66, 68, 66, 68, 66, 69, 36, 35, 28, 52,
+    36, 66, 194, 138, 74, 130, 194, 200, 105, 82, 83, 66, 98, 66, 98, 66, 98, 66, 83, 73,
+    88, 50, 162, 162, 162, 121, 57, 98, 162, 162, 167, 89, 50, 82, 50, 82, 57, 55, 2, 117,
+    34, 91, 66, 100, 50, 146, 50, 146, 34, 173, 61, 50, 34, 162, 34, 162, 34, 162, 50, 146,
+    51, 115, 68, 53, 103, 2, 72, 35, 52, 34, 98, 18, 114, 18, 122, 34, 18, 114, 18, 114,
+    34, 98, 35, 52, 55, 130, 227, 228, 194, 18, 194, 34, 162, 51, 146, 66, 130, 83, 122, 108,
+    67, 50, 50, 66, 66, 51, 35, 66, 66, 34, 82, 70, 82, 82, 114, 196, 162, 18, 162, 34,
+    130, 50, 130, 66, 106, 81, 50, 34, 66, 50, 50, 34, 66, 50, 34, 66, 66, 2, 146, 130,
+    132, 114, 132, 114, 115, 18, 98, 114, 34, 98, 99, 50, 90, 66, 90, 82, 66, 90, 66, 76,
+    50, 66, 50, 50, 50, 50, 66, 66, 34, 50, 66, 66, 34, 34, 82, 82, 18, 34, 82, 82,
+    2, 114, 114, 100, 98, 98, 18, 82, 82, 34, 82, 82, 50, 72, 66, 66, 58, 50, 50, 34,
+    49, 50, 34, 50, 50, 34, 34, 50, 66, 18, 18, 66, 66, 28, 58, 67, 67, 82, 66, 114,
+    35, 114, 34, 149, 134, 106, 52, 18, 20, 34, 50, 50, 34, 50, 50, 18, 66, 68, 66, 68,
+    66, 66, 10, 24, 50, 35, 50, 34, 84, 86, 56, 34, 18, 18, 18, 34, 36, 34, 36, 34,
+    34, 2, 47, 3, 177, 36, 38, 33, 36, 37, 34, 37, 35, 50, 37, 50, 35, 161, 51, 212,
+    37, 115, 36, 49, 33, 49, 35, 35, 34, 33, 35, 35, 35, 66, 36, 35, 66, 36, 35, 66,
+    36, 35, 32, 2, 43, 43, 50, 50, 18, 50, 34, 34, 66, 18, 42, 50, 55, 18, 34, 18,
+    21, 34, 18, 36, 18, 34, 36, 18, 34, 34, 33, 65, 81, 33, 97, 33, 99, 101, 72, 131,
+    130, 130, 114, 70, 69, 146, 146, 130, 130, 130, 39, 24, 34, 130, 137, 55, 33, 50, 33, 33,
+    65, 33, 82, 70, 33, 51, 98, 98, 37, 53, 114, 113, 113, 45, 17, 113, 119, 38, 114, 130,
+    82, 83, 18, 66, 66, 50, 66, 50, 66, 66, 50, 82, 50, 50, 82, 50, 34, 113, 50, 34,
+    114, 34, 33, 130, 34, 18, 152, 151, 210, 240, 47, 2, 114, 240, 47, 2, 240, 41, 36, 37,
+    49, 36, 36, 35, 36, 36, 36, 35, 35, 37, 35, 35, 38, 19, 34, 39, 34, 34, 39, 34,
+    34, 40, 33, 33, 41, 137, 125, 47, 2, 240, 47, 2, 70, 106, 67, 67, 50, 130, 19, 148,
+    175, 242, 164, 165, 131, 18, 130, 51, 67, 74, 102, 52, 72, 34, 66, 18, 111, 150, 70, 33,
+    36, 34, 132, 64, 2, 163, 18, 132, 18, 130, 50, 114, 82, 98, 82, 98, 83, 66, 114, 66,
+    114, 50, 146, 34, 146, 34, 146, 18, 180, 180, 194, 18, 115, 18, 98, 50, 82, 82, 66, 82,
+    65, 113, 50, 114, 34, 114, 18, 148, 148, 147, 50, 33, 178, 18, 178, 18, 245, 42, 49, 40,
+    65, 40, 35, 39, 37, 38, 37, 38, 37, 52, 39, 36, 39, 35, 41, 34, 41, 34, 41, 33,
+    43, 75, 76, 32, 34, 34, 130, 33, 145, 34, 130, 34, 242, 39, 49, 38, 35, 37, 37, 36,
+    37, 36, 23, 19, 39, 34, 39, 33, 41, 73, 73, 48, 51, 230, 178, 50, 178, 66, 146, 82,
+    18, 68, 82, 18, 68, 82, 18, 50, 18, 82, 34, 34, 18, 82, 34, 33, 34, 82, 52, 34,
+    82, 52, 50, 66, 51, 66, 66, 66, 82, 34, 81, 101, 82, 241, 47, 2, 240, 62, 48, 36,
+    34, 66, 18, 34, 18, 66, 17, 66, 18, 52, 66, 18, 34, 18, 66, 33, 34, 18, 66, 36,
+    34, 66, 36, 34, 66, 50, 65, 66, 50, 66, 34, 66, 84, 66, 226, 225, 226, 195, 130, 186,
+    83, 35, 35, 51, 147, 34, 178, 19, 196, 212, 212, 212, 210, 18, 178, 34, 178, 50, 65, 66,
+    91, 163, 70, 90, 34, 114, 18, 148, 148, 148, 148, 146, 18, 114, 58, 71, 163, 241, 110, 36,
+    31, 34, 244, 47, 81, 178, 97, 98, 50, 240, 34, 47, 2, 34, 240, 33, 47, 36, 242, 79,
+    36, 242, 70, 86, 69, 117, 83, 51, 51, 49, 103, 99, 73, 64, 131, 215, 177, 19, 17, 211,
+    241, 31, 18, 146, 194, 34, 194, 18, 228, 228, 228, 84, 85, 40, 35, 22, 70, 51, 116, 73,
+    129, 33, 33, 247, 40, 35, 42, 34, 42, 34, 42, 33, 44, 76, 69, 37, 69, 37, 69, 37,
+    69, 37, 69, 37, 69, 37, 33, 35, 67, 34, 98, 99, 68, 64, 57, 97, 33, 33, 255, 50,
+    98, 50, 130, 34, 130, 18, 164, 66, 68, 66, 68, 66, 68, 66, 69, 36, 35, 28, 52, 36,
+    71, 73, 35, 97, 18, 147, 146, 162, 162, 162, 162, 163, 162, 164, 153, 87, 162, 162, 162, 162,
+    53, 55, 19, 68, 98, 114, 114, 115, 115, 103, 69, 114, 114, 114, 114, 82, 50, 18, 52, 102,
+    18, 23, 33, 20, 69, 50, 33, 49, 111, 33, 32, 50, 40, 81, 7, 50, 6, 20, 67, 184,
+    114, 102, 227, 181, 248, 19, 47, 18, 226, 133, 181, 113, 65, 161, 65, 255, 255, 255, 251, 63,
+    83, 21, 242, 115, 47, 17, 65, 255, 255, 255, 251, 76, 71, 34, 42, 34, 38, 20, 26, 20,
+    31, 4, 248, 34, 47, 113, 65, 209, 249, 47, 146, 241, 38, 47, 33, 227, 130, 180, 146, 178,
+    255, 255, 255, 245, 63, 148, 241, 68, 47, 21, 255, 255, 255, 244, 44, 26, 59, 55, 77, 47,
+    34, 97, 242, 38, 31, 33, 249, 47, 145, 34, 49, 133, 243, 38, 50, 38, 50, 37, 66, 37,
+    66, 36, 33, 34, 36, 33, 34, 35, 34, 34, 35, 34, 34, 34, 35, 34, 34, 35, 34, 33,
+    36, 34, 69, 34, 69, 34, 54, 118, 75, 42, 42, 43, 16, 33, 50, 85, 115, 241, 37, 34,
+    36, 50, 35, 66, 35, 66, 34, 33, 34, 34, 18, 34, 33, 34, 34, 67, 34, 67, 34, 52,
+    101, 73, 40, 41, 25, 32, 34, 162, 134, 102, 130, 162, 168, 73, 50, 83, 34, 98, 34, 98,
+    34, 98, 34, 83, 41, 56, 34, 146, 146, 118, 86, 114, 146, 151, 72, 50, 82, 34, 82, 34,
+    82, 40, 55, 6, 72, 34, 67, 18, 82, 18, 49, 18, 18, 37, 18, 67, 18, 52, 23, 20,
+    130, 130, 130, 130, 130, 2, 20, 52, 34, 34, 82, 18, 82, 18, 100, 100, 100, 49, 18, 18,
+    52, 19, 51, 18, 22, 18, 97, 18, 97, 18, 130, 114, 114, 127, 119, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 32, 113, 113, 127, 70, 38, 38, 38, 38, 38, 38, 38, 32, 57,
+    57, 50, 162, 162, 162, 162, 122, 42, 82, 162, 162, 162, 162, 162, 56, 56, 50, 146, 146, 105,
+    41, 82, 146, 146, 146, 9, 25, 18, 130, 130, 130, 136, 41, 18, 85, 100, 100, 100, 100, 100,
+    98, 130, 115, 84, 99, 8, 24, 18, 114, 114, 120, 27, 84, 84, 84, 82, 114, 114, 69, 68,
+    18, 114, 99, 34, 98, 83, 66, 82, 82, 98, 66, 66, 130, 50, 50, 147, 34, 34, 179, 18,
+    19, 171, 162, 21, 34, 130, 51, 66, 98, 82, 66, 98, 82, 82, 66, 98, 83, 34, 114, 99,
+    18, 114, 114, 244, 47, 66, 244, 32, 18, 66, 66, 66, 50, 50, 98, 34, 34, 115, 18, 19,
+    130, 18, 18, 138, 114, 20, 18, 98, 50, 50, 66, 66, 66, 50, 66, 70, 82, 83, 240, 47,
+    2, 240, 32, 22, 57, 18, 83, 130, 130, 115, 53, 86, 131, 130, 130, 131, 108, 38, 113, 145,
+    131, 99, 21, 41, 82, 98, 37, 53, 99, 99, 74, 37, 97, 113, 98, 83, 2, 114, 18, 98,
+    34, 82, 50, 67, 50, 51, 66, 35, 82, 19, 103, 84, 18, 83, 50, 66, 82, 50, 82, 50,
+    98, 34, 117, 115, 162, 162, 162, 2, 66, 34, 50, 50, 34, 66, 18, 85, 86, 67, 18, 66,
+    50, 50, 66, 34, 70, 83, 130, 130, 130, 2, 114, 18, 98, 34, 82, 50, 33, 19, 50, 36,
+    66, 35, 82, 19, 103, 87, 83, 17, 18, 66, 33, 34, 50, 33, 34, 50, 98, 34, 114, 18,
+    114, 2, 66, 18, 50, 34, 19, 50, 18, 69, 70, 54, 50, 17, 18, 34, 17, 34, 18, 66,
+    18, 82, 34, 114, 50, 98, 66, 82, 54, 35, 82, 51, 98, 35, 114, 19, 135, 116, 18, 115,
+    50, 98, 82, 82, 82, 82, 98, 66, 114, 50, 114, 18, 118, 82, 130, 130, 66, 34, 50, 50,
+    34, 66, 18, 85, 86, 67, 18, 66, 50, 50, 66, 34, 66, 34, 82, 6, 121, 99, 82, 83,
+    98, 67, 114, 51, 130, 35, 146, 19, 167, 148, 19, 131, 50, 130, 82, 114, 83, 98, 98, 98,
+    114, 82, 115, 6, 67, 22, 51, 98, 35, 114, 19, 133, 150, 131, 19, 114, 50, 114, 66, 98,
+    67, 82, 83, 2, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 43, 43, 34, 114, 34,
+    114, 34, 114, 34, 114, 34, 114, 34, 118, 116, 178, 178, 178, 2, 82, 34, 82, 34, 82, 34,
+    82, 34, 82, 41, 41, 34, 82, 34, 82, 34, 86, 84, 146, 146, 146, 2, 123, 123, 114, 114,
+    114, 114, 114, 114, 114, 123, 123, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 2, 90, 90, 82, 98, 82, 98, 82, 105, 105, 98, 82, 98, 82, 98, 82, 98, 82, 11,
+    139, 130, 114, 130, 114, 130, 114, 130, 114, 130, 120, 34, 121, 18, 114, 85, 114, 100, 114, 100,
+    114, 100, 114, 100, 114, 100, 114, 98, 242, 47, 19, 228, 240, 48, 9, 121, 114, 82, 114, 82,
+    114, 82, 114, 88, 18, 82, 84, 82, 84, 82, 84, 82, 84, 82, 82, 226, 226, 226, 181, 180,
+    82, 196, 35, 99, 54, 50, 66, 50, 50, 66, 66, 18, 82, 66, 18, 82, 66, 18, 82, 66,
+    18, 82, 66, 18, 82, 66, 34, 66, 50, 50, 82, 34, 51, 84, 84, 52, 124, 51, 147, 35,
+    66, 50, 18, 34, 65, 34, 34, 50, 49, 34, 50, 49, 34, 65, 34, 34, 66, 18, 50, 50,
+    17, 67, 51, 33, 58, 71, 58, 35, 97, 18, 147, 146, 162, 162, 162, 162, 163, 162, 179, 97,
+    42, 71, 129, 178, 162, 131, 53, 40, 19, 68, 98, 114, 114, 115, 115, 65, 24, 53, 98, 114,
+    114, 84, 15, 149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 72, 74, 42, 42, 32,
+    15, 84, 40, 40, 40, 40, 40, 40, 40, 70, 72, 40, 40, 32, 3, 99, 18, 98, 50, 66,
+    67, 35, 82, 34, 102, 116, 146, 162, 162, 162, 162, 162, 162, 162, 2, 98, 18, 66, 34, 66,
+    34, 66, 50, 34, 66, 34, 70, 84, 100, 114, 130, 130, 130, 130, 130, 2, 130, 18, 99, 18,
+    98, 50, 66, 82, 34, 99, 18, 116, 146, 162, 162, 135, 114, 162, 162, 162, 2, 100, 98, 17,
+    82, 34, 66, 34, 65, 66, 34, 66, 34, 81, 18, 100, 99, 130, 130, 87, 98, 130, 2, 130,
+    18, 98, 50, 66, 66, 66, 82, 34, 116, 132, 146, 148, 114, 18, 114, 34, 82, 66, 50, 82,
+    50, 101, 130, 162, 162, 162, 2, 98, 18, 66, 50, 34, 84, 100, 114, 116, 82, 19, 51, 34,
+    50, 69, 98, 130, 130, 130, 12, 34, 44, 34, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 125, 93, 241, 47, 18, 241, 32, 10,
+    18, 42, 18, 98, 82, 98, 82, 98, 82, 98, 82, 98, 82, 98, 82, 98, 82, 107, 75, 210,
+    210, 210, 2, 98, 34, 98, 34, 98, 34, 98, 34, 98, 35, 82, 57, 72, 162, 162, 162, 162,
+    162, 164, 132, 162, 162, 162, 2, 82, 34, 82, 34, 82, 34, 82, 35, 66, 56, 71, 146, 146,
+    148, 116, 146, 146, 146, 2, 100, 100, 100, 34, 36, 34, 36, 34, 44, 40, 66, 34, 66, 34,
+    66, 34, 130, 130, 130, 130, 2, 84, 84, 34, 18, 18, 18, 18, 24, 39, 66, 18, 66, 18,
+    114, 114, 114, 2, 130, 130, 130, 130, 130, 136, 41, 18, 85, 100, 100, 100, 100, 100, 98, 2,
+    114, 114, 114, 114, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 134, 170, 116, 67,
+    34, 50, 130, 18, 35, 145, 19, 18, 162, 31, 34, 241, 66, 241, 47, 19, 241, 47, 35, 113,
+    138, 152, 101, 34, 40, 18, 34, 69, 18, 98, 28, 28, 50, 178, 195, 81, 73, 102, 148, 200,
+    146, 83, 34, 50, 115, 18, 50, 130, 18, 35, 130, 47, 34, 241, 66, 241, 47, 34, 241, 47,
+    19, 129, 116, 52, 151, 210, 241, 47, 18, 241, 32, 101, 131, 34, 34, 34, 82, 18, 34, 97,
+    36, 113, 60, 50, 210, 194, 210, 66, 119, 146, 194, 194, 15, 240, 113, 65, 240, 79, 211, 98,
+    99, 19, 82, 83, 51, 66, 67, 83, 50, 51, 115, 34, 35, 147, 18, 19, 163, 18, 19, 156,
+    130, 36, 34, 115, 36, 35, 98, 66, 66, 82, 82, 82, 51, 82, 83, 34, 98, 98, 19, 98,
+    99, 81, 65, 166, 180, 255, 147, 50, 51, 51, 34, 35, 83, 18, 19, 114, 18, 18, 136, 136,
+    114, 20, 18, 83, 34, 35, 66, 50, 50, 50, 66, 66, 19, 66, 67, 2, 101, 83, 18, 67,
+    34, 51, 50, 35, 66, 19, 87, 73, 34, 83, 18, 98, 18, 98, 18, 98, 18, 98, 18, 98,
+    18, 98, 146, 146, 100, 115, 2, 84, 51, 18, 35, 34, 18, 68, 87, 34, 66, 18, 66, 18,
+    66, 18, 66, 18, 66, 114, 114, 114, 68, 57, 89, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 66, 98, 66, 98, 35, 118, 132, 194, 178, 178, 193,
+    71, 103, 98, 50, 98, 50, 97, 66, 97, 66, 82, 66, 82, 66, 82, 66, 51, 87, 100, 178,
+    162, 177, 178, 2, 116, 116, 116, 116, 116, 127, 183, 71, 71, 71, 71, 71, 71, 41, 40, 54,
+    71, 48, 2, 84, 84, 84, 84, 95, 117, 69, 69, 69, 39, 39, 39, 36, 84, 64, 2, 114,
+    34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 43, 43, 34, 114, 34, 114, 34, 114, 34, 114,
+    34, 114, 34, 118, 116, 178, 162, 162, 177, 2, 97, 34, 97, 34, 97, 34, 97, 34, 97, 41,
+    34, 97, 34, 97, 34, 97, 34, 101, 99, 146, 145, 145, 146, 2, 100, 100, 100, 100, 101, 82,
+    25, 40, 130, 130, 130, 130, 130, 100, 100, 98, 130, 130, 2, 84, 84, 84, 85, 66, 24, 39,
+    114, 114, 84, 84, 82, 114, 114, 3, 115, 35, 115, 36, 99, 36, 84, 34, 17, 84, 34, 18,
+    50, 18, 34, 18, 50, 18, 34, 34, 33, 34, 34, 34, 18, 34, 34, 49, 18, 34, 34, 51,
+    50, 34, 51, 50, 34, 146, 34, 150, 148, 210, 194, 209, 209, 3, 83, 35, 83, 35, 83, 36,
+    52, 34, 17, 49, 18, 34, 18, 18, 18, 34, 33, 17, 34, 34, 35, 34, 34, 35, 34, 34,
+    118, 116, 178, 162, 177, 178, 15, 240, 65, 49, 133, 147, 248, 58, 58, 57, 33, 40, 33, 39,
+    49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 33, 49,
+    69, 83, 248, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 32, 66, 18, 130, 18, 255,
+    83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82, 66, 82, 73, 59, 34,
+    114, 34, 114, 18, 146, 34, 18, 66, 18, 247, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193,
+    81, 32, 108, 108, 82, 34, 194, 34, 179, 34, 178, 50, 178, 57, 50, 73, 50, 66, 146, 82,
+    153, 138, 130, 98, 130, 107, 121, 37, 53, 55, 23, 33, 68, 66, 130, 98, 47, 1, 243, 82,
+    130, 82, 130, 69, 88, 25, 36, 70, 33, 49, 69, 191, 87, 39, 39, 39, 245, 114, 114, 114,
+    114, 127, 48, 49, 49, 85, 99, 251, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 39, 90,
+    49, 115, 178, 194, 178, 191, 240, 148, 146, 18, 114, 35, 83, 57, 101, 22, 56, 33, 98, 159,
+    150, 70, 33, 36, 34, 132, 64, 66, 34, 114, 34, 255, 23, 90, 49, 115, 178, 194, 178, 191,
+    240, 148, 146, 18, 114, 35, 83, 57, 101, 34, 34, 66, 34, 248, 99, 130, 22, 41, 249, 100,
+    98, 18, 66, 40, 68, 114, 34, 226, 34, 255, 242, 54, 38, 49, 53, 37, 51, 52, 36, 53,
+    51, 35, 55, 50, 34, 57, 49, 33, 58, 49, 33, 57, 200, 34, 66, 39, 50, 66, 54, 36,
+    36, 37, 37, 37, 35, 53, 37, 50, 38, 38, 33, 54, 38, 48, 82, 34, 162, 34, 255, 131,
+    50, 51, 51, 34, 35, 83, 18, 19, 114, 18, 18, 136, 136, 114, 20, 18, 83, 34, 35, 66,
+    50, 50, 50, 66, 66, 19, 66, 67, 18, 34, 66, 34, 249, 99, 145, 37, 56, 40, 39, 51,
+    85, 104, 56, 40, 40, 54, 194, 96, 34, 34, 34, 34, 242, 82, 149, 38, 34, 83, 86, 54,
+    52, 162, 80, 10, 26, 130, 131, 115, 130, 132, 118, 146, 162, 146, 147, 125, 54, 9, 25, 114,
+    114, 114, 115, 116, 102, 131, 130, 130, 131, 108, 38, 38, 86, 226, 101, 86, 86, 71, 66, 20,
+    51, 20, 50, 36, 35, 36, 34, 52, 19, 52, 18, 71, 70, 85, 101, 98, 22, 54, 245, 36,
+    84, 83, 98, 114, 33, 65, 49, 65, 34, 99, 99, 84, 84, 32, 34, 34, 82, 34, 250, 38,
+    85, 101, 100, 116, 33, 67, 49, 67, 34, 66, 50, 66, 35, 65, 51, 65, 36, 116, 101, 86,
+    86, 32, 18, 34, 50, 34, 245, 36, 84, 83, 98, 114, 33, 65, 49, 65, 34, 99, 99, 84,
+    84, 32, 66, 34, 130, 34, 255, 102, 106, 67, 67, 50, 130, 19, 133, 164, 164, 164, 164, 165,
+    131, 18, 130, 51, 67, 74, 102, 34, 34, 66, 34, 250, 68, 130, 36, 33, 38, 70, 70, 70,
+    70, 33, 36, 34, 132, 64, 70, 106, 67, 67, 50, 130, 19, 148, 175, 242, 164, 165, 131, 18,
+    130, 51, 67, 74, 102, 52, 72, 34, 66, 18, 111, 150, 70, 33, 36, 34, 132, 64, 66, 34,
+    130, 34, 255, 102, 106, 67, 67, 50, 130, 19, 148, 175, 242, 164, 165, 131, 18, 130, 51, 67,
+    74, 102, 34, 34, 66, 34, 250, 68, 130, 36, 33, 38, 249, 100, 98, 18, 66, 40, 68, 34,
+    34, 98, 34, 254, 116, 162, 23, 43, 43, 42, 34, 162, 170, 42, 41, 57, 33, 22, 50, 163,
+    112, 18, 34, 50, 34, 246, 83, 114, 21, 40, 33, 129, 135, 39, 53, 33, 130, 80, 54, 102,
+    240, 40, 33, 38, 34, 38, 35, 36, 51, 36, 37, 35, 37, 34, 38, 49, 39, 72, 73, 57,
+    41, 55, 72, 48, 54, 86, 249, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33,
+    38, 33, 39, 56, 56, 41, 40, 54, 71, 48, 50, 34, 98, 34, 252, 40, 33, 38, 34, 38,
+    35, 36, 51, 36, 37, 35, 37, 34, 38, 49, 39, 72, 73, 57, 41, 55, 72, 48, 50, 34,
+    82, 34, 249, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39, 56,
+    56, 41, 40, 54, 71, 48, 82, 18, 98, 18, 113, 33, 241, 40, 33, 38, 34, 38, 35, 36,
+    51, 36, 37, 35, 37, 34, 38, 49, 39, 72, 73, 57, 41, 55, 72, 48, 82, 34, 66, 34,
+    81, 49, 82, 34, 210, 114, 18, 82, 34, 82, 35, 50, 66, 50, 67, 19, 82, 18, 98, 18,
+    115, 131, 130, 146, 131, 100, 115, 34, 34, 66, 34, 247, 38, 70, 70, 70, 70, 70, 85, 33,
+    146, 136, 40, 40, 40, 40, 40, 32, 34, 34, 50, 34, 244, 37, 69, 69, 69, 84, 33, 130,
+    119, 39, 39, 39, 32, 15, 87, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 69, 71, 39,
+    39, 32, 15, 54, 38, 38, 38, 38, 38, 38, 68, 70, 38, 38, 32, 66, 34, 130, 34, 255,
+    34, 164, 164, 164, 164, 164, 170, 75, 52, 83, 36, 98, 36, 98, 36, 98, 36, 83, 43, 58,
+    66, 50, 34, 98, 34, 252, 40, 72, 72, 72, 72, 147, 177, 69, 33, 69, 33, 177, 147, 32,
+    57, 57, 50, 162, 162, 162, 162, 122, 42, 82, 162, 162, 162, 162, 166, 162, 162, 162, 101, 117,
+    56, 56, 50, 146, 105, 41, 82, 146, 146, 146, 150, 146, 146, 146, 85, 101, 2, 130, 18, 98,
+    50, 66, 66, 66, 82, 34, 116, 132, 146, 148, 114, 18, 114, 34, 82, 66, 50, 82, 50, 98,
+    18, 130, 162, 162, 116, 131, 2, 98, 18, 66, 50, 34, 84, 100, 114, 116, 82, 19, 51, 34,
+    50, 66, 18, 98, 130, 130, 114, 100, 2, 130, 18, 98, 50, 66, 66, 66, 82, 34, 116, 132,
+    90, 84, 114, 18, 114, 34, 82, 66, 50, 82, 50, 98, 18, 130, 2, 98, 18, 66, 50, 34,
+    84, 100, 57, 68, 82, 19, 51, 34, 50, 66, 18, 98, 2, 114, 18, 114, 18, 114, 18, 114,
+    18, 114, 18, 114, 18, 114, 18, 114, 18, 114, 18, 114, 18, 114, 18, 66, 18, 18, 68, 51,
+    52, 57, 53, 72, 35, 82, 18, 116, 116, 116, 146, 146, 159, 153, 41, 41, 32, 53, 136, 82,
+    82, 66, 114, 50, 114, 50, 114, 50, 114, 51, 98, 67, 82, 92, 74, 146, 194, 194, 194, 53,
+    105, 66, 82, 50, 114, 34, 114, 34, 114, 178, 178, 178, 180, 148, 146, 178, 178, 178, 2, 146,
+    146, 146, 159, 153, 41, 41, 39, 71, 71, 70, 34, 51, 51, 112, 53, 89, 50, 83, 18, 114,
+    18, 132, 130, 162, 162, 146, 162, 146, 147, 34, 66, 79, 144, 2, 130, 130, 130, 143, 120, 40,
+    40, 40, 40, 40, 40, 145, 144, 53, 72, 35, 82, 18, 116, 116, 116, 146, 146, 146, 146, 146,
+    146, 159, 112, 54, 137, 82, 99, 50, 130, 50, 146, 34, 146, 34, 90, 60, 50, 66, 34, 34,
+    82, 34, 34, 82, 34, 34, 82, 34, 34, 66, 50, 50, 35, 50, 69, 146, 194, 194, 194, 107,
+    44, 18, 98, 50, 114, 50, 114, 50, 114, 50, 114, 50, 114, 66, 82, 83, 51, 118, 2, 146,
+    146, 146, 146, 21, 53, 20, 19, 82, 18, 116, 116, 116, 146, 146, 146, 146, 2, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 127, 48, 2, 210, 210, 210, 215, 105, 100, 50, 100,
+    50, 100, 50, 100, 50, 100, 50, 100, 65, 100, 66, 84, 67, 35, 18, 86, 2, 69, 18, 42,
+    19, 89, 82, 37, 34, 99, 18, 117, 132, 132, 132, 132, 133, 98, 35, 51, 86, 2, 146, 146,
+    146, 146, 116, 116, 116, 116, 99, 18, 68, 41, 66, 50, 146, 146, 146, 114, 178, 163, 162, 132,
+    99, 115, 131, 130, 146, 162, 165, 151, 135, 147, 53, 89, 50, 83, 18, 114, 18, 117, 130, 162,
+    162, 146, 65, 82, 38, 19, 18, 53, 34, 83, 34, 54, 38, 34, 53, 121, 82, 82, 66, 114,
+    50, 114, 50, 114, 194, 194, 194, 194, 194, 194, 194, 197, 149, 34, 113, 66, 52, 67, 19, 116,
+    162, 164, 130, 19, 98, 50, 98, 66, 66, 83, 49, 114, 34, 130, 18, 143, 17, 192, 2, 118,
+    118, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114,
+    34, 98, 67, 51, 87, 69, 88, 66, 82, 34, 98, 162, 162, 41, 57, 179, 162, 162, 18, 114,
+    18, 114, 20, 51, 71, 4, 164, 194, 194, 194, 194, 194, 194, 194, 194, 130, 34, 130, 50, 98,
+    66, 98, 83, 35, 118, 4, 135, 149, 104, 35, 82, 34, 146, 162, 162, 162, 132, 132, 114, 19,
+    98, 35, 51, 71, 53, 72, 35, 82, 18, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    114, 69, 88, 51, 82, 34, 116, 132, 130, 162, 162, 162, 146, 147, 51, 20, 70, 133, 162, 69,
+    105, 51, 34, 19, 19, 50, 37, 66, 52, 66, 50, 98, 50, 98, 50, 98, 50, 98, 50, 178,
+    178, 178, 178, 178, 53, 89, 35, 83, 18, 114, 18, 117, 132, 136, 66, 52, 34, 114, 18, 116,
+    132, 34, 66, 75, 27, 53, 104, 67, 82, 50, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34,
+    114, 34, 118, 118, 114, 34, 114, 34, 114, 34, 114, 2, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 117, 83, 18, 82, 41, 69, 146, 194, 194, 194, 50, 114, 50, 114, 50, 114, 50, 114,
+    51, 98, 66, 83, 89, 129, 50, 194, 197, 149, 68, 104, 51, 67, 34, 98, 34, 162, 180, 151,
+    133, 162, 178, 18, 114, 18, 98, 51, 51, 71, 53, 72, 35, 82, 18, 101, 116, 116, 146, 146,
+    146, 146, 146, 146, 146, 146, 53, 89, 50, 82, 49, 114, 33, 114, 34, 82, 41, 57, 179, 162,
+    162, 18, 114, 18, 114, 35, 51, 71, 2, 114, 114, 114, 127, 87, 39, 39, 39, 39, 39, 39,
+    39, 32, 98, 194, 167, 90, 50, 50, 50, 34, 50, 68, 66, 68, 66, 68, 66, 68, 66, 66,
+    18, 50, 50, 35, 34, 35, 73, 130, 194, 85, 136, 82, 83, 66, 98, 50, 115, 34, 130, 34,
+    114, 51, 98, 52, 52, 50, 22, 82, 194, 173, 29, 50, 70, 106, 67, 67, 50, 130, 19, 133,
+    164, 164, 164, 164, 165, 131, 18, 130, 51, 67, 74, 102, 83, 134, 130, 34, 114, 50, 130, 34,
+    152, 146, 20, 114, 50, 114, 66, 98, 68, 66, 68, 66, 66, 18, 50, 50, 51, 18, 19, 88,
+    20, 17, 34, 34, 18, 20, 18, 17, 34, 49, 49, 50, 97, 82, 36, 35, 50, 81, 18, 65,
+    66, 66, 37, 34, 52, 67, 34, 19, 51, 1, 127, 16, 2, 82, 84, 82, 84, 82, 84, 82,
+    84, 82, 84, 82, 84, 82, 84, 82, 84, 67, 70, 37, 36, 21, 37, 18, 2, 21, 20, 34,
+    18, 84, 84, 84, 84, 84, 114, 127, 87, 39, 39, 32, 37, 18, 51, 36, 50, 67, 34, 98,
+    34, 98, 34, 98, 34, 98, 34, 98, 50, 67, 51, 38, 37, 20, 130, 162, 162, 162, 2, 21,
+    52, 34, 50, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 86, 84, 114,
+    146, 146, 146, 2, 114, 114, 114, 127, 87, 39, 37, 69, 69, 69, 68, 98, 65, 81, 32, 37,
+    18, 51, 36, 50, 67, 34, 98, 34, 98, 34, 98, 34, 98, 34, 98, 50, 67, 51, 36, 69,
+    18, 162, 162, 162, 164, 2, 98, 98, 98, 111, 54, 38, 38, 38, 38, 38, 38, 113, 112, 2,
+    21, 20, 34, 18, 84, 84, 84, 84, 84, 84, 84, 84, 84, 114, 114, 121, 2, 21, 84, 51,
+    50, 98, 50, 114, 34, 114, 34, 114, 34, 43, 33, 66, 34, 18, 66, 34, 34, 34, 50, 37,
+    66, 178, 178, 178, 130, 162, 162, 162, 89, 42, 18, 82, 34, 98, 34, 98, 34, 98, 34, 98,
+    34, 98, 50, 66, 67, 35, 86, 2, 114, 114, 114, 114, 21, 20, 34, 18, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 114, 114, 114, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 36, 2, 226, 226, 226, 226, 20, 117, 35, 100, 81, 100, 82, 84, 82, 84, 82, 84,
+    82, 84, 82, 84, 82, 69, 83, 38, 101, 20, 226, 226, 226, 50, 114, 131, 131, 119, 40, 18,
+    66, 18, 100, 100, 100, 100, 98, 18, 82, 19, 35, 54, 2, 114, 114, 114, 114, 84, 84, 84,
+    84, 84, 84, 84, 84, 70, 36, 21, 18, 114, 114, 114, 114, 2, 114, 114, 114, 114, 20, 40,
+    19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 34, 114, 114, 33, 84, 98, 101, 50, 34, 34,
+    66, 17, 99, 99, 99, 99, 82, 18, 51, 37, 17, 2, 21, 52, 34, 50, 82, 34, 82, 34,
+    82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 146, 146, 146, 148, 100, 67, 33,
+    51, 114, 87, 56, 50, 66, 34, 82, 17, 98, 17, 100, 100, 98, 18, 67, 19, 36, 37, 18,
+    116, 114, 146, 146, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82,
+    34, 67, 35, 36, 53, 18, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 18,
+    19, 4, 146, 146, 146, 146, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34,
+    82, 34, 67, 35, 36, 53, 18, 22, 49, 51, 114, 130, 114, 98, 114, 98, 98, 98, 98, 98,
+    98, 114, 120, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 34, 81, 82, 82,
+    101, 67, 51, 66, 66, 66, 82, 66, 82, 82, 87, 2, 82, 84, 82, 84, 82, 84, 82, 84,
+    82, 84, 82, 84, 82, 84, 82, 84, 67, 70, 37, 36, 21, 37, 18, 226, 226, 226, 226, 37,
+    50, 35, 18, 84, 84, 82, 18, 66, 34, 34, 50, 18, 69, 68, 82, 98, 98, 114, 135, 2,
+    21, 36, 35, 18, 82, 18, 97, 18, 100, 97, 18, 82, 18, 82, 18, 66, 34, 55, 53, 2,
+    84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 114, 146, 146, 146, 34, 82, 34, 82,
+    34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 67, 35, 36, 53, 18, 146, 146,
+    146, 148, 2, 82, 20, 34, 84, 19, 18, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82,
+    84, 67, 85, 36, 82, 21, 18, 82, 2, 21, 20, 34, 18, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 114, 114, 114, 37, 18, 25, 18, 69, 100, 100, 100, 100, 98, 18, 67, 25, 37, 18,
+    130, 17, 82, 40, 53, 2, 82, 82, 82, 82, 82, 82, 82, 82, 94, 114, 226, 226, 226, 114,
+    82, 20, 34, 84, 19, 18, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 67, 85,
+    36, 82, 21, 18, 82, 114, 226, 226, 226, 34, 20, 84, 34, 66, 82, 50, 82, 50, 98, 34,
+    98, 34, 98, 34, 82, 50, 82, 51, 50, 66, 21, 66, 162, 139, 50, 52, 72, 34, 66, 18,
+    100, 100, 100, 100, 98, 18, 66, 40, 68, 53, 130, 34, 130, 34, 130, 34, 152, 136, 114, 50,
+    114, 67, 82, 67, 82, 68, 66, 68, 66, 66, 18, 50, 50, 58, 88, 146, 194, 194, 194, 2,
+    194, 194, 194, 194, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    67, 83, 41, 21, 23, 4, 132, 5, 20, 2, 82, 18, 66, 33, 66, 34, 50, 35, 34, 18,
+    17, 18, 18, 35, 34, 50, 34, 65, 34, 66, 18, 82, 6, 71, 131, 130, 130, 130, 130, 130,
+    130, 47, 80, 3, 52, 67, 66, 66, 66, 66, 66, 51, 19, 20, 34, 15, 86, 40, 40, 40,
+    40, 40, 40, 40, 40, 32, 8, 41, 131, 130, 17, 100, 100, 100, 100, 100, 100, 98, 15, 112,
+    10, 33, 50, 50, 50, 50, 50, 50, 50, 50, 8, 41, 18, 85, 100, 100, 100, 100, 100, 100,
+    100, 98, 2, 52, 34, 53, 18, 101, 116, 116, 116, 116, 114, 18, 82, 41, 69, 13, 6, 39,
+    99, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 6, 56, 114, 130, 114, 114, 114,
+    114, 98, 24, 22, 2, 114, 114, 114, 127, 55, 38, 39, 38, 39, 39, 38, 39, 38, 32, 8,
+    41, 18, 85, 100, 100, 100, 100, 100, 111, 112, 2, 53, 50, 23, 52, 51, 35, 82, 35, 82,
+    34, 98, 34, 98, 34, 98, 19, 98, 18, 54, 18, 54, 15, 240, 4, 21, 50, 50, 50, 50,
+    50, 50, 60, 8, 41, 18, 85, 100, 100, 100, 100, 98, 18, 66, 40, 54, 2, 100, 98, 18,
+    82, 18, 82, 18, 82, 34, 66, 34, 51, 34, 50, 51, 19, 69, 53, 68, 97, 7, 40, 18,
+    69, 84, 86, 50, 19, 50, 114, 114, 114, 114, 114, 114, 114, 114, 6, 56, 18, 66, 18, 86,
+    50, 19, 50, 114, 114, 98, 24, 22, 2, 98, 18, 82, 34, 66, 50, 50, 51, 18, 84, 98,
+    130, 130, 130, 130, 130, 130, 130, 130, 2, 82, 18, 66, 34, 50, 49, 50, 50, 34, 68, 98,
+    114, 130, 24, 25, 15, 121, 25, 41, 34, 21, 34, 37, 34, 37, 19, 36, 35, 36, 35, 35,
+    36, 41, 41, 41, 32, 6, 56, 114, 130, 114, 114, 114, 114, 114, 114, 114, 2, 66, 68, 66,
+    68, 66, 66, 18, 35, 65, 34, 34, 66, 38, 66, 37, 67, 35, 98, 66, 67, 88, 102, 9,
+    42, 50, 67, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 86, 85, 98, 29, 45, 83,
+    178, 194, 194, 210, 164, 180, 180, 180, 180, 178, 18, 162, 18, 146, 50, 115, 67, 52, 103, 35,
+    50, 67, 66, 66, 82, 50, 98, 50, 98, 50, 98, 50, 98, 50, 98, 66, 82, 88, 100, 18,
+    178, 178, 178, 178, 181, 133, 51, 118, 82, 66, 66, 81, 66, 81, 66, 81, 81, 81, 177, 177,
+    177, 177, 177, 177, 177, 177, 181, 117, 162, 162, 162, 29, 45, 129, 183, 114, 67, 67, 114, 50,
+    146, 18, 162, 18, 180, 180, 180, 177, 33, 162, 34, 146, 50, 114, 83, 51, 119, 52, 86, 50,
+    66, 18, 100, 100, 100, 101, 82, 18, 82, 130, 130, 130, 130, 130, 130, 130, 130, 51, 134, 98,
+    66, 82, 66, 82, 66, 82, 71, 17, 71, 98, 65, 98, 65, 98, 65, 98, 65, 98, 65, 98,
+    178, 178, 178, 178, 5, 133, 178, 178, 178, 181, 136, 82, 67, 66, 97, 66, 98, 50, 98, 50,
+    98, 50, 98, 50, 98, 50, 82, 82, 51, 102, 102, 152, 130, 82, 114, 98, 98, 114, 98, 121,
+    137, 130, 52, 130, 52, 130, 52, 130, 50, 17, 130, 50, 18, 114, 99, 98, 114, 98, 132, 50,
+    167, 1, 110, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 2, 130, 130,
+    136, 35, 51, 18, 100, 100, 100, 100, 100, 98, 18, 82, 19, 36, 40, 130, 130, 130, 6, 150,
+    145, 65, 145, 65, 145, 65, 145, 65, 49, 81, 72, 114, 67, 97, 98, 97, 113, 97, 114, 81,
+    114, 82, 98, 82, 97, 98, 82, 114, 51, 133, 40, 120, 210, 210, 210, 170, 45, 19, 66, 65,
+    18, 82, 67, 98, 67, 98, 67, 98, 67, 98, 67, 98, 65, 18, 82, 65, 19, 50, 81, 53,
+    97, 69, 40, 34, 114, 130, 130, 49, 73, 19, 66, 18, 100, 100, 100, 100, 100, 100, 100, 100,
+    98, 99, 168, 83, 83, 51, 115, 34, 146, 18, 180, 180, 180, 180, 180, 180, 178, 18, 146, 34,
+    146, 50, 114, 83, 51, 119, 210, 34, 146, 34, 164, 6, 119, 113, 66, 113, 66, 113, 66, 113,
+    66, 113, 66, 113, 66, 113, 66, 113, 66, 113, 66, 113, 66, 113, 66, 113, 66, 98, 82, 82,
+    98, 50, 133, 4, 85, 81, 33, 97, 18, 99, 115, 115, 113, 17, 113, 18, 82, 40, 52, 33,
+    145, 145, 145, 145, 145, 145, 130, 226, 226, 226, 226, 232, 136, 130, 66, 17, 98, 66, 18, 82,
+    68, 98, 68, 98, 68, 98, 68, 98, 66, 18, 82, 66, 19, 35, 82, 38, 2, 130, 130, 130,
+    130, 130, 130, 130, 82, 18, 85, 100, 100, 100, 98, 17, 98, 18, 82, 34, 50, 69, 7, 57,
+    18, 82, 18, 100, 100, 100, 100, 100, 82, 25, 23, 50, 130, 130, 130, 137, 25, 99, 153, 83,
+    83, 66, 115, 34, 146, 18, 180, 180, 180, 180, 180, 180, 178, 18, 146, 34, 146, 50, 114, 83,
+    53, 87, 34, 210, 210, 179, 194, 71, 107, 51, 50, 50, 34, 66, 68, 82, 68, 82, 68, 82,
+    68, 82, 68, 82, 66, 18, 66, 66, 19, 50, 50, 59, 103, 178, 210, 210, 210, 82, 178, 178,
+    98, 50, 98, 50, 98, 50, 111, 181, 36, 37, 36, 37, 36, 37, 43, 43, 43, 43, 43, 32,
+    67, 87, 34, 66, 34, 84, 100, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 113, 2,
+    100, 100, 100, 100, 100, 100, 100, 98, 18, 82, 25, 52, 18, 130, 130, 130, 130, 130, 130, 2,
+    100, 100, 100, 100, 100, 100, 100, 98, 18, 82, 40, 52, 18, 132, 100, 101, 82, 19, 35, 54,
+    2, 130, 130, 130, 130, 130, 34, 73, 18, 85, 100, 115, 115, 115, 115, 115, 115, 115, 113, 100,
+    137, 67, 82, 50, 129, 34, 194, 178, 194, 194, 194, 164, 162, 18, 146, 18, 146, 19, 130, 35,
+    114, 52, 52, 89, 130, 210, 210, 210, 210, 170, 45, 19, 66, 50, 18, 82, 52, 98, 52, 98,
+    52, 98, 52, 98, 52, 98, 50, 18, 82, 50, 19, 50, 66, 53, 82, 7, 57, 18, 100, 100,
+    100, 100, 92, 18, 130, 130, 135, 50, 65, 50, 65, 50, 65, 50, 130, 52, 86, 50, 66, 33,
+    97, 18, 98, 18, 131, 131, 147, 147, 133, 100, 115, 113, 18, 82, 19, 50, 69, 2, 115, 115,
+    115, 115, 115, 115, 100, 100, 107, 23, 50, 130, 130, 130, 137, 25, 15, 163, 38, 36, 36, 37,
+    51, 23, 34, 40, 73, 74, 42, 58, 72, 33, 39, 35, 38, 35, 37, 37, 36, 42, 32, 6,
+    150, 145, 65, 145, 65, 145, 65, 145, 65, 114, 81, 114, 81, 114, 81, 114, 81, 114, 81, 114,
+    81, 114, 81, 114, 82, 98, 82, 82, 114, 51, 133, 2, 130, 130, 130, 130, 133, 88, 34, 66,
+    34, 81, 34, 81, 34, 85, 130, 130, 130, 130, 130, 67, 133, 98, 50, 82, 178, 163, 179, 179,
+    50, 83, 18, 114, 18, 132, 132, 132, 129, 34, 98, 35, 51, 86, 130, 130, 130, 130, 133, 82,
+    18, 82, 33, 82, 34, 66, 40, 70, 130, 130, 130, 130, 130, 130, 2, 100, 100, 100, 100, 100,
+    100, 100, 98, 18, 66, 39, 84, 114, 130, 130, 130, 130, 130, 116, 134, 114, 50, 97, 66, 97,
+    66, 97, 50, 58, 113, 193, 193, 137, 35, 49, 98, 65, 98, 65, 98, 50, 99, 34, 117, 49,
+    114, 98, 114, 114, 116, 68, 68, 68, 66, 18, 50, 22, 33, 114, 114, 113, 114, 97, 84, 50,
+    34, 33, 68, 68, 83, 83, 83, 68, 66, 18, 50, 37, 37, 66, 49, 66, 50, 130, 114, 100,
+    86, 50, 66, 18, 97, 18, 100, 100, 100, 97, 34, 66, 54, 83, 35, 52, 53, 18, 34, 18,
+    66, 68, 66, 68, 66, 68, 65, 84, 66, 68, 66, 66, 17, 81, 66, 18, 70, 50, 210, 181,
+    130, 51, 210, 210, 36, 50, 34, 33, 66, 17, 66, 17, 66, 18, 50, 98, 98, 100, 68, 68,
+    68, 68, 66, 22, 52, 36, 50, 37, 68, 66, 17, 66, 97, 68, 68, 116, 68, 68, 68, 68,
+    66, 22, 67, 35, 85, 65, 50, 34, 50, 34, 50, 49, 50, 53, 86, 34, 50, 34, 66, 18,
+    66, 18, 66, 18, 66, 18, 66, 18, 66, 34, 34, 53, 36, 51, 50, 34, 21, 18, 66, 68,
+    66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 66, 65, 34, 34, 66, 52, 66, 36, 51, 18,
+    18, 68, 68, 83, 83, 83, 68, 66, 18, 50, 18, 34, 82, 113, 114, 98, 98, 82, 52, 69,
+    116, 68, 68, 68, 68, 66, 22, 52, 36, 35, 52, 34, 36, 18, 18, 21, 66, 51, 52, 66,
+    65, 83, 66, 65, 83, 66, 65, 68, 240, 33, 46, 18, 45, 35, 63, 36, 242, 92, 153, 39,
+    47, 50, 242, 32, 51, 55, 18, 50, 17, 81, 113, 113, 50, 33, 23, 18, 67, 83, 83, 83,
+    83, 68, 66, 18, 50, 37, 38, 25, 98, 98, 98, 98, 34, 39, 18, 68, 68, 83, 83, 83,
+    83, 66, 18, 50, 37, 35, 52, 50, 18, 18, 19, 18, 66, 65, 18, 66, 68, 66, 68, 66,
+    68, 66, 68, 161, 34, 130, 34, 114, 66, 98, 50, 98, 115, 98, 114, 98, 97, 67, 114, 114,
+    100, 68, 68, 68, 66, 18, 34, 38, 98, 26, 65, 34, 49, 50, 33, 50, 37, 52, 65, 113,
+    115, 83, 83, 68, 66, 22, 52, 129, 179, 147, 162, 178, 193, 193, 18, 52, 50, 33, 18, 34,
+    18, 66, 68, 66, 68, 66, 68, 66, 68, 66, 68, 162, 18, 130, 34, 114, 66, 83, 2, 98,
+    98, 98, 98, 98, 50, 18, 49, 34, 50, 18, 50, 18, 68, 68, 83, 83, 81, 17, 66, 18,
+    50, 37, 81, 161, 161, 133, 82, 17, 18, 50, 33, 34, 33, 49, 49, 18, 49, 52, 49, 52,
+    49, 52, 131, 131, 116, 116, 114, 18, 82, 34, 82, 55, 99, 3, 35, 37, 18, 50, 49, 65,
+    49, 65, 49, 65, 49, 129, 129, 129, 18, 81, 18, 81, 18, 81, 18, 81, 18, 66, 38, 83,
+    36, 51, 50, 34, 18, 21, 66, 68, 66, 83, 66, 83, 66, 68, 66, 68, 66, 50, 38, 50,
+    68, 98, 194, 194, 50, 114, 50, 114, 73, 117, 98, 98, 98, 98, 98, 98, 35, 18, 18, 22,
+    68, 66, 17, 66, 17, 66, 98, 98, 100, 68, 68, 68, 68, 66, 22, 52, 35, 52, 50, 33,
+    18, 19, 18, 66, 65, 18, 66, 68, 66, 68, 66, 68, 161, 33, 146, 34, 129, 66, 210, 211,
+    150, 129, 67, 194, 209, 34, 49, 18, 65, 17, 83, 83, 83, 81, 17, 81, 23, 50, 33, 115,
+    83, 83, 68, 66, 22, 52, 2, 35, 18, 21, 34, 34, 34, 34, 33, 50, 98, 50, 18, 25,
+    68, 68, 68, 68, 68, 68, 66, 18, 50, 37, 35, 69, 34, 50, 18, 50, 18, 98, 98, 19,
+    39, 18, 68, 83, 83, 83, 83, 68, 68, 65, 18, 50, 18, 34, 65, 66, 34, 66, 34, 82,
+    18, 97, 18, 82, 18, 36, 34, 36, 34, 82, 18, 97, 18, 100, 100, 97, 34, 66, 54, 84,
+    113, 113, 113, 113, 113, 113, 50, 33, 23, 17, 83, 83, 83, 83, 83, 68, 66, 18, 34, 53,
+    34, 50, 20, 21, 49, 50, 49, 50, 49, 50, 114, 19, 55, 34, 66, 18, 66, 18, 81, 18,
+    81, 18, 81, 18, 81, 33, 66, 34, 50, 53, 66, 98, 98, 98, 98, 98, 79, 18, 34, 19,
+    34, 34, 35, 34, 23, 38, 39, 68, 69, 53, 53, 52, 33, 115, 48, 2, 98, 98, 98, 98,
+    98, 102, 36, 21, 68, 83, 83, 83, 83, 81, 17, 66, 18, 50, 37, 52, 114, 49, 50, 36,
+    18, 68, 115, 82, 19, 50, 98, 115, 130, 130, 114, 98, 68, 82, 34, 114, 115, 114, 98, 98,
+    67, 114, 98, 98, 66, 132, 68, 68, 69, 50, 22, 66, 34, 34, 34, 53, 68, 68, 68, 35,
+    18, 68, 83, 68, 35, 18, 68, 83, 83, 66, 18, 50, 37, 36, 50, 34, 18, 68, 68, 68,
+    68, 68, 66, 17, 66, 18, 34, 52, 68, 35, 36, 97, 13, 20, 68, 66, 97, 98, 52, 129,
+    116, 68, 68, 68, 68, 66, 22, 52, 34, 83, 66, 98, 98, 98, 81, 23, 38, 98, 98, 97,
+    82, 68, 130, 100, 68, 68, 68, 68, 66, 22, 52, 36, 71, 18, 66, 18, 81, 18, 81, 18,
+    81, 40, 113, 129, 129, 55, 19, 49, 18, 81, 18, 81, 18, 66, 18, 66, 38, 36, 51, 66,
+    34, 18, 19, 18, 67, 50, 18, 66, 81, 18, 66, 84, 81, 84, 81, 84, 81, 81, 18, 81,
+    66, 34, 66, 50, 50, 49, 20, 145, 210, 210, 179, 194, 36, 67, 18, 50, 50, 34, 50, 98,
+    99, 82, 83, 98, 65, 18, 84, 84, 84, 84, 82, 23, 67, 2, 34, 34, 50, 18, 68, 68,
+    68, 68, 73, 18, 18, 50, 98, 68, 68, 68, 66, 22, 52, 37, 67, 34, 34, 82, 18, 97,
+    18, 100, 100, 100, 82, 34, 66, 54, 82, 114, 129, 65, 65, 65, 70, 99, 36, 51, 21, 68,
+    68, 68, 68, 114, 98, 115, 85, 34, 34, 2, 82, 249, 37, 46, 37, 32, 20, 49, 53, 34,
+    34, 35, 17, 18, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50, 98, 50, 82, 82, 66,
+    82, 73, 59, 34, 114, 34, 114, 18, 146, 244, 42, 18, 25, 18, 26, 32, 37, 55, 33, 67,
+    114, 39, 26, 84, 84, 76, 21, 18, 195, 97, 33, 81, 33, 83, 66, 130, 249, 115, 130, 36,
+    49, 37, 33, 37, 33, 36, 49, 130, 130, 37, 33, 38, 70, 70, 69, 193, 128, 2, 130, 243,
+    40, 40, 40, 40, 33, 82, 145, 52, 33, 38, 70, 70, 70, 70, 84, 33, 145, 33, 80, 7,
+    56, 34, 67, 18, 82, 18, 82, 18, 67, 24, 40, 34, 82, 18, 100, 100, 100, 92, 24, 241,
+    25, 25, 16, 2, 130, 130, 130, 130, 21, 41, 19, 66, 18, 100, 100, 100, 100, 101, 66, 25,
+    18, 21, 241, 25, 25, 16, 7, 56, 34, 67, 18, 82, 18, 82, 18, 67, 24, 40, 34, 82,
+    18, 100, 100, 100, 92, 24, 248, 100, 96, 2, 130, 130, 130, 130, 21, 41, 19, 66, 18, 100,
+    100, 100, 100, 101, 66, 25, 18, 21, 248, 100, 96, 130, 146, 161, 245, 115, 162, 54, 17, 41,
+    57, 42, 42, 42, 42, 42, 58, 43, 54, 18, 164, 120, 27, 42, 40, 48, 82, 98, 114, 98,
+    241, 82, 129, 52, 70, 39, 39, 39, 55, 52, 17, 131, 86, 39, 39, 37, 64, 66, 162, 255,
+    8, 74, 34, 84, 18, 114, 18, 117, 132, 132, 132, 132, 132, 117, 114, 18, 84, 26, 40, 130,
+    130, 253, 40, 40, 40, 34, 81, 33, 145, 36, 86, 70, 70, 70, 70, 33, 36, 49, 146, 81,
+    32, 8, 74, 34, 84, 18, 114, 18, 117, 132, 132, 132, 132, 132, 117, 114, 18, 84, 26, 40,
+    245, 42, 42, 32, 130, 130, 130, 130, 37, 18, 25, 18, 69, 100, 100, 100, 100, 98, 18, 67,
+    25, 37, 18, 226, 130, 130, 8, 74, 34, 84, 18, 114, 18, 117, 132, 132, 132, 132, 132, 117,
+    114, 18, 84, 26, 40, 255, 6, 102, 130, 130, 130, 130, 37, 18, 25, 18, 69, 100, 100, 100,
+    100, 98, 18, 67, 25, 37, 18, 247, 100, 96, 8, 74, 34, 84, 18, 114, 18, 117, 132, 132,
+    132, 132, 132, 117, 114, 18, 84, 26, 40, 129, 178, 162, 131, 130, 130, 130, 130, 37, 18, 25,
+    18, 69, 100, 100, 100, 100, 98, 18, 67, 25, 37, 18, 65, 146, 130, 99, 8, 74, 34, 84,
+    18, 114, 18, 117, 132, 132, 132, 132, 132, 117, 114, 18, 84, 26, 40, 245, 42, 56, 33, 24,
+    19, 16, 130, 130, 130, 130, 37, 18, 25, 18, 69, 100, 100, 100, 100, 98, 18, 67, 25, 37,
+    18, 226, 116, 97, 33, 82, 34, 49, 130, 130, 230, 54, 31, 87, 39, 39, 39, 245, 114, 114,
+    114, 114, 127, 48, 50, 146, 145, 241, 100, 111, 165, 56, 34, 69, 111, 152, 41, 53, 18, 131,
+    96, 97, 114, 98, 230, 54, 31, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 113, 130,
+    114, 240, 100, 111, 165, 56, 34, 69, 111, 152, 41, 53, 18, 131, 96, 15, 87, 39, 39, 39,
+    245, 114, 114, 114, 114, 127, 52, 38, 54, 17, 36, 19, 16, 53, 56, 34, 69, 111, 152, 41,
+    53, 18, 131, 102, 39, 55, 17, 37, 19, 16, 15, 87, 39, 39, 39, 245, 114, 114, 114, 114,
+    127, 59, 50, 19, 17, 33, 19, 18, 32, 53, 56, 34, 69, 111, 152, 41, 53, 18, 131, 110,
+    49, 21, 17, 17, 21, 17, 48, 33, 49, 69, 191, 87, 39, 39, 39, 245, 114, 114, 114, 114,
+    127, 53, 24, 39, 37, 48, 34, 49, 85, 84, 251, 83, 130, 36, 86, 249, 130, 147, 81, 40,
+    54, 97, 146, 130, 99, 50, 98, 244, 243, 98, 98, 98, 103, 23, 18, 98, 98, 98, 98, 98,
+    98, 66, 82, 243, 66, 82, 37, 35, 226, 37, 37, 37, 37, 37, 37, 37, 37, 32, 70, 118,
+    245, 116, 162, 70, 18, 42, 58, 43, 43, 38, 118, 121, 88, 33, 40, 34, 54, 35, 149, 96,
+    38, 70, 249, 81, 33, 145, 36, 86, 70, 70, 70, 70, 33, 36, 49, 146, 81, 40, 33, 21,
+    34, 131, 80, 82, 146, 251, 39, 71, 71, 71, 71, 71, 251, 116, 116, 116, 116, 116, 116, 114,
+    2, 114, 241, 39, 39, 39, 39, 33, 66, 129, 51, 85, 69, 69, 69, 69, 69, 69, 69, 32,
+    2, 116, 116, 116, 116, 116, 127, 183, 71, 71, 71, 71, 71, 71, 47, 17, 161, 161, 2, 114,
+    114, 114, 114, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82, 194, 114, 114, 50, 34,
+    82, 34, 210, 116, 116, 116, 116, 116, 127, 183, 71, 71, 71, 71, 71, 71, 32, 2, 34, 82,
+    34, 243, 41, 41, 41, 41, 33, 68, 131, 51, 50, 37, 34, 37, 34, 37, 34, 37, 34, 37,
+    34, 37, 34, 37, 34, 37, 32, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 43,
+    43, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 178, 178, 148, 34,
+    146, 146, 146, 146, 20, 72, 51, 51, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82, 34, 82,
+    34, 82, 34, 82, 34, 146, 146, 116, 2, 116, 116, 116, 116, 116, 127, 183, 71, 71, 71, 71,
+    71, 71, 46, 19, 22, 87, 48, 2, 114, 114, 114, 114, 20, 40, 19, 53, 84, 84, 84, 84,
+    84, 84, 84, 82, 162, 49, 69, 83, 34, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 146, 34, 18, 18, 35, 34, 66, 241, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 40, 50, 33, 33, 34, 32, 66, 50, 65, 34, 36, 34, 130, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 50, 65, 34, 36, 34, 226, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 98, 146, 161, 243, 37, 50, 36, 51, 35, 52, 34, 53, 33, 54, 87,
+    72, 72, 87, 33, 54, 34, 53, 35, 52, 36, 51, 37, 50, 38, 48, 34, 114, 129, 243, 40,
+    40, 40, 40, 36, 49, 35, 50, 34, 51, 33, 52, 85, 70, 85, 33, 52, 34, 51, 35, 50,
+    36, 48, 2, 83, 34, 67, 50, 51, 66, 35, 82, 19, 101, 116, 132, 133, 114, 19, 98, 35,
+    82, 51, 66, 67, 50, 83, 34, 99, 242, 42, 42, 32, 2, 130, 130, 130, 130, 67, 18, 51,
+    34, 35, 50, 19, 69, 84, 101, 82, 19, 66, 35, 50, 51, 34, 67, 226, 130, 130, 2, 83,
+    34, 67, 50, 51, 66, 35, 82, 19, 101, 116, 132, 133, 114, 19, 98, 35, 82, 51, 66, 67,
+    50, 83, 34, 99, 253, 102, 96, 2, 130, 130, 130, 130, 67, 18, 51, 34, 35, 50, 19, 69,
+    84, 101, 82, 19, 66, 35, 50, 51, 34, 67, 247, 100, 96, 2, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 127, 61, 24, 24, 16, 15, 240, 38, 6, 86, 254, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 146, 159, 33, 161, 161, 12, 130, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 162, 66, 66, 2, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 127, 63, 70, 54, 34, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 236, 2, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    127, 60, 39, 17, 21, 33, 36, 19, 16, 34, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 162, 51, 49, 18, 17, 49, 114, 177, 177, 244, 69, 133, 133, 97, 35, 33,
+    65, 35, 33, 65, 35, 33, 66, 33, 34, 66, 33, 34, 66, 33, 34, 67, 51, 67, 51, 67,
+    51, 73, 73, 73, 32, 130, 210, 210, 210, 250, 33, 67, 66, 129, 97, 51, 67, 85, 37, 69,
+    37, 69, 37, 69, 37, 69, 37, 69, 37, 69, 37, 69, 37, 32, 98, 178, 255, 20, 88, 88,
+    86, 18, 50, 20, 18, 50, 20, 18, 50, 20, 34, 18, 36, 34, 18, 36, 34, 18, 36, 51,
+    52, 51, 52, 51, 52, 148, 148, 146, 114, 226, 255, 146, 20, 52, 40, 22, 19, 52, 53, 82,
+    84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 82, 4, 88, 88, 86, 18,
+    50, 20, 18, 50, 20, 18, 50, 20, 34, 18, 36, 34, 18, 36, 34, 18, 36, 51, 52, 51,
+    52, 51, 52, 148, 148, 146, 244, 43, 43, 32, 2, 20, 52, 40, 22, 19, 52, 53, 82, 84,
+    82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 84, 82, 82, 248, 46, 46, 32, 66, 146,
+    252, 54, 101, 101, 116, 65, 36, 65, 51, 66, 35, 66, 50, 67, 34, 67, 49, 68, 33, 68,
+    117, 102, 86, 48, 50, 114, 247, 33, 66, 129, 51, 85, 69, 69, 69, 69, 69, 69, 69, 32,
+    3, 102, 86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36, 51, 20, 66, 20, 71,
+    86, 101, 99, 241, 26, 26, 16, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82,
+    194, 114, 114, 3, 102, 86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36, 51, 20,
+    66, 20, 71, 86, 101, 99, 249, 101, 96, 2, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84,
+    84, 82, 244, 99, 96, 3, 102, 86, 87, 68, 18, 68, 19, 52, 34, 52, 35, 36, 50, 36,
+    51, 20, 66, 20, 71, 86, 101, 99, 240, 41, 17, 23, 33, 38, 19, 16, 2, 20, 40, 19,
+    53, 84, 84, 84, 84, 84, 84, 84, 82, 194, 113, 17, 82, 18, 65, 49, 145, 194, 178, 248,
+    50, 24, 18, 41, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35,
+    52, 52, 166, 96, 114, 114, 129, 241, 34, 20, 18, 63, 4, 72, 34, 66, 18, 100, 100, 100,
+    100, 98, 18, 66, 40, 68, 66, 34, 130, 34, 255, 99, 33, 129, 34, 150, 106, 67, 67, 50,
+    130, 19, 133, 164, 164, 164, 164, 165, 131, 18, 130, 51, 67, 74, 102, 34, 34, 66, 34, 240,
+    34, 20, 18, 63, 4, 72, 34, 66, 18, 100, 100, 100, 100, 98, 18, 66, 40, 68, 82, 209,
+    210, 249, 104, 104, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35,
+    52, 52, 166, 96, 50, 145, 161, 241, 100, 111, 164, 72, 34, 66, 18, 100, 100, 100, 100, 98,
+    18, 66, 40, 68, 130, 178, 193, 249, 104, 104, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74,
+    74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 98, 129, 130, 240, 100, 111, 164, 72, 34, 66,
+    18, 100, 100, 100, 100, 98, 18, 66, 40, 68, 82, 98, 113, 215, 40, 18, 69, 84, 84, 84,
+    75, 23, 34, 114, 114, 114, 114, 114, 66, 114, 129, 130, 241, 33, 82, 145, 52, 33, 38, 70,
+    70, 70, 70, 84, 33, 145, 33, 82, 40, 40, 40, 32, 50, 114, 247, 114, 129, 36, 85, 69,
+    69, 68, 177, 114, 39, 39, 39, 39, 39, 32, 66, 130, 249, 33, 82, 145, 52, 33, 38, 70,
+    70, 70, 70, 84, 33, 145, 33, 82, 40, 40, 40, 32, 50, 146, 253, 116, 131, 36, 50, 37,
+    34, 37, 34, 36, 50, 131, 116, 35, 51, 36, 50, 37, 34, 37, 34, 38, 33, 38, 33, 39,
+    32, 34, 66, 226, 28, 50, 66, 66, 66, 66, 66, 66, 66, 7, 72, 50, 67, 34, 82, 34,
+    82, 34, 67, 40, 55, 66, 51, 50, 67, 34, 82, 34, 82, 34, 98, 18, 98, 18, 114, 226,
+    146, 146, 2, 28, 50, 66, 66, 66, 66, 66, 66, 66, 162, 66, 66, 22, 86, 240, 116, 131,
+    36, 50, 37, 34, 37, 34, 36, 50, 131, 116, 35, 51, 36, 50, 37, 34, 37, 34, 38, 33,
+    38, 33, 39, 46, 41, 41, 32, 12, 194, 28, 50, 66, 66, 66, 66, 66, 66, 66, 162, 66,
+    66, 7, 72, 50, 67, 34, 82, 34, 82, 34, 67, 40, 55, 66, 51, 50, 67, 34, 82, 34,
+    82, 34, 98, 18, 98, 18, 114, 249, 101, 96, 18, 19, 22, 19, 66, 82, 82, 82, 82, 82,
+    82, 82, 243, 97, 96, 82, 130, 250, 99, 129, 53, 17, 40, 40, 56, 86, 104, 57, 40, 40,
+    54, 194, 112, 50, 98, 246, 81, 165, 54, 100, 86, 54, 53, 161, 80, 38, 56, 19, 81, 18,
+    130, 131, 133, 102, 131, 146, 130, 131, 108, 39, 241, 40, 40, 32, 37, 26, 83, 102, 69, 99,
+    99, 90, 21, 210, 98, 98, 34, 50, 50, 34, 129, 240, 99, 129, 53, 17, 40, 40, 56, 86,
+    104, 57, 40, 40, 54, 194, 112, 34, 34, 34, 18, 97, 97, 213, 26, 83, 102, 69, 99, 99,
+    90, 21, 82, 130, 97, 49, 97, 18, 99, 240, 99, 129, 53, 17, 40, 40, 56, 86, 104, 57,
+    40, 40, 54, 194, 112, 50, 98, 194, 34, 49, 33, 68, 82, 213, 26, 83, 102, 69, 99, 99,
+    90, 21, 82, 130, 250, 99, 129, 53, 17, 40, 40, 56, 86, 104, 57, 40, 40, 54, 194, 127,
+    18, 130, 130, 50, 98, 213, 26, 83, 102, 69, 99, 99, 90, 21, 210, 98, 98, 82, 162, 254,
+    249, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 18, 82, 251, 37, 37, 36,
+    225, 37, 37, 37, 37, 37, 37, 37, 98, 80, 15, 149, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 47, 114, 162, 162, 18, 82, 82, 78, 18, 82, 82, 82, 82, 82, 82, 86,
+    37, 162, 82, 82, 15, 149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 47, 242,
+    102, 96, 18, 82, 82, 78, 18, 82, 82, 82, 82, 82, 82, 86, 37, 240, 97, 96, 15, 149,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 47, 114, 163, 129, 33, 114, 34, 18,
+    82, 82, 78, 18, 82, 82, 82, 82, 82, 82, 86, 37, 162, 67, 65, 18, 33, 49, 2, 116,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 252, 34, 37, 34, 32,
+    2, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 244, 34, 35, 34, 32, 2, 116,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69, 242, 34, 22, 17, 17,
+    21, 18, 48, 2, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 178, 33, 65, 17,
+    17, 49, 35, 2, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83, 18, 82, 41, 69,
+    114, 147, 113, 33, 98, 49, 2, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36, 18, 50,
+    115, 81, 33, 66, 34, 114, 145, 145, 243, 34, 21, 18, 51, 39, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 82, 98, 113, 113, 115, 33, 33, 33, 33, 33,
+    35, 245, 37, 69, 69, 69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 34, 34, 82, 34, 252,
+    101, 99, 39, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 85, 49, 37, 34, 148, 80, 18,
+    34, 50, 34, 246, 99, 107, 37, 69, 69, 69, 69, 69, 69, 69, 83, 49, 130, 65, 32, 82,
+    33, 113, 18, 17, 113, 35, 241, 41, 33, 39, 34, 39, 34, 39, 35, 37, 36, 37, 36, 37,
+    37, 35, 38, 35, 38, 49, 55, 33, 40, 33, 41, 58, 58, 48, 66, 33, 81, 18, 17, 81,
+    34, 250, 39, 33, 37, 34, 37, 34, 37, 35, 35, 36, 35, 37, 33, 38, 33, 38, 33, 39,
+    56, 48, 2, 146, 18, 114, 34, 114, 34, 114, 50, 82, 66, 82, 66, 82, 82, 50, 98, 50,
+    99, 19, 114, 18, 130, 18, 147, 163, 163, 249, 43, 43, 32, 2, 114, 18, 82, 34, 82, 34,
+    82, 50, 50, 66, 50, 82, 18, 98, 18, 98, 18, 115, 131, 245, 41, 41, 32, 114, 242, 47,
+    33, 251, 37, 69, 69, 69, 33, 36, 68, 34, 36, 68, 34, 35, 34, 35, 34, 35, 34, 35,
+    35, 34, 34, 34, 36, 34, 34, 34, 36, 33, 36, 33, 36, 33, 36, 33, 36, 84, 70, 68,
+    70, 68, 70, 54, 54, 54, 48, 50, 226, 225, 240, 31, 130, 67, 68, 67, 66, 18, 49, 17,
+    50, 34, 34, 18, 34, 34, 34, 18, 34, 34, 34, 18, 34, 50, 17, 49, 18, 68, 52, 68,
+    52, 82, 82, 98, 82, 146, 241, 47, 2, 251, 37, 69, 69, 69, 33, 36, 68, 34, 36, 68,
+    34, 35, 34, 35, 34, 35, 34, 35, 35, 34, 34, 34, 36, 34, 34, 34, 36, 33, 36, 33,
+    36, 33, 36, 33, 36, 84, 70, 68, 70, 68, 70, 54, 54, 54, 48, 130, 210, 194, 194, 247,
+    36, 52, 68, 52, 33, 35, 17, 19, 34, 34, 33, 34, 34, 34, 33, 34, 34, 34, 33, 34,
+    35, 33, 19, 17, 36, 67, 68, 67, 69, 37, 38, 37, 32, 98, 34, 194, 34, 249, 37, 69,
+    69, 69, 33, 36, 68, 34, 36, 68, 34, 35, 34, 35, 34, 35, 34, 35, 35, 34, 34, 34,
+    36, 34, 34, 34, 36, 33, 36, 33, 36, 33, 36, 33, 36, 84, 70, 68, 70, 68, 70, 54,
+    54, 54, 48, 66, 34, 146, 34, 255, 82, 67, 68, 67, 66, 18, 49, 17, 50, 34, 34, 18,
+    34, 34, 34, 18, 34, 34, 34, 18, 34, 50, 17, 49, 18, 68, 52, 68, 52, 82, 82, 98,
+    82, 130, 241, 47, 254, 37, 69, 69, 69, 33, 36, 68, 34, 36, 68, 34, 35, 34, 35, 34,
+    35, 34, 35, 35, 34, 34, 34, 36, 34, 34, 34, 36, 33, 36, 33, 36, 33, 36, 33, 36,
+    84, 70, 68, 70, 68, 70, 54, 54, 54, 48, 98, 210, 255, 114, 67, 68, 67, 66, 18, 49,
+    17, 50, 34, 34, 18, 34, 34, 34, 18, 34, 34, 34, 18, 34, 50, 17, 49, 18, 68, 52,
+    68, 52, 82, 82, 98, 82, 2, 84, 84, 84, 82, 18, 68, 66, 34, 68, 66, 34, 50, 34,
+    50, 34, 50, 34, 50, 50, 34, 34, 34, 66, 34, 34, 34, 66, 18, 66, 18, 66, 18, 66,
+    18, 69, 68, 100, 68, 100, 68, 99, 99, 99, 99, 254, 47, 18, 241, 32, 2, 67, 68, 67,
+    66, 18, 49, 17, 50, 34, 34, 18, 34, 34, 34, 18, 34, 34, 34, 18, 34, 50, 17, 49,
+    18, 68, 52, 68, 52, 82, 82, 98, 82, 249, 45, 45, 32, 82, 162, 255, 3, 83, 34, 82,
+    51, 50, 82, 35, 98, 18, 116, 147, 147, 132, 133, 98, 34, 83, 50, 66, 67, 34, 98, 19,
+    99, 82, 146, 251, 53, 49, 51, 51, 49, 53, 33, 39, 56, 55, 86, 33, 37, 35, 35, 51,
+    49, 53, 48, 50, 34, 98, 34, 241, 53, 50, 37, 35, 51, 37, 34, 54, 33, 39, 73, 57,
+    56, 72, 86, 34, 37, 51, 36, 36, 50, 38, 33, 54, 48, 50, 34, 82, 34, 249, 53, 49,
+    51, 51, 49, 53, 33, 39, 56, 55, 86, 33, 37, 35, 35, 51, 49, 53, 48, 82, 162, 254,
+    54, 49, 38, 35, 36, 36, 50, 53, 34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32,
+    82, 146, 251, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39, 56,
+    56, 41, 40, 54, 71, 48, 82, 145, 18, 114, 34, 240, 249, 146, 146, 147, 131, 131, 146, 146,
+    147, 131, 146, 146, 159, 144, 50, 115, 82, 17, 81, 49, 191, 54, 38, 38, 53, 53, 54, 38,
+    53, 243, 15, 153, 41, 41, 56, 56, 57, 41, 41, 56, 57, 41, 41, 249, 242, 42, 42, 32,
+    15, 54, 38, 38, 53, 53, 54, 38, 53, 243, 209, 129, 129, 15, 153, 41, 41, 56, 56, 57,
+    41, 41, 56, 57, 41, 41, 249, 252, 102, 96, 15, 54, 38, 38, 53, 53, 54, 38, 53, 243,
+    244, 99, 96, 2, 114, 114, 114, 114, 20, 40, 19, 53, 84, 84, 84, 84, 84, 84, 84, 82,
+    244, 99, 96, 2, 34, 34, 34, 245, 38, 38, 37, 113, 114, 38, 38, 38, 38, 38, 38, 38,
+    99, 80, 83, 178, 33, 161, 49, 162, 33, 179, 247, 36, 52, 68, 52, 33, 35, 17, 19, 34,
+    34, 33, 34, 34, 34, 33, 34, 34, 34, 33, 34, 35, 33, 19, 17, 36, 67, 68, 67, 69,
+    37, 38, 37, 32, 67, 114, 33, 97, 49, 98, 33, 115, 240, 39, 33, 37, 34, 37, 34, 51,
+    36, 35, 36, 49, 53, 33, 38, 33, 39, 56, 56, 41, 40, 54, 71, 48, 161, 209, 209, 177,
+    53, 49, 55, 97, 67, 178, 103, 88, 66, 82, 66, 82, 66, 67, 73, 85, 18, 66, 82, 243,
+    66, 82, 37, 35, 67, 69, 37, 37, 37, 37, 37, 37, 37, 37, 32, 52, 35, 66, 82, 52,
+    82, 82, 18, 35, 66, 52, 82, 82, 82, 82, 82, 52, 35, 66, 54, 50, 52, 52, 82, 82,
+    82, 82, 82, 82, 82, 82, 53, 88, 66, 82, 34, 69, 18, 51, 66, 34, 98, 34, 98, 51,
+    66, 68, 34, 102, 132, 132, 132, 34, 53, 39, 53, 56, 34, 81, 34, 133, 117, 50, 51, 33,
+    85, 100, 100, 100, 98, 18, 66, 40, 68, 83, 163, 163, 146, 18, 130, 18, 115, 19, 98, 50,
+    98, 50, 82, 82, 66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 244, 43, 43, 32, 37, 55,
+    33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 194, 114, 114, 99, 209, 177, 177, 248, 58, 58,
+    57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39,
+    33, 41, 32, 67, 145, 113, 113, 229, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 178,
+    162, 114, 33, 113, 18, 130, 33, 247, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35,
+    37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 146, 130, 82, 33, 81, 18, 98,
+    33, 242, 85, 116, 20, 57, 36, 115, 130, 37, 34, 37, 34, 36, 50, 147, 81, 32, 130, 193,
+    146, 33, 113, 18, 130, 33, 247, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37,
+    37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 98, 129, 82, 33, 49, 18, 66, 33,
+    213, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 148, 193, 98, 50, 81, 18, 17, 98,
+    33, 247, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147,
+    178, 39, 34, 39, 33, 41, 32, 116, 161, 66, 50, 49, 18, 17, 66, 33, 242, 85, 116, 20,
+    57, 36, 115, 130, 37, 34, 37, 34, 36, 50, 147, 81, 32, 67, 33, 113, 19, 145, 18, 130,
+    33, 247, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147,
+    178, 39, 34, 39, 33, 41, 32, 35, 33, 49, 19, 81, 18, 66, 33, 213, 55, 33, 67, 114,
+    39, 26, 84, 84, 76, 21, 18, 83, 161, 17, 145, 49, 247, 58, 58, 57, 33, 40, 33, 39,
+    49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 47, 66, 178,
+    178, 65, 113, 17, 97, 17, 81, 49, 213, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18,
+    194, 114, 114, 130, 162, 177, 247, 20, 24, 73, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35,
+    38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 32, 98, 98, 113, 225, 50,
+    68, 213, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 82, 178, 194, 247, 20, 24, 73,
+    58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39,
+    34, 39, 33, 41, 32, 49, 130, 130, 225, 50, 68, 213, 55, 33, 67, 114, 39, 26, 84, 84,
+    76, 21, 18, 99, 209, 177, 177, 145, 65, 132, 147, 163, 163, 146, 18, 130, 18, 115, 19, 98,
+    50, 98, 50, 82, 82, 66, 82, 73, 59, 34, 114, 34, 114, 18, 146, 67, 145, 113, 113, 81,
+    50, 68, 213, 55, 33, 67, 114, 39, 26, 84, 84, 76, 21, 18, 67, 33, 113, 34, 246, 20,
+    24, 73, 58, 58, 57, 33, 40, 33, 39, 49, 54, 35, 38, 35, 37, 37, 36, 37, 36, 147,
+    178, 39, 34, 39, 33, 41, 32, 35, 33, 49, 34, 209, 50, 68, 213, 55, 33, 67, 114, 39,
+    26, 84, 84, 76, 21, 18, 65, 49, 133, 147, 248, 58, 58, 57, 33, 40, 33, 39, 49, 54,
+    35, 38, 35, 37, 37, 36, 37, 36, 147, 178, 39, 34, 39, 33, 41, 47, 66, 178, 178, 33,
+    49, 69, 83, 248, 83, 114, 20, 55, 34, 113, 165, 69, 68, 193, 81, 45, 24, 24, 16, 15,
+    87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 61, 24, 24, 16, 53, 56, 34, 69, 111, 152,
+    41, 53, 18, 131, 111, 2, 130, 130, 67, 145, 113, 113, 207, 87, 39, 39, 39, 245, 114, 114,
+    114, 114, 127, 48, 83, 145, 130, 113, 242, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 35,
+    17, 65, 19, 191, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48, 51, 17, 81, 17, 17,
+    65, 35, 250, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 146, 130, 82, 33, 81, 18, 98,
+    33, 240, 146, 146, 41, 41, 41, 41, 146, 146, 41, 41, 41, 41, 41, 146, 144, 161, 162, 83,
+    18, 82, 17, 129, 49, 244, 85, 132, 36, 50, 38, 34, 162, 162, 42, 43, 53, 20, 133, 96,
+    98, 129, 67, 18, 49, 18, 65, 49, 191, 87, 39, 39, 39, 245, 114, 114, 114, 114, 127, 48,
+    113, 146, 83, 18, 50, 17, 97, 49, 240, 83, 130, 36, 86, 249, 130, 147, 81, 40, 54, 116,
+    161, 51, 49, 65, 18, 17, 65, 49, 240, 146, 146, 41, 41, 41, 41, 146, 146, 41, 41, 41,
+    41, 41, 146, 144, 131, 193, 67, 49, 66, 17, 33, 81, 49, 244, 85, 132, 36, 50, 38, 34,
+    162, 162, 42, 43, 53, 20, 133, 96, 35, 33, 53, 81, 18, 65, 49, 191, 87, 39, 39, 39,
+    245, 114, 114, 114, 114, 127, 48, 51, 17, 65, 20, 82, 17, 97, 49, 240, 83, 130, 36, 86,
+    249, 130, 147, 81, 40, 54, 51, 97, 18, 65, 49, 191, 87, 39, 39, 39, 245, 114, 114, 114,
+    114, 127, 61, 24, 24, 16, 66, 131, 98, 17, 97, 49, 240, 83, 130, 36, 86, 249, 130, 147,
+    81, 40, 54, 240, 40, 40, 32, 3, 65, 33, 33, 98, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 3, 65, 33, 33, 98, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 15, 240, 38, 4, 79, 114, 96, 70, 106, 67, 67, 50, 130, 19, 133, 164, 164, 164, 164,
+    165, 131, 18, 130, 51, 67, 74, 102, 249, 44, 44, 32, 52, 72, 34, 66, 18, 100, 100, 100,
+    100, 98, 18, 66, 40, 68, 242, 40, 40, 32, 99, 225, 193, 193, 249, 102, 164, 52, 51, 40,
+    33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 68, 145, 130, 113, 242,
+    68, 130, 36, 33, 38, 70, 70, 70, 70, 33, 36, 34, 132, 64, 178, 178, 130, 33, 132, 146,
+    34, 247, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52,
+    166, 96, 146, 145, 82, 34, 66, 17, 98, 34, 242, 69, 131, 36, 34, 38, 33, 38, 33, 38,
+    33, 38, 33, 38, 34, 36, 35, 133, 64, 130, 210, 146, 33, 129, 18, 146, 34, 247, 102, 164,
+    52, 51, 40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 98, 146,
+    82, 33, 66, 17, 82, 34, 240, 68, 130, 36, 33, 38, 70, 70, 70, 70, 33, 36, 34, 132,
+    64, 148, 209, 114, 50, 97, 18, 17, 114, 34, 247, 102, 164, 52, 51, 40, 33, 56, 90, 74,
+    74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 96, 131, 161, 66, 65, 50, 17, 18, 50, 34,
+    242, 69, 131, 36, 34, 38, 33, 38, 33, 38, 33, 38, 33, 38, 34, 36, 35, 133, 64, 67,
+    33, 129, 19, 161, 18, 146, 33, 248, 102, 164, 52, 51, 40, 33, 56, 90, 74, 74, 74, 74,
+    88, 49, 40, 35, 52, 52, 166, 96, 50, 33, 65, 20, 82, 17, 82, 34, 240, 68, 130, 36,
+    33, 38, 70, 70, 70, 70, 33, 36, 34, 132, 64, 98, 180, 146, 34, 247, 102, 164, 52, 51,
+    40, 33, 56, 90, 74, 74, 74, 74, 88, 49, 40, 35, 52, 52, 166, 111, 146, 194, 194, 66,
+    131, 97, 33, 82, 34, 240, 68, 130, 36, 33, 38, 70, 70, 70, 70, 33, 36, 34, 132, 79,
+    34, 130, 130, 114, 193, 194, 249, 99, 18, 146, 17, 68, 81, 40, 33, 56, 33, 42, 74, 74,
+    74, 74, 88, 34, 40, 34, 68, 52, 151, 96, 98, 130, 130, 130, 241, 19, 67, 17, 146, 36,
+    34, 38, 33, 38, 33, 38, 33, 38, 33, 38, 34, 36, 35, 133, 64, 82, 210, 209, 249, 99,
+    18, 146, 17, 68, 81, 40, 33, 56, 33, 42, 74, 74, 74, 74, 88, 34, 40, 34, 68, 52,
+    151, 96, 34, 146, 162, 162, 240, 19, 67, 17, 146, 36, 34, 38, 33, 38, 33, 38, 33, 38,
+    33, 38, 34, 36, 35, 133, 64, 99, 225, 193, 193, 249, 99, 18, 146, 17, 68, 81, 40, 33,
+    56, 33, 42, 74, 74, 74, 74, 88, 34, 40, 34, 68, 52, 151, 96, 68, 161, 146, 129, 240,
+    19, 67, 17, 146, 36, 34, 38, 33, 38, 33, 38, 33, 38, 33, 38, 34, 36, 35, 133, 64,
+    67, 33, 129, 34, 248, 99, 18, 146, 17, 68, 81, 40, 33, 56, 33, 42, 74, 74, 74, 74,
+    88, 34, 40, 34, 68, 52, 151, 96, 50, 33, 81, 18, 17, 81, 34, 250, 19, 67, 17, 146,
+    36, 34, 38, 33, 38, 33, 38, 33, 38, 33, 38, 34, 36, 35, 133, 64, 70, 49, 41, 33,
+    20, 69, 18, 130, 19, 130, 18, 164, 164, 164, 164, 165, 130, 34, 130, 36, 67, 73, 118, 249,
+    44, 44, 32, 161, 52, 49, 25, 34, 66, 34, 98, 18, 98, 18, 98, 18, 98, 18, 98, 34,
+    66, 56, 84, 244, 41, 41, 32, 2, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 83,
+    18, 82, 41, 69, 243, 41, 41, 32, 2, 84, 84, 84, 84, 84, 84, 84, 85, 51, 24, 36,
+    18, 194, 114, 114, 68, 161, 146, 129, 241, 39, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    85, 49, 37, 34, 148, 80, 52, 129, 114, 97, 210, 84, 84, 84, 84, 84, 84, 84, 85, 51,
+    24, 36, 18, 98, 178, 193, 247, 39, 34, 55, 34, 55, 65, 39, 35, 39, 35, 39, 35, 39,
+    35, 39, 35, 39, 35, 39, 35, 39, 35, 38, 52, 37, 37, 151, 80, 82, 130, 130, 145, 242,
+    53, 33, 53, 101, 34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 51, 51, 132, 65, 32,
+    65, 210, 210, 246, 39, 34, 55, 34, 55, 65, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35,
+    39, 35, 39, 35, 39, 35, 38, 52, 37, 37, 151, 80, 18, 146, 162, 162, 241, 53, 33, 53,
+    101, 34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 51, 51, 132, 65, 32, 68, 209, 194,
+    177, 247, 39, 34, 55, 34, 55, 65, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35,
+    39, 35, 39, 35, 38, 52, 37, 37, 151, 80, 52, 161, 146, 129, 241, 53, 33, 53, 101, 34,
+    37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 51, 51, 132, 65, 32, 50, 33, 129, 35, 245,
+    39, 34, 55, 34, 55, 65, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35, 39, 35,
+    39, 35, 38, 52, 37, 37, 151, 80, 34, 33, 81, 18, 17, 81, 35, 250, 53, 33, 53, 101,
+    34, 37, 34, 37, 34, 37, 34, 37, 34, 37, 34, 51, 51, 132, 65, 32, 2, 114, 35, 114,
+    35, 116, 18, 114, 50, 114, 50, 114, 50, 114, 50, 114, 50, 114, 50, 114, 50, 114, 50, 99,
+    66, 82, 89, 117, 249, 44, 44, 32, 163, 82, 19, 86, 82, 34, 82, 34, 82, 34, 82, 34,
+    82, 34, 82, 35, 51, 56, 68, 18, 241, 41, 41, 32, 66, 178, 178, 241, 54, 49, 38, 35,
+    36, 36, 50, 53, 34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 34, 161, 162, 162,
+    241, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39, 56, 56, 41,
+    40, 54, 71, 48, 3, 99, 18, 98, 50, 66, 67, 35, 82, 34, 102, 116, 146, 162, 162, 162,
+    162, 162, 162, 162, 247, 42, 42, 32, 2, 114, 18, 82, 34, 82, 35, 50, 66, 50, 67, 19,
+    82, 18, 98, 18, 115, 131, 130, 146, 131, 34, 36, 50, 35, 66, 84, 177, 162, 145, 242, 54,
+    49, 38, 35, 36, 36, 50, 53, 34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 83,
+    177, 145, 145, 240, 39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39,
+    56, 56, 41, 40, 54, 71, 48, 66, 33, 97, 35, 240, 54, 49, 38, 35, 36, 36, 50, 53,
+    34, 38, 103, 73, 42, 42, 42, 42, 42, 42, 42, 32, 66, 33, 81, 18, 17, 81, 34, 250,
+    39, 33, 37, 34, 37, 34, 51, 36, 35, 36, 49, 53, 33, 38, 33, 39, 56, 56, 41, 40,
+    54, 71, 48, 2, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114, 34, 114,
+    34, 114, 34, 114, 34, 114, 34, 114, 34, 127, 176, 34, 34, 25, 34, 34, 50, 34, 50, 34,
+    50, 34, 50, 34, 50, 34, 50, 34, 50, 34, 50, 34, 50, 34, 50, 34, 50, 34, 50, 34,
+    10, 10, 15, 112, 15, 16, 15, 246, 15, 250, 2, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 18, 15, 90, 245, 33, 20, 18, 18, 18, 18,
+    17, 18, 17, 18, 18, 20, 17, 2, 18, 18, 33, 33, 33, 49, 18, 36, 34, 18, 34, 18,
+    34, 18, 34, 18, 34, 18, 36, 34, 17, 49, 18, 34, 18, 34, 18, 36, 34, 17, 49, 2,
+    34, 18, 34, 18, 34, 18, 34, 33, 49, 66, 130, 130, 130, 79, 84, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 32, 66, 130, 130, 130, 79, 84, 40, 40, 40, 40, 36, 245, 66, 130,
+    130, 130, 20, 31, 145, 64, 1, 99, 69, 38, 21, 35, 65, 4, 2, 84, 82, 2, 82, 84,
+    82, 82, 6, 35, 113, 210, 18, 97, 194, 50, 65, 210, 50, 50, 210, 50, 49, 226, 50, 33,
+    241, 33, 35, 31, 35, 49, 51, 83, 145, 50, 18, 50, 18, 129, 34, 50, 18, 50, 97, 50,
+    50, 18, 50, 82, 50, 50, 18, 50, 81, 66, 50, 18, 50, 65, 98, 18, 50, 18, 81, 115,
+    83, 35, 114, 245, 33, 37, 47, 82, 50, 65, 246, 35, 35, 47, 98, 50, 49, 247, 35, 34,
+    47, 129, 34, 34, 250, 51, 19, 53, 38, 42, 34, 83, 83, 88, 18, 35, 33, 35, 18, 35,
+    23, 34, 35, 33, 35, 33, 20, 37, 35, 35, 33, 35, 33, 20, 37, 20, 35, 33, 35, 33,
+    35, 21, 37, 19, 18, 35, 18, 34, 37, 22, 83, 83, 64, 34, 33, 33, 49, 34, 18, 33,
+    33, 33, 33, 49, 33, 34, 18, 18, 33, 33, 18, 33, 33, 33, 49, 33, 33, 2, 50, 49,
+    65, 2, 18, 50, 18, 49, 33, 65, 33, 2, 18, 18, 50, 18, 18, 49, 33, 33, 65, 33,
+    33, 49, 81, 17, 49, 34, 18, 49, 65, 50, 34, 33, 49, 81, 82, 66, 65, 1, 66, 66,
+    81, 81, 49, 34, 34, 49, 82, 129, 34, 49, 51, 83, 51, 51, 83, 19, 117, 66, 51, 52,
+    37, 34, 51, 19, 83, 51, 51, 83, 49, 113, 114, 178, 2, 52, 52, 52, 52, 52, 52, 52,
+    52, 50, 17, 50, 17, 50, 226, 52, 50, 36, 41, 34, 18, 50, 18, 50, 18, 53, 52, 67,
+    82, 98, 98, 247, 38, 32, 15, 80, 3, 195, 31, 22, 128, 88, 111, 17, 60, 48, 97, 81,
+    81, 97, 81, 97, 81, 17, 49, 33, 49, 49, 17, 81, 145, 243, 30, 19, 19, 27, 33, 17,
+    46, 63, 19, 226, 17, 18, 162, 49, 50, 129, 65, 65, 65, 49, 51, 49, 49, 18, 17, 18,
+    50, 17, 18, 67, 115, 99, 115, 66, 17, 18, 50, 17, 18, 17, 49, 49, 17, 49, 49, 65,
+    145, 129, 145, 12, 146, 145, 145, 161, 145, 145, 161, 145, 145, 161, 145, 145, 161, 145, 146, 6,
+    34, 34, 34, 34, 34, 34, 38, 34, 34, 34, 34, 34, 34, 40, 4, 34, 34, 34, 34, 34,
+    34, 38, 34, 34, 34, 34, 34, 34, 42, 21, 85, 40, 24, 17, 82, 18, 66, 114, 114, 114,
+    114, 99, 114, 83, 99, 83, 99, 98, 114, 98, 130, 98, 115, 98, 115, 249, 39, 54, 39, 48,
+    21, 73, 51, 67, 34, 98, 34, 98, 34, 83, 34, 67, 50, 51, 66, 35, 82, 34, 98, 34,
+    98, 34, 247, 38, 34, 38, 32, 2, 53, 34, 39, 18, 33, 69, 132, 132, 117, 99, 18, 83,
+    34, 67, 65, 66, 81, 66, 162, 241, 36, 36, 36, 32, 15, 22, 37, 38, 38, 38, 37, 38,
+    38, 38, 37, 38, 32, 6, 56, 18, 39, 39, 39, 39, 39, 36, 18, 34, 50, 33, 66, 33,
+    66, 33, 66, 33, 66, 33, 66, 33, 66, 33, 66, 33, 18, 21, 21, 21, 18, 18, 18, 33,
+    18, 2, 18, 18, 21, 21, 21, 18, 18, 17, 65, 129, 65, 49, 49, 18, 17, 18, 67, 99,
+    66, 17, 18, 17, 49, 49, 65, 129, 2, 18, 244, 33, 33, 34, 16, 88, 111, 17, 60, 63,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 147, 195, 31, 22, 128, 65, 129, 65, 49, 49,
+    18, 17, 18, 67, 99, 66, 17, 18, 17, 49, 49, 65, 129, 129, 129, 65, 49, 49, 18, 17,
+    18, 67, 99, 66, 17, 18, 17, 49, 49, 65, 129, 82, 82, 18, 34, 18, 18, 82, 82, 66,
+    82, 82, 67, 66, 82, 67, 66, 34, 18, 34, 18, 53, 157, 38, 119, 88, 111, 17, 60, 48,
+    81, 161, 33, 50, 33, 19, 50, 20, 85, 63, 114, 100, 49, 17, 36, 18, 18, 23, 16, 82,
+    82, 226, 82, 242, 37, 32, 34, 18, 18, 18, 33, 33, 18, 18, 33, 33, 33, 33, 49, 33,
+    33, 17, 66, 130, 249, 38, 70, 47, 146, 130, 2, 100, 98, 249, 40, 47, 2, 130, 82, 130,
+    6, 245, 64, 98, 194, 255, 255, 255, 2, 164, 164, 162, 255, 255, 255, 2, 194, 194, 113, 225,
+    225, 146, 49, 34, 82, 49, 34, 161, 225, 127, 240, 113, 162, 33, 162, 33, 34, 161, 34, 161,
+    225, 4, 100, 100, 6, 36, 68, 38, 66, 199, 130, 81, 114, 226, 120, 129, 97, 129, 98, 113,
+    98, 113, 113, 103, 51, 20, 148, 33, 240, 31, 1, 240, 112, 98, 18, 70, 72, 34, 18, 19,
+    18, 34, 17, 50, 33, 33, 34, 49, 18, 34, 34, 18, 34, 33, 33, 50, 33, 18, 50, 18,
+    18, 50, 18, 17, 83, 33, 83, 18, 49, 37, 19, 40, 49, 33, 69, 73, 19, 82, 18, 130,
+    146, 50, 21, 52, 19, 50, 66, 50, 66, 50, 66, 50, 82, 34, 82, 34, 49, 37, 19, 55,
+    56, 56, 50, 146, 146, 146, 151, 71, 66, 146, 146, 103, 114, 146, 146, 84, 71, 50, 130, 130,
+    130, 103, 82, 130, 103, 82, 130, 130, 95, 80, 146, 225, 98, 20, 22, 36, 37, 34, 18, 82,
+    84, 82, 84, 82, 84, 67, 84, 67, 84, 67, 84, 52, 84, 49, 18, 84, 34, 18, 82, 66,
+    210, 35, 66, 51, 66, 51, 66, 52, 50, 52, 50, 53, 34, 28, 34, 18, 34, 31, 146, 34,
+    33, 35, 35, 67, 35, 67, 36, 51, 36, 48, 5, 243, 130, 28, 36, 34, 28, 37, 33, 28,
+    37, 129, 97, 37, 33, 20, 36, 17, 36, 49, 20, 23, 34, 66, 20, 23, 115, 20, 53, 40,
+    21, 82, 40, 24, 49, 40, 26, 17, 40, 26, 17, 40, 100, 33, 42, 144, 6, 216, 178, 67,
+    162, 82, 162, 82, 54, 18, 82, 34, 50, 18, 82, 18, 120, 34, 120, 51, 82, 66, 69, 34,
+    82, 99, 18, 83, 113, 18, 98, 113, 18, 100, 66, 18, 120, 2, 98, 100, 98, 111, 248, 18,
+    65, 18, 66, 31, 49, 35, 34, 35, 34, 35, 34, 34, 36, 34, 19, 34, 36, 34, 20, 18,
+    36, 33, 36, 33, 36, 33, 36, 70, 53, 70, 54, 54, 54, 48, 6, 106, 68, 82, 52, 98,
+    36, 98, 36, 98, 36, 34, 34, 36, 34, 34, 36, 34, 34, 36, 34, 34, 36, 34, 100, 34,
+    100, 34, 100, 50, 84, 72, 130, 162, 119, 130, 69, 18, 57, 50, 67, 34, 98, 34, 98, 34,
+    98, 34, 98, 34, 98, 50, 67, 57, 69, 18, 253, 102, 96, 101, 88, 51, 81, 50, 147, 146,
+    138, 66, 162, 136, 98, 178, 163, 81, 72, 101, 34, 98, 50, 82, 66, 66, 82, 50, 98, 34,
+    114, 18, 132, 122, 85, 130, 19, 114, 35, 98, 50, 98, 66, 82, 82, 66, 98, 15, 181, 43,
+    34, 24, 33, 40, 73, 34, 22, 65, 38, 17, 58, 41, 73, 17, 43, 43, 43, 32, 85, 240,
+    157, 33, 34, 60, 17, 36, 61, 37, 45, 37, 45, 37, 60, 37, 59, 38, 35, 69, 38, 34,
+    49, 36, 38, 34, 34, 33, 85, 49, 35, 133, 34, 35, 65, 81, 51, 49, 34, 50, 84, 111,
+    17, 245, 47, 82, 245, 32, 99, 117, 98, 34, 82, 34, 82, 34, 82, 33, 116, 51, 35, 42,
+    17, 36, 18, 161, 161, 146, 131, 115, 6, 89, 34, 82, 45, 98, 29, 83, 18, 52, 40, 50,
+    146, 146, 146, 146, 146, 81, 148, 88, 35, 17, 49, 34, 33, 82, 49, 82, 49, 82, 49, 82,
+    49, 37, 49, 37, 49, 52, 49, 50, 18, 33, 50, 18, 33, 50, 36, 35, 54, 113, 161, 83,
+    163, 163, 146, 18, 130, 18, 76, 28, 66, 50, 82, 66, 60, 50, 82, 50, 98, 50, 114, 34,
+    114, 18, 130, 69, 105, 65, 98, 194, 178, 163, 29, 55, 63, 178, 43, 43, 39, 19, 67, 53,
+    112, 81, 129, 101, 55, 18, 33, 35, 49, 50, 49, 50, 49, 50, 49, 50, 49, 50, 49, 50,
+    49, 66, 33, 33, 19, 17, 18, 38, 97, 129, 129, 15, 189, 251, 82, 178, 178, 178, 178, 178,
+    178, 178, 178, 178, 31, 86, 42, 35, 167, 40, 36, 116, 106, 41, 42, 41, 42, 41, 32, 50,
+    162, 162, 33, 117, 115, 146, 33, 87, 66, 19, 146, 82, 20, 84, 18, 82, 50, 66, 66, 51,
+    71, 85, 37, 104, 50, 67, 34, 82, 34, 82, 34, 82, 34, 67, 34, 36, 25, 66, 146, 121,
+    66, 146, 146, 34, 147, 54, 114, 65, 66, 82, 162, 82, 102, 66, 98, 50, 51, 97, 66, 50,
+    36, 18, 35, 34, 45, 34, 18, 210, 34, 195, 34, 194, 50, 178, 66, 178, 67, 34, 82, 117,
+    34, 147, 54, 114, 65, 66, 82, 162, 82, 102, 66, 98, 50, 51, 97, 66, 50, 36, 18, 35,
+    34, 45, 34, 18, 210, 35, 179, 53, 130, 115, 98, 146, 98, 67, 19, 82, 86, 85, 82, 82,
+    35, 129, 18, 129, 18, 114, 18, 113, 34, 113, 34, 113, 34, 113, 34, 114, 18, 129, 18, 132,
+    147, 97, 71, 20, 103, 18, 34, 74, 65, 51, 98, 65, 34, 146, 34, 34, 164, 34, 242, 47,
+    34, 242, 47, 34, 243, 47, 34, 243, 54, 26, 155, 112, 66, 165, 119, 82, 18, 114, 34, 114,
+    34, 114, 34, 114, 34, 114, 34, 114, 34, 130, 18, 33, 103, 130, 185, 73, 50, 130, 86, 82,
+    82, 65, 67, 82, 146, 98, 130, 114, 130, 114, 114, 50, 51, 49, 19, 22, 38, 18, 18, 50,
+    130, 34, 66, 114, 34, 66, 98, 50, 66, 83, 50, 66, 82, 67, 34, 82, 101, 50, 130, 102,
+    82, 98, 65, 67, 98, 146, 114, 130, 130, 130, 130, 114, 147, 49, 19, 18, 66, 22, 18, 34,
+    66, 114, 50, 66, 114, 50, 66, 98, 66, 66, 83, 66, 66, 82, 98, 35, 66, 119, 38, 43,
+    83, 114, 115, 132, 69, 51, 98, 114, 114, 115, 81, 24, 38, 23, 74, 33, 114, 178, 178, 162,
+    42, 42, 162, 162, 147, 146, 17, 99, 42, 55, 20, 58, 34, 41, 65, 34, 97, 65, 34, 98,
+    34, 34, 116, 50, 231, 151, 146, 226, 226, 226, 226, 226, 226, 53, 115, 18, 49, 113, 18, 17,
+    65, 97, 66, 65, 97, 66, 65, 97, 66, 65, 82, 161, 82, 167, 177, 81, 177, 81, 177, 81,
+    162, 81, 161, 98, 66, 33, 114, 33, 20, 147, 244, 65, 23, 17, 71, 44, 29, 35, 84, 34,
+    19, 36, 33, 21, 36, 38, 36, 38, 37, 22, 37, 22, 37, 22, 33, 71, 17, 18, 24, 28,
+    26, 60, 16, 4, 85, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34,
+    33, 81, 34, 39, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34,
+    33, 81, 37, 84, 49, 130, 130, 130, 130, 20, 49, 18, 19, 19, 66, 18, 82, 18, 82, 18,
+    82, 17, 100, 100, 97, 18, 82, 18, 82, 50, 130, 34, 84, 84, 146, 21, 52, 34, 50, 81,
+    34, 97, 34, 97, 34, 82, 34, 82, 33, 98, 18, 98, 18, 97, 34, 82, 52, 34, 33, 33,
+    65, 33, 65, 33, 65, 113, 113, 113, 113, 113, 113, 113, 98, 33, 49, 52, 52, 106, 115, 194,
+    162, 162, 162, 163, 162, 162, 162, 161, 36, 66, 38, 18, 101, 83, 145, 34, 113, 65, 113, 193,
+    193, 193, 193, 178, 178, 177, 145, 18, 151, 81, 17, 68, 18, 17, 100, 67, 65, 17, 50, 17,
+    49, 18, 34, 18, 34, 17, 49, 33, 49, 18, 49, 17, 67, 51, 66, 82, 82, 40, 34, 18,
+    142, 50, 18, 162, 18, 162, 18, 21, 66, 20, 35, 50, 19, 82, 34, 19, 82, 34, 18, 98,
+    34, 18, 98, 34, 18, 98, 34, 19, 82, 34, 19, 82, 34, 20, 50, 50, 18, 21, 4, 114,
+    49, 99, 33, 99, 49, 82, 17, 33, 82, 18, 33, 66, 33, 34, 50, 49, 33, 50, 49, 49,
+    34, 65, 33, 34, 65, 49, 18, 81, 33, 18, 82, 35, 97, 50, 116, 19, 114, 100, 83, 100,
+    82, 117, 66, 114, 18, 66, 114, 19, 50, 114, 34, 50, 50, 34, 35, 34, 33, 33, 18, 50,
+    34, 33, 33, 18, 51, 18, 33, 33, 18, 66, 18, 33, 33, 18, 69, 50, 34, 84, 99, 84,
+    98, 115, 36, 56, 82, 98, 49, 161, 33, 54, 17, 17, 65, 65, 34, 65, 65, 34, 65, 50,
+    34, 69, 50, 65, 114, 65, 113, 17, 49, 97, 49, 129, 81, 97, 118, 240, 20, 51, 20, 82,
+    19, 19, 34, 17, 37, 18, 54, 18, 38, 34, 38, 18, 17, 37, 18, 17, 33, 66, 19, 23,
+    19, 23, 34, 23, 64, 8, 49, 33, 51, 17, 33, 49, 34, 33, 49, 34, 33, 49, 34, 33,
+    49, 34, 33, 49, 34, 33, 49, 17, 17, 38, 33, 33, 113, 33, 113, 33, 113, 33, 113, 33,
+    116, 84, 130, 66, 83, 67, 49, 18, 65, 18, 33, 18, 65, 33, 18, 18, 65, 33, 17, 34,
+    65, 35, 34, 65, 35, 34, 65, 35, 34, 65, 33, 18, 18, 65, 33, 33, 18, 65, 33, 36,
+    65, 17, 67, 66, 118, 194, 210, 210, 71, 82, 33, 65, 49, 65, 66, 18, 65, 66, 18, 65,
+    66, 18, 65, 66, 113, 65, 129, 34, 147, 177, 18, 161, 33, 145, 50, 129, 65, 49, 49, 82,
+    21, 114, 35, 83, 53, 22, 33, 51, 66, 33, 66, 66, 33, 66, 66, 33, 66, 65, 65, 50,
+    49, 97, 34, 20, 131, 34, 130, 51, 114, 66, 33, 66, 66, 33, 66, 66, 49, 34, 84, 20,
+    98, 8, 81, 33, 66, 49, 33, 65, 17, 33, 33, 65, 17, 33, 33, 65, 18, 17, 33, 65,
+    17, 33, 33, 65, 17, 33, 33, 67, 33, 39, 49, 33, 33, 34, 33, 33, 49, 33, 33, 33,
+    50, 33, 17, 33, 65, 33, 17, 33, 66, 37, 84, 5, 152, 98, 67, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 51, 75, 34, 18, 100, 34, 115, 34, 114, 50, 100, 34, 82, 34, 18, 66,
+    66, 65, 164, 54, 17, 56, 50, 67, 34, 52, 34, 49, 18, 34, 49, 18, 34, 34, 18, 40,
+    56, 50, 17, 34, 50, 17, 50, 36, 51, 19, 82, 19, 85, 114, 17, 146, 18, 49, 66, 33,
+    34, 35, 82, 34, 34, 33, 18, 17, 50, 17, 18, 21, 33, 65, 9, 240, 31, 65, 38, 18,
+    129, 33, 98, 129, 33, 98, 129, 33, 98, 129, 38, 18, 129, 33, 98, 129, 33, 98, 129, 33,
+    98, 129, 38, 22, 5, 18, 50, 33, 51, 19, 33, 49, 17, 17, 17, 33, 49, 33, 33, 33,
+    49, 81, 33, 49, 81, 65, 227, 98, 81, 50, 34, 65, 50, 34, 50, 50, 34, 49, 50, 66,
+    18, 50, 66, 17, 66, 68, 50, 99, 50, 98, 50, 130, 34, 115, 34, 115, 18, 114, 20, 113,
+    36, 113, 50, 113, 209, 13, 129, 34, 114, 33, 129, 33, 129, 49, 114, 33, 129, 34, 113, 49,
+    114, 33, 129, 34, 113, 49, 129, 33, 129, 34, 114, 33, 141, 24, 99, 82, 83, 82, 104, 98,
+    83, 83, 82, 102, 131, 114, 114, 114, 114, 116, 59, 69, 105, 51, 83, 34, 114, 18, 148, 148,
+    148, 148, 148, 131, 18, 114, 50, 82, 67, 51, 38, 28, 22, 6, 28, 22, 35, 51, 66, 82,
+    50, 114, 19, 117, 148, 148, 148, 148, 146, 18, 114, 35, 83, 57, 101, 49, 161, 49, 88, 146,
+    146, 145, 145, 145, 134, 147, 146, 146, 146, 146, 146, 34, 86, 81, 50, 65, 70, 3, 20, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 2, 83, 34, 67, 50, 51, 66, 35, 82, 19, 101, 116,
+    132, 133, 114, 19, 98, 35, 82, 51, 66, 67, 50, 83, 34, 99, 83, 145, 49, 129, 49, 129,
+    49, 147, 163, 149, 130, 18, 130, 18, 114, 50, 98, 50, 98, 50, 82, 82, 66, 82, 73, 59,
+    34, 114, 34, 114, 18, 146, 70, 98, 18, 50, 49, 50, 66, 17, 66, 66, 17, 66, 65, 34,
+    50, 50, 114, 33, 148, 18, 113, 82, 97, 98, 81, 98, 81, 97, 81, 113, 65, 98, 57, 145,
+    147, 99, 35, 34, 18, 98, 34, 97, 51, 66, 51, 66, 65, 82, 50, 82, 33, 130, 162, 163,
+    164, 65, 71, 85, 130, 82, 81, 145, 50, 146, 34, 146, 19, 159, 109, 45, 46, 25, 36, 23,
+    38, 112, 83, 82, 34, 34, 82, 18, 85, 69, 67, 23, 50, 130, 130, 81, 54, 67, 66, 49,
+    49, 65, 34, 50, 34, 129, 145, 116, 65, 114, 113, 129, 129, 115, 82, 23, 69, 114, 55, 17,
+    82, 49, 33, 82, 82, 82, 82, 82, 194, 151, 162, 194, 193, 209, 97, 82, 98, 65, 118, 98,
+    98, 98, 98, 98, 98, 98, 23, 23, 98, 98, 98, 111, 48, 20, 179, 17, 50, 145, 33, 17,
+    51, 114, 129, 17, 97, 17, 129, 18, 65, 33, 129, 33, 65, 33, 129, 34, 33, 49, 129, 34,
+    33, 49, 129, 49, 17, 65, 129, 51, 65, 129, 51, 65, 129, 51, 65, 113, 81, 81, 65, 33,
+    81, 82, 36, 97, 82, 17, 242, 32, 35, 50, 36, 67, 67, 67, 52, 50, 21, 145, 50, 114,
+    35, 99, 35, 84, 35, 83, 51, 67, 52, 33, 81, 36, 81, 67, 67, 67, 67, 67, 52, 67,
+    51, 83, 35, 102, 129, 17, 202, 59, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 47, 144,
+    17, 119, 38, 97, 113, 113, 113, 113, 114, 98, 98, 98, 98, 23, 21, 17, 1, 175, 121, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 19, 52, 35, 65, 149, 36, 36, 36,
+    36, 36, 36, 36, 36, 22, 71, 139, 83, 100, 33, 18, 146, 20, 179, 18, 178, 33, 194, 34,
+    178, 34, 178, 34, 162, 67, 115, 91, 121, 7, 240, 47, 82, 98, 81, 68, 99, 66, 49, 18,
+    97, 17, 81, 33, 38, 17, 33, 99, 34, 81, 49, 82, 50, 66, 49, 83, 34, 71, 49, 33,
+    34, 50, 81, 34, 49, 18, 49, 97, 18, 66, 28, 33, 17, 33, 17, 17, 49, 33, 33, 17,
+    17, 97, 33, 17, 17, 97, 33, 17, 17, 97, 33, 17, 17, 97, 33, 17, 17, 97, 33, 17,
+    33, 81, 33, 17, 33, 81, 33, 18, 34, 52, 37, 21, 98, 49, 17, 66, 81, 17, 49, 97,
+    18, 18, 113, 17, 17, 129, 17, 17, 129, 17, 17, 129, 34, 129, 33, 161, 17, 161, 17, 161,
+    17, 161, 17, 161, 17, 163, 12, 33, 113, 33, 113, 33, 113, 33, 113, 33, 113, 33, 113, 33,
+    113, 33, 113, 33, 113, 33, 113, 33, 113, 33, 113, 33, 116, 14, 33, 81, 34, 33, 81, 34,
+    33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81,
+    34, 33, 81, 34, 33, 81, 34, 33, 81, 34, 33, 81, 37, 84, 31, 1, 34, 43, 34, 43,
+    34, 43, 19, 28, 19, 28, 19, 28, 19, 28, 19, 26, 19, 26, 19, 26, 19, 41, 34, 41,
+    34, 41, 34, 42, 18, 42, 18, 42, 241, 38, 74, 34, 99, 18, 114, 18, 132, 135, 87, 82,
+    162, 162, 162, 148, 130, 19, 52, 56, 15, 55, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 32, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 127, 80, 82, 162, 162,
+    162, 162, 162, 162, 162, 148, 133, 98, 34, 82, 66, 66, 67, 34, 98, 18, 130, 54, 129, 33,
+    52, 65, 33, 83, 49, 33, 81, 17, 49, 33, 81, 18, 33, 33, 81, 33, 17, 33, 81, 34,
+    17, 33, 81, 34, 17, 33, 81, 33, 33, 33, 81, 33, 33, 33, 81, 18, 33, 17, 81, 33,
+    33, 33, 81, 17, 49, 33, 82, 73, 163, 161, 17, 145, 33, 145, 17, 69, 17, 17, 49, 17,
+    35, 17, 33, 33, 50, 17, 33, 17, 65, 33, 17, 33, 65, 17, 33, 33, 65, 17, 33, 33,
+    65, 17, 33, 33, 50, 17, 33, 18, 49, 33, 35, 50, 33, 53, 19, 69, 51, 50, 18, 17,
+    65, 17, 17, 82, 33, 82, 40, 33, 97, 33, 97, 18, 114, 151, 50, 50, 195, 33, 17, 17,
+    33, 17, 17, 33, 17, 33, 17, 33, 17, 17, 33, 17, 33, 17, 17, 35, 98, 98, 246, 53,
+    17, 20, 18, 20, 17, 21, 17, 21, 17, 21, 17, 20, 18, 20, 18, 20, 17, 21, 17, 21,
+    17, 20, 18, 20, 17, 19, 64, 2, 68, 66, 24, 51, 83, 35, 98, 18, 18, 82, 18, 34,
+    66, 17, 66, 52, 67, 19, 117, 147, 178, 194, 178, 82, 50, 102, 98, 98, 98, 98, 23, 23,
+    98, 98, 111, 48, 49, 211, 179, 191, 240, 19, 211, 209, 50, 84, 54, 24, 17, 18, 17, 66,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 177, 211, 211, 31, 240, 179, 179, 209, 50, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 65, 18, 17, 24, 22, 52, 82, 49, 113, 83, 83, 51, 115,
+    31, 240, 19, 115, 51, 83, 81, 113, 50, 84, 54, 24, 17, 18, 17, 66, 98, 98, 98, 98,
+    65, 18, 17, 24, 22, 52, 82, 6, 86, 83, 129, 18, 113, 34, 97, 50, 162, 162, 162, 162,
+    162, 86, 86, 131, 116, 98, 18, 82, 34, 66, 130, 130, 130, 130, 178, 162, 162, 162, 162, 50,
+    82, 34, 98, 18, 116, 131, 86, 245, 40, 40, 40, 35, 20, 36, 19, 37, 18, 38, 17, 39,
+    56, 96, 243, 37, 37, 37, 37, 38, 36, 255, 1, 51, 40, 50, 41, 19, 16, 246, 34, 41,
+    35, 39, 37, 33, 254, 82, 82, 82, 82, 97, 97, 6, 69, 38, 51, 19, 20, 82, 65, 18,
+    18, 50, 114, 37, 130, 36, 70, 18, 34, 54, 17, 66, 83, 114, 35, 17, 133, 33, 240, 16,
+    129, 146, 35, 114, 35, 114, 35, 127, 240, 19, 34, 147, 34, 145, 65, 65, 115, 85, 50, 17,
+    18, 18, 33, 33, 66, 100, 70, 35, 17, 18, 33, 33, 33, 81, 129, 129, 129, 129, 245, 35,
+    41, 35, 41, 35, 33, 254, 115, 34, 115, 34, 145, 49, 65, 129, 129, 129, 129, 129, 33, 18,
+    33, 19, 18, 20, 53, 83, 65, 33, 33, 19, 17, 18, 38, 68, 98, 243, 39, 35, 39, 50,
+    39, 50, 195, 196, 55, 36, 55, 36, 25, 16, 240, 40, 36, 40, 36, 40, 36, 194, 194, 55,
+    34, 55, 36, 24, 16, 243, 40, 34, 41, 33, 42, 255, 33, 57, 34, 56, 35, 25, 32, 65,
+    115, 85, 50, 17, 18, 18, 33, 33, 81, 129, 129, 129, 129, 129, 129, 129, 79, 48, 2, 145,
+    50, 131, 34, 147, 31, 242, 147, 18, 131, 34, 145, 15, 52, 24, 24, 24, 24, 24, 24, 24,
+    21, 18, 18, 17, 49, 17, 34, 100, 70, 32, 65, 115, 85, 50, 17, 18, 18, 33, 33, 81,
+    129, 129, 129, 33, 18, 33, 19, 18, 20, 53, 83, 63, 48, 194, 66, 114, 50, 146, 18, 161,
+    30, 28, 67, 211, 209, 18, 194, 130, 50, 146, 34, 162, 46, 44, 194, 194, 209, 164, 66, 66,
+    18, 50, 81, 50, 18, 97, 49, 30, 28, 67, 81, 115, 65, 129, 20, 162, 34, 66, 50, 34,
+    82, 34, 34, 98, 46, 44, 82, 82, 98, 66, 209, 243, 37, 37, 39, 35, 35, 51, 33, 65,
+    66, 177, 98, 55, 36, 53, 38, 22, 16, 129, 146, 49, 18, 82, 50, 34, 50, 66, 50, 31,
+    226, 50, 35, 36, 83, 38, 17, 35, 16, 17, 162, 146, 81, 50, 51, 49, 37, 49, 19, 18,
+    36, 49, 51, 65, 49, 82, 146, 98, 18, 98, 18, 18, 70, 100, 114, 65, 130, 114, 114, 122,
+    18, 82, 34, 66, 50, 50, 130, 130, 130, 130, 130, 130, 130, 81, 130, 130, 141, 69, 51, 18,
+    35, 34, 49, 50, 114, 114, 114, 114, 114, 130, 130, 130, 130, 130, 130, 130, 50, 50, 35, 50,
+    19, 79, 113, 56, 56, 32, 2, 114, 114, 114, 114, 114, 114, 114, 49, 50, 50, 34, 66, 31,
+    54, 38, 39, 16, 7, 55, 130, 130, 130, 130, 130, 81, 34, 82, 18, 18, 54, 84, 114, 162,
+    162, 162, 50, 82, 34, 98, 18, 127, 177, 58, 58, 16, 118, 147, 35, 114, 98, 82, 130, 17,
+    34, 17, 98, 18, 21, 82, 38, 180, 210, 54, 115, 51, 98, 98, 66, 129, 66, 82, 18, 34,
+    101, 18, 134, 164, 194, 14, 254, 104, 104, 59, 17, 42, 18, 41, 19, 45, 45, 45, 45, 45,
+    32, 2, 50, 130, 34, 146, 18, 175, 242, 18, 162, 34, 34, 52, 49, 50, 34, 162, 31, 42,
+    89, 49, 40, 50, 41, 16, 133, 118, 115, 66, 68, 34, 82, 18, 18, 82, 18, 18, 130, 18,
+    130, 18, 130, 34, 98, 51, 67, 72, 116, 5, 134, 148, 148, 66, 34, 18, 66, 33, 34, 82,
+    17, 146, 17, 146, 18, 129, 34, 114, 50, 82, 87, 131, 49, 211, 179, 191, 240, 15, 240, 19,
+    211, 209, 1, 66, 51, 33, 18, 17, 33, 17, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    50, 35, 18, 19, 33, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 177, 211, 211, 31, 240,
+    15, 240, 179, 194, 209, 1, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 33, 17, 18, 19,
+    34, 49, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 17, 36, 17, 20, 35, 50, 177, 211,
+    211, 31, 240, 179, 65, 99, 67, 97, 67, 191, 240, 19, 211, 209, 50, 66, 84, 50, 70, 34,
+    56, 18, 65, 18, 17, 34, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 33, 18, 17,
+    66, 24, 50, 38, 66, 52, 82, 66, 49, 211, 179, 191, 240, 19, 211, 97, 97, 99, 211, 31,
+    240, 179, 179, 209, 50, 194, 194, 207, 240, 19, 211, 194, 194, 207, 61, 61, 61, 16, 65, 81,
+    115, 51, 85, 21, 50, 17, 21, 18, 18, 33, 33, 18, 33, 81, 66, 129, 66, 129, 66, 129,
+    66, 129, 66, 129, 66, 129, 66, 129, 66, 129, 66, 129, 66, 162, 226, 226, 31, 240, 179, 179,
+    210, 226, 31, 12, 44, 44, 32, 65, 66, 129, 66, 129, 66, 129, 66, 129, 66, 129, 66, 129,
+    66, 129, 66, 129, 66, 129, 66, 81, 33, 33, 18, 33, 19, 17, 21, 18, 44, 68, 36, 98,
+    66, 49, 211, 179, 191, 240, 255, 15, 240, 179, 194, 209, 177, 211, 211, 31, 240, 255, 15, 240,
+    19, 211, 209, 243, 37, 37, 38, 21, 241, 98, 83, 82, 110, 35, 33, 161, 49, 129, 146, 49,
+    18, 82, 50, 34, 61, 18, 81, 85, 50, 66, 44, 67, 17, 50, 97, 18, 49, 247, 18, 41,
+    35, 34, 230, 38, 36, 38, 33, 213, 37, 38, 22, 16, 243, 44, 44, 241, 211, 222, 35, 209,
+    65, 115, 82, 18, 50, 35, 19, 35, 49, 34, 65, 34, 65, 34, 65, 34, 65, 34, 65, 34,
+    65, 34, 65, 34, 65, 34, 65, 34, 250, 46, 34, 238, 44, 33, 220, 45, 16, 33, 34, 65,
+    34, 65, 34, 65, 34, 65, 34, 65, 34, 65, 34, 65, 34, 65, 34, 65, 34, 50, 35, 19,
+    35, 35, 18, 68, 98, 243, 37, 37, 39, 35, 209, 43, 89, 34, 196, 53, 38, 22, 16, 65,
+    115, 82, 18, 50, 35, 19, 35, 49, 34, 65, 34, 65, 34, 65, 34, 65, 34, 50, 35, 19,
+    35, 35, 18, 68, 98, 6, 102, 97, 49, 114, 49, 99, 49, 81, 18, 49, 114, 49, 114, 49,
+    114, 49, 114, 49, 114, 178, 102, 102, 113, 34, 97, 50, 81, 51, 65, 52, 49, 50, 81, 50,
+    81, 50, 81, 50, 146, 146, 240, 28, 23, 35, 23, 35, 23, 35, 23, 35, 17, 36, 35, 53,
+    35, 38, 34, 39, 33, 38, 96, 245, 26, 26, 19, 37, 19, 37, 19, 34, 18, 19, 35, 17,
+    19, 36, 35, 37, 19, 38, 18, 39, 96, 243, 44, 209, 44, 243, 211, 221, 49, 250, 35, 222,
+    33, 240, 194, 194, 44, 209, 243, 44, 44, 35, 18, 34, 17, 246, 18, 34, 17, 19, 211, 209,
+    250, 46, 35, 18, 19, 19, 33, 97, 145, 33, 49, 87, 20, 44, 45, 16, 65, 115, 85, 50,
+    17, 18, 18, 33, 33, 81, 129, 87, 81, 129, 87, 39, 81, 129, 129, 65, 129, 129, 129, 87,
+    81, 129, 87, 39, 81, 81, 33, 33, 19, 17, 18, 38, 68, 98, 243, 44, 44, 44, 98, 34,
+    146, 34, 49, 61, 61, 16, 65, 115, 85, 50, 17, 18, 18, 33, 33, 81, 129, 242, 24, 24,
+    31, 33, 129, 129, 250, 46, 46, 33, 49, 49, 161, 49, 108, 44, 45, 16, 65, 129, 129, 251,
+    24, 31, 177, 81, 33, 33, 19, 17, 18, 38, 68, 98, 81, 146, 35, 130, 19, 149, 175, 242,
+    18, 162, 34, 146, 49, 248, 35, 41, 34, 42, 33, 255, 41, 49, 40, 50, 41, 19, 32, 65,
+    210, 193, 27, 17, 194, 211, 193, 18, 27, 35, 210, 225, 81, 129, 17, 97, 49, 65, 81, 35,
+    51, 49, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 85,
+    161, 226, 61, 33, 178, 17, 195, 193, 27, 17, 194, 209, 53, 81, 49, 81, 49, 81, 49, 81,
+    49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 51, 51, 34, 49, 82, 17, 114,
+    81, 129, 17, 97, 49, 65, 81, 35, 51, 49, 49, 81, 49, 81, 49, 81, 49, 85, 250, 85,
+    19, 21, 80, 81, 129, 17, 97, 49, 65, 81, 35, 51, 49, 49, 81, 49, 81, 49, 81, 49,
+    81, 49, 81, 49, 81, 49, 51, 51, 17, 113, 25, 81, 145, 17, 117, 81, 81, 51, 51, 65,
+    49, 97, 49, 97, 49, 97, 49, 97, 49, 97, 49, 97, 49, 67, 51, 33, 113, 41, 81, 131,
+    97, 17, 17, 65, 33, 33, 35, 17, 19, 49, 17, 17, 81, 17, 17, 81, 17, 17, 81, 17,
+    17, 81, 17, 17, 81, 17, 17, 81, 17, 17, 51, 17, 19, 17, 49, 49, 25, 81, 129, 17,
+    97, 49, 65, 33, 33, 36, 20, 49, 49, 65, 81, 35, 51, 49, 49, 81, 49, 81, 49, 81,
+    49, 81, 49, 81, 49, 85, 81, 129, 17, 97, 49, 65, 33, 33, 36, 20, 49, 49, 65, 81,
+    35, 51, 49, 49, 81, 49, 81, 49, 81, 49, 51, 51, 17, 113, 25, 4, 97, 65, 33, 98,
+    49, 40, 17, 33, 193, 17, 210, 193, 17, 40, 17, 33, 33, 98, 52, 97, 15, 30, 30, 18,
+    102, 18, 102, 18, 57, 18, 72, 18, 33, 39, 18, 34, 38, 23, 37, 24, 36, 25, 35, 26,
+    34, 27, 33, 16, 225, 17, 193, 18, 177, 34, 161, 50, 145, 66, 129, 82, 50, 33, 98, 34,
+    33, 114, 18, 33, 132, 33, 147, 33, 102, 33, 225, 239, 16, 81, 129, 17, 97, 49, 65, 81,
+    35, 51, 49, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 51, 51, 34, 49, 82, 17,
+    114, 244, 36, 38, 83, 36, 35, 35, 33, 254, 50, 34, 50, 84, 50, 209, 50, 66, 98, 52,
+    82, 38, 66, 24, 50, 33, 18, 17, 66, 66, 98, 66, 98, 66, 98, 66, 98, 66, 65, 18,
+    17, 34, 56, 18, 70, 34, 84, 50, 98, 66, 162, 211, 211, 31, 240, 179, 179, 210, 226, 31,
+    236, 44, 46, 46, 33, 240, 194, 194, 194, 130, 130, 50, 114, 66, 98, 82, 95, 240, 19, 66,
+    115, 50, 129, 66, 82, 210, 50, 130, 66, 114, 82, 31, 230, 36, 39, 35, 40, 35, 16, 113,
+    162, 33, 34, 82, 49, 50, 50, 65, 66, 31, 226, 51, 19, 36, 50, 18, 38, 19, 18, 16,
+    114, 18, 98, 34, 18, 82, 50, 18, 66, 66, 18, 63, 240, 19, 50, 18, 83, 34, 18, 97,
+    50, 18, 50, 18, 162, 18, 34, 98, 18, 50, 82, 18, 66, 31, 228, 33, 35, 37, 33, 34,
+    38, 33, 34, 16, 97, 17, 146, 17, 17, 18, 82, 33, 17, 34, 50, 49, 17, 50, 31, 226,
+    50, 17, 18, 36, 49, 17, 17, 38, 18, 17, 17, 16, 243, 29, 44, 17, 27, 18, 210, 28,
+    17, 29, 46, 16, 251, 30, 45, 17, 17, 194, 27, 17, 28, 45, 29, 16, 243, 23, 21, 39,
+    35, 17, 23, 17, 17, 18, 146, 34, 23, 17, 18, 17, 23, 36, 39, 22, 22, 16, 2, 146,
+    34, 130, 34, 130, 34, 114, 74, 74, 66, 82, 98, 66, 98, 65, 130, 34, 130, 34, 130, 18,
+    164, 164, 178, 52, 86, 50, 66, 34, 84, 130, 130, 130, 130, 130, 130, 146, 82, 18, 66, 35,
+    35, 54, 37, 49, 35, 98, 98, 113, 35, 33, 18, 33, 19, 68, 68, 68, 50, 18, 35, 36,
+    15, 55, 39, 39, 39, 39, 245, 114, 114, 114, 127, 80, 97, 47, 53, 17, 36, 33, 36, 33,
+    36, 33, 36, 18, 245, 49, 50, 34, 50, 34, 50, 33, 79, 81, 16, 70, 17, 67, 66, 66,
+    97, 17, 34, 98, 18, 17, 113, 49, 17, 97, 67, 81, 98, 65, 114, 49, 115, 49, 113, 18,
+    17, 114, 34, 129, 52, 66, 49, 54, 98, 180, 164, 146, 34, 130, 34, 129, 50, 114, 66, 98,
+    66, 82, 98, 66, 98, 50, 130, 34, 130, 44, 30, 13, 18, 130, 18, 114, 34, 114, 50, 98,
+    50, 82, 82, 66, 82, 50, 98, 50, 114, 34, 114, 18, 148, 147, 163, 74, 36, 147, 178, 178,
+    193, 223, 237, 45, 44, 60, 76, 160, 161, 209, 194, 122, 36, 49, 83, 66, 82, 82, 66, 82,
+    81, 98, 95, 229, 38, 36, 24, 34, 40, 49, 41, 76, 164, 43, 45, 16, 55, 19, 113, 130,
+    140, 130, 146, 152, 10, 195, 210, 210, 209, 223, 240, 194, 193, 194, 178, 163, 58, 247, 44, 36,
+    156, 74, 33, 40, 35, 39, 36, 23, 21, 255, 5, 22, 36, 38, 21, 37, 37, 21, 37, 35,
+    51, 166, 44, 32, 8, 131, 146, 155, 145, 130, 114, 24, 15, 255, 250, 15, 184, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 32, 2, 132, 132, 132, 132, 132, 132,
+    132, 132, 132, 132, 132, 132, 132, 132, 132, 143, 176, 15, 177, 59, 59, 59, 59, 59, 59, 58,
+    42, 42, 42, 42, 42, 42, 57, 251, 15, 176, 15, 191, 242, 28, 28, 28, 22, 214, 28, 28,
+    28, 16, 97, 193, 250, 28, 28, 28, 28, 22, 251, 97, 193, 193, 193, 193, 82, 67, 66, 82,
+    82, 66, 82, 82, 66, 82, 82, 66, 82, 82, 67, 66, 2, 82, 98, 82, 82, 98, 82, 82,
+    83, 82, 82, 82, 98, 82, 82, 98, 81, 161, 161, 81, 65, 53, 33, 35, 39, 84, 102, 67,
+    17, 19, 18, 49, 51, 65, 161, 161, 35, 33, 50, 66, 65, 17, 49, 35, 35, 47, 33, 82,
+    48, 162, 161, 161, 177, 177, 161, 177, 51, 66, 81, 65, 98, 49, 98, 33, 129, 33, 130, 17,
+    131, 162, 162, 161, 21, 193, 177, 131, 66, 97, 49, 113, 33, 129, 33, 53, 49, 161, 177, 51,
+    66, 81, 65, 98, 49, 98, 33, 129, 33, 130, 17, 131, 162, 162, 161, 81, 162, 145, 17, 129,
+    33, 66, 18, 33, 65, 38, 33, 113, 49, 113, 49, 161, 177, 51, 66, 81, 65, 98, 49, 98,
+    33, 129, 33, 130, 17, 131, 162, 162, 161, 34, 66, 21, 21, 51, 33, 66, 49, 81, 49, 67,
+    53, 19, 34, 66, 34, 67, 53, 21, 18, 51, 49, 17, 66, 65, 17, 81, 65, 17, 67, 49,
+    37, 21, 50, 67, 1, 161, 161, 161, 161, 161, 161, 161, 161, 175, 112, 146, 179, 178, 178, 179,
+    178, 179, 163, 178, 179, 178, 178, 179, 191, 192, 146, 178, 179, 178, 179, 163, 178, 180, 162, 17,
+    146, 34, 115, 50, 98, 66, 83, 81, 95, 201, 32, 193, 163, 102, 116, 117, 100, 33, 68, 66,
+    50, 98, 52, 66, 84, 33, 133, 164, 150, 179, 193, 15, 248, 50, 98, 98, 98, 98, 98, 98,
+    98, 18, 52, 66, 68, 50, 18, 98, 98, 98, 98, 98, 98, 98, 1, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 36, 68, 68, 68, 68, 68,
+    68, 70, 36, 68, 68, 38, 68, 68, 68, 68, 68, 68, 68, 51, 99, 84, 82, 17, 82, 18,
+    65, 34, 50, 34, 50, 50, 34, 50, 18, 66, 18, 84, 82, 2, 84, 84, 81, 33, 66, 34,
+    50, 34, 50, 34, 34, 66, 18, 66, 18, 68, 99, 99, 50, 87, 19, 50, 18, 83, 99, 99,
+    99, 99, 99, 99, 99, 98, 1, 99, 99, 99, 99, 99, 99, 99, 100, 84, 81, 39, 53, 82,
+    84, 65, 33, 65, 113, 113, 113, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 50, 18, 67,
+    82, 51, 84, 18, 17, 81, 33, 18, 17, 81, 66, 113, 66, 113, 66, 113, 66, 98, 65, 114,
+    65, 114, 65, 114, 65, 114, 65, 114, 65, 114, 65, 114, 65, 114, 50, 114, 50, 66, 18, 17,
+    18, 83, 35, 82, 51, 35, 84, 18, 17, 33, 18, 65, 33, 18, 17, 18, 33, 65, 66, 50,
+    113, 66, 50, 113, 66, 50, 113, 66, 50, 98, 65, 66, 98, 65, 66, 98, 65, 66, 98, 65,
+    66, 98, 65, 66, 98, 65, 66, 98, 65, 66, 98, 65, 66, 98, 50, 65, 114, 50, 65, 66,
+    18, 17, 18, 20, 83, 35, 51, 82, 84, 65, 33, 65, 113, 113, 84, 52, 17, 33, 18, 18,
+    17, 18, 33, 17, 18, 18, 20, 17, 52, 82, 98, 98, 98, 50, 18, 67, 82, 51, 84, 18,
+    17, 81, 33, 18, 17, 81, 66, 113, 66, 113, 66, 90, 52, 65, 18, 33, 18, 65, 33, 33,
+    18, 65, 33, 33, 18, 65, 33, 36, 65, 18, 58, 82, 65, 114, 65, 114, 50, 114, 50, 66,
+    18, 17, 18, 83, 35, 82, 51, 35, 84, 18, 17, 33, 18, 65, 33, 18, 17, 18, 33, 65,
+    66, 50, 113, 66, 50, 113, 66, 50, 95, 3, 68, 20, 66, 17, 36, 20, 33, 18, 17, 36,
+    20, 33, 33, 17, 36, 20, 33, 18, 68, 20, 67, 240, 82, 65, 66, 98, 65, 66, 98, 50,
+    65, 114, 50, 65, 66, 18, 17, 18, 20, 83, 35, 51, 83, 84, 81, 33, 81, 129, 129, 115,
+    68, 17, 49, 18, 33, 33, 18, 34, 50, 19, 50, 33, 66, 114, 114, 114, 114, 66, 18, 83,
+    83, 84, 81, 33, 81, 129, 129, 100, 68, 17, 49, 18, 18, 33, 22, 17, 18, 18, 36, 17,
+    68, 98, 114, 114, 114, 66, 18, 83, 83, 84, 81, 33, 81, 129, 129, 100, 68, 17, 49, 18,
+    18, 33, 18, 19, 17, 18, 19, 20, 17, 68, 98, 114, 114, 114, 66, 18, 83, 66, 130, 255,
+    255, 66, 100, 98, 2, 100, 98, 255, 255, 66, 130, 4, 196, 2, 100, 98, 255, 255, 2, 100,
+    98, 82, 178, 255, 47, 176, 178, 178, 251, 133, 143, 226, 178, 2, 130, 18, 130, 252, 251, 210,
+    130, 18, 130, 82, 178, 246, 55, 146, 69, 95, 82, 178, 35, 121, 36, 85, 1, 99, 51, 24,
+    38, 66, 161, 52, 82, 18, 34, 83, 66, 82, 82, 53, 69, 34, 98, 50, 164, 130, 18, 130,
+    34, 113, 50, 98, 65, 68, 65, 65, 114, 34, 114, 34, 132, 147, 2, 33, 34, 33, 33, 18,
+    18, 17, 18, 18, 18, 33, 34, 114, 178, 162, 115, 18, 73, 36, 70, 113, 178, 178, 15, 191,
+    4, 111, 5, 80, 50, 113, 23, 37, 70, 252, 251, 145, 178, 98, 34, 49, 24, 21, 70, 98,
+    162, 127, 178, 43, 32, 50, 113, 23, 37, 70, 252, 251, 251, 208, 50, 113, 23, 37, 70, 247,
+    35, 251, 82, 162, 125, 34, 130, 98, 50, 33, 24, 21, 70, 114, 177, 111, 180, 42, 40, 210,
+    43, 32, 37, 95, 5, 95, 37, 95, 20, 80, 129, 178, 114, 34, 49, 23, 37, 70, 113, 133,
+    95, 3, 118, 43, 28, 16, 35, 122, 20, 86, 241, 70, 240, 100, 253, 208, 36, 111, 5, 95,
+    21, 111, 6, 79, 22, 68, 55, 17, 114, 1, 114, 50, 55, 38, 66, 251, 251, 251, 208, 3,
+    115, 27, 70, 255, 41, 36, 70, 177, 68, 134, 114, 50, 52, 73, 84, 251, 69, 132, 83, 35,
+    39, 80, 68, 134, 114, 50, 52, 73, 84, 251, 251, 82, 178, 244, 251, 251, 251, 82, 178, 244,
+    251, 251, 251, 243, 43, 32, 2, 178, 249, 251, 251, 251, 248, 43, 32, 162, 178, 239, 191, 191,
+    189, 43, 32, 2, 31, 1, 223, 242, 33, 240, 29, 13, 31, 1, 47, 242, 209, 240, 18, 15,
+    180, 19, 24, 19, 20, 251, 83, 145, 49, 129, 49, 129, 49, 132, 243, 251, 251, 251, 55, 89,
+    193, 240, 251, 251, 251, 83, 163, 146, 17, 146, 18, 129, 49, 114, 49, 242, 251, 251, 251, 50,
+    50, 113, 49, 130, 18, 130, 17, 163, 163, 243, 251, 251, 251, 97, 193, 193, 151, 131, 163, 145,
+    49, 242, 251, 251, 251, 97, 179, 161, 17, 146, 17, 145, 34, 129, 49, 119, 241, 251, 251, 251,
+    65, 81, 67, 18, 19, 33, 34, 34, 65, 36, 17, 65, 19, 34, 81, 50, 95, 191, 191, 176,
+    33, 18, 19, 97, 33, 33, 81, 49, 33, 81, 49, 33, 81, 49, 33, 241, 251, 251, 251, 68,
+    193, 193, 177, 193, 250, 31, 79, 191, 191, 176, 161, 178, 162, 63, 182, 42, 38, 251, 50, 162,
+    177, 15, 191, 191, 191, 191, 176, 145, 178, 63, 183, 42, 37, 251, 66, 178, 125, 50, 162, 15,
+    191, 191, 191, 191, 191, 191, 176, 178, 133, 72, 39, 84, 167, 152, 149, 178, 223, 176, 2, 181,
+    167, 151, 164, 87, 55, 69, 130, 249, 251, 193, 133, 86, 54, 100, 150, 182, 166, 178, 223, 189,
+    251, 1, 197, 166, 167, 164, 118, 54, 70, 114, 249, 251, 223, 176, 193, 133, 86, 54, 100, 150,
+    182, 166, 178, 129, 79, 181, 38, 251, 50, 1, 197, 166, 167, 164, 118, 54, 70, 114, 244, 20,
+    251, 82, 111, 179, 32, 161, 98, 131, 68, 85, 52, 85, 52, 84, 68, 99, 83, 147, 68, 164,
+    52, 164, 52, 164, 52, 162, 83, 243, 16, 2, 97, 164, 67, 164, 52, 164, 53, 148, 53, 147,
+    83, 116, 52, 100, 52, 100, 52, 100, 52, 115, 82, 145, 19, 66, 51, 52, 18, 18, 18, 18,
+    18, 18, 18, 36, 36, 36, 33, 18, 18, 18, 18, 33, 18, 35, 51, 66, 51, 130, 178, 51,
+    66, 19, 27, 70, 161, 178, 137, 38, 38, 34, 113, 50, 146, 177, 33, 133, 117, 85, 85, 17,
+    83, 50, 85, 17, 149, 165, 114, 37, 66, 82, 65, 114, 67, 66, 87, 149, 165, 114, 51, 81,
+    37, 70, 85, 101, 130, 17, 178, 177, 130, 178, 33, 133, 86, 71, 68, 49, 88, 134, 167, 82,
+    51, 82, 111, 180, 27, 32, 114, 65, 98, 68, 49, 118, 166, 114, 36, 88, 55, 54, 115, 18,
+    177, 143, 179, 27, 32, 193, 148, 86, 70, 84, 150, 166, 182, 163, 229, 95, 22, 64, 1, 196,
+    182, 166, 180, 118, 55, 54, 115, 247, 17, 100, 67, 121, 32, 145, 178, 33, 133, 86, 71, 68,
+    50, 72, 134, 167, 82, 51, 82, 117, 95, 19, 33, 69, 32, 114, 65, 98, 68, 49, 118, 166,
+    129, 36, 88, 55, 54, 115, 18, 177, 113, 22, 68, 25, 65, 66, 82, 193, 133, 86, 54, 100,
+    150, 166, 66, 92, 67, 54, 182, 148, 86, 70, 84, 145, 1, 196, 182, 166, 180, 118, 54, 70,
+    69, 86, 55, 54, 116, 166, 182, 165, 193, 129, 178, 178, 49, 118, 86, 55, 84, 34, 88, 134,
+    66, 78, 51, 54, 152, 81, 52, 71, 70, 86, 113, 50, 177, 178, 129, 178, 65, 98, 68, 50,
+    102, 166, 130, 20, 103, 54, 71, 53, 56, 55, 55, 100, 17, 134, 167, 98, 37, 66, 97, 65,
+    178, 193, 178, 162, 147, 131, 102, 85, 134, 181, 179, 195, 179, 193, 193, 1, 194, 194, 195, 180,
+    181, 181, 103, 68, 116, 131, 146, 177, 193, 163, 132, 116, 71, 85, 166, 180, 52, 83, 38, 51,
+    84, 49, 131, 179, 194, 193, 1, 195, 179, 196, 183, 149, 86, 84, 115, 86, 70, 17, 52, 115,
+    146, 162, 177, 193, 163, 132, 116, 71, 85, 166, 180, 195, 179, 193, 193, 22, 68, 55, 1, 195,
+    179, 196, 183, 149, 86, 84, 115, 146, 177, 249, 17, 100, 67, 112, 162, 177, 178, 17, 145, 18,
+    132, 147, 131, 117, 85, 18, 88, 149, 149, 129, 51, 82, 67, 65, 113, 50, 113, 129, 65, 113,
+    66, 82, 82, 65, 115, 18, 133, 165, 130, 21, 88, 68, 116, 132, 130, 17, 145, 18, 177, 178,
+    58, 28, 17, 178, 177, 194, 178, 194, 203, 10, 59, 194, 194, 178, 178, 177, 178, 27, 145, 178,
+    178, 177, 122, 28, 17, 81, 82, 66, 81, 82, 82, 66, 82, 65, 114, 34, 139, 81, 178, 178,
+    177, 114, 178, 177, 90, 59, 129, 50, 98, 66, 82, 66, 81, 82, 66, 81, 82, 66, 27, 97,
+    178, 178, 177, 43, 18, 162, 177, 193, 194, 178, 195, 187, 251, 208, 11, 194, 194, 178, 178, 178,
+    177, 163, 27, 253, 192, 247, 27, 37, 177, 36, 36, 37, 36, 22, 21, 21, 37, 36, 22, 35,
+    39, 49, 25, 180, 43, 24, 211, 27, 32, 247, 27, 35, 185, 33, 40, 34, 39, 19, 38, 35,
+    38, 20, 37, 36, 22, 19, 49, 182, 43, 24, 196, 27, 32, 43, 18, 162, 177, 193, 194, 178,
+    195, 187, 113, 178, 93, 81, 11, 179, 193, 194, 178, 178, 162, 162, 42, 161, 178, 93, 81, 1,
+    99, 99, 99, 99, 99, 33, 51, 24, 17, 68, 17, 52, 81, 39, 53, 1, 99, 99, 99, 99,
+    99, 99, 34, 35, 34, 36, 84, 81, 39, 53, 1, 99, 99, 99, 99, 49, 35, 49, 35, 20,
+    19, 49, 36, 33, 36, 81, 39, 53, 15, 219, 43, 43, 43, 43, 43, 43, 43, 251, 15, 187,
+    43, 43, 43, 43, 43, 43, 43, 253, 15, 219, 43, 43, 43, 43, 43, 43, 43, 251, 223, 176,
+    15, 187, 43, 43, 43, 43, 43, 43, 43, 253, 223, 176, 15, 152, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 16, 2, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 143, 128, 69, 104,
+    67, 33, 34, 49, 65, 50, 18, 65, 67, 81, 67, 28, 29, 65, 68, 65, 65, 34, 49, 50,
+    51, 51, 87, 69, 104, 67, 82, 49, 130, 18, 147, 163, 28, 29, 148, 145, 34, 114, 51, 51,
+    87, 69, 104, 67, 82, 49, 97, 18, 18, 18, 35, 19, 53, 35, 67, 51, 52, 52, 19, 18,
+    36, 18, 50, 17, 34, 114, 51, 51, 87, 69, 104, 67, 82, 49, 97, 18, 18, 83, 19, 83,
+    35, 67, 51, 51, 68, 19, 84, 18, 97, 34, 114, 51, 51, 87, 69, 104, 67, 82, 49, 130,
+    18, 147, 66, 67, 66, 67, 66, 68, 148, 145, 34, 114, 51, 51, 87, 69, 104, 67, 82, 49,
+    130, 18, 37, 35, 49, 49, 35, 34, 49, 35, 34, 49, 36, 34, 18, 36, 51, 49, 34, 114,
+    51, 51, 87, 69, 104, 67, 82, 49, 65, 50, 18, 65, 33, 19, 34, 17, 17, 35, 67, 51,
+    53, 38, 33, 33, 20, 65, 65, 34, 49, 50, 51, 51, 87, 69, 104, 67, 82, 49, 130, 18,
+    23, 19, 39, 19, 163, 164, 23, 20, 145, 34, 114, 51, 51, 87, 69, 104, 67, 82, 49, 130,
+    18, 147, 163, 39, 19, 39, 20, 148, 145, 34, 114, 51, 51, 87, 15, 197, 20, 53, 20, 53,
+    20, 53, 20, 49, 193, 197, 20, 53, 20, 53, 20, 58, 240, 15, 202, 58, 58, 58, 49, 193,
+    202, 58, 58, 58, 240, 15, 193, 22, 17, 49, 36, 98, 34, 49, 51, 82, 52, 51, 51, 67,
+    50, 49, 34, 49, 51, 33, 49, 37, 90, 240, 15, 202, 58, 58, 52, 36, 52, 36, 52, 36,
+    58, 58, 58, 58, 240, 1, 209, 209, 209, 209, 209, 223, 13, 29, 29, 29, 29, 16, 194, 194,
+    194, 194, 194, 207, 240, 194, 194, 194, 194, 194, 194, 14, 97, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 97, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 126, 1,
+    97, 97, 97, 97, 97, 111, 6, 22, 22, 22, 22, 16, 1, 97, 97, 97, 97, 104, 97, 104,
+    97, 97, 97, 97, 1, 209, 209, 209, 209, 223, 13, 29, 240, 209, 209, 209, 209, 1, 33, 161,
+    33, 161, 33, 161, 33, 161, 33, 161, 33, 161, 44, 44, 33, 161, 33, 161, 33, 161, 33, 161,
+    33, 161, 33, 1, 33, 49, 97, 33, 49, 97, 33, 49, 97, 33, 49, 97, 33, 49, 97, 33,
+    49, 97, 33, 56, 33, 56, 33, 49, 97, 33, 49, 97, 33, 49, 97, 33, 49, 97, 33, 49,
+    97, 33, 49, 1, 33, 161, 33, 161, 33, 161, 33, 161, 33, 161, 44, 33, 161, 33, 161, 44,
+    33, 161, 33, 161, 33, 161, 33, 161, 33, 225, 129, 65, 129, 65, 113, 81, 113, 81, 98, 81,
+    97, 111, 228, 39, 20, 24, 19, 40, 19, 25, 18, 41, 18, 29, 16, 225, 129, 65, 129, 65,
+    113, 81, 113, 81, 98, 95, 5, 38, 21, 23, 240, 65, 129, 50, 129, 49, 145, 34, 145, 33,
+    209, 225, 33, 114, 17, 33, 113, 33, 33, 98, 33, 33, 97, 49, 33, 82, 49, 33, 81, 65,
+    44, 44, 33, 50, 81, 33, 49, 97, 33, 49, 97, 33, 33, 113, 33, 33, 113, 33, 18, 193,
+    225, 33, 114, 17, 33, 113, 33, 33, 98, 33, 33, 97, 49, 33, 82, 49, 44, 33, 66, 65,
+    33, 65, 81, 44, 33, 49, 97, 33, 49, 97, 33, 33, 113, 33, 33, 113, 33, 18, 193, 117,
+    129, 18, 177, 162, 131, 71, 38, 104, 165, 163, 177, 177, 117, 131, 20, 114, 33, 114, 163, 164,
+    166, 150, 72, 37, 98, 146, 162, 165, 147, 178, 133, 100, 18, 68, 50, 21, 85, 134, 114, 37,
+    66, 84, 34, 118, 163, 193, 2, 180, 151, 98, 52, 66, 85, 18, 133, 103, 68, 50, 21, 85,
+    131, 161, 163, 133, 85, 18, 52, 66, 20, 101, 130, 20, 98, 52, 66, 85, 18, 133, 163, 223,
+    176, 3, 165, 130, 20, 98, 53, 50, 100, 18, 133, 100, 18, 53, 50, 20, 101, 130, 249, 251,
+    20, 132, 18, 33, 135, 47, 18, 225, 72, 64, 20, 132, 22, 113, 47, 18, 241, 34, 20, 132,
+    164, 162, 45, 45, 34, 164, 113, 225, 225, 225, 225, 247, 84, 180, 111, 113, 225, 225, 225, 225,
+    6, 49, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 18, 82, 34, 82, 34, 66,
+    66, 50, 66, 50, 66, 49, 97, 34, 98, 18, 98, 18, 100, 131, 131, 240, 247, 15, 127, 3,
+    131, 116, 114, 17, 114, 18, 97, 34, 82, 34, 82, 50, 66, 50, 50, 66, 50, 82, 34, 82,
+    15, 124, 37, 34, 37, 34, 37, 20, 20, 36, 35, 36, 35, 36, 34, 38, 33, 38, 33, 38,
+    72, 56, 48, 1, 161, 162, 148, 113, 50, 81, 65, 81, 81, 65, 82, 49, 97, 63, 112, 146,
+    131, 113, 18, 97, 34, 81, 50, 65, 66, 49, 82, 33, 98, 17, 127, 144, 115, 196, 194, 17,
+    193, 34, 162, 34, 162, 50, 130, 66, 130, 66, 130, 82, 98, 98, 98, 114, 66, 130, 66, 130,
+    66, 146, 34, 162, 34, 180, 196, 194, 2, 194, 18, 178, 18, 162, 34, 162, 50, 146, 50, 130,
+    82, 114, 82, 98, 98, 98, 114, 82, 114, 66, 146, 50, 146, 34, 162, 34, 178, 18, 180, 211,
+    210, 70, 106, 51, 99, 34, 130, 18, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+    164, 164, 162, 196, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 165, 130, 35,
+    99, 58, 102, 66, 116, 83, 18, 51, 50, 19, 82, 18, 67, 34, 35, 69, 99, 129, 4, 65,
+    113, 98, 70, 67, 66, 17, 65, 33, 17, 51, 33, 50, 35, 19, 50, 67, 82, 35, 117, 79,
+    179, 49, 38, 51, 36, 49, 49, 35, 34, 50, 38, 48, 1, 227, 198, 137, 103, 19, 67, 20,
+    54, 52, 68, 68, 54, 52, 35, 35, 36, 19, 67, 22, 135, 165, 194, 1, 227, 198, 131, 21,
+    99, 34, 19, 67, 50, 54, 82, 68, 98, 54, 82, 35, 35, 66, 19, 67, 52, 131, 19, 165,
+    194, 1, 227, 194, 19, 132, 35, 101, 51, 67, 18, 86, 50, 100, 66, 86, 50, 67, 35, 34,
+    51, 67, 18, 19, 135, 165, 194, 1, 240, 47, 3, 227, 227, 240, 62, 60, 105, 50, 55, 52,
+    52, 56, 49, 58, 92, 32, 240, 30, 44, 60, 60, 59, 60, 59, 105, 50, 55, 52, 52, 56,
+    49, 58, 92, 32, 1, 114, 50, 55, 38, 66, 251, 251, 2, 146, 18, 114, 50, 82, 82, 50,
+    98, 49, 130, 18, 130, 18, 130, 17, 163, 163, 162, 178, 82, 178, 179, 163, 163, 146, 17, 146,
+    18, 114, 34, 114, 50, 82, 81, 66, 98, 50, 114, 88, 58, 19, 162, 162, 43, 19, 114, 18,
+    130, 18, 130, 43, 56, 18, 203, 73, 8, 90, 194, 194, 25, 34, 114, 34, 130, 18, 129, 43,
+    42, 34, 163, 27, 41, 54, 99, 36, 50, 99, 33, 51, 34, 18, 37, 36, 18, 49, 36, 18,
+    49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 34,
+    2, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18, 49, 36, 18,
+    49, 36, 18, 49, 36, 37, 34, 17, 51, 34, 34, 99, 51, 51, 86, 65, 129, 129, 129, 101,
+    55, 18, 33, 36, 33, 35, 49, 35, 49, 35, 49, 35, 49, 35, 49, 35, 49, 35, 49, 34,
+    66, 18, 130, 18, 130, 18, 130, 18, 130, 18, 130, 18, 79, 180, 33, 40, 33, 36, 251, 66,
+    18, 130, 18, 130, 18, 130, 18, 130, 18, 193, 163, 117, 85, 85, 66, 19, 114, 21, 82, 69,
+    180, 181, 178, 211, 181, 181, 82, 68, 50, 115, 18, 85, 85, 85, 100, 146, 161, 98, 97, 131,
+    68, 67, 85, 52, 53, 69, 52, 53, 68, 68, 52, 99, 83, 67, 147, 68, 68, 148, 52, 68,
+    148, 52, 68, 148, 52, 68, 146, 83, 82, 243, 16, 2, 97, 98, 148, 67, 68, 148, 52, 68,
+    148, 53, 52, 148, 53, 52, 147, 83, 67, 116, 52, 68, 84, 52, 68, 84, 52, 68, 84, 52,
+    68, 99, 82, 83, 129, 225, 178, 118, 70, 54, 116, 166, 182, 165, 193, 223, 189, 58, 107, 106,
+    104, 85, 99, 102, 64, 2, 182, 166, 182, 148, 86, 70, 85, 129, 250, 251, 248, 54, 100, 100,
+    88, 90, 106, 122, 76, 16, 15, 191, 146, 133, 71, 54, 100, 150, 182, 166, 178, 15, 189, 28,
+    90, 107, 106, 70, 100, 100, 88, 32, 193, 178, 147, 131, 117, 56, 54, 83, 117, 55, 101, 166,
+    180, 195, 194, 193, 1, 194, 195, 180, 113, 53, 67, 55, 20, 68, 53, 168, 133, 85, 84, 131,
+    146, 177, 146, 178, 177, 33, 133, 132, 101, 71, 85, 18, 118, 165, 52, 17, 51, 38, 51, 69,
+    49, 50, 51, 82, 67, 50, 114, 34, 129, 33, 146, 178, 33, 129, 51, 82, 67, 65, 118, 151,
+    119, 86, 84, 115, 17, 54, 40, 17, 52, 115, 148, 132, 145, 18, 177, 130, 178, 177, 79, 5,
+    36, 37, 21, 36, 37, 36, 37, 36, 22, 35, 38, 251, 66, 127, 179, 43, 28, 16, 130, 178,
+    177, 77, 114, 34, 113, 50, 98, 50, 98, 50, 97, 66, 82, 79, 212, 39, 251, 50, 177, 193,
+    15, 11, 43, 43, 43, 43, 43, 251, 98, 95, 180, 44, 16, 13, 178, 178, 178, 178, 178, 191,
+    214, 37, 251, 66, 193, 193, 148, 86, 70, 84, 150, 166, 182, 113, 35, 98, 103, 63, 20, 102,
+    44, 16, 1, 196, 182, 166, 180, 118, 55, 54, 115, 65, 178, 103, 63, 20, 102, 44, 16, 193,
+    163, 132, 116, 71, 85, 166, 180, 195, 179, 113, 65, 98, 65, 22, 68, 55, 98, 162, 1, 195,
+    180, 180, 183, 149, 86, 84, 115, 146, 177, 97, 178, 65, 23, 52, 55, 17, 66, 162, 162, 177,
+    178, 180, 133, 100, 18, 69, 34, 21, 18, 37, 66, 38, 34, 50, 38, 50, 84, 34, 88, 81,
+    67, 66, 97, 66, 162, 130, 162, 178, 66, 66, 84, 34, 87, 98, 52, 66, 55, 18, 34, 69,
+    34, 39, 33, 20, 50, 21, 85, 132, 145, 18, 177, 178, 193, 162, 162, 178, 180, 133, 85, 18,
+    54, 34, 20, 34, 37, 65, 50, 20, 18, 50, 53, 50, 85, 18, 82, 21, 81, 67, 66, 127,
+    179, 43, 28, 16, 145, 178, 178, 50, 82, 69, 34, 66, 21, 82, 53, 50, 70, 18, 50, 53,
+    50, 20, 18, 53, 50, 20, 102, 114, 18, 178, 143, 178, 27, 44, 16, 4, 164, 164, 2, 82,
+    68, 82, 66, 210, 210, 255, 255, 247, 45, 47, 255, 255, 98, 210, 2, 210, 255, 255, 255, 82,
+    210, 255, 255, 255, 66, 210, 138, 115, 226, 240, 47, 17, 241, 44, 255, 100, 47, 33, 242, 47,
+    34, 242, 63, 26, 74, 36, 147, 178, 178, 163, 191, 241, 180, 162, 17, 162, 19, 196, 202, 55,
+    19, 113, 115, 125, 115, 113, 18, 152, 98, 194, 255, 138, 36, 147, 178, 178, 193, 223, 237, 45,
+    44, 60, 76, 160, 15, 223, 58, 36, 147, 178, 178, 193, 223, 237, 45, 44, 60, 76, 160, 15,
+    93, 113, 55, 24, 40, 200, 41, 41, 128, 74, 36, 147, 178, 178, 193, 223, 237, 45, 44, 60,
+    76, 174, 253, 74, 36, 147, 178, 178, 207, 13, 29, 241, 210, 195, 196, 202, 10, 241, 63, 34,
+    242, 47, 33, 242, 36, 255, 108, 47, 17, 241, 47, 2, 227, 122, 10, 195, 210, 33, 162, 17,
+    177, 17, 191, 241, 179, 177, 194, 178, 163, 58, 8, 131, 18, 100, 125, 115, 98, 114, 24, 13,
+    29, 240, 172, 61, 45, 45, 29, 255, 12, 44, 28, 43, 42, 51, 160, 15, 90, 136, 57, 41,
+    185, 24, 39, 33, 128, 15, 11, 43, 43, 43, 43, 253, 178, 178, 178, 191, 176, 15, 144, 15,
+    255, 48, 15, 255, 48, 15, 255, 255, 246, 2, 34, 36, 34, 34, 2, 34, 36, 34, 36, 34,
+    36, 34, 34, 12, 76, 76, 15, 152, 249, 143, 144, 1, 33, 33, 34, 33, 33, 33, 1, 33,
+    33, 34, 33, 33, 34, 33, 33, 34, 33, 33, 33, 8, 72, 72, 72, 15, 24, 241, 143, 24,
+    241, 15, 21, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 15, 240, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 15, 84, 68, 68, 68, 68, 68, 68, 68, 68, 68, 64, 15, 246, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 14, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 15,
+    213, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 15, 20, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 64, 15, 242, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 2, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 94, 2, 82, 82, 82, 82, 82, 82, 82, 82, 82, 95, 208,
+    4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 16, 4, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 79, 242, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 95, 16, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 95, 240, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 80,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 246, 2, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 95, 21, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 2, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 95, 240, 82, 82, 82, 82, 82, 82, 82, 82, 82, 4, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 79, 17, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 32, 18,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 95, 84, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 64, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 84, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 64, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 242, 18, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 18, 98, 98, 98, 98, 98, 98, 98, 98, 98, 95, 246, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 246,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 95,
+    21, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 95, 240, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 79, 85, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 32, 82, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 31, 20, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 64,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 84, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 246, 82, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 82, 98, 98, 98, 98, 98, 98, 98, 98, 98, 31, 242, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 79, 246, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 15, 149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32,
+    7, 95, 241, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 95, 241, 87, 82, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 15, 255, 53, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 15,
+    148, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 64, 8, 79, 242, 132, 132, 132, 132, 132,
+    132, 132, 132, 132, 132, 79, 242, 72, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 15, 255,
+    52, 72, 72, 72, 72, 72, 72, 72, 72, 72, 64, 82, 162, 162, 162, 162, 162, 162, 162, 162,
+    162, 162, 95, 144, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 87, 95, 241, 82, 162, 162,
+    162, 162, 162, 162, 162, 162, 162, 175, 241, 87, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+    95, 255, 48, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 79, 144, 68, 132, 132, 132,
+    132, 132, 132, 132, 132, 132, 72, 79, 242, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 143,
+    242, 72, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 79, 255, 48, 82, 162, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 95, 149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 82,
+    162, 162, 162, 162, 162, 162, 162, 162, 162, 87, 95, 241, 162, 162, 162, 162, 162, 162, 162, 162,
+    162, 162, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 175, 241, 87, 82, 162, 162, 162, 162,
+    162, 162, 162, 162, 162, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 95, 255, 53, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 32, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 79,
+    149, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 82, 162, 162, 162, 162, 162, 162, 162,
+    162, 162, 162, 95, 148, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 64, 68, 132, 132, 132,
+    132, 132, 132, 132, 132, 132, 132, 79, 148, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 64,
+    68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 72, 79, 242, 146, 162, 162, 162, 162, 162, 162,
+    162, 162, 162, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 143, 242, 72, 82, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 88, 79, 242, 132,
+    132, 132, 132, 132, 132, 132, 132, 132, 132, 82, 162, 162, 162, 162, 162, 162, 162, 162, 162, 159,
+    242, 72, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 68, 132, 132, 132, 132, 132, 132, 132,
+    132, 132, 79, 255, 53, 42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 82, 162, 162, 162, 162,
+    162, 162, 162, 162, 162, 95, 255, 52, 72, 72, 72, 72, 72, 72, 72, 72, 72, 64, 68, 132,
+    132, 132, 132, 132, 132, 132, 132, 132, 72, 79, 242, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+    132, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 143, 242, 72, 68, 132, 132, 132, 132, 132,
+    132, 132, 132, 132, 68, 132, 132, 132, 132, 132, 132, 132, 132, 132, 79, 255, 52, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 64, 4, 40, 36, 4, 40, 40, 40, 36, 15, 24, 241, 15, 242,
+    241, 255, 32, 12, 249, 249, 1, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 9, 82, 95, 21, 37, 37, 37, 37, 37,
+    37, 37, 32, 15, 34, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20,
+    18, 20, 18, 20, 18, 16, 9, 113, 113, 38, 38, 33, 65, 33, 65, 33, 65, 33, 65, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 7, 82, 95, 21, 37, 37, 37, 37, 37, 37, 37, 37,
+    32, 15, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18, 20, 18,
+    20, 18, 20, 18, 16, 8, 113, 118, 38, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 2, 82, 82, 82, 82, 82, 82, 82, 82, 82, 89, 82,
+    94, 1, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 79, 16, 1, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 65, 33, 65, 38, 113, 127, 16, 82, 82, 82, 82, 82, 82, 82, 82, 82, 89,
+    82, 95, 16, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 65, 47, 32, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33,
+    65, 33, 65, 33, 65, 38, 33, 113, 127, 32, 2, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    89, 82, 95, 21, 37, 37, 37, 37, 37, 37, 37, 32, 1, 33, 65, 33, 65, 33, 65, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 38, 38, 33, 65, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 1, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 38,
+    113, 113, 38, 38, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 82, 82, 82, 82, 82, 82, 82, 82, 82, 89, 82, 95, 21, 37, 37, 37, 37, 37, 37,
+    37, 37, 32, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 65, 38, 38, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65,
+    33, 65, 33, 65, 33, 65, 33, 65, 38, 33, 113, 118, 38, 33, 65, 33, 65, 33, 65, 33,
+    65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 65, 33, 12, 249, 249, 82, 162, 162, 162, 162,
+    162, 162, 162, 162, 15, 148, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24,
+    18, 24, 18, 24, 18, 24, 18, 16, 12, 249, 82, 162, 84, 18, 24, 18, 24, 18, 24, 18,
+    24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 16, 82, 162, 162, 162, 162, 162, 162, 162, 162,
+    162, 92, 249, 249, 65, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33,
+    129, 33, 129, 33, 129, 33, 79, 144, 65, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33,
+    129, 33, 129, 33, 129, 33, 129, 33, 69, 37, 249, 249, 82, 162, 162, 162, 162, 162, 162, 162,
+    162, 162, 92, 82, 162, 95, 149, 42, 42, 42, 42, 42, 42, 42, 42, 32, 65, 33, 129, 33,
+    129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 79, 148,
+    18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24,
+    18, 16, 65, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33, 129, 33,
+    129, 33, 69, 37, 249, 82, 162, 84, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24, 18, 24,
+    18, 24, 18, 24, 18, 16, 37, 22, 17, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 5,
+    38, 97, 98, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 88, 21, 2, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 102, 37, 194, 193, 194,
+    193, 194, 193, 194, 193, 194, 193, 194, 178, 194, 178, 194, 178, 194, 178, 194, 178, 194, 178, 194,
+    178, 2, 209, 210, 209, 210, 209, 210, 210, 194, 210, 194, 210, 194, 210, 194, 210, 194, 210, 194,
+    210, 194, 210, 194, 210, 2, 162, 17, 161, 34, 130, 49, 129, 66, 98, 81, 97, 98, 66, 114,
+    49, 130, 34, 148, 164, 178, 194, 180, 164, 146, 34, 130, 34, 114, 66, 98, 66, 82, 98, 66,
+    98, 50, 130, 34, 130, 18, 162, 12, 15, 144, 12, 15, 144, 15, 144, 15, 255, 48, 15, 144,
+    15, 255, 48, 111, 240, 102, 18, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 31, 255,
+    48, 6, 111, 240, 15, 255, 49, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 15,
+    255, 255, 255, 255, 255, 252, 15, 255, 48, 15, 255, 255, 246, 15, 255, 255, 255, 255, 144, 15,
+    255, 255, 255, 255, 255, 252, 15, 255, 255, 255, 255, 255, 255, 255, 240, 15, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 48, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 15, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 15, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 246, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 15, 255, 255, 255, 255,
+    255, 255, 255, 240, 15, 255, 255, 255, 255, 255, 252, 15, 255, 255, 255, 255, 144, 15, 255, 255,
+    246, 15, 255, 48, 15, 255, 255, 255, 255, 255, 252, 2, 98, 50, 98, 50, 98, 114, 97, 66,
+    97, 66, 99, 98, 50, 98, 50, 98, 245, 38, 20, 38, 29, 38, 35, 38, 47, 82, 97, 66,
+    97, 210, 98, 50, 98, 245, 38, 20, 38, 16, 2, 34, 34, 33, 34, 34, 34, 33, 34, 34,
+    34, 33, 66, 34, 34, 18, 34, 34, 34, 20, 34, 34, 33, 34, 34, 34, 33, 66, 34, 34,
+    18, 34, 34, 34, 18, 34, 34, 34, 20, 34, 34, 33, 34, 34, 34, 33, 66, 34, 34, 18,
+    34, 34, 34, 20, 34, 34, 33, 34, 34, 34, 33, 34, 34, 34, 33, 66, 34, 34, 18, 34,
+    34, 34, 20, 34, 34, 33, 34, 34, 34, 33, 66, 34, 34, 18, 34, 34, 34, 18, 34, 34,
+    34, 18, 38, 37, 38, 37, 38, 41, 38, 22, 38, 22, 38, 31, 34, 98, 82, 98, 249, 38,
+    22, 38, 31, 34, 98, 82, 98, 249, 38, 22, 38, 31, 34, 98, 82, 98, 249, 38, 22, 38,
+    18, 15, 255, 48, 15, 255, 48, 15, 255, 255, 246, 15, 255, 255, 246, 15, 255, 255, 246, 8,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 143, 255, 255, 255, 255, 255, 252, 8, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 241, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 128, 15, 255, 255, 255, 255, 255, 255, 88, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 128, 15, 255, 255, 255, 255, 255, 252, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 15, 255, 255, 246, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 143, 24, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 128, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    143, 255, 255, 255, 255, 255, 255, 80, 15, 255, 255, 255, 255, 255, 255, 255, 0, 15, 29, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 241, 29, 18, 179, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 209, 29, 15, 29, 45, 33, 162, 33, 162, 33, 162, 33, 162, 33,
+    162, 33, 162, 33, 162, 33, 162, 33, 162, 33, 162, 45, 241, 15, 29, 45, 242, 210, 223, 45,
+    45, 242, 210, 223, 45, 241, 15, 18, 17, 33, 18, 18, 34, 17, 33, 18, 18, 34, 17, 33,
+    18, 18, 34, 17, 33, 18, 18, 34, 17, 33, 18, 18, 34, 17, 33, 18, 18, 34, 17, 33,
+    18, 18, 34, 17, 33, 18, 18, 34, 17, 33, 18, 18, 34, 17, 33, 18, 18, 34, 17, 33,
+    18, 18, 34, 17, 33, 18, 18, 34, 17, 33, 18, 18, 241, 15, 18, 17, 33, 18, 18, 34,
+    17, 33, 18, 18, 242, 33, 18, 17, 33, 34, 33, 18, 17, 33, 47, 34, 17, 33, 18, 18,
+    34, 17, 33, 18, 18, 242, 33, 18, 17, 33, 34, 33, 18, 17, 33, 47, 34, 17, 33, 18,
+    18, 241, 15, 17, 34, 34, 34, 34, 34, 34, 33, 50, 34, 34, 98, 34, 34, 49, 34, 34,
+    34, 34, 34, 34, 33, 50, 34, 34, 98, 34, 34, 49, 34, 34, 34, 34, 34, 34, 33, 50,
+    34, 34, 98, 34, 34, 49, 34, 34, 34, 241, 15, 18, 19, 34, 33, 33, 19, 34, 34, 51,
+    34, 34, 51, 34, 34, 66, 34, 34, 33, 33, 34, 34, 34, 66, 34, 34, 66, 34, 34, 66,
+    34, 34, 33, 33, 34, 34, 34, 66, 34, 34, 66, 34, 34, 66, 34, 34, 33, 241, 15, 17,
+    34, 49, 49, 33, 49, 49, 49, 50, 49, 49, 97, 49, 49, 65, 49, 49, 49, 33, 49, 49,
+    49, 65, 49, 49, 97, 49, 49, 65, 49, 49, 49, 33, 49, 49, 49, 65, 49, 49, 97, 49,
+    49, 65, 49, 49, 49, 241, 15, 255, 255, 250, 11, 130, 130, 130, 130, 130, 130, 130, 139, 15,
+    255, 255, 255, 240, 15, 29, 45, 45, 45, 45, 255, 16, 15, 255, 255, 255, 0, 8, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 88, 75, 60, 59, 60, 59, 60, 59, 59, 75,
+    49, 146, 49, 145, 49, 146, 49, 145, 49, 146, 59, 59, 247, 30, 44, 60, 74, 90, 104, 120,
+    134, 150, 164, 180, 194, 210, 224, 247, 30, 44, 17, 28, 18, 26, 19, 26, 20, 24, 21, 24,
+    22, 22, 23, 22, 24, 20, 25, 20, 26, 18, 27, 18, 224, 65, 146, 130, 116, 100, 86, 70,
+    56, 40, 26, 65, 146, 130, 113, 33, 97, 33, 81, 65, 65, 65, 49, 97, 33, 97, 26, 1,
+    227, 197, 167, 137, 107, 77, 47, 225, 195, 165, 135, 105, 75, 32, 1, 227, 193, 34, 161, 66,
+    129, 98, 97, 130, 65, 162, 33, 195, 178, 17, 146, 49, 114, 81, 82, 113, 50, 145, 18, 178,
+    1, 147, 117, 87, 57, 25, 23, 53, 83, 113, 1, 147, 113, 34, 81, 66, 49, 98, 17, 83,
+    17, 51, 49, 19, 83, 113, 2, 213, 168, 123, 78, 29, 27, 87, 132, 177, 2, 213, 161, 67,
+    113, 115, 65, 163, 17, 147, 18, 99, 81, 36, 132, 177, 15, 1, 225, 211, 195, 181, 165, 151,
+    135, 121, 105, 91, 75, 61, 45, 16, 15, 1, 28, 17, 27, 19, 26, 19, 25, 21, 24, 21,
+    23, 23, 22, 23, 21, 25, 20, 25, 19, 27, 18, 27, 17, 29, 45, 16, 10, 24, 40, 54,
+    70, 84, 100, 114, 130, 10, 17, 97, 34, 81, 49, 65, 65, 65, 81, 33, 97, 33, 114, 130,
+    253, 43, 73, 103, 133, 163, 193, 225, 227, 197, 167, 137, 107, 77, 32, 253, 43, 33, 25, 35,
+    23, 37, 21, 39, 19, 41, 17, 43, 17, 58, 19, 56, 21, 54, 23, 52, 25, 50, 27, 77,
+    32, 145, 115, 85, 55, 25, 25, 55, 85, 115, 145, 145, 115, 82, 33, 50, 65, 18, 97, 19,
+    81, 51, 49, 83, 17, 115, 145, 210, 165, 120, 75, 30, 45, 90, 135, 180, 225, 210, 165, 116,
+    49, 67, 113, 19, 161, 35, 145, 84, 81, 132, 33, 180, 225, 113, 211, 181, 151, 121, 91, 61,
+    31, 1, 226, 196, 166, 136, 106, 76, 32, 113, 211, 178, 33, 146, 65, 114, 97, 82, 129, 50,
+    161, 18, 193, 17, 178, 33, 146, 65, 114, 97, 82, 129, 50, 161, 18, 194, 113, 211, 178, 33,
+    146, 17, 33, 114, 19, 33, 82, 21, 33, 50, 23, 33, 18, 25, 33, 17, 40, 18, 33, 38,
+    18, 65, 36, 18, 97, 34, 18, 129, 50, 161, 18, 194, 85, 131, 51, 82, 114, 50, 37, 49,
+    33, 39, 36, 25, 34, 42, 18, 42, 18, 42, 18, 41, 33, 17, 40, 33, 17, 39, 33, 49,
+    51, 50, 66, 98, 103, 177, 226, 130, 113, 33, 97, 33, 81, 65, 65, 65, 50, 66, 33, 97,
+    18, 99, 131, 98, 17, 97, 34, 66, 49, 65, 66, 34, 81, 33, 100, 114, 130, 85, 131, 51,
+    82, 114, 50, 161, 33, 180, 194, 210, 210, 210, 209, 17, 193, 17, 177, 49, 146, 66, 98, 103,
+    177, 100, 129, 113, 82, 114, 65, 161, 255, 17, 210, 210, 210, 255, 241, 25, 36, 23, 40, 48,
+    85, 132, 35, 82, 33, 33, 18, 51, 33, 33, 19, 33, 17, 33, 33, 22, 17, 33, 33, 18,
+    18, 33, 33, 33, 18, 18, 33, 33, 33, 18, 18, 33, 33, 33, 18, 18, 33, 33, 33, 18,
+    17, 17, 17, 33, 33, 18, 17, 17, 17, 33, 33, 19, 50, 33, 33, 19, 66, 17, 33, 18,
+    103, 177, 85, 131, 51, 82, 114, 50, 161, 33, 82, 68, 53, 66, 65, 65, 50, 50, 65, 50,
+    50, 65, 50, 65, 50, 49, 17, 68, 65, 17, 177, 49, 146, 66, 98, 103, 177, 85, 137, 91,
+    61, 45, 31, 255, 255, 1, 210, 211, 181, 152, 80, 100, 133, 19, 86, 50, 55, 81, 39, 90,
+    105, 105, 105, 105, 97, 23, 97, 23, 81, 54, 66, 69, 50, 103, 100, 131, 36, 82, 69, 50,
+    86, 33, 105, 104, 120, 120, 120, 119, 17, 103, 17, 102, 49, 86, 66, 53, 103, 100, 131, 51,
+    82, 114, 50, 161, 33, 180, 194, 210, 223, 241, 30, 29, 60, 74, 103, 100, 137, 91, 61, 47,
+    255, 240, 210, 209, 17, 193, 17, 177, 49, 146, 66, 98, 103, 100, 131, 36, 82, 69, 50, 86,
+    33, 105, 104, 120, 120, 210, 209, 17, 193, 17, 177, 49, 146, 66, 98, 103, 100, 131, 36, 82,
+    69, 50, 86, 33, 105, 104, 120, 127, 247, 30, 29, 60, 74, 103, 83, 53, 38, 23, 31, 255,
+    33, 113, 114, 99, 84, 71, 16, 2, 84, 53, 38, 31, 255, 242, 21, 35, 15, 255, 244, 71,
+    102, 102, 103, 79, 255, 244, 15, 247, 89, 51, 54, 39, 36, 42, 19, 27, 34, 28, 31, 1,
+    240, 31, 1, 240, 18, 28, 18, 27, 20, 25, 37, 38, 39, 124, 31, 250, 15, 247, 89, 51,
+    54, 39, 36, 42, 19, 27, 34, 28, 31, 1, 17, 209, 16, 29, 31, 1, 33, 193, 33, 177,
+    65, 146, 82, 98, 119, 193, 255, 160, 83, 51, 66, 82, 97, 98, 97, 113, 2, 130, 130, 113,
+    129, 113, 114, 113, 113, 98, 97, 98, 97, 82, 52, 1, 113, 114, 113, 129, 130, 116, 113, 85,
+    131, 51, 82, 114, 50, 161, 33, 180, 194, 210, 209, 1, 210, 209, 17, 193, 17, 177, 49, 146,
+    66, 98, 103, 177, 254, 29, 44, 59, 74, 89, 104, 119, 134, 149, 164, 179, 194, 209, 224, 240,
+    30, 45, 60, 75, 90, 105, 120, 135, 150, 165, 180, 195, 210, 240, 15, 225, 210, 195, 180, 165,
+    150, 135, 120, 105, 90, 75, 60, 45, 16, 15, 1, 226, 211, 196, 181, 166, 151, 136, 121, 106,
+    91, 76, 61, 46, 16, 20, 17, 66, 66, 65, 20, 15, 119, 135, 135, 135, 135, 135, 135, 135,
+    135, 135, 135, 135, 135, 241, 15, 22, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+    248, 15, 253, 29, 44, 59, 74, 89, 104, 119, 134, 149, 164, 179, 207, 16, 15, 29, 44, 59,
+    74, 89, 104, 119, 134, 149, 164, 179, 194, 209, 253, 15, 22, 22, 38, 22, 38, 22, 38, 22,
+    38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 241, 247,
+    30, 44, 17, 28, 18, 26, 19, 26, 20, 24, 21, 24, 18, 34, 22, 18, 50, 22, 19, 35,
+    20, 25, 20, 26, 18, 27, 18, 224, 247, 30, 44, 60, 33, 26, 49, 26, 50, 24, 66, 24,
+    67, 22, 83, 22, 84, 20, 100, 20, 101, 18, 117, 18, 224, 247, 30, 44, 17, 28, 17, 42,
+    18, 42, 18, 56, 19, 56, 19, 70, 20, 70, 20, 84, 21, 84, 21, 98, 22, 98, 224, 104,
+    163, 99, 114, 162, 82, 194, 50, 226, 33, 241, 18, 31, 20, 242, 47, 50, 243, 47, 50, 243,
+    63, 33, 17, 241, 33, 47, 1, 49, 226, 65, 194, 98, 146, 131, 67, 198, 15, 22, 22, 38,
+    22, 38, 22, 38, 22, 38, 22, 38, 22, 150, 45, 45, 45, 45, 45, 45, 241, 15, 29, 45,
+    45, 45, 45, 45, 150, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 241, 15, 29,
+    45, 45, 45, 45, 45, 38, 150, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 241, 15,
+    22, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 22, 38, 157, 45, 45, 45, 45, 45, 241,
+    100, 131, 17, 19, 82, 49, 50, 50, 65, 81, 33, 81, 84, 81, 98, 97, 105, 98, 210, 209,
+    17, 193, 17, 177, 49, 146, 66, 98, 103, 100, 131, 51, 82, 114, 50, 161, 33, 180, 194, 217,
+    98, 97, 98, 97, 97, 17, 81, 97, 17, 81, 81, 49, 65, 66, 66, 33, 50, 103, 100, 131,
+    51, 82, 114, 50, 161, 33, 180, 194, 210, 105, 97, 98, 97, 97, 17, 81, 97, 17, 81, 81,
+    49, 65, 66, 66, 33, 50, 103, 100, 131, 17, 19, 82, 49, 50, 50, 65, 81, 33, 81, 84,
+    81, 98, 97, 98, 105, 210, 209, 17, 193, 17, 177, 49, 146, 66, 98, 103, 15, 27, 33, 26,
+    34, 25, 35, 24, 36, 23, 37, 22, 38, 21, 39, 20, 40, 19, 41, 18, 42, 17, 43, 60,
+    45, 16, 15, 1, 43, 18, 42, 19, 41, 20, 40, 21, 39, 22, 38, 23, 37, 24, 36, 25,
+    35, 26, 34, 27, 33, 28, 61, 46, 16, 240, 30, 45, 17, 28, 18, 27, 19, 26, 20, 25,
+    21, 24, 22, 23, 23, 22, 24, 21, 25, 20, 26, 19, 27, 18, 240, 14, 178, 178, 178, 178,
+    178, 178, 178, 178, 178, 178, 190, 15, 255, 255, 255, 255, 255, 64, 12, 146, 146, 146, 146, 146,
+    146, 146, 146, 156, 15, 255, 255, 255, 241, 254, 29, 44, 59, 33, 26, 34, 25, 35, 24, 36,
+    23, 37, 22, 38, 21, 39, 20, 40, 19, 41, 18, 42, 17, 224, 245, 29, 21, 19, 24, 21,
+    22, 24, 73, 100, 49, 97, 52, 105, 72, 18, 34, 21, 38, 35, 35, 20, 39, 29, 16, 119,
+    169, 138, 110, 78, 63, 17, 242, 248, 28, 135, 165, 195, 225, 241, 65, 33, 49, 177, 240, 31,
+    1, 240, 31, 1, 240, 30, 32, 246, 24, 30, 18, 18, 24, 31, 65, 147, 177, 33, 33, 97,
+    49, 97, 33, 49, 113, 17, 49, 65, 81, 17, 146, 50, 97, 33, 33, 17, 18, 33, 129, 65,
+    129, 65, 113, 97, 97, 118, 255, 255, 1, 161, 243, 31, 1, 177, 242, 31, 65, 113, 254, 45,
+    18, 18, 24, 19, 27, 19, 27, 18, 29, 32, 113, 240, 46, 46, 45, 71, 227, 198, 137, 106,
+    105, 136, 50, 56, 22, 23, 24, 16, 113, 240, 46, 45, 17, 29, 18, 23, 98, 99, 26, 21,
+    38, 40, 20, 25, 21, 25, 18, 34, 24, 17, 18, 17, 24, 36, 39, 24, 16, 113, 98, 82,
+    82, 82, 82, 82, 82, 98, 114, 114, 114, 17, 83, 98, 68, 15, 234, 33, 25, 34, 24, 35,
+    23, 36, 22, 37, 22, 22, 22, 37, 23, 36, 24, 35, 25, 33, 42, 74, 64, 98, 147, 35,
+    81, 129, 49, 161, 17, 194, 194, 82, 82, 68, 66, 68, 66, 194, 193, 17, 161, 33, 145, 66,
+    97, 118, 114, 169, 99, 84, 51, 130, 50, 162, 18, 178, 18, 178, 18, 178, 34, 162, 36, 99,
+    49, 34, 66, 18, 18, 49, 50, 52, 49, 65, 50, 17, 34, 66, 18, 51, 99, 20, 85, 18,
+    49, 65, 49, 18, 49, 50, 52, 49, 65, 49, 37, 69, 35, 130, 50, 162, 18, 178, 18, 178,
+    18, 178, 34, 162, 50, 115, 90, 134, 146, 146, 130, 130, 86, 71, 50, 82, 18, 98, 18, 113,
+    18, 113, 18, 98, 34, 67, 55, 85, 181, 194, 50, 177, 82, 146, 97, 161, 82, 65, 81, 82,
+    37, 21, 34, 34, 51, 52, 34, 82, 146, 82, 146, 82, 161, 81, 179, 19, 197, 163, 239, 6,
+    244, 53, 181, 37, 39, 37, 22, 39, 38, 18, 36, 33, 36, 34, 84, 17, 49, 20, 118, 19,
+    22, 100, 37, 21, 106, 22, 101, 35, 37, 103, 17, 23, 103, 55, 111, 32, 149, 213, 85, 98,
+    240, 34, 35, 211, 17, 20, 18, 20, 33, 21, 35, 18, 17, 98, 34, 18, 51, 18, 34, 20,
+    54, 33, 49, 33, 57, 19, 33, 17, 35, 23, 19, 36, 35, 23, 19, 36, 35, 23, 19, 17,
+    19, 35, 23, 20, 17, 68, 23, 21, 33, 21, 24, 240, 15, 236, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 240, 15, 236, 44, 40, 34, 40, 19, 39, 20, 38, 21, 38, 21, 37,
+    37, 34, 70, 36, 38, 36, 23, 44, 240, 15, 236, 33, 38, 33, 34, 36, 34, 35, 34, 35,
+    36, 68, 37, 37, 36, 68, 35, 34, 35, 34, 36, 34, 33, 38, 33, 44, 44, 240, 17, 81,
+    17, 66, 33, 49, 50, 17, 83, 82, 99, 66, 17, 65, 49, 34, 49, 33, 81, 251, 27, 23,
+    23, 20, 23, 22, 20, 18, 31, 244, 99, 20, 161, 19, 195, 225, 241, 113, 49, 177, 240, 31,
+    1, 240, 31, 1, 226, 246, 29, 30, 31, 1, 17, 193, 33, 194, 247, 225, 26, 17, 17, 226,
+    210, 24, 17, 17, 33, 23, 33, 18, 17, 113, 32, 244, 72, 50, 53, 38, 35, 26, 17, 28,
+    44, 44, 44, 44, 44, 44, 44, 44, 240, 244, 73, 102, 163, 193, 209, 255, 255, 255, 255, 96,
+    81, 33, 150, 134, 134, 148, 164, 84, 34, 35, 31, 81, 113, 97, 81, 81, 18, 66, 50, 19,
+    55, 29, 28, 16, 193, 84, 50, 84, 33, 106, 17, 38, 17, 34, 38, 44, 65, 39, 34, 15,
+    213, 148, 168, 101, 149, 150, 134, 128, 15, 247, 90, 70, 137, 88, 104, 104, 15, 12, 17, 117,
+    19, 40, 20, 69, 20, 24, 21, 38, 21, 23, 21, 144, 99, 113, 17, 113, 17, 98, 17, 66,
+    17, 17, 34, 17, 17, 17, 19, 17, 17, 17, 17, 49, 17, 17, 17, 113, 17, 130, 130, 130,
+    129, 25, 15, 12, 37, 113, 24, 20, 21, 68, 23, 21, 22, 37, 23, 21, 128, 11, 130, 130,
+    130, 130, 113, 17, 49, 17, 17, 19, 17, 17, 17, 49, 17, 17, 17, 66, 17, 17, 98, 17,
+    113, 17, 113, 17, 115, 114, 179, 35, 113, 129, 81, 145, 81, 145, 82, 114, 97, 18, 35, 81,
+    17, 18, 35, 33, 17, 18, 50, 33, 18, 18, 34, 18, 19, 18, 35, 17, 33, 19, 98, 18,
+    17, 99, 18, 38, 33, 18, 20, 17, 17, 50, 146, 129, 151, 55, 35, 35, 114, 178, 179, 162,
+    178, 163, 163, 163, 178, 130, 34, 70, 41, 100, 98, 147, 35, 81, 129, 49, 18, 66, 17, 17,
+    19, 68, 22, 43, 18, 31, 85, 37, 44, 36, 68, 17, 19, 67, 19, 17, 97, 21, 17, 65,
+    23, 96, 245, 36, 25, 22, 23, 23, 24, 22, 24, 17, 65, 23, 52, 52, 225, 19, 17, 18,
+    17, 18, 17, 19, 18, 33, 20, 21, 17, 33, 27, 62, 45, 73, 52, 64, 81, 115, 19, 35,
+    20, 18, 19, 21, 67, 18, 65, 33, 49, 55, 65, 33, 49, 70, 81, 17, 33, 100, 97, 17,
+    18, 100, 114, 17, 130, 81, 145, 17, 113, 33, 113, 33, 129, 17, 66, 49, 61, 81, 161, 161,
+    161, 161, 161, 147, 131, 65, 101, 69, 82, 67, 40, 20, 50, 114, 99, 99, 114, 130, 113, 17,
+    97, 129, 71, 82, 50, 82, 66, 66, 66, 66, 66, 66, 66, 66, 51, 71, 82, 99, 18, 34,
+    53, 18, 86, 116, 146, 148, 118, 82, 18, 18, 50, 34, 34, 49, 97, 69, 37, 65, 55, 49,
+    97, 97, 97, 97, 97, 97, 97, 97, 84, 164, 178, 194, 194, 194, 97, 82, 95, 21, 37, 37,
+    37, 22, 44, 44, 44, 43, 64, 98, 148, 19, 83, 163, 164, 163, 129, 35, 129, 35, 104, 115,
+    19, 113, 17, 19, 195, 195, 195, 198, 244, 60, 39, 50, 34, 50, 17, 18, 34, 17, 17, 51,
+    35, 65, 19, 35, 17, 33, 19, 35, 17, 33, 34, 34, 33, 34, 18, 34, 18, 17, 17, 33,
+    33, 33, 18, 18, 65, 18, 22, 74, 73, 17, 18, 16, 81, 146, 146, 89, 33, 17, 18, 17,
+    17, 18, 34, 34, 17, 17, 18, 17, 19, 37, 20, 35, 18, 19, 17, 35, 26, 33, 18, 17,
+    17, 82, 18, 81, 33, 17, 114, 114, 147, 19, 210, 210, 130, 34, 115, 35, 84, 35, 82, 18,
+    18, 164, 65, 69, 60, 19, 129, 34, 179, 193, 98, 152, 82, 33, 50, 50, 49, 66, 18, 65,
+    84, 65, 83, 82, 82, 67, 82, 66, 17, 66, 49, 17, 33, 51, 17, 33, 49, 18, 18, 49,
+    66, 35, 33, 50, 84, 19, 118, 98, 147, 35, 81, 129, 49, 161, 17, 19, 135, 120, 100, 34,
+    34, 36, 19, 49, 40, 105, 66, 28, 43, 88, 118, 15, 223, 255, 250, 253, 255, 251, 253, 6,
+    44, 38, 255, 255, 175, 223, 255, 191, 208, 15, 223, 255, 250, 98, 194, 111, 255, 191, 208, 6,
+    44, 38, 255, 255, 166, 44, 38, 255, 251, 253, 15, 223, 255, 250, 253, 255, 251, 98, 194, 96,
+    6, 44, 38, 255, 255, 175, 223, 255, 182, 44, 38, 15, 223, 255, 250, 98, 194, 111, 255, 182,
+    44, 38, 6, 44, 38, 255, 255, 166, 44, 38, 255, 251, 98, 194, 96, 114, 226, 161, 22, 17,
+    83, 34, 35, 83, 18, 19, 81, 38, 33, 65, 49, 33, 49, 38, 70, 19, 18, 33, 35, 49,
+    38, 33, 68, 18, 20, 82, 34, 34, 84, 18, 20, 132, 210, 87, 131, 67, 98, 146, 50, 177,
+    49, 209, 18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 240, 37, 85, 50, 51, 50, 65, 39,
+    18, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 35,
+    51, 35, 51, 51, 50, 240, 47, 2, 240, 47, 3, 18, 114, 20, 34, 67, 33, 34, 38, 50,
+    50, 146, 82, 114, 121, 87, 138, 109, 62, 63, 1, 67, 51, 131, 51, 255, 255, 240, 39, 39,
+    36, 51, 36, 101, 61, 91, 121, 245, 29, 21, 19, 24, 21, 22, 24, 73, 20, 20, 49, 20,
+    17, 52, 20, 25, 18, 39, 18, 34, 21, 38, 35, 35, 20, 39, 29, 16, 18, 132, 97, 33,
+    97, 33, 97, 17, 97, 33, 81, 33, 81, 33, 81, 33, 81, 33, 81, 33, 81, 17, 81, 17,
+    81, 17, 68, 99, 52, 65, 18, 65, 33, 65, 33, 81, 33, 81, 17, 97, 17, 97, 17, 97,
+    17, 97, 33, 97, 17, 113, 17, 113, 17, 116, 1, 99, 97, 18, 66, 38, 54, 34, 66, 17,
+    97, 17, 99, 100, 81, 34, 50, 53, 97, 129, 101, 97, 129, 67, 103, 51, 51, 18, 98, 18,
+    115, 132, 116, 117, 82, 35, 36, 54, 114, 146, 146, 119, 98, 146, 146, 66, 146, 146, 119, 98,
+    146, 147, 103, 50, 67, 18, 98, 18, 115, 132, 116, 117, 82, 36, 19, 70, 150, 195, 165, 67,
+    35, 18, 41, 34, 18, 67, 49, 18, 98, 82, 114, 65, 130, 65, 130, 66, 114, 66, 98, 99,
+    35, 134, 162, 162, 162, 37, 50, 18, 50, 34, 17, 82, 20, 82, 18, 114, 18, 114, 18, 98,
+    46, 162, 162, 162, 162, 18, 130, 117, 85, 98, 130, 130, 19, 71, 51, 50, 34, 81, 34, 82,
+    18, 81, 34, 66, 34, 65, 50, 65, 3, 50, 53, 50, 50, 33, 50, 49, 49, 50, 49, 49,
+    50, 49, 58, 49, 50, 49, 49, 50, 49, 49, 50, 49, 19, 50, 50, 84, 145, 33, 130, 33,
+    145, 33, 147, 82, 148, 132, 82, 34, 34, 20, 18, 20, 17, 17, 18, 34, 34, 34, 34, 34,
+    34, 34, 50, 18, 18, 86, 130, 162, 148, 146, 162, 5, 55, 17, 83, 98, 98, 89, 22, 33,
+    113, 113, 113, 113, 113, 119, 34, 130, 52, 100, 17, 50, 65, 51, 66, 34, 66, 81, 33, 83,
+    65, 33, 66, 100, 210, 226, 226, 226, 226, 226, 226, 226, 1, 196, 131, 34, 113, 66, 98, 82,
+    66, 118, 134, 114, 66, 82, 98, 66, 98, 66, 98, 66, 98, 82, 66, 104, 132, 238, 56, 98,
+    66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 98, 66, 63,
+    26, 32, 69, 116, 53, 18, 34, 114, 65, 113, 81, 114, 65, 130, 18, 36, 67, 34, 34, 129,
+    66, 113, 66, 113, 67, 98, 34, 28, 99, 129, 49, 97, 81, 81, 81, 81, 81, 81, 81, 49,
+    17, 81, 18, 19, 49, 33, 50, 49, 33, 65, 33, 49, 49, 49, 68, 49, 161, 193, 33, 131,
+    81, 65, 97, 35, 35, 83, 33, 17, 18, 83, 34, 34, 97, 50, 34, 18, 49, 50, 38, 33,
+    49, 51, 33, 33, 49, 50, 49, 33, 49, 50, 49, 33, 49, 50, 49, 33, 49, 50, 34, 33,
+    49, 50, 33, 49, 49, 50, 18, 49, 49, 50, 17, 65, 49, 51, 210, 196, 178, 34, 240, 16,
+    84, 131, 19, 114, 66, 97, 97, 82, 97, 97, 82, 98, 66, 53, 54, 253, 253, 81, 162, 35,
+    19, 97, 17, 18, 17, 17, 98, 50, 33, 98, 50, 33, 98, 49, 49, 98, 49, 49, 98, 49,
+    49, 98, 49, 49, 98, 49, 49, 98, 49, 49, 98, 49, 49, 98, 49, 50, 82, 49, 50, 82,
+    49, 66, 17, 212, 225, 119, 119, 179, 162, 17, 146, 33, 130, 49, 18, 66, 65, 19, 34, 81,
+    37, 163, 180, 146, 19, 114, 51, 82, 81, 97, 97, 114, 50, 130, 19, 145, 17, 18, 129, 17,
+    33, 131, 33, 130, 49, 130, 49, 20, 65, 49, 17, 49, 114, 65, 129, 65, 113, 21, 113, 34,
+    130, 163, 241, 49, 50, 34, 33, 49, 115, 35, 19, 31, 33, 50, 33, 75, 18, 34, 35, 34,
+    193, 2, 130, 18, 98, 49, 97, 66, 66, 81, 65, 98, 34, 98, 34, 74, 42, 66, 34, 97,
+    65, 97, 65, 82, 66, 50, 98, 33, 129, 97, 196, 178, 147, 17, 18, 66, 33, 33, 34, 18,
+    66, 65, 17, 82, 82, 82, 82, 82, 81, 17, 66, 65, 44, 49, 113, 81, 113, 81, 113, 89,
+    113, 134, 18, 81, 17, 17, 34, 50, 17, 33, 33, 21, 33, 18, 17, 17, 17, 17, 18, 20,
+    18, 51, 22, 52, 22, 66, 19, 18, 82, 34, 18, 81, 23, 81, 113, 104, 81, 113, 104, 3,
+    34, 38, 34, 35, 17, 18, 35, 49, 113, 65, 97, 72, 65, 97, 65, 97, 65, 97, 65, 97,
+    65, 97, 72, 49, 113, 47, 144, 66, 113, 17, 113, 17, 116, 82, 34, 66, 34, 65, 65, 66,
+    34, 84, 81, 49, 97, 33, 97, 33, 81, 65, 49, 97, 40, 225, 18, 113, 19, 129, 49, 97,
+    81, 65, 17, 81, 49, 129, 33, 129, 33, 129, 33, 50, 65, 18, 33, 81, 50, 97, 49, 113,
+    33, 145, 27, 81, 163, 147, 148, 114, 34, 97, 65, 97, 65, 97, 65, 102, 82, 66, 49, 129,
+    18, 129, 17, 162, 173, 97, 196, 178, 147, 17, 18, 66, 33, 33, 34, 29, 17, 26, 29, 18,
+    26, 17, 17, 24, 17, 44, 49, 113, 81, 23, 81, 23, 89, 113, 146, 18, 18, 98, 17, 34,
+    50, 17, 33, 33, 36, 33, 18, 17, 34, 17, 33, 18, 17, 17, 65, 17, 18, 17, 17, 65,
+    17, 20, 17, 65, 23, 104, 104, 81, 113, 104, 104, 104, 3, 34, 38, 34, 35, 25, 65, 97,
+    72, 72, 72, 72, 72, 72, 72, 72, 49, 113, 47, 144, 66, 115, 115, 116, 82, 34, 66, 34,
+    65, 65, 66, 34, 84, 100, 100, 100, 86, 56, 40, 225, 33, 130, 17, 133, 113, 20, 81, 22,
+    71, 17, 57, 57, 33, 19, 21, 18, 17, 22, 72, 72, 56, 17, 42, 81, 163, 147, 148, 118,
+    102, 102, 102, 102, 88, 58, 27, 31, 246, 242, 42, 41, 71, 101, 131, 147, 161, 255, 97, 81,
+    67, 33, 18, 39, 27, 32, 49, 97, 66, 18, 34, 18, 17, 65, 17, 82, 82, 82, 81, 98,
+    194, 194, 177, 33, 145, 65, 129, 81, 97, 113, 65, 145, 33, 161, 17, 193, 242, 41, 18, 23,
+    19, 22, 21, 21, 22, 19, 24, 17, 25, 18, 24, 18, 23, 20, 21, 22, 20, 23, 18, 24,
+    17, 26, 16, 98, 180, 150, 134, 134, 134, 148, 108, 44, 31, 209, 97, 83, 49, 18, 56, 29,
+    32, 242, 41, 17, 24, 19, 23, 20, 21, 22, 19, 23, 18, 25, 17, 26, 42, 36, 36, 35,
+    33, 18, 18, 49, 18, 39, 27, 32, 49, 97, 69, 37, 22, 47, 255, 242, 28, 58, 74, 88,
+    118, 148, 178, 193, 242, 41, 72, 71, 101, 131, 162, 162, 163, 132, 118, 103, 73, 42, 16, 98,
+    162, 33, 145, 65, 113, 81, 113, 81, 129, 65, 129, 49, 99, 17, 52, 17, 177, 17, 81, 98,
+    82, 82, 67, 65, 34, 17, 17, 18, 17, 81, 33, 49, 146, 245, 28, 26, 18, 26, 18, 18,
+    23, 18, 18, 23, 18, 18, 24, 17, 18, 25, 17, 18, 35, 52, 17, 17, 33, 22, 18, 18,
+    44, 58, 33, 39, 52, 128, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 79, 0, 65,
+    130, 116, 81, 19, 65, 49, 65, 49, 65, 129, 129, 129, 129, 129, 69, 69, 68, 49, 148, 103,
+    49, 51, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 81, 49, 85, 85, 85,
+    36, 100, 100, 74, 74, 65, 129, 65, 129, 74, 74, 65, 129, 65, 129, 65, 129, 65, 129, 65,
+    129, 65, 134, 89, 73, 99, 97, 81, 81, 81, 81, 81, 81, 85, 17, 51, 51, 51, 49, 17,
+    33, 35, 49, 33, 33, 39, 18, 18, 18, 20, 33, 33, 33, 65, 81, 81, 17, 51, 40, 17,
+    49, 17, 49, 17, 51, 35, 20, 18, 33, 17, 49, 17, 81, 240, 57, 26, 21, 20, 20, 51,
+    19, 33, 145, 35, 19, 37, 26, 26, 26, 26, 25, 55, 33, 32, 243, 58, 17, 27, 43, 23,
+    34, 35, 33, 33, 34, 50, 17, 49, 50, 38, 36, 22, 43, 44, 27, 17, 26, 17, 42, 16,
+    56, 97, 34, 33, 81, 50, 49, 65, 33, 33, 17, 98, 65, 33, 20, 99, 17, 33, 81, 50,
+    34, 81, 34, 17, 129, 19, 20, 21, 34, 50, 65, 49, 50, 49, 84, 20, 98, 180, 146, 34,
+    129, 51, 98, 51, 82, 19, 209, 49, 145, 50, 34, 65, 50, 19, 65, 67, 69, 35, 200, 37,
+    22, 21, 98, 180, 146, 34, 129, 51, 98, 51, 82, 19, 226, 17, 162, 18, 34, 66, 34, 19,
+    50, 67, 69, 35, 200, 37, 22, 21, 98, 180, 146, 34, 129, 51, 98, 51, 82, 19, 226, 17,
+    162, 18, 34, 51, 34, 19, 82, 35, 50, 19, 35, 81, 104, 37, 22, 21, 98, 180, 146, 34,
+    129, 51, 98, 51, 82, 50, 179, 33, 116, 34, 34, 18, 18, 34, 19, 22, 35, 98, 51, 98,
+    72, 37, 22, 21, 98, 180, 146, 34, 129, 51, 98, 51, 82, 20, 161, 81, 115, 50, 34, 81,
+    34, 19, 82, 35, 49, 50, 35, 67, 88, 37, 22, 21, 98, 180, 146, 34, 129, 51, 98, 51,
+    82, 35, 161, 81, 97, 18, 50, 34, 18, 33, 34, 19, 18, 33, 51, 65, 18, 51, 81, 104,
+    37, 22, 21, 98, 180, 146, 34, 129, 51, 98, 51, 82, 240, 66, 26, 18, 34, 36, 34, 33,
+    52, 20, 53, 36, 53, 22, 130, 81, 97, 80, 98, 180, 146, 34, 129, 51, 98, 51, 82, 246,
+    29, 34, 40, 33, 57, 59, 60, 130, 81, 97, 80, 70, 120, 99, 36, 68, 35, 113, 113, 34,
+    115, 20, 103, 17, 102, 131, 17, 20, 21, 38, 21, 53, 20, 84, 20, 83, 152, 82, 33, 50,
+    50, 49, 66, 19, 50, 40, 37, 20, 38, 35, 68, 66, 54, 51, 21, 24, 65, 66, 18, 49,
+    66, 35, 49, 35, 57, 118, 98, 147, 35, 66, 22, 17, 33, 54, 33, 17, 35, 35, 34, 50,
+    19, 50, 18, 98, 22, 67, 21, 101, 17, 81, 18, 18, 21, 20, 18, 40, 17, 33, 35, 19,
+    17, 49, 114, 87, 98, 147, 35, 66, 129, 33, 177, 17, 194, 20, 36, 18, 17, 50, 49, 19,
+    65, 85, 50, 49, 18, 17, 33, 33, 33, 18, 34, 66, 34, 177, 33, 161, 49, 114, 87, 49,
+    163, 147, 146, 162, 162, 180, 81, 33, 130, 22, 50, 22, 50, 98, 34, 98, 49, 81, 19, 23,
+    18, 68, 15, 242, 180, 180, 180, 180, 81, 84, 67, 68, 82, 68, 180, 180, 180, 191, 242, 15,
+    242, 180, 129, 36, 115, 20, 130, 20, 180, 180, 180, 33, 132, 19, 116, 34, 116, 191, 242, 15,
+    242, 180, 129, 36, 115, 20, 130, 20, 81, 84, 67, 68, 82, 68, 33, 132, 19, 116, 34, 116,
+    191, 242, 15, 242, 180, 33, 81, 36, 19, 51, 20, 34, 66, 20, 180, 180, 180, 33, 81, 36,
+    19, 51, 20, 34, 66, 20, 191, 242, 15, 242, 180, 33, 81, 36, 19, 51, 20, 34, 66, 20,
+    81, 84, 67, 68, 82, 68, 33, 81, 36, 19, 51, 20, 34, 66, 20, 191, 242, 15, 242, 180,
+    34, 66, 20, 19, 51, 20, 33, 81, 36, 33, 81, 36, 19, 51, 20, 34, 66, 20, 180, 34,
+    66, 20, 19, 51, 20, 33, 81, 47, 242, 98, 147, 35, 81, 129, 49, 161, 17, 194, 194, 145,
+    34, 131, 18, 146, 18, 194, 193, 17, 161, 34, 129, 81, 97, 118, 98, 147, 35, 81, 129, 49,
+    161, 17, 194, 194, 33, 97, 34, 18, 83, 18, 18, 98, 18, 194, 193, 17, 161, 34, 129, 81,
+    97, 118, 98, 152, 90, 60, 31, 248, 28, 60, 47, 240, 28, 43, 88, 118, 98, 152, 90, 60,
+    31, 241, 22, 21, 37, 52, 38, 47, 240, 28, 43, 88, 118, 15, 208, 6, 44, 38, 15, 223,
+    255, 191, 208, 6, 44, 38, 255, 251, 253, 15, 223, 255, 182, 44, 38, 6, 44, 38, 255, 251,
+    98, 194, 96, 3, 164, 129, 50, 97, 85, 17, 145, 17, 145, 17, 145, 17, 145, 20, 97, 17,
+    50, 65, 17, 84, 33, 177, 177, 177, 3, 164, 134, 107, 27, 27, 27, 27, 27, 17, 70, 17,
+    99, 33, 177, 177, 177, 245, 37, 37, 83, 83, 69, 66, 70, 65, 100, 82, 34, 34, 50, 38,
+    84, 23, 60, 75, 49, 41, 51, 54, 53, 52, 54, 53, 24, 16, 98, 178, 17, 161, 49, 145,
+    34, 148, 178, 152, 146, 194, 194, 194, 99, 50, 53, 66, 66, 19, 34, 34, 17, 56, 193, 163,
+    129, 33, 114, 49, 97, 81, 65, 113, 33, 146, 162, 148, 81, 18, 34, 17, 35, 67, 36, 36,
+    18, 131, 161, 65, 129, 129, 84, 65, 49, 86, 97, 34, 53, 34, 17, 97, 17, 116, 97, 18,
+    67, 98, 130, 248, 31, 2, 161, 50, 49, 78, 49, 17, 98, 81, 17, 97, 17, 65, 33, 65,
+    33, 49, 49, 65, 33, 49, 49, 65, 49, 33, 65, 33, 65, 17, 81, 33, 65, 17, 81, 33,
+    88, 39, 21, 69, 131, 167, 137, 106, 82, 54, 66, 85, 50, 100, 255, 186, 98, 34, 49, 98,
+    34, 49, 97, 50, 49, 97, 50, 49, 97, 50, 50, 82, 149, 98, 49, 97, 65, 97, 65, 117,
+    50, 50, 65, 18, 49, 35, 26, 70, 130, 177, 177, 177, 177, 98, 194, 130, 20, 18, 88, 82,
+    97, 51, 134, 50, 51, 18, 50, 50, 34, 50, 50, 19, 135, 100, 50, 66, 90, 66, 34, 34,
+    130, 81, 161, 17, 84, 17, 21, 20, 21, 81, 33, 129, 17, 161, 177, 177, 177, 177, 177, 177,
+    177, 177, 241, 57, 18, 23, 19, 20, 49, 18, 98, 17, 51, 34, 35, 17, 18, 49, 49, 19,
+    17, 20, 17, 17, 19, 18, 19, 34, 17, 51, 99, 68, 18, 24, 17, 26, 32, 242, 42, 41,
+    72, 68, 49, 17, 17, 129, 65, 34, 33, 83, 33, 99, 33, 99, 49, 84, 33, 49, 21, 35,
+    21, 17, 65, 23, 16, 18, 182, 167, 165, 251, 207, 246, 69, 99, 118, 48, 162, 118, 55, 69,
+    255, 92, 251, 75, 106, 122, 48, 248, 46, 45, 18, 28, 18, 27, 17, 33, 26, 17, 33, 25,
+    19, 18, 24, 18, 19, 23, 19, 20, 21, 26, 20, 26, 19, 21, 37, 18, 28, 17, 241, 243,
+    39, 23, 39, 38, 54, 71, 119, 54, 39, 39, 39, 24, 24, 16, 67, 50, 108, 51, 36, 35,
+    18, 68, 68, 50, 34, 51, 66, 34, 67, 50, 34, 67, 50, 34, 53, 52, 66, 19, 36, 35,
+    60, 98, 66, 130, 66, 130, 66, 108, 98, 66, 130, 66, 130, 66, 150, 240, 61, 86, 66, 49,
+    82, 146, 81, 36, 53, 86, 36, 101, 66, 49, 36, 147, 35, 50, 84, 34, 35, 33, 36, 34,
+    19, 35, 36, 65, 52, 37, 101, 39, 38, 40, 53, 41, 139, 96, 240, 94, 18, 63, 20, 240,
+    49, 18, 240, 33, 19, 51, 36, 33, 19, 52, 66, 66, 50, 34, 50, 66, 50, 34, 65, 65,
+    66, 34, 65, 66, 50, 34, 50, 66, 68, 66, 83, 36, 35, 124, 162, 66, 194, 243, 47, 23,
+    240, 47, 50, 243, 32, 150, 195, 180, 67, 50, 18, 41, 34, 19, 51, 49, 18, 98, 82, 114,
+    65, 130, 66, 114, 66, 114, 67, 82, 99, 36, 118, 178, 210, 210, 183, 162, 210, 210, 130, 117,
+    129, 19, 130, 17, 81, 33, 33, 84, 164, 129, 33, 69, 99, 19, 66, 81, 65, 98, 49, 98,
+    49, 98, 50, 82, 66, 50, 101, 228, 51, 53, 21, 35, 81, 17, 18, 17, 18, 18, 18, 36,
+    34, 68, 49, 133, 114, 50, 82, 82, 65, 98, 65, 113, 65, 98, 66, 81, 103, 131, 177, 193,
+    151, 145, 193, 50, 100, 70, 50, 17, 17, 97, 87, 39, 81, 100, 67, 19, 18, 81, 17, 99,
+    114, 100, 82, 18, 50, 53, 52, 183, 34, 97, 82, 20, 50, 97, 18, 18, 34, 104, 18, 97,
+    18, 34, 18, 82, 18, 18, 50, 50, 36, 85, 37, 55, 19, 53, 84, 84, 85, 51, 23, 53,
+    37, 55, 31, 255, 1, 115, 80, 35, 49, 49, 17, 82, 82, 81, 17, 49, 51, 37, 49, 19,
+    17, 17, 33, 17, 34, 33, 17, 34, 33, 17, 33, 17, 19, 17, 53, 34, 49, 35, 53, 17,
+    21, 18, 49, 19, 51, 69, 51, 69, 52, 34, 17, 18, 18, 36, 33, 35, 145, 35, 114, 69,
+    85, 18, 50, 50, 49, 18, 54, 68, 50, 49, 66, 18, 18, 66, 34, 51, 100, 51, 127, 9,
+    74, 68, 98, 128, 37, 69, 66, 18, 66, 18, 50, 35, 19, 50, 18, 84, 81, 34, 50, 34,
+    50, 50, 18, 69, 83, 67, 103, 51, 51, 18, 98, 18, 115, 132, 116, 117, 82, 35, 36, 54,
+    114, 146, 146, 146, 146, 146, 146, 51, 87, 49, 67, 130, 146, 130, 130, 130, 114, 100, 68, 98,
+    130, 130, 103, 82, 130, 130, 240, 40, 70, 49, 36, 51, 34, 53, 33, 53, 34, 36, 51, 34,
+    53, 87, 56, 41, 41, 39, 118, 41, 41, 32, 66, 146, 98, 18, 34, 52, 18, 85, 63, 115,
+    85, 65, 35, 33, 34, 37, 41, 41, 41, 39, 118, 41, 41, 32, 113, 225, 225, 225, 225, 225,
+    162, 82, 99, 51, 130, 18, 179, 101, 33, 37, 66, 50, 146, 18, 179, 209, 49, 113, 33, 65,
+    19, 51, 82, 99, 85, 49, 33, 65, 99, 69, 34, 50, 17, 66, 18, 50, 19, 18, 52, 82,
+    51, 67, 82, 83, 83, 83, 83, 98, 114, 114, 99, 82, 98, 71, 50, 98, 98, 56, 82, 130,
+    34, 179, 210, 211, 164, 20, 37, 18, 82, 99, 177, 50, 114, 103, 42, 66, 146, 17, 210, 211,
+    181, 133, 40, 50, 211, 164, 20, 37, 18, 82, 99, 177, 50, 114, 103, 56, 82, 130, 34, 39,
+    35, 27, 18, 41, 35, 66, 68, 20, 37, 18, 82, 99, 25, 17, 50, 114, 103, 42, 66, 65,
+    66, 17, 41, 34, 27, 19, 39, 37, 133, 40, 50, 211, 21, 23, 20, 37, 18, 82, 99, 25,
+    17, 50, 114, 103, 81, 147, 117, 84, 18, 65, 18, 33, 98, 147, 103, 50, 67, 18, 98, 18,
+    34, 51, 51, 36, 35, 36, 117, 82, 36, 19, 70, 50, 209, 33, 193, 33, 211, 240, 47, 2,
+    143, 34, 20, 39, 38, 32, 18, 193, 17, 193, 17, 116, 37, 36, 132, 167, 68, 84, 33, 33,
+    130, 19, 146, 84, 66, 97, 45, 18, 56, 129, 210, 211, 193, 33, 210, 4, 180, 134, 17, 67,
+    33, 19, 20, 50, 83, 35, 68, 34, 33, 49, 51, 18, 39, 99, 19, 17, 145, 34, 85, 130,
+    82, 81, 130, 49, 67, 17, 18, 33, 68, 49, 17, 66, 114, 66, 114, 50, 130, 50, 130, 50,
+    130, 50, 113, 33, 18, 17, 97, 65, 18, 81, 81, 113, 119, 85, 130, 82, 81, 50, 50, 49,
+    67, 50, 33, 67, 65, 17, 113, 82, 97, 98, 83, 82, 34, 19, 17, 50, 20, 52, 18, 35,
+    51, 17, 33, 177, 49, 145, 81, 113, 119, 81, 227, 210, 212, 81, 83, 113, 83, 110, 17, 83,
+    82, 83, 180, 178, 210, 194, 209, 15, 41, 50, 22, 33, 35, 114, 36, 68, 36, 83, 34, 34,
+    18, 18, 33, 39, 91, 240, 17, 51, 17, 34, 18, 34, 17, 17, 18, 35, 17, 18, 17, 17,
+    20, 19, 17, 22, 34, 18, 34, 33, 33, 17, 17, 33, 17, 33, 17, 17, 65, 37, 161, 226,
+    181, 146, 19, 145, 35, 17, 113, 50, 52, 49, 35, 81, 17, 33, 18, 18, 65, 17, 18, 19,
+    97, 17, 34, 17, 113, 17, 29, 17, 17, 193, 20, 113, 18, 17, 98, 18, 17, 81, 17, 33,
+    17, 67, 49, 17, 65, 17, 49, 17, 65, 17, 49, 17, 65, 17, 50, 81, 17, 34, 97, 18,
+    33, 98, 49, 132, 25, 82, 129, 65, 27, 35, 113, 45, 18, 17, 17, 114, 73, 162, 100, 17,
+    81, 18, 33, 65, 33, 18, 65, 33, 34, 49, 33, 33, 17, 33, 33, 33, 17, 33, 33, 33,
+    17, 51, 33, 17, 66, 18, 17, 81, 18, 17, 113, 33, 146, 99, 86, 50, 49, 98, 34, 17,
+    81, 34, 19, 107, 98, 102, 55, 91, 54, 82, 22, 21, 27, 162, 145, 130, 114, 114, 114, 130,
+    114, 66, 18, 84, 100, 114, 162, 132, 116, 116, 131, 66, 35, 67, 20, 71, 101, 116, 132, 2,
+    113, 19, 83, 19, 51, 51, 19, 85, 115, 117, 83, 19, 51, 51, 19, 85, 114, 33, 179, 82,
+    37, 52, 22, 22, 27, 57, 87, 103, 89, 59, 22, 22, 20, 52, 50, 82, 162, 50, 67, 51,
+    35, 82, 19, 101, 132, 131, 132, 118, 99, 18, 83, 35, 51, 66, 51, 131, 161, 177, 65, 99,
+    35, 68, 35, 52, 52, 20, 87, 102, 132, 134, 104, 89, 52, 21, 51, 52, 51, 66, 81, 70,
+    145, 65, 145, 18, 17, 145, 18, 17, 145, 18, 17, 85, 18, 38, 82, 98, 27, 18, 27, 18,
+    82, 102, 18, 37, 65, 18, 17, 145, 18, 17, 145, 65, 150, 84, 180, 180, 180, 180, 180, 111,
+    255, 240, 84, 180, 180, 180, 180, 99, 195, 195, 195, 195, 195, 195, 102, 60, 54, 99, 195, 195,
+    195, 195, 195, 84, 180, 180, 180, 180, 180, 101, 75, 75, 75, 70, 84, 180, 180, 180, 180, 67,
+    115, 115, 115, 63, 240, 67, 115, 115, 115, 115, 115, 115, 115, 51, 129, 33, 113, 34, 52, 35,
+    33, 129, 17, 134, 41, 37, 49, 34, 97, 34, 97, 34, 97, 34, 97, 34, 101, 116, 53, 97,
+    49, 99, 17, 54, 21, 50, 66, 23, 18, 23, 18, 50, 65, 21, 19, 67, 17, 99, 17, 99,
+    17, 99, 17, 97, 49, 101, 43, 103, 148, 82, 83, 82, 82, 99, 81, 85, 65, 63, 146, 18,
+    117, 20, 70, 21, 53, 38, 37, 53, 21, 88, 144, 97, 193, 177, 17, 146, 17, 93, 17, 17,
+    65, 33, 33, 17, 82, 65, 113, 66, 82, 49, 17, 81, 17, 28, 81, 34, 145, 17, 162, 193,
+    98, 211, 195, 195, 194, 225, 116, 49, 51, 31, 82, 18, 87, 30, 29, 60, 60, 60, 48, 99,
+    180, 181, 179, 209, 225, 116, 49, 63, 130, 35, 65, 36, 19, 56, 29, 59, 90, 91, 48, 99,
+    181, 165, 165, 164, 115, 34, 51, 21, 33, 47, 177, 17, 97, 66, 18, 71, 59, 90, 90, 91,
+    48, 98, 211, 181, 151, 149, 115, 33, 35, 51, 49, 36, 31, 67, 19, 66, 50, 18, 52, 33,
+    17, 17, 17, 23, 105, 107, 60, 48, 247, 30, 30, 29, 59, 89, 118, 179, 17, 145, 22, 91,
+    60, 46, 30, 16, 247, 30, 30, 29, 17, 27, 33, 41, 35, 38, 39, 35, 17, 37, 33, 22,
+    19, 27, 17, 28, 46, 30, 16, 129, 226, 225, 17, 193, 33, 193, 49, 117, 53, 18, 209, 18,
+    177, 65, 145, 82, 98, 113, 113, 113, 113, 97, 51, 33, 97, 34, 18, 17, 99, 82, 85, 132,
+    20, 85, 21, 53, 38, 37, 53, 17, 211, 181, 152, 89, 105, 115, 35, 35, 35, 49, 37, 18,
+    89, 119, 249, 31, 1, 226, 227, 193, 33, 117, 70, 50, 99, 97, 113, 113, 82, 145, 81, 146,
+    35, 133, 18, 130, 82, 97, 129, 129, 226, 225, 17, 193, 33, 193, 49, 125, 18, 69, 65, 18,
+    38, 49, 65, 23, 17, 90, 113, 21, 17, 113, 34, 49, 97, 51, 33, 97, 34, 18, 17, 99,
+    82, 249, 31, 1, 226, 225, 17, 193, 18, 118, 17, 22, 49, 23, 17, 97, 20, 33, 129, 21,
+    147, 17, 17, 129, 34, 18, 129, 17, 35, 130, 82, 97, 129, 249, 31, 1, 226, 225, 17, 209,
+    17, 118, 39, 49, 65, 50, 98, 18, 34, 129, 65, 161, 33, 33, 145, 19, 17, 131, 50, 130,
+    82, 97, 129, 249, 31, 1, 226, 227, 193, 18, 118, 24, 49, 20, 35, 97, 53, 132, 17, 162,
+    18, 17, 145, 21, 129, 17, 50, 130, 82, 97, 129, 114, 227, 193, 18, 193, 18, 193, 34, 101,
+    85, 34, 131, 81, 83, 113, 82, 129, 82, 129, 19, 34, 97, 19, 17, 18, 100, 51, 113, 129,
+    99, 179, 179, 98, 51, 49, 36, 19, 31, 50, 181, 118, 147, 209, 209, 50, 50, 54, 59, 59,
+    48, 99, 179, 179, 97, 67, 49, 35, 35, 35, 29, 51, 51, 97, 65, 130, 50, 84, 52, 36,
+    19, 20, 18, 51, 50, 99, 179, 179, 113, 225, 145, 65, 146, 49, 49, 98, 33, 33, 130, 17,
+    17, 164, 111, 6, 59, 17, 57, 18, 17, 39, 19, 18, 37, 20, 19, 41, 30, 16, 246, 31,
+    1, 145, 65, 49, 98, 33, 33, 134, 164, 124, 116, 65, 101, 145, 33, 18, 113, 49, 33, 97,
+    65, 49, 145, 113, 225, 210, 65, 82, 19, 18, 99, 19, 17, 97, 17, 17, 33, 114, 18, 19,
+    57, 50, 50, 39, 99, 17, 17, 114, 17, 33, 17, 100, 20, 81, 49, 17, 33, 161, 225, 244,
+    28, 28, 22, 21, 20, 18, 49, 33, 53, 119, 87, 102, 147, 34, 35, 39, 28, 28, 28, 16,
+    247, 30, 26, 19, 19, 22, 33, 33, 40, 121, 86, 212, 151, 105, 65, 39, 34, 18, 37, 20,
+    19, 26, 30, 16, 113, 225, 210, 65, 67, 19, 18, 105, 105, 90, 62, 44, 88, 121, 105, 82,
+    35, 34, 145, 225, 247, 27, 18, 18, 24, 117, 145, 36, 181, 147, 227, 181, 149, 179, 18, 120,
+    65, 39, 19, 18, 27, 16, 113, 177, 33, 18, 97, 33, 17, 17, 114, 17, 19, 17, 102, 17,
+    89, 19, 73, 63, 4, 118, 179, 18, 17, 82, 20, 17, 17, 85, 18, 17, 17, 17, 38, 33,
+    17, 28, 16, 82, 179, 163, 82, 51, 38, 49, 40, 33, 36, 27, 99, 149, 68, 33, 25, 33,
+    39, 34, 51, 83, 163, 163, 82, 179, 163, 82, 51, 38, 49, 40, 33, 36, 27, 81, 33, 146,
+    18, 68, 33, 25, 33, 39, 34, 51, 83, 163, 163, 82, 164, 149, 67, 20, 24, 19, 25, 17,
+    26, 23, 83, 107, 21, 17, 25, 18, 25, 19, 20, 17, 36, 34, 84, 163, 82, 162, 17, 145,
+    49, 67, 17, 33, 24, 17, 17, 25, 17, 31, 53, 54, 177, 19, 17, 17, 19, 34, 17, 67,
+    33, 33, 49, 65, 18, 67, 21, 74, 48, 99, 181, 165, 99, 24, 37, 69, 20, 105, 116, 19,
+    115, 50, 114, 67, 82, 84, 52, 75, 69, 21, 83, 51, 99, 177, 49, 161, 49, 99, 17, 52,
+    34, 39, 33, 17, 54, 66, 55, 34, 17, 39, 18, 59, 66, 21, 17, 81, 51, 49, 65, 50,
+    65, 66, 33, 17, 34, 83, 51, 99, 177, 33, 132, 17, 20, 49, 17, 17, 17, 17, 18, 49,
+    19, 18, 17, 17, 65, 37, 18, 34, 19, 51, 23, 68, 18, 65, 49, 65, 22, 22, 49, 17,
+    19, 17, 17, 49, 17, 17, 22, 65, 33, 17, 17, 33, 83, 17, 19, 147, 85, 132, 20, 84,
+    37, 50, 33, 49, 34, 34, 37, 34, 19, 18, 57, 17, 81, 20, 34, 81, 51, 33, 81, 39,
+    88, 34, 18, 34, 34, 51, 50, 33, 19, 35, 17, 69, 20, 119, 82, 164, 145, 19, 67, 17,
+    18, 24, 19, 17, 34, 34, 17, 17, 31, 21, 54, 177, 49, 17, 17, 19, 49, 17, 17, 65,
+    33, 33, 17, 17, 65, 18, 33, 19, 21, 33, 26, 48, 97, 193, 165, 97, 35, 17, 51, 49,
+    33, 18, 19, 33, 34, 37, 22, 99, 97, 37, 33, 35, 33, 19, 35, 49, 35, 17, 17, 49,
+    33, 33, 69, 129, 17, 193, 97, 193, 145, 33, 33, 103, 50, 17, 18, 33, 18, 19, 33, 34,
+    67, 21, 34, 51, 50, 18, 21, 18, 50, 33, 19, 36, 33, 35, 17, 37, 17, 33, 50, 17,
+    18, 145, 193, 113, 181, 98, 21, 18, 50, 49, 50, 35, 49, 51, 20, 33, 36, 18, 18, 20,
+    18, 99, 65, 17, 53, 39, 33, 21, 19, 49, 50, 35, 49, 49, 17, 34, 20, 33, 117, 145,
+    17, 82, 179, 148, 83, 35, 38, 49, 40, 33, 41, 22, 99, 149, 68, 33, 24, 49, 39, 49,
+    51, 83, 148, 163, 113, 210, 145, 50, 146, 34, 49, 98, 33, 33, 130, 17, 17, 161, 17, 117,
+    19, 26, 19, 21, 81, 34, 145, 33, 18, 113, 34, 34, 81, 50, 50, 130, 225, 113, 211, 129,
+    51, 130, 35, 33, 98, 18, 33, 129, 33, 131, 35, 35, 20, 30, 20, 21, 33, 51, 49, 97,
+    66, 113, 35, 18, 81, 51, 34, 131, 195, 113, 210, 146, 49, 50, 66, 49, 35, 82, 33, 34,
+    114, 49, 193, 117, 19, 23, 67, 51, 81, 49, 145, 33, 18, 99, 33, 35, 66, 49, 50, 130,
+    210, 113, 211, 130, 34, 50, 67, 18, 35, 67, 33, 19, 114, 17, 18, 81, 52, 65, 31, 66,
+    50, 68, 33, 56, 49, 17, 53, 50, 18, 52, 34, 35, 40, 60, 32, 85, 146, 83, 81, 146,
+    49, 178, 17, 209, 17, 211, 211, 211, 211, 211, 209, 33, 178, 49, 146, 81, 114, 120, 15, 1,
+    29, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 243, 31, 0, 31, 242, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 223, 32, 15, 1, 29, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 243, 31, 0, 31, 242, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 223, 32, 97, 195, 165, 150, 148, 114, 34, 34, 52, 68, 22, 44, 37, 36,
+    18, 20, 50, 20, 18, 102, 133, 163, 193, 15, 80, 15, 255, 240, 15, 255, 255, 255, 255, 80,
+    17, 33, 18, 28, 15, 18, 18, 34, 16, 17, 50, 33, 49, 34, 34, 35, 23, 23, 23, 20,
+    15, 242, 33, 50, 18, 49, 33, 50, 129, 177, 120, 26, 37, 33, 54, 33, 54, 33, 54, 33,
+    69, 33, 72, 102, 177, 177, 84, 33, 69, 33, 67, 50, 66, 65, 98, 19, 115, 37, 40, 31,
+    49, 115, 85, 55, 31, 33, 101, 69, 54, 69, 68, 34, 50, 52, 20, 26, 26, 41, 69, 115,
+    145, 246, 24, 86, 85, 102, 86, 64, 35, 68, 54, 22, 23, 22, 31, 240, 29, 59, 88, 149,
+    179, 209, 50, 133, 118, 88, 72, 88, 73, 88, 56, 56, 57, 56, 86, 102, 116, 49, 34, 50,
+    18, 18, 33, 35, 81, 17, 51, 82, 33, 129, 18, 88, 89, 73, 73, 72, 86, 132, 33, 115,
+    33, 147, 1, 210, 36, 103, 67, 37, 51, 22, 34, 55, 20, 24, 115, 83, 67, 83, 99, 83,
+    84, 84, 84, 84, 84, 84, 84, 99, 99, 115, 115, 115, 146, 19, 130, 130, 115, 115, 99, 100,
+    84, 84, 84, 84, 84, 83, 84, 83, 83, 83, 66, 51, 36, 35, 36, 35, 51, 36, 36, 36,
+    36, 36, 51, 51, 52, 51, 51, 67, 51, 19, 52, 51, 51, 52, 51, 51, 51, 51, 51, 51,
+    51, 36, 36, 35, 36, 35, 36, 83, 67, 83, 67, 83, 67, 83, 67, 83, 67, 98, 99, 98,
+    99, 98, 99, 98, 99, 98, 99, 3, 82, 83, 67, 83, 67, 83, 67, 83, 67, 67, 67, 51,
+    67, 51, 67, 51, 67, 51, 67, 100, 101, 100, 100, 101, 100, 100, 101, 100, 100, 117, 116, 132,
+    117, 116, 132, 117, 116, 117, 116, 20, 117, 116, 117, 117, 116, 117, 116, 132, 117, 100, 116, 100,
+    101, 100, 100, 101, 100, 100, 101, 85, 69, 85, 69, 85, 69, 85, 69, 85, 69, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 5, 84, 85, 84, 85, 84, 85, 84, 85, 84, 69, 69, 53,
+    69, 53, 69, 53, 69, 53, 69, 33, 34, 18, 33, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 50, 50, 49, 2, 50, 50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 18, 18, 70, 67, 115, 115, 115, 115, 100, 100, 54, 70, 116, 100, 115, 115,
+    115, 115, 115, 118, 5, 100, 99, 99, 99, 99, 99, 100, 101, 69, 52, 83, 99, 99, 99, 99,
+    84, 53, 100, 152, 106, 68, 53, 36, 70, 22, 38, 22, 45, 38, 22, 38, 22, 38, 22, 38,
+    20, 99, 60, 74, 118, 100, 152, 106, 67, 84, 36, 33, 52, 24, 36, 24, 45, 36, 23, 37,
+    21, 54, 20, 55, 20, 99, 60, 74, 118, 100, 152, 106, 68, 83, 37, 33, 51, 25, 35, 25,
+    42, 68, 25, 20, 25, 20, 25, 20, 20, 99, 53, 37, 74, 118, 100, 152, 106, 70, 36, 38,
+    53, 21, 69, 21, 17, 42, 33, 37, 19, 34, 37, 19, 116, 23, 37, 23, 36, 60, 74, 118,
+    100, 152, 106, 68, 83, 37, 84, 21, 24, 21, 75, 84, 25, 35, 25, 35, 25, 35, 20, 99,
+    53, 22, 74, 118, 99, 153, 91, 53, 68, 36, 34, 20, 20, 45, 90, 105, 51, 24, 51, 20,
+    19, 51, 19, 36, 84, 53, 21, 89, 119, 100, 152, 106, 67, 114, 36, 100, 24, 36, 24, 29,
+    37, 23, 37, 22, 38, 22, 38, 21, 38, 60, 74, 118, 100, 152, 106, 68, 68, 36, 49, 36,
+    20, 35, 35, 20, 50, 26, 69, 20, 34, 36, 19, 51, 35, 19, 51, 35, 20, 99, 53, 37,
+    74, 118, 99, 153, 91, 53, 53, 36, 17, 52, 20, 19, 56, 19, 56, 18, 73, 109, 36, 24,
+    35, 36, 84, 52, 37, 89, 119, 100, 152, 106, 67, 24, 34, 51, 66, 20, 19, 18, 18, 20,
+    19, 18, 38, 18, 34, 33, 20, 18, 34, 33, 20, 19, 18, 33, 18, 81, 66, 18, 81, 65,
+    60, 74, 118, 115, 179, 51, 113, 130, 81, 36, 66, 49, 50, 17, 82, 33, 97, 97, 17, 113,
+    97, 17, 113, 114, 113, 114, 113, 114, 113, 97, 33, 97, 97, 33, 97, 97, 49, 39, 33, 66,
+    23, 17, 114, 82, 150, 115, 179, 51, 113, 130, 81, 38, 34, 49, 49, 66, 34, 33, 130, 49,
+    17, 146, 49, 17, 146, 66, 130, 82, 114, 98, 98, 97, 33, 66, 113, 33, 50, 129, 49, 39,
+    33, 66, 23, 17, 114, 82, 150, 115, 179, 51, 113, 130, 81, 38, 34, 49, 130, 34, 33, 145,
+    49, 17, 161, 49, 17, 130, 82, 100, 82, 146, 66, 161, 49, 33, 145, 49, 33, 130, 49, 49,
+    39, 33, 66, 36, 49, 114, 82, 150, 115, 179, 51, 113, 130, 81, 83, 34, 49, 99, 50, 33,
+    81, 18, 65, 17, 82, 18, 65, 17, 81, 34, 82, 65, 50, 82, 50, 50, 82, 56, 49, 33,
+    40, 49, 33, 114, 65, 49, 98, 49, 66, 82, 33, 114, 82, 150, 115, 179, 51, 113, 130, 81,
+    38, 34, 49, 50, 114, 33, 50, 129, 17, 66, 129, 17, 70, 82, 65, 51, 66, 146, 66, 161,
+    49, 33, 145, 49, 33, 130, 49, 49, 38, 49, 66, 36, 49, 114, 82, 150, 115, 179, 51, 113,
+    130, 81, 53, 34, 49, 50, 114, 33, 49, 145, 17, 50, 145, 17, 55, 82, 51, 50, 66, 50,
+    66, 66, 50, 81, 49, 33, 34, 81, 49, 33, 49, 66, 49, 49, 38, 49, 66, 51, 49, 114,
+    82, 150, 115, 179, 51, 113, 130, 81, 39, 18, 49, 130, 34, 33, 129, 65, 17, 130, 65, 17,
+    130, 82, 129, 98, 114, 98, 113, 97, 33, 82, 97, 33, 82, 97, 49, 65, 97, 66, 34, 81,
+    114, 82, 150, 115, 179, 51, 113, 130, 81, 53, 34, 49, 50, 50, 34, 33, 49, 81, 49, 17,
+    65, 66, 49, 17, 66, 49, 82, 85, 82, 66, 50, 66, 50, 81, 49, 33, 34, 81, 49, 33,
+    49, 66, 49, 49, 35, 19, 33, 66, 51, 49, 114, 82, 150, 115, 179, 51, 113, 130, 81, 53,
+    34, 49, 50, 50, 34, 33, 49, 81, 49, 17, 65, 81, 49, 17, 65, 82, 50, 66, 51, 50,
+    87, 50, 98, 33, 49, 33, 145, 49, 33, 130, 49, 49, 38, 49, 66, 35, 65, 114, 82, 150,
+    115, 179, 51, 113, 130, 81, 19, 38, 49, 33, 17, 33, 33, 18, 33, 65, 18, 34, 17, 17,
+    81, 17, 50, 17, 17, 81, 17, 65, 34, 81, 17, 65, 34, 81, 17, 65, 34, 81, 17, 65,
+    17, 33, 65, 17, 50, 17, 33, 65, 18, 33, 33, 49, 20, 20, 17, 70, 34, 17, 114, 82,
+    150, 115, 185, 123, 83, 70, 52, 33, 23, 39, 23, 24, 23, 24, 31, 17, 241, 31, 17, 114,
+    113, 114, 113, 115, 55, 52, 55, 39, 153, 96, 115, 185, 123, 83, 100, 52, 20, 36, 41, 36,
+    26, 36, 26, 46, 46, 46, 39, 37, 40, 36, 41, 51, 115, 67, 114, 121, 150, 115, 185, 123,
+    83, 100, 57, 36, 42, 20, 27, 20, 25, 45, 79, 18, 241, 20, 42, 20, 41, 36, 51, 115,
+    68, 68, 121, 150, 115, 185, 123, 86, 52, 55, 53, 38, 17, 37, 22, 33, 37, 22, 18, 43,
+    19, 42, 35, 42, 132, 35, 132, 40, 37, 55, 36, 71, 35, 121, 150, 115, 185, 123, 83, 100,
+    52, 41, 36, 41, 21, 41, 21, 107, 19, 63, 2, 241, 20, 42, 20, 41, 36, 51, 100, 68,
+    68, 121, 150, 115, 185, 123, 84, 84, 52, 41, 36, 26, 20, 42, 20, 17, 90, 51, 41, 36,
+    41, 37, 20, 35, 37, 20, 36, 20, 36, 51, 100, 69, 52, 121, 150, 115, 185, 123, 83, 115,
+    57, 36, 41, 21, 25, 37, 25, 47, 1, 240, 47, 1, 114, 98, 114, 98, 115, 81, 116, 66,
+    103, 153, 96, 115, 185, 123, 84, 84, 52, 35, 36, 36, 21, 20, 21, 20, 36, 21, 35, 28,
+    91, 35, 41, 37, 20, 35, 37, 20, 36, 20, 36, 51, 49, 51, 69, 52, 121, 150, 115, 185,
+    123, 84, 84, 52, 35, 36, 36, 21, 20, 21, 21, 20, 21, 21, 41, 35, 58, 123, 34, 20,
+    42, 20, 41, 36, 51, 100, 68, 53, 121, 150, 115, 185, 123, 81, 52, 50, 50, 17, 19, 19,
+    18, 36, 19, 19, 18, 21, 18, 35, 33, 21, 18, 35, 39, 18, 35, 39, 18, 35, 39, 18,
+    35, 33, 36, 19, 19, 18, 36, 19, 19, 18, 50, 65, 33, 33, 66, 66, 49, 121, 150, 116,
+    196, 196, 196, 31, 235, 59, 59, 59, 48, 18, 163, 163, 163, 162, 178, 49, 114, 18, 132, 132,
+    117, 148, 250, 30, 45, 50, 225, 130, 75, 60, 29, 16, 87, 116, 147, 132, 114, 33, 83, 49,
+    67, 131, 131, 146, 246, 46, 53, 232, 89, 60, 16, 131, 180, 180, 191, 242, 163, 163, 163, 178,
+    161, 226, 211, 196, 31, 10, 75, 60, 45, 16, 161, 226, 211, 196, 31, 235, 60, 45, 16, 161,
+    226, 211, 33, 20, 23, 17, 20, 25, 20, 23, 17, 20, 22, 194, 209, 161, 225, 65, 20, 21,
+    49, 20, 22, 33, 20, 23, 17, 20, 23, 17, 20, 21, 49, 20, 21, 209, 161, 226, 61, 46,
+    31, 225, 220, 45, 16, 1, 227, 197, 162, 35, 130, 67, 87, 101, 131, 161, 1, 227, 197, 167,
+    137, 81, 66, 97, 35, 116, 145, 1, 226, 196, 181, 151, 136, 121, 73, 87, 102, 132, 147, 161,
+    161, 65, 146, 61, 46, 31, 226, 204, 45, 16, 161, 226, 91, 61, 31, 225, 210, 25, 45, 16,
+    49, 97, 98, 82, 38, 22, 31, 81, 100, 37, 22, 16, 249, 21, 180, 195, 225, 210, 189, 16,
+    115, 177, 18, 56, 34, 33, 162, 17, 179, 171, 35, 129, 19, 148, 163, 115, 178, 17, 57, 33,
+    34, 161, 18, 179, 186, 49, 130, 33, 146, 17, 163, 209, 226, 209, 33, 72, 49, 49, 193, 17,
+    194, 17, 189, 20, 30, 149, 180, 194, 114, 228, 197, 78, 41, 36, 33, 179, 17, 194, 33, 193,
+    49, 161, 88, 33, 210, 240, 16, 83, 70, 33, 49, 129, 33, 145, 17, 147, 132, 122, 20, 26,
+    131, 146, 99, 58, 38, 20, 22, 37, 132, 147, 145, 17, 129, 33, 113, 69, 17, 161, 131, 73,
+    33, 65, 161, 49, 177, 49, 162, 17, 163, 17, 147, 25, 19, 179, 194, 146, 88, 18, 57, 34,
+    49, 162, 33, 178, 17, 177, 33, 161, 49, 145, 87, 17, 209, 67, 103, 53, 19, 147, 146, 161,
+    161, 146, 137, 20, 25, 55, 6, 81, 67, 18, 66, 76, 33, 20, 67, 37, 82, 53, 49, 178,
+    163, 99, 19, 99, 18, 115, 17, 131, 209, 193, 17, 162, 147, 133, 6, 81, 70, 66, 166, 54,
+    51, 38, 65, 225, 131, 162, 145, 17, 129, 115, 131, 17, 99, 18, 83, 19, 131, 146, 161, 49,
+    163, 148, 103, 102, 117, 132, 193, 193, 17, 162, 162, 133, 6, 150, 97, 61, 38, 82, 22, 81,
+    225, 131, 162, 145, 17, 129, 113, 33, 117, 102, 87, 86, 131, 146, 146, 211, 195, 68, 98, 44,
+    17, 23, 82, 34, 100, 179, 194, 243, 38, 21, 84, 35, 145, 50, 115, 36, 68, 46, 16, 7,
+    49, 39, 65, 47, 68, 148, 17, 96, 7, 33, 55, 34, 55, 34, 44, 23, 43, 19, 23, 34,
+    177, 113, 33, 177, 33, 193, 33, 58, 33, 240, 29, 33, 146, 27, 17, 42, 18, 16, 87, 138,
+    109, 62, 63, 1, 255, 255, 255, 255, 240, 47, 3, 213, 183, 144, 87, 134, 19, 104, 50, 58,
+    49, 58, 65, 27, 78, 77, 77, 77, 77, 77, 61, 65, 42, 50, 56, 50, 86, 50, 121, 87,
+    133, 35, 102, 82, 55, 97, 55, 113, 24, 122, 137, 137, 137, 137, 137, 122, 113, 39, 98, 54,
+    82, 85, 66, 120, 87, 133, 35, 101, 98, 53, 129, 53, 145, 21, 167, 182, 182, 182, 182, 182,
+    168, 145, 37, 130, 53, 98, 85, 66, 120, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 211,
+    240, 47, 2, 240, 47, 2, 240, 61, 77, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 52,
+    98, 101, 50, 132, 49, 149, 18, 151, 182, 182, 182, 182, 183, 167, 149, 34, 133, 50, 101, 82,
+    69, 121, 87, 131, 37, 98, 71, 50, 87, 49, 104, 18, 106, 122, 122, 122, 122, 123, 107, 104,
+    34, 88, 50, 71, 82, 54, 121, 87, 131, 37, 98, 56, 50, 57, 49, 74, 18, 61, 77, 77,
+    77, 77, 77, 78, 74, 34, 58, 50, 56, 82, 54, 120, 36, 101, 34, 49, 81, 50, 17, 66,
+    49, 66, 18, 69, 66, 33, 65, 49, 65, 50, 49, 49, 50, 34, 210, 17, 240, 17, 20, 34,
+    37, 17, 20, 34, 37, 17, 20, 34, 37, 17, 45, 34, 19, 21, 18, 36, 33, 21, 17, 38,
+    53, 52, 101, 102, 17, 17, 56, 83, 17, 51, 36, 84, 32, 20, 195, 34, 34, 23, 34, 18,
+    17, 33, 19, 84, 17, 19, 49, 17, 129, 17, 51, 33, 177, 50, 18, 17, 193, 18, 52, 18,
+    66, 20, 113, 18, 66, 17, 161, 17, 82, 17, 161, 146, 162, 114, 178, 17, 49, 33, 178, 17,
+    49, 33, 194, 98, 216, 225, 82, 240, 96, 33, 209, 68, 116, 50, 34, 82, 33, 50, 55, 50,
+    33, 240, 18, 31, 1, 33, 240, 18, 19, 37, 35, 17, 34, 52, 66, 18, 18, 53, 17, 18,
+    18, 27, 19, 17, 83, 51, 81, 17, 35, 51, 33, 18, 35, 18, 18, 19, 35, 19, 115, 20,
+    43, 37, 41, 39, 39, 41, 128, 131, 231, 171, 140, 98, 65, 66, 98, 146, 68, 18, 50, 35,
+    18, 18, 18, 50, 33, 34, 34, 18, 50, 18, 34, 34, 146, 34, 34, 146, 35, 18, 49, 17,
+    65, 18, 20, 163, 68, 84, 98, 23, 18, 99, 35, 35, 115, 83, 153, 183, 87, 131, 67, 98,
+    146, 50, 177, 49, 209, 18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 28, 34, 33, 17, 33,
+    33, 17, 35, 19, 33, 35, 20, 34, 33, 34, 33, 34, 39, 34, 50, 37, 34, 82, 114, 121,
+    87, 131, 67, 98, 146, 50, 177, 49, 35, 51, 33, 18, 33, 18, 18, 17, 35, 34, 18, 17,
+    34, 34, 240, 47, 2, 28, 34, 33, 17, 33, 33, 17, 35, 19, 33, 35, 20, 34, 33, 34,
+    33, 34, 39, 34, 50, 37, 34, 82, 114, 121, 119, 211, 67, 147, 130, 129, 178, 98, 19, 51,
+    33, 82, 33, 18, 33, 18, 18, 67, 17, 33, 18, 34, 17, 67, 179, 66, 210, 50, 44, 18,
+    19, 33, 17, 33, 33, 18, 20, 18, 19, 33, 33, 17, 33, 17, 49, 34, 33, 35, 18, 82,
+    40, 18, 114, 52, 34, 147, 98, 200, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 35, 51,
+    35, 51, 51, 50, 240, 47, 2, 28, 34, 33, 145, 35, 18, 114, 20, 33, 98, 33, 34, 35,
+    19, 34, 50, 37, 34, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 35, 51, 33, 18,
+    33, 18, 18, 17, 35, 34, 18, 17, 34, 34, 240, 47, 2, 28, 34, 33, 145, 35, 18, 114,
+    20, 33, 98, 33, 34, 35, 19, 34, 50, 37, 34, 82, 114, 121, 87, 131, 67, 98, 146, 50,
+    177, 49, 35, 51, 33, 18, 33, 18, 18, 17, 35, 34, 18, 17, 35, 18, 212, 209, 18, 28,
+    34, 33, 145, 35, 18, 114, 20, 33, 98, 33, 34, 35, 19, 34, 50, 37, 34, 82, 114, 121,
+    87, 131, 67, 98, 146, 50, 177, 49, 34, 82, 33, 18, 50, 35, 51, 67, 19, 66, 50, 82,
+    50, 240, 33, 194, 34, 25, 18, 49, 39, 33, 66, 22, 34, 18, 34, 49, 50, 35, 34, 82,
+    37, 39, 39, 144, 61, 51, 181, 71, 65, 18, 19, 67, 34, 37, 85, 50, 25, 18, 49, 209,
+    34, 35, 51, 34, 17, 51, 51, 49, 17, 240, 17, 31, 1, 17, 240, 17, 31, 1, 18, 18,
+    114, 18, 18, 34, 67, 33, 50, 38, 50, 66, 146, 98, 114, 137, 17, 209, 35, 147, 47, 2,
+    84, 98, 57, 50, 33, 36, 49, 34, 20, 33, 36, 17, 35, 21, 19, 51, 51, 51, 35, 51,
+    36, 47, 2, 240, 47, 3, 18, 114, 20, 34, 67, 33, 34, 38, 50, 50, 146, 82, 114, 121,
+    87, 131, 67, 98, 146, 50, 177, 49, 146, 33, 18, 35, 35, 51, 51, 35, 66, 162, 50, 240,
+    47, 2, 240, 49, 39, 33, 66, 36, 50, 18, 34, 99, 35, 41, 37, 39, 39, 144, 87, 131,
+    67, 98, 146, 50, 177, 49, 35, 51, 33, 18, 33, 18, 18, 17, 35, 34, 18, 17, 34, 34,
+    240, 47, 2, 240, 47, 3, 18, 114, 20, 34, 67, 33, 34, 38, 50, 50, 146, 82, 114, 121,
+    87, 131, 67, 98, 146, 50, 177, 49, 35, 51, 33, 18, 33, 18, 18, 17, 35, 34, 18, 17,
+    34, 34, 240, 33, 41, 18, 33, 41, 18, 34, 25, 18, 49, 39, 33, 66, 36, 65, 18, 34,
+    98, 51, 37, 33, 53, 37, 71, 144, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 18, 18,
+    17, 34, 19, 49, 17, 34, 17, 50, 51, 51, 50, 240, 47, 2, 240, 49, 39, 33, 66, 36,
+    50, 18, 34, 99, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 33, 18,
+    20, 33, 18, 36, 20, 35, 51, 36, 50, 66, 50, 66, 240, 47, 2, 240, 49, 39, 33, 66,
+    36, 50, 18, 34, 99, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 63, 1,
+    33, 177, 50, 178, 34, 81, 67, 47, 2, 240, 47, 3, 18, 114, 20, 34, 67, 33, 34, 38,
+    50, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 211, 36, 37, 34,
+    240, 47, 2, 240, 47, 3, 162, 20, 131, 33, 34, 83, 50, 50, 146, 82, 114, 121, 87, 131,
+    67, 98, 146, 50, 177, 49, 209, 18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 240, 47, 3,
+    41, 36, 209, 34, 178, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18,
+    211, 36, 37, 34, 240, 47, 2, 240, 47, 3, 41, 36, 209, 34, 178, 50, 146, 82, 114, 121,
+    87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 211, 37, 21, 34, 82, 51, 34, 240, 47, 2,
+    240, 50, 146, 77, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 34, 50,
+    33, 49, 18, 99, 17, 18, 17, 17, 81, 51, 51, 51, 50, 51, 50, 17, 34, 194, 18, 194,
+    18, 240, 50, 146, 77, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177,
+    49, 209, 18, 18, 18, 17, 34, 19, 49, 17, 34, 17, 50, 51, 51, 50, 240, 47, 2, 240,
+    50, 146, 77, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 209,
+    18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 177, 50, 147, 51, 84, 68, 51, 113, 34, 18,
+    130, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 65, 49, 65, 18, 50, 50,
+    51, 50, 82, 50, 240, 47, 2, 240, 35, 51, 51, 50, 17, 33, 33, 18, 69, 53, 18, 43,
+    35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 35, 51, 35, 51,
+    51, 50, 240, 47, 2, 98, 114, 114, 99, 98, 84, 98, 81, 34, 81, 82, 50, 146, 82, 114,
+    121, 87, 131, 67, 98, 146, 50, 177, 49, 146, 33, 18, 35, 35, 51, 51, 35, 66, 162, 50,
+    240, 38, 34, 17, 33, 39, 33, 65, 54, 33, 134, 34, 33, 18, 37, 21, 35, 41, 37, 39,
+    39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 35, 51, 33, 18, 33, 18, 18, 17, 35, 34,
+    18, 17, 34, 34, 240, 47, 2, 98, 114, 114, 99, 98, 84, 98, 81, 34, 81, 82, 50, 146,
+    82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 18, 18, 17, 34, 19, 49, 17,
+    34, 17, 50, 51, 51, 50, 240, 38, 39, 39, 38, 54, 37, 70, 37, 18, 37, 21, 35, 41,
+    37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 35, 51, 35, 51, 51, 50,
+    240, 47, 2, 240, 35, 147, 52, 18, 36, 68, 33, 36, 18, 36, 52, 35, 36, 20, 37, 39,
+    39, 144, 87, 131, 67, 98, 146, 50, 177, 49, 146, 33, 18, 35, 35, 51, 51, 35, 66, 162,
+    50, 240, 47, 2, 57, 51, 65, 34, 68, 66, 18, 65, 34, 67, 66, 50, 65, 66, 82, 114,
+    121, 87, 131, 67, 98, 146, 50, 177, 49, 34, 82, 33, 18, 50, 35, 51, 67, 19, 66, 50,
+    82, 50, 240, 47, 2, 57, 51, 65, 34, 68, 66, 18, 65, 34, 67, 66, 50, 65, 66, 82,
+    114, 121, 87, 131, 67, 98, 146, 50, 34, 50, 33, 49, 18, 99, 17, 18, 17, 17, 81, 51,
+    51, 51, 50, 51, 50, 66, 240, 47, 2, 85, 83, 35, 51, 36, 18, 113, 33, 34, 178, 50,
+    146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 34, 50, 33, 49, 18, 99, 17, 18, 17, 17,
+    81, 51, 51, 51, 50, 51, 50, 66, 240, 47, 2, 85, 83, 35, 51, 36, 18, 34, 49, 33,
+    34, 67, 66, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 18, 67, 17, 49, 66, 18,
+    65, 18, 49, 81, 51, 51, 51, 50, 51, 50, 66, 240, 47, 2, 85, 83, 35, 51, 36, 18,
+    113, 33, 34, 178, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 18, 67, 17, 49, 66,
+    18, 65, 18, 49, 81, 51, 51, 51, 50, 51, 50, 66, 240, 47, 2, 85, 83, 35, 51, 36,
+    18, 34, 49, 33, 34, 67, 66, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49,
+    209, 18, 18, 18, 17, 34, 19, 49, 17, 34, 17, 50, 51, 51, 50, 161, 66, 146, 66, 85,
+    83, 35, 51, 36, 18, 113, 33, 34, 178, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50,
+    177, 49, 34, 82, 33, 18, 50, 35, 51, 67, 19, 66, 50, 82, 50, 240, 47, 2, 85, 83,
+    35, 51, 36, 18, 113, 33, 34, 178, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177,
+    49, 65, 49, 65, 18, 50, 50, 51, 50, 83, 34, 194, 18, 209, 18, 240, 37, 85, 50, 51,
+    50, 65, 39, 18, 18, 43, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50, 177, 49,
+    209, 18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 85, 82, 66, 50, 67, 34, 82, 36, 33,
+    113, 33, 34, 25, 18, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 34, 50, 33, 49,
+    18, 99, 17, 18, 17, 17, 81, 51, 51, 51, 50, 51, 50, 66, 240, 37, 85, 36, 35, 36,
+    50, 37, 34, 66, 23, 18, 18, 33, 145, 35, 41, 37, 39, 39, 144, 87, 132, 21, 101, 19,
+    19, 50, 19, 18, 20, 51, 52, 33, 17, 18, 17, 17, 18, 33, 17, 20, 17, 51, 50, 19,
+    33, 17, 19, 18, 34, 65, 81, 66, 85, 82, 66, 50, 67, 34, 82, 36, 33, 113, 33, 34,
+    25, 18, 50, 146, 82, 114, 121, 87, 131, 67, 98, 33, 98, 50, 34, 49, 49, 49, 34, 81,
+    49, 18, 211, 81, 34, 82, 65, 66, 66, 49, 97, 66, 85, 82, 66, 50, 67, 34, 82, 36,
+    33, 113, 33, 34, 25, 18, 50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 177, 49, 209,
+    18, 18, 18, 17, 34, 19, 49, 17, 34, 17, 50, 51, 51, 17, 18, 194, 18, 85, 82, 66,
+    50, 67, 34, 82, 36, 33, 113, 33, 34, 25, 18, 50, 146, 82, 114, 121, 87, 131, 67, 98,
+    146, 50, 177, 49, 34, 82, 33, 18, 50, 35, 51, 67, 19, 66, 50, 82, 50, 240, 37, 85,
+    36, 35, 36, 50, 37, 34, 66, 23, 18, 18, 33, 145, 35, 41, 37, 39, 39, 144, 119, 211,
+    67, 147, 130, 129, 178, 98, 18, 82, 33, 82, 51, 34, 50, 67, 50, 34, 33, 17, 67, 18,
+    82, 19, 66, 210, 50, 85, 82, 19, 71, 68, 18, 41, 49, 17, 49, 41, 34, 82, 28, 114,
+    146, 147, 98, 200, 87, 131, 67, 98, 146, 50, 177, 49, 209, 18, 35, 51, 35, 51, 51, 50,
+    240, 47, 2, 99, 98, 85, 83, 69, 68, 69, 65, 34, 67, 66, 50, 146, 82, 114, 121, 87,
+    131, 67, 98, 146, 50, 34, 50, 33, 49, 18, 99, 17, 18, 17, 17, 81, 51, 51, 51, 50,
+    51, 50, 66, 240, 47, 2, 113, 115, 83, 84, 97, 97, 34, 178, 50, 146, 82, 114, 121, 87,
+    131, 67, 98, 146, 50, 34, 50, 33, 49, 18, 99, 17, 18, 17, 17, 81, 51, 51, 51, 50,
+    51, 50, 17, 34, 194, 18, 99, 50, 18, 85, 83, 69, 68, 69, 65, 34, 67, 66, 50, 146,
+    82, 114, 121, 119, 195, 67, 162, 146, 114, 34, 50, 33, 113, 18, 99, 17, 82, 17, 17, 81,
+    50, 65, 51, 51, 49, 51, 35, 50, 51, 18, 17, 209, 20, 17, 83, 66, 17, 33, 18, 53,
+    50, 17, 33, 33, 53, 49, 33, 33, 34, 37, 19, 18, 34, 34, 35, 19, 33, 66, 49, 81,
+    50, 82, 33, 81, 34, 98, 39, 33, 114, 33, 81, 33, 87, 131, 67, 98, 146, 50, 33, 81,
+    33, 49, 18, 17, 34, 17, 33, 18, 17, 17, 18, 33, 17, 19, 33, 49, 17, 49, 34, 49,
+    17, 49, 17, 50, 65, 81, 66, 99, 98, 85, 83, 69, 68, 69, 65, 34, 67, 66, 50, 146,
+    82, 114, 121, 87, 131, 67, 99, 115, 54, 53, 49, 20, 18, 19, 17, 18, 20, 19, 18, 20,
+    20, 19, 19, 19, 20, 23, 19, 20, 19, 19, 18, 240, 39, 23, 53, 53, 70, 22, 18, 43,
+    35, 41, 37, 39, 39, 144, 241, 65, 49, 79, 50, 49, 65, 242, 35, 20, 22, 116, 35, 20,
+    21, 52, 51, 65, 49, 66, 41, 47, 2, 177, 240, 29, 29, 33, 33, 33, 18, 33, 44, 19,
+    17, 18, 33, 19, 28, 19, 51, 51, 28, 31, 1, 193, 240, 28, 23, 23, 28, 37, 53, 44,
+    38, 22, 30, 43, 47, 2, 146, 242, 39, 47, 73, 87, 131, 67, 98, 146, 50, 177, 49, 33,
+    17, 49, 17, 33, 18, 35, 51, 35, 51, 51, 50, 49, 17, 49, 17, 50, 240, 38, 54, 37,
+    85, 52, 84, 68, 84, 18, 36, 52, 35, 41, 37, 39, 39, 144, 87, 131, 67, 98, 146, 50,
+    177, 49, 209, 18, 35, 51, 35, 51, 51, 50, 240, 47, 2, 240, 47, 3, 212, 209, 34, 178,
+    50, 146, 82, 114, 121, 87, 131, 67, 98, 146, 50, 34, 50, 33, 49, 18, 99, 17, 18, 17,
+    179, 240, 34, 66, 82, 61, 245, 43, 34, 34, 114, 20, 18, 114, 17, 47, 3, 213, 39, 39,
+    144, 33, 209, 68, 116, 50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 51, 51,
+    49, 33, 49, 18, 18, 17, 49, 18, 34, 18, 17, 34, 33, 33, 240, 17, 83, 17, 19, 81,
+    17, 35, 51, 33, 17, 49, 25, 17, 49, 33, 177, 35, 18, 17, 33, 33, 18, 20, 33, 65,
+    65, 37, 34, 82, 39, 39, 41, 128, 49, 209, 100, 132, 81, 34, 82, 34, 66, 55, 65, 66,
+    225, 65, 240, 20, 19, 51, 51, 35, 19, 17, 34, 17, 34, 35, 17, 17, 18, 17, 34, 33,
+    35, 59, 66, 38, 17, 21, 65, 33, 35, 51, 33, 33, 65, 25, 17, 67, 17, 177, 33, 19,
+    18, 33, 17, 33, 33, 23, 18, 49, 65, 39, 34, 82, 41, 54, 44, 128, 33, 209, 68, 116,
+    50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 240, 18, 19, 37, 35, 17, 34,
+    53, 17, 18, 18, 27, 19, 17, 83, 17, 19, 81, 17, 35, 51, 33, 17, 49, 25, 17, 49,
+    33, 177, 35, 18, 23, 18, 20, 33, 65, 65, 37, 34, 82, 39, 39, 41, 128, 33, 209, 68,
+    116, 50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 49, 18, 20, 49, 33, 52,
+    20, 49, 18, 51, 36, 49, 33, 66, 50, 65, 33, 240, 17, 83, 51, 81, 17, 35, 51, 33,
+    18, 35, 18, 18, 19, 35, 19, 115, 20, 43, 37, 41, 39, 39, 41, 128, 33, 209, 68, 116,
+    50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 19, 36, 51, 18, 21, 33, 37, 18, 19, 37,
+    35, 17, 34, 52, 66, 18, 18, 53, 17, 18, 18, 27, 19, 17, 83, 51, 81, 17, 35, 51,
+    33, 18, 42, 33, 35, 24, 50, 20, 37, 51, 37, 41, 39, 39, 41, 128, 33, 209, 68, 116,
+    50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 240, 18, 19, 37, 35, 17, 34,
+    52, 66, 18, 18, 53, 17, 18, 18, 22, 17, 18, 19, 17, 83, 51, 81, 17, 41, 33, 18,
+    37, 53, 35, 22, 37, 20, 37, 36, 37, 35, 51, 39, 39, 41, 128, 33, 209, 68, 116, 50,
+    34, 82, 33, 50, 55, 50, 33, 240, 18, 19, 36, 51, 18, 21, 33, 37, 18, 19, 37, 35,
+    17, 34, 52, 66, 18, 18, 53, 17, 18, 18, 22, 17, 18, 19, 17, 83, 51, 81, 17, 41,
+    33, 18, 36, 84, 35, 18, 36, 50, 20, 36, 52, 37, 35, 17, 19, 39, 39, 41, 128, 33,
+    209, 68, 116, 50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 240, 18, 18, 33,
+    33, 18, 34, 17, 35, 17, 18, 33, 19, 18, 19, 51, 36, 18, 22, 17, 17, 20, 17, 83,
+    81, 81, 17, 41, 33, 18, 36, 84, 35, 18, 36, 50, 20, 43, 37, 41, 39, 39, 41, 128,
+    33, 209, 68, 116, 50, 34, 82, 33, 50, 55, 50, 33, 240, 18, 31, 1, 33, 240, 18, 21,
+    18, 37, 17, 36, 20, 36, 18, 19, 22, 20, 18, 31, 1, 21, 37, 37, 17, 18, 18, 50,
+    18, 17, 34, 34, 82, 34, 49, 33, 113, 33, 66, 25, 18, 82, 146, 114, 114, 152, 87, 131,
+    67, 98, 146, 50, 53, 50, 33, 51, 19, 49, 18, 33, 98, 35, 177, 50, 240, 47, 2, 161,
+    66, 66, 50, 67, 35, 34, 66, 17, 49, 67, 33, 34, 178, 50, 146, 82, 114, 120,
+};
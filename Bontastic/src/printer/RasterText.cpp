@@ -0,0 +1,313 @@
+#include "RasterText.h"
+#include <string.h>
+#include "RasterFont.h"
+#include "Transcoder.h"
+
+static const size_t glyphCount = sizeof(rasterGlyphs) / sizeof(rasterGlyphs[0]);
+// Box drawn for characters the font lacks (CJK, most emoji).
+static const uint8_t missingAdvance = 14;
+
+static uint8_t band[rasterHeaderSize + rasterRowBytes * rasterFontHeight];
+static RasterStats stats;
+
+static const RasterGlyph *findGlyph(uint32_t cp)
+{
+    size_t lo = 0;
+    size_t hi = glyphCount;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (rasterGlyphs[mid].codepoint < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo < glyphCount && rasterGlyphs[lo].codepoint == cp ? &rasterGlyphs[lo] : nullptr;
+}
+
+static bool skipped(uint32_t cp)
+{
+    // Controls, zero-width joiner and variation selectors print nothing.
+    return cp < 0x20 || cp == 0x7F || cp == 0x200D || (cp >= 0xFE00 && cp <= 0xFE0F);
+}
+
+static uint8_t advanceOf(uint32_t cp)
+{
+    if (cp == '\t')
+    {
+        cp = ' ';
+    }
+    if (skipped(cp) && cp != ' ')
+    {
+        return 0;
+    }
+    const RasterGlyph *glyph = findGlyph(cp);
+    return glyph ? glyph->advance : missingAdvance;
+}
+
+bool rasterImproves(const uint8_t *utf8, size_t size, uint8_t codePage)
+{
+    size_t i = 0;
+    while (i < size)
+    {
+        uint32_t cp;
+        i += decodeUtf8(utf8 + i, size - i, cp);
+        if (cp >= 0x80 && !codePageHas(cp, codePage) && rasterGlyphFor(cp))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t rasterGlyphFor(uint32_t cp)
+{
+    if (skipped(cp))
+    {
+        return 0;
+    }
+    return findGlyph(cp) ? cp : rasterMissingGlyph;
+}
+
+static void setPixel(int x, int y)
+{
+    if (x >= 0 && x < rasterWidth && y >= 0 && y < rasterFontHeight)
+    {
+        band[rasterHeaderSize + y * rasterRowBytes + x / 8] |= 0x80 >> (x % 8);
+    }
+}
+
+static void drawGlyph(const RasterGlyph &glyph, int penX)
+{
+    const RasterGlyph *next = &glyph + 1;
+    size_t end = next < rasterGlyphs + glyphCount ? next->offset : sizeof(rasterGlyphRuns);
+    size_t nibble = glyph.offset * 2;
+    uint32_t pixels = glyph.width * glyph.height;
+    uint32_t pixel = 0;
+    bool black = false;
+    int x0 = penX + glyph.left;
+    while (pixel < pixels && nibble < end * 2)
+    {
+        uint32_t run = 0;
+        uint8_t value;
+        do
+        {
+            uint8_t byte = rasterGlyphRuns[nibble / 2];
+            value = nibble % 2 ? byte & 0x0F : byte >> 4;
+            run += value;
+            nibble++;
+        } while (value == 15 && nibble < end * 2);
+        if (black)
+        {
+            for (uint32_t p = pixel; p < pixel + run && p < pixels; ++p)
+            {
+                setPixel(x0 + p % glyph.width, glyph.top + p / glyph.width);
+            }
+        }
+        pixel += run;
+        black = !black;
+    }
+}
+
+static void drawMissing(int penX)
+{
+    int top = rasterFontBaseline - 14;
+    for (int x = 1; x < missingAdvance - 2; ++x)
+    {
+        setPixel(penX + x, top);
+        setPixel(penX + x, rasterFontBaseline - 1);
+    }
+    for (int y = top; y < rasterFontBaseline; ++y)
+    {
+        setPixel(penX + 1, y);
+        setPixel(penX + missingAdvance - 3, y);
+    }
+}
+
+bool rasterGlyphCell(uint32_t cp, uint8_t *cell)
+{
+    if (skipped(cp))
+    {
+        return false;
+    }
+    // Draw with the ink starting at x = 0 in the band, then resample.
+    memset(band + rasterHeaderSize, 0, sizeof(band) - rasterHeaderSize);
+    const RasterGlyph *glyph = findGlyph(cp);
+    uint8_t width;
+    if (glyph)
+    {
+        drawGlyph(*glyph, -glyph->left);
+        width = glyph->width;
+    }
+    else
+    {
+        drawMissing(-1);
+        width = missingAdvance - 3;
+    }
+    memset(cell, 0, rasterCellWidth * rasterCellBytes);
+    int pad = width < rasterCellWidth ? (rasterCellWidth - width) / 2 : 0;
+    for (int column = 0; column < rasterCellWidth; ++column)
+    {
+        int x = width > rasterCellWidth ? column * width / rasterCellWidth : column - pad;
+        if (x < 0 || x >= width)
+        {
+            continue;
+        }
+        for (int y = 0; y < rasterFontHeight && y < rasterCellBytes * 8; ++y)
+        {
+            if (band[rasterHeaderSize + y * rasterRowBytes + x / 8] & (0x80 >> (x % 8)))
+            {
+                cell[column * rasterCellBytes + y / 8] |= 0x80 >> (y % 8);
+            }
+        }
+    }
+    return true;
+}
+
+// Finds where the line starting at start ends: at a newline, after the last
+// space that still fits, or at the last character that fits.
+static size_t measureLine(const uint8_t *utf8, size_t size, size_t start, size_t &next)
+{
+    uint16_t width = 0;
+    size_t i = start;
+    size_t breakAt = 0;
+    while (i < size)
+    {
+        uint32_t cp;
+        size_t length = decodeUtf8(utf8 + i, size - i, cp);
+        if (cp == '\n')
+        {
+            next = i + length;
+            return i;
+        }
+        uint8_t advance = advanceOf(cp);
+        if (width + advance > rasterWidth && i > start)
+        {
+            if (breakAt)
+            {
+                next = breakAt;
+                return breakAt;
+            }
+            next = i;
+            return i;
+        }
+        width += advance;
+        i += length;
+        if (cp == ' ')
+        {
+            breakAt = i;
+        }
+    }
+    next = size;
+    return size;
+}
+
+static bool rowInk(const uint8_t *row, uint8_t &width)
+{
+    width = rasterRowBytes;
+    while (width && !row[width - 1])
+    {
+        width--;
+    }
+    return width > 0;
+}
+
+// ESC J n: print nothing and feed n dot rows.
+static void sendFeed(uint16_t rows, RasterSink sink)
+{
+    while (rows)
+    {
+        uint8_t step = rows > 255 ? 255 : rows;
+        uint8_t feed[3] = {0x1B, 'J', step};
+        sink(feed, sizeof(feed), 0, step);
+        stats.sentBytes += sizeof(feed);
+        rows -= step;
+    }
+}
+
+void sendRasterBand(uint8_t *band, uint16_t rows, RasterSink sink)
+{
+    uint8_t *bitmap = band + rasterHeaderSize;
+    uint16_t first = rows;
+    uint16_t last = 0;
+    uint8_t width = 0;
+    for (uint16_t y = 0; y < rows; ++y)
+    {
+        uint8_t rowWidth;
+        if (rowInk(bitmap + y * rasterRowBytes, rowWidth))
+        {
+            first = first < y ? first : y;
+            last = y;
+            width = width > rowWidth ? width : rowWidth;
+        }
+    }
+    stats.bands++;
+    stats.rawBytes += rasterHeaderSize + rows * rasterRowBytes;
+    if (first == rows)
+    {
+        sendFeed(rows, sink);
+        return;
+    }
+
+    sendFeed(first, sink);
+    uint16_t height = last - first + 1;
+    for (uint16_t y = 0; y < height; ++y)
+    {
+        memmove(bitmap + y * width, bitmap + (first + y) * rasterRowBytes, width);
+    }
+    const uint8_t header[rasterHeaderSize] = {0x1D, 0x76, 0x30, 0x00, width, 0x00,
+                                              static_cast<uint8_t>(height), static_cast<uint8_t>(height >> 8)};
+    memcpy(band, header, sizeof(header));
+    size_t size = rasterHeaderSize + height * width;
+    sink(band, size, height, 0);
+    stats.sentBytes += size;
+    sendFeed(rows - 1 - last, sink);
+}
+
+const RasterStats &rasterStats()
+{
+    return stats;
+}
+
+void rasterizeText(const uint8_t *utf8, size_t size, RasterSink sink)
+{
+    size_t start = 0;
+    while (start < size)
+    {
+        size_t next;
+        size_t end = measureLine(utf8, size, start, next);
+        memset(band + rasterHeaderSize, 0, sizeof(band) - rasterHeaderSize);
+        int penX = 0;
+        size_t i = start;
+        while (i < end)
+        {
+            uint32_t cp;
+            i += decodeUtf8(utf8 + i, size - i, cp);
+            if (cp == '\t')
+            {
+                cp = ' ';
+            }
+            if (skipped(cp))
+            {
+                continue;
+            }
+            const RasterGlyph *glyph = findGlyph(cp);
+            if (glyph)
+            {
+                drawGlyph(*glyph, penX);
+                penX += glyph->advance;
+            }
+            else
+            {
+                drawMissing(penX);
+                penX += missingAdvance;
+            }
+        }
+        sendRasterBand(band, rasterFontHeight, sink);
+        start = next;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint16_t rasterWidth = 384;
+static const uint8_t rasterRowBytes = rasterWidth / 8;
+// ESC & cell of the printer's 12x24 font A, stored column by column.
+static const uint8_t rasterCellWidth = 12;
+static const uint8_t rasterCellBytes = 3;
+
+// Receives ready-to-send raster commands; rows counts the dot rows printed
+// and feedRows those only fed (ESC J), for pacing.
+typedef void (*RasterSink)(const uint8_t *bytes, size_t size, uint16_t rows, uint16_t feedRows);
+
+// Room a band buffer keeps in front of its bitmap for the GS v 0 header.
+static const size_t rasterHeaderSize = 8;
+
+struct RasterStats
+{
+    uint32_t bands;
+    uint32_t rawBytes; // what untrimmed full-width GS v 0 bands would take
+    uint32_t sentBytes;
+};
+
+// Sends rows of a full-width bitmap stored at band + rasterHeaderSize. White
+// rows above and below the ink become ESC J feeds and white columns on the
+// right are trimmed, since the UART rather than the CPU limits throughput.
+// The bitmap is packed in place.
+void sendRasterBand(uint8_t *band, uint16_t rows, RasterSink sink);
+const RasterStats &rasterStats();
+
+// Every character the embedded font lacks prints as the same box, which the
+// glyph cache keeps under this code point.
+static const uint32_t rasterMissingGlyph = 0xFFFD;
+
+// True when text has characters the ROM code page cannot show, i.e. when
+// printing it as a raster is worth the cost: the font has them, or they at
+// least keep their place as a box instead of becoming '?'.
+bool rasterImproves(const uint8_t *utf8, size_t size, uint8_t codePage);
+
+// The glyph the raster font prints for cp: cp itself, rasterMissingGlyph
+// when the font lacks it, or 0 when cp prints nothing (controls, joiners,
+// variation selectors).
+uint32_t rasterGlyphFor(uint32_t cp);
+
+// Renders cp's glyph, or the box when the font lacks it, into a font A cell
+// (rasterCellWidth columns of rasterCellBytes, top byte first). Narrow glyphs
+// are centred and wide ones squeezed by dropping columns. Returns false when
+// cp prints nothing.
+bool rasterGlyphCell(uint32_t cp, uint8_t *cell);
+
+// Word-wraps text to the paper width with the embedded font and hands each
+// line to sink through sendRasterBand; only one band is ever held in RAM.
+void rasterizeText(const uint8_t *utf8, size_t size, RasterSink sink);
@@ -0,0 +1,183 @@
+#include "ReceiptBuilder.h"
+#include <string.h>
+#include "GlyphCache.h"
+#include "Transcoder.h"
+
+static const uint8_t asciiEsc = 0x1B;
+static const uint8_t asciiGs = 0x1D;
+
+ReceiptBuilder::ReceiptBuilder()
+{
+    reset(32);
+}
+
+void ReceiptBuilder::reset(uint8_t columns)
+{
+    maxColumns = columns ? columns : 32;
+    length = 0;
+    lineCount = 0;
+    feedCount = 0;
+    column = 0;
+    overflow = false;
+}
+
+void ReceiptBuilder::put(uint8_t c)
+{
+    if (length >= receiptCapacity)
+    {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    track(c);
+}
+
+void ReceiptBuilder::track(uint8_t c)
+{
+    if (c == '\n')
+    {
+        lineCount++;
+        column = 0;
+    }
+    else if (c >= 0x20 && ++column >= maxColumns)
+    {
+        // The printer wraps on its own; count the wrapped line.
+        lineCount++;
+        column = 0;
+    }
+}
+
+ReceiptBuilder &ReceiptBuilder::append(const uint8_t *bytes, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        put(bytes[i]);
+    }
+    return *this;
+}
+
+ReceiptBuilder &ReceiptBuilder::text(const char *s)
+{
+    return append(reinterpret_cast<const uint8_t *>(s), strlen(s));
+}
+
+ReceiptBuilder &ReceiptBuilder::utf8(const uint8_t *bytes, size_t size, uint8_t codePage, uint16_t *unmapped)
+{
+    size_t room = receiptCapacity - length;
+    size_t written = transcodeUtf8(bytes, size, codePage, buffer + length, room, unmapped);
+    if (size && written == room)
+    {
+        overflow = true;
+    }
+    for (size_t i = 0; i < written; ++i)
+    {
+        track(buffer[length + i]);
+    }
+    length += written;
+    return *this;
+}
+
+ReceiptBuilder &ReceiptBuilder::utf8(const uint8_t *bytes, size_t size, uint8_t codePage, const GlyphCache &cache)
+{
+    size_t room = receiptCapacity - length;
+    size_t written = cache.transcode(bytes, size, codePage, buffer + length, room);
+    if (size && written + 3 >= room)
+    {
+        overflow = true;
+    }
+    for (size_t i = 0; i < written; ++i)
+    {
+        if (buffer[length + i] == asciiEsc)
+        {
+            // ESC % n switches; it takes no column.
+            i += 2;
+            continue;
+        }
+        track(buffer[length + i]);
+    }
+    length += written;
+    return *this;
+}
+
+ReceiptBuilder &ReceiptBuilder::line(const char *s)
+{
+    text(s);
+    put('\n');
+    return *this;
+}
+
+ReceiptBuilder &ReceiptBuilder::rule()
+{
+    return line("----------------");
+}
+
+// ESC d n: print and feed n lines.
+ReceiptBuilder &ReceiptBuilder::feed(uint8_t lines)
+{
+    if (lines)
+    {
+        command(asciiEsc, 'd', lines);
+        feedCount += lines;
+        column = 0;
+    }
+    return *this;
+}
+
+ReceiptBuilder &ReceiptBuilder::command(uint8_t a, uint8_t b, uint8_t n)
+{
+    if (length + 3 > receiptCapacity)
+    {
+        overflow = true;
+        return *this;
+    }
+    buffer[length++] = a;
+    buffer[length++] = b;
+    buffer[length++] = n;
+    return *this;
+}
+
+// GS ( k pL pH cn fn [args]: one QR sub-function (cn 49).
+ReceiptBuilder &ReceiptBuilder::qrCode(const uint8_t *data, size_t size, uint8_t moduleSize, uint8_t justify)
+{
+    static const uint8_t model[] = {asciiGs, '(', 'k', 4, 0, 49, 65, 50, 0};
+    static const uint8_t print[] = {asciiGs, '(', 'k', 3, 0, 49, 81, 48};
+    // Byte-mode capacity at ECC M for versions 1-10, to size the estimate.
+    static const uint8_t capacities[] = {14, 26, 42, 62, 84, 106, 122, 152, 180, 213};
+    uint8_t level[] = {asciiGs, '(', 'k', 3, 0, 49, 69, 49};
+    uint8_t module[] = {asciiGs, '(', 'k', 3, 0, 49, 67, moduleSize};
+    uint8_t store[] = {asciiGs, '(', 'k', static_cast<uint8_t>((size + 3) & 0xFF), static_cast<uint8_t>((size + 3) >> 8),
+                       49, 80, 48};
+    if (length + sizeof(model) + sizeof(module) + sizeof(level) + sizeof(store) + size + sizeof(print) + 7 >
+        receiptCapacity)
+    {
+        overflow = true;
+        return *this;
+    }
+    if (column)
+    {
+        put('\n');
+    }
+    command(asciiEsc, 'a', 1);
+    memcpy(buffer + length, model, sizeof(model));
+    length += sizeof(model);
+    memcpy(buffer + length, module, sizeof(module));
+    length += sizeof(module);
+    memcpy(buffer + length, level, sizeof(level));
+    length += sizeof(level);
+    memcpy(buffer + length, store, sizeof(store));
+    length += sizeof(store);
+    memcpy(buffer + length, data, size);
+    length += size;
+    memcpy(buffer + length, print, sizeof(print));
+    length += sizeof(print);
+    command(asciiEsc, 'a', justify);
+
+    size_t version = 1;
+    while (version < sizeof(capacities) && size > capacities[version - 1])
+    {
+        version++;
+    }
+    uint16_t dots = (17 + 4 * version + 8) * moduleSize;
+    lineCount += (dots + 23) / 24;
+    return *this;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class GlyphCache;
+
+static const size_t receiptCapacity = 1024;
+
+// Composes a complete ESC/POS receipt into one contiguous buffer so it can be
+// handed to the UART in a single write. Tracks how many printed lines the
+// bytes will produce so the sender can estimate mechanism time.
+class ReceiptBuilder
+{
+public:
+    ReceiptBuilder();
+
+    // Empties the buffer; columns is the printer's line width in characters
+    // for the active font and size, used to count wrapped lines.
+    void reset(uint8_t columns);
+    ReceiptBuilder &append(const uint8_t *bytes, size_t size);
+    ReceiptBuilder &text(const char *s);
+    // Transcodes UTF-8 straight into the buffer for the given ESC t page.
+    ReceiptBuilder &utf8(const uint8_t *bytes, size_t size, uint8_t codePage, uint16_t *unmapped = nullptr);
+    // Same, printing characters resident in cache from their user-defined slots.
+    ReceiptBuilder &utf8(const uint8_t *bytes, size_t size, uint8_t codePage, const GlyphCache &cache);
+    ReceiptBuilder &line(const char *s = "");
+    ReceiptBuilder &rule();
+    ReceiptBuilder &feed(uint8_t lines);
+    ReceiptBuilder &command(uint8_t a, uint8_t b, uint8_t n);
+    // Native QR code (GS ( k, model 2, ECC M), centred on its own lines;
+    // justify is the ESC a alignment to restore afterwards.
+    ReceiptBuilder &qrCode(const uint8_t *data, size_t size, uint8_t moduleSize, uint8_t justify);
+
+    const uint8_t *data() const { return buffer; }
+    size_t size() const { return length; }
+    uint16_t lines() const { return lineCount; }
+    uint16_t feeds() const { return feedCount; }
+    bool truncated() const { return overflow; }
+
+private:
+    void put(uint8_t c);
+    void track(uint8_t c);
+
+    uint8_t buffer[receiptCapacity];
+    size_t length;
+    uint16_t lineCount;
+    uint16_t feedCount;
+    uint8_t column;
+    uint8_t maxColumns;
+    bool overflow;
+};
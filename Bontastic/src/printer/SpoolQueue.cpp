@@ -0,0 +1,270 @@
+#include "SpoolQueue.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+
+// Bump when PrintJob's layout changes so stale journals are discarded.
+static const uint32_t spoolRecordMagic = 0x42534A02;
+
+struct SpoolRecordHeader
+{
+    uint32_t magic;
+    uint32_t seq;
+};
+
+static const size_t spoolRecordSize = sizeof(SpoolRecordHeader) + sizeof(PrintJob);
+static const uint32_t compactThreshold = 64;
+
+bool SpoolQueue::begin(const char *journalPath, const char *cursorPath)
+{
+    journal = journalPath;
+    cursor = cursorPath;
+    base = journalEnd = written = acked = 0;
+    unsavedPops = 0;
+    windowHead = 0;
+    windowCount = 0;
+    journaled = LittleFS.begin(true);
+    if (!journaled)
+    {
+        Serial.println("Spool: LittleFS unavailable, RAM only");
+        return false;
+    }
+
+    File cur = LittleFS.open(cursor, FILE_READ);
+    if (cur)
+    {
+        cur.read(reinterpret_cast<uint8_t *>(&acked), sizeof(acked));
+        cur.close();
+    }
+    base = journalEnd = written = acked;
+
+    File file = LittleFS.open(journal, FILE_READ);
+    if (!file)
+    {
+        return true;
+    }
+    SpoolRecordHeader header = {};
+    bool valid = file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) == sizeof(header) &&
+                 header.magic == spoolRecordMagic;
+    // A torn final record from a power cut is ignored.
+    uint32_t count = file.size() / spoolRecordSize;
+    file.close();
+    if (!valid)
+    {
+        Serial.println("Spool: discarding incompatible journal");
+        LittleFS.remove(journal);
+        return true;
+    }
+
+    base = header.seq;
+    journalEnd = written = base + count;
+    if (static_cast<int32_t>(acked - base) < 0 || static_cast<int32_t>(written - acked) < 0)
+    {
+        acked = base;
+    }
+    if (!size())
+    {
+        LittleFS.remove(journal);
+        base = journalEnd = written = acked;
+        return true;
+    }
+    Serial.print("Spool: recovered ");
+    Serial.print(size());
+    Serial.println(" jobs");
+    fillWindow();
+    return true;
+}
+
+bool SpoolQueue::push(const PrintJob &job)
+{
+    if (size() >= spoolMaxJobs)
+    {
+        return false;
+    }
+    // Jobs stay in RAM while the window has room and nothing is queued
+    // behind it on flash; after that the journal keeps them in order.
+    if (windowCount < spoolRamJobs && acked + windowCount == written)
+    {
+        window[(windowHead + windowCount++) % spoolRamJobs] = job;
+        written++;
+        return true;
+    }
+    if (!journaled || !appendJournal(&job))
+    {
+        return false;
+    }
+    written++;
+    return true;
+}
+
+bool SpoolQueue::peek(size_t index, PrintJob &job)
+{
+    if (index >= size())
+    {
+        return false;
+    }
+    if (index < windowCount)
+    {
+        job = window[(windowHead + index) % spoolRamJobs];
+        return true;
+    }
+    return journaled && readRecord(acked + index, job);
+}
+
+void SpoolQueue::pop()
+{
+    if (!size())
+    {
+        return;
+    }
+    if (windowCount)
+    {
+        windowHead = (windowHead + 1) % spoolRamJobs;
+        windowCount--;
+    }
+    acked++;
+    if (!journaled)
+    {
+        return;
+    }
+    if (static_cast<int32_t>(journalEnd - acked) <= 0)
+    {
+        // Nothing unprinted is on flash any more, so the cursor is moot.
+        discardJournal();
+        return;
+    }
+    if (++unsavedPops >= spoolCursorBatch)
+    {
+        saveCursor();
+    }
+    if (acked - base >= compactThreshold)
+    {
+        compact();
+    }
+    fillWindow();
+}
+
+void SpoolQueue::checkpoint()
+{
+    if (!journaled)
+    {
+        return;
+    }
+    if (journalEnd != written && !appendJournal(nullptr))
+    {
+        return;
+    }
+    if (unsavedPops)
+    {
+        saveCursor();
+    }
+}
+
+// Appends the jobs held only in the window, then job if given as sequence
+// number written, in one open of the journal.
+bool SpoolQueue::appendJournal(const PrintJob *job)
+{
+    File file = LittleFS.open(journal, FILE_APPEND);
+    if (!file)
+    {
+        return false;
+    }
+    uint32_t end = job ? written + 1 : written;
+    bool ok = true;
+    while (ok && journalEnd != end)
+    {
+        const PrintJob &record =
+            journalEnd == written ? *job : window[(windowHead + journalEnd - acked) % spoolRamJobs];
+        SpoolRecordHeader header = {spoolRecordMagic, journalEnd};
+        size_t n = file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+        n += file.write(reinterpret_cast<const uint8_t *>(&record), sizeof(record));
+        ok = n == spoolRecordSize;
+        if (ok)
+        {
+            journalEnd++;
+        }
+    }
+    file.close();
+    if (!ok)
+    {
+        Serial.println("Spool: journal write failed");
+    }
+    return ok;
+}
+
+bool SpoolQueue::readRecord(uint32_t seq, PrintJob &job)
+{
+    File file = LittleFS.open(journal, FILE_READ);
+    if (!file)
+    {
+        return false;
+    }
+    bool ok = file.seek((seq - base) * spoolRecordSize + sizeof(SpoolRecordHeader)) &&
+              file.read(reinterpret_cast<uint8_t *>(&job), sizeof(job)) == sizeof(job);
+    file.close();
+    return ok;
+}
+
+void SpoolQueue::fillWindow()
+{
+    while (windowCount < spoolRamJobs && acked + windowCount != written)
+    {
+        PrintJob &slot = window[(windowHead + windowCount) % spoolRamJobs];
+        if (!readRecord(acked + windowCount, slot))
+        {
+            break;
+        }
+        windowCount++;
+    }
+}
+
+void SpoolQueue::saveCursor()
+{
+    unsavedPops = 0;
+    File file = LittleFS.open(cursor, FILE_WRITE);
+    if (file)
+    {
+        file.write(reinterpret_cast<const uint8_t *>(&acked), sizeof(acked));
+        file.close();
+    }
+}
+
+// Rewrites the unacknowledged tail into a fresh journal so a spool that never
+// fully drains does not grow without bound. Records keep their sequence
+// numbers, so the cursor stays valid whichever journal survives a power cut.
+void SpoolQueue::compact()
+{
+    char tmpPath[40];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", journal);
+    File src = LittleFS.open(journal, FILE_READ);
+    File dst = LittleFS.open(tmpPath, FILE_WRITE);
+    if (!src || !dst)
+    {
+        return;
+    }
+    uint8_t record[spoolRecordSize];
+    src.seek((acked - base) * spoolRecordSize);
+    uint32_t copied = 0;
+    while (src.read(record, sizeof(record)) == sizeof(record))
+    {
+        dst.write(record, sizeof(record));
+        copied++;
+    }
+    src.close();
+    dst.close();
+    if (copied != journalEnd - acked || !LittleFS.rename(tmpPath, journal))
+    {
+        LittleFS.remove(tmpPath);
+        return;
+    }
+    base = acked;
+}
+
+void SpoolQueue::discardJournal()
+{
+    if (journalEnd != base)
+    {
+        LittleFS.remove(journal);
+    }
+    base = journalEnd = acked;
+    unsavedPops = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "PrintJob.h"
+
+static const size_t spoolRamJobs = 8;
+static const uint32_t spoolMaxJobs = 512;
+// Pops between cursor writes; a power cut can reprint at most this many jobs.
+static const uint32_t spoolCursorBatch = 8;
+
+// FIFO of print jobs that overflows to a LittleFS journal. Jobs live in a
+// small RAM window until it is full; only then, or at checkpoint(), are they
+// appended to the journal with an absolute sequence number, and they stay
+// there until the cursor file moves past them, so a power cycle replays
+// whatever had been journaled but not printed. Jobs beyond the window are read
+// back from the journal on demand. Jobs still only in RAM are lost on a power
+// cut. Not thread-safe; callers lock.
+class SpoolQueue
+{
+public:
+    bool begin(const char *journalPath, const char *cursorPath);
+    bool push(const PrintJob &job);
+    bool peek(size_t index, PrintJob &job);
+    void pop();
+    // Journals the jobs held only in RAM and saves the cursor if it is behind.
+    void checkpoint();
+
+    size_t size() const { return written - acked; }
+    bool persistent() const { return journaled; }
+
+private:
+    bool appendJournal(const PrintJob *job);
+    bool readRecord(uint32_t seq, PrintJob &job);
+    void fillWindow();
+    void saveCursor();
+    void compact();
+    void discardJournal();
+
+    const char *journal = nullptr;
+    const char *cursor = nullptr;
+    bool journaled = false;
+    // The journal holds records [base, journalEnd); jobs not in the window are
+    // always among them.
+    uint32_t base = 0;
+    uint32_t journalEnd = 0;
+    uint32_t written = 0;
+    uint32_t acked = 0;
+    uint32_t unsavedPops = 0;
+    PrintJob window[spoolRamJobs];
+    size_t windowHead = 0;
+    size_t windowCount = 0;
+};
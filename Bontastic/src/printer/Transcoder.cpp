@@ -0,0 +1,184 @@
+#include "Transcoder.h"
+#include <string.h>
+#include "CodePageTables.h"
+
+static const CodePageTable *findPage(uint8_t codePage)
+{
+    for (const CodePageTable &page : codePageTables)
+    {
+        if (page.escT == codePage)
+        {
+            return &page;
+        }
+    }
+    return nullptr;
+}
+
+static int findCodepoint(const uint16_t *codepoints, size_t count, uint32_t cp)
+{
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (codepoints[mid] < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo < count && codepoints[lo] == cp ? (int)lo : -1;
+}
+
+// Length of the leading run of printable ASCII (0x20-0x7E), four bytes at a
+// time where possible.
+static size_t printableRun(const uint8_t *in, size_t size)
+{
+    size_t n = 0;
+    while (n + 4 <= size)
+    {
+        uint32_t word;
+        memcpy(&word, in + n, sizeof(word));
+        // High bit set in a lane means that byte is >= 0x80, < 0x20 or 0x7F.
+        if (((word - 0x20202020u) | word | (word + 0x01010101u)) & 0x80808080u)
+        {
+            break;
+        }
+        n += 4;
+    }
+    while (n < size && in[n] >= 0x20 && in[n] < 0x7F)
+    {
+        n++;
+    }
+    return n;
+}
+
+size_t decodeUtf8(const uint8_t *in, size_t size, uint32_t &cp)
+{
+    uint8_t c = in[0];
+    size_t length;
+    if (c < 0x80)
+    {
+        cp = c;
+        return 1;
+    }
+    if ((c & 0xE0) == 0xC0)
+    {
+        length = 2;
+        cp = c & 0x1F;
+    }
+    else if ((c & 0xF0) == 0xE0)
+    {
+        length = 3;
+        cp = c & 0x0F;
+    }
+    else if ((c & 0xF8) == 0xF0)
+    {
+        length = 4;
+        cp = c & 0x07;
+    }
+    else
+    {
+        cp = 0;
+        return 1;
+    }
+    if (length > size)
+    {
+        cp = 0;
+        return 1;
+    }
+    for (size_t i = 1; i < length; ++i)
+    {
+        if ((in[i] & 0xC0) != 0x80)
+        {
+            cp = 0;
+            return 1;
+        }
+        cp = (cp << 6) | (in[i] & 0x3F);
+    }
+    return length;
+}
+
+size_t transcodeUtf8(const uint8_t *utf8, size_t size, uint8_t codePage, uint8_t *out, size_t capacity,
+                     uint16_t *unmapped)
+{
+    const CodePageTable *page = findPage(codePage);
+    const size_t translitCount = sizeof(translitCodepoints) / sizeof(translitCodepoints[0]);
+    size_t written = 0;
+    size_t i = 0;
+    uint16_t missing = 0;
+    while (i < size && written < capacity)
+    {
+        size_t run = printableRun(utf8 + i, size - i);
+        if (run)
+        {
+            if (run > capacity - written)
+            {
+                run = capacity - written;
+            }
+            memcpy(out + written, utf8 + i, run);
+            written += run;
+            i += run;
+            continue;
+        }
+
+        uint8_t c = utf8[i];
+        if (c < 0x80)
+        {
+            if (c == '\n')
+            {
+                out[written++] = '\n';
+            }
+            else if (c == '\t')
+            {
+                out[written++] = ' ';
+            }
+            i++;
+            continue;
+        }
+
+        uint32_t cp;
+        i += decodeUtf8(utf8 + i, size - i, cp);
+        // Combining marks and variation selectors have no glyph of their own.
+        if ((cp >= 0x0300 && cp <= 0x036F) || (cp >= 0xFE00 && cp <= 0xFE0F) || cp == 0x200D)
+        {
+            continue;
+        }
+        int index = page && cp ? findCodepoint(page->codepoints, page->count, cp) : -1;
+        if (index >= 0)
+        {
+            out[written++] = page->bytes[index];
+            continue;
+        }
+        index = cp ? findCodepoint(translitCodepoints, translitCount, cp) : -1;
+        if (index >= 0)
+        {
+            const char *text = translitText[index];
+            while (*text && written < capacity)
+            {
+                out[written++] = *text++;
+            }
+            continue;
+        }
+        out[written++] = '?';
+        missing++;
+    }
+    if (unmapped)
+    {
+        *unmapped = missing;
+    }
+    return written;
+}
+
+bool codePageHas(uint32_t cp, uint8_t codePage)
+{
+    if (cp >= 0x20 && cp < 0x7F)
+    {
+        return true;
+    }
+    const CodePageTable *page = findPage(codePage);
+    return page && findCodepoint(page->codepoints, page->count, cp) >= 0;
+}
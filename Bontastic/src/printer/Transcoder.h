@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Converts UTF-8 to the single-byte ESC t code page the printer is set to.
+// Characters missing from the page fall back to an ASCII transliteration,
+// then to '?'. Control characters other than newline are dropped so message
+// text can never smuggle printer commands. Returns the bytes written to out;
+// unmapped, when given, receives the number of characters printed as '?'.
+size_t transcodeUtf8(const uint8_t *utf8, size_t size, uint8_t codePage, uint8_t *out, size_t capacity,
+                     uint16_t *unmapped = nullptr);
+
+// Decodes one UTF-8 sequence at bytes[0]; returns its length, or 1 with
+// cp = 0 when the bytes are not valid UTF-8.
+size_t decodeUtf8(const uint8_t *bytes, size_t size, uint32_t &cp);
+// True when the ESC t page has a ROM glyph for cp (printable ASCII or a
+// table entry); transliterations do not count.
+bool codePageHas(uint32_t cp, uint8_t codePage);
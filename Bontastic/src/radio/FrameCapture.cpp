@@ -0,0 +1,201 @@
+#include "FrameCapture.h"
+#include <LittleFS.h>
+#include <freertos/semphr.h>
+
+static const uint32_t captureMagic = 0x42434101;
+static const size_t captureRecordHeader = sizeof(uint32_t) + sizeof(uint16_t);
+static const uint16_t captureSessionMarker = 0xFFFF;
+
+static SemaphoreHandle_t captureMutex;
+static volatile bool capturing;
+static File captureFile;
+static uint8_t captureBuffer[captureBufferSize];
+static size_t captureUsed;
+static uint32_t captureBytes;
+// millis() when the oldest staged byte was buffered.
+static uint32_t captureStagedAt;
+
+// Caller holds captureMutex.
+static bool flushCapture()
+{
+    if (!captureUsed)
+    {
+        return true;
+    }
+    bool ok = captureFile.write(captureBuffer, captureUsed) == captureUsed;
+    captureFile.flush();
+    captureBytes += captureUsed;
+    captureUsed = 0;
+    return ok;
+}
+
+// Caller holds captureMutex.
+static void stageRecord(uint16_t size, const uint8_t *bytes)
+{
+    uint32_t stamp = millis();
+    if (!captureUsed)
+    {
+        captureStagedAt = stamp;
+    }
+    uint8_t *out = captureBuffer + captureUsed;
+    memcpy(out, &stamp, sizeof(stamp));
+    memcpy(out + sizeof(stamp), &size, sizeof(size));
+    captureUsed += captureRecordHeader;
+    if (bytes)
+    {
+        memcpy(out + captureRecordHeader, bytes, size);
+        captureUsed += size;
+    }
+}
+
+// Caller holds captureMutex.
+static void closeCapture()
+{
+    flushCapture();
+    captureFile.close();
+    capturing = false;
+}
+
+bool frameCaptureStart(bool append)
+{
+    if (!captureMutex)
+    {
+        captureMutex = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(captureMutex, portMAX_DELAY);
+    if (!capturing && LittleFS.begin(true))
+    {
+        captureFile = LittleFS.open(captureFilePath, append ? FILE_APPEND : FILE_WRITE);
+        if (captureFile)
+        {
+            captureBytes = captureFile.size();
+            captureUsed = 0;
+            if (!captureBytes)
+            {
+                memcpy(captureBuffer, &captureMagic, sizeof(captureMagic));
+                captureUsed = sizeof(captureMagic);
+                captureStagedAt = millis();
+            }
+            stageRecord(captureSessionMarker, nullptr);
+            capturing = true;
+            Serial.print("Capture: recording to ");
+            Serial.print(captureFilePath);
+            Serial.print(" at ");
+            Serial.println(captureBytes);
+        }
+    }
+    bool active = capturing;
+    xSemaphoreGive(captureMutex);
+    return active;
+}
+
+void frameCaptureStop()
+{
+    if (!captureMutex)
+    {
+        return;
+    }
+    xSemaphoreTake(captureMutex, portMAX_DELAY);
+    if (capturing)
+    {
+        closeCapture();
+        Serial.print("Capture: stopped at ");
+        Serial.println(captureBytes);
+    }
+    xSemaphoreGive(captureMutex);
+}
+
+bool frameCaptureActive()
+{
+    return capturing;
+}
+
+void captureFrame(const FromRadioFrame &frame)
+{
+    if (!capturing)
+    {
+        return;
+    }
+    xSemaphoreTake(captureMutex, portMAX_DELAY);
+    size_t record = captureRecordHeader + frame.size;
+    if (capturing && captureUsed + record > sizeof(captureBuffer) && !flushCapture())
+    {
+        Serial.println("Capture: write failed, stopping");
+        closeCapture();
+    }
+    if (capturing && captureBytes + captureUsed + record > captureMaxBytes)
+    {
+        Serial.println("Capture: file full, stopping");
+        closeCapture();
+    }
+    if (capturing)
+    {
+        stageRecord(frame.size, frame.bytes);
+        if (millis() - captureStagedAt >= captureFlushInterval && !flushCapture())
+        {
+            Serial.println("Capture: write failed, stopping");
+            closeCapture();
+        }
+    }
+    xSemaphoreGive(captureMutex);
+}
+
+void frameCaptureIdle()
+{
+    if (!capturing)
+    {
+        return;
+    }
+    xSemaphoreTake(captureMutex, portMAX_DELAY);
+    if (capturing && captureUsed && millis() - captureStagedAt >= captureFlushInterval && !flushCapture())
+    {
+        Serial.println("Capture: write failed, stopping");
+        closeCapture();
+    }
+    xSemaphoreGive(captureMutex);
+}
+
+bool CaptureReader::open(const char *path)
+{
+    file = LittleFS.open(path, FILE_READ);
+    if (!file)
+    {
+        return false;
+    }
+    uint32_t magic = 0;
+    if (file.read(reinterpret_cast<uint8_t *>(&magic), sizeof(magic)) != sizeof(magic) || magic != captureMagic)
+    {
+        file.close();
+        return false;
+    }
+    return true;
+}
+
+bool CaptureReader::next(FromRadioFrame &frame, uint32_t &timestamp)
+{
+    uint8_t header[captureRecordHeader];
+    uint16_t size = captureSessionMarker;
+    sessionStart = false;
+    while (size == captureSessionMarker)
+    {
+        if (!file || file.read(header, sizeof(header)) != sizeof(header))
+        {
+            return false;
+        }
+        memcpy(&timestamp, header, sizeof(timestamp));
+        memcpy(&size, header + sizeof(timestamp), sizeof(size));
+        sessionStart |= size == captureSessionMarker;
+    }
+    // A torn final record from a power cut ends the capture.
+    if (size > sizeof(frame.bytes) || file.read(frame.bytes, size) != size)
+    {
+        return false;
+    }
+    frame.size = size;
+    return true;
+}
+
+void CaptureReader::close()
+{
+    file.close();
+}
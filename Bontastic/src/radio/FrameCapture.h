@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include "FromRadioRing.h"
+
+static const char *const captureFilePath = "/capture.bin";
+static const size_t captureBufferSize = 2048;
+static const uint32_t captureMaxBytes = 256 * 1024;
+// Staged frames older than this are written out even if the buffer has room.
+static const uint32_t captureFlushInterval = 30UL * 1000UL;
+
+// Records every raw FromRadio frame the ingest task reads, as
+// [millis u32][size u16][bytes] records after a magic header. Each start
+// writes a session record (size 0xFFFF, no bytes) first, since millis()
+// restarts at every boot. Frames are staged in RAM and appended to flash a
+// buffer at a time, or once captureFlushInterval has passed.
+// append keeps the previous recording, for resuming after a reboot; a fresh
+// start truncates it.
+bool frameCaptureStart(bool append);
+void frameCaptureStop();
+bool frameCaptureActive();
+void captureFrame(const FromRadioFrame &frame);
+// Writes out staged frames once they are captureFlushInterval old, for quiet
+// periods when no new frame arrives to trigger it.
+void frameCaptureIdle();
+
+// Sequential reader for a capture file, for replay and benchmarking.
+class CaptureReader
+{
+public:
+    bool open(const char *path);
+    bool next(FromRadioFrame &frame, uint32_t &timestamp);
+    // True when the frame last returned is the first of a recording session;
+    // its timestamp restarts from the boot that session was recorded in.
+    bool startsSession() const { return sessionStart; }
+    void close();
+
+private:
+    File file;
+    bool sessionStart = false;
+};
@@ -0,0 +1,28 @@
+#include "FromNumQueue.h"
+
+void FromNumQueue::push(uint32_t value)
+{
+    latest.store(value, std::memory_order_release);
+    total.store(total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= fromNumQueueSize)
+    {
+        overflow.store(overflow.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    values[h & (fromNumQueueSize - 1)] = value;
+    head.store(h + 1, std::memory_order_release);
+}
+
+bool FromNumQueue::pop(uint32_t &value)
+{
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    value = values[t & (fromNumQueueSize - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+static const size_t fromNumQueueSize = 64;
+
+static_assert((fromNumQueueSize & (fromNumQueueSize - 1)) == 0, "queue size must be a power of two");
+
+// Lock-free single-producer/single-consumer queue of FromNum notify values.
+// The BLE host task pushes, the ingest task pops. If the consumer falls a whole
+// queue behind, the newest value is still published through newest(), so the
+// drain target is never lost even when individual entries are.
+class FromNumQueue
+{
+public:
+    void push(uint32_t value);
+    bool pop(uint32_t &value);
+
+    uint32_t newest() const { return latest.load(std::memory_order_acquire); }
+    uint32_t pushed() const { return total.load(std::memory_order_relaxed); }
+    uint32_t overflowed() const { return overflow.load(std::memory_order_relaxed); }
+
+private:
+    uint32_t values[fromNumQueueSize];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    std::atomic<uint32_t> latest{0};
+    std::atomic<uint32_t> total{0};
+    std::atomic<uint32_t> overflow{0};
+};
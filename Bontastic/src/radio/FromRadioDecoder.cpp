@@ -0,0 +1,68 @@
+#include "FromRadioDecoder.h"
+#include "../nanopb/pb_decode.h"
+
+static bool decodePacket(pb_istream_t &stream, const FromRadioHandlers &handlers)
+{
+    meshtastic_MeshPacket packet = meshtastic_MeshPacket_init_zero;
+    if (!pb_decode_delimited(&stream, meshtastic_MeshPacket_fields, &packet))
+    {
+        return false;
+    }
+    handlers.onPacket(packet);
+    return true;
+}
+
+static bool decodeNodeInfo(pb_istream_t &stream, const FromRadioHandlers &handlers)
+{
+    meshtastic_NodeInfo info = meshtastic_NodeInfo_init_zero;
+    if (!pb_decode_delimited(&stream, meshtastic_NodeInfo_fields, &info))
+    {
+        return false;
+    }
+    handlers.onNodeInfo(info);
+    return true;
+}
+
+static bool decodeConfigComplete(pb_istream_t &stream, const FromRadioHandlers &handlers)
+{
+    uint32_t configId;
+    if (!pb_decode_varint32(&stream, &configId))
+    {
+        return false;
+    }
+    handlers.onConfigComplete(configId);
+    return true;
+}
+
+bool decodeFromRadio(const uint8_t *bytes, size_t size, const FromRadioHandlers &handlers)
+{
+    pb_istream_t stream = pb_istream_from_buffer(bytes, size);
+    pb_wire_type_t wireType;
+    uint32_t tag;
+    bool eof;
+    while (pb_decode_tag(&stream, &wireType, &tag, &eof))
+    {
+        bool ok;
+        if (tag == meshtastic_FromRadio_packet_tag && wireType == PB_WT_STRING && handlers.onPacket)
+        {
+            ok = decodePacket(stream, handlers);
+        }
+        else if (tag == meshtastic_FromRadio_node_info_tag && wireType == PB_WT_STRING && handlers.onNodeInfo)
+        {
+            ok = decodeNodeInfo(stream, handlers);
+        }
+        else if (tag == meshtastic_FromRadio_config_complete_id_tag && wireType == PB_WT_VARINT && handlers.onConfigComplete)
+        {
+            ok = decodeConfigComplete(stream, handlers);
+        }
+        else
+        {
+            ok = pb_skip_field(&stream, wireType);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return eof;
+}
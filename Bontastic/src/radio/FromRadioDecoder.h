@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../protobufs/mesh.pb.h"
+
+// Handlers for the FromRadio payload variants we act on. A null entry means the
+// variant is skipped on the wire without being decoded.
+struct FromRadioHandlers
+{
+    void (*onPacket)(const meshtastic_MeshPacket &packet);
+    void (*onNodeInfo)(const meshtastic_NodeInfo &info);
+    void (*onConfigComplete)(uint32_t configId);
+};
+
+// Walks the top-level FromRadio fields tag by tag and decodes only the
+// submessages that have a handler, each into its own right-sized struct
+// instead of the full meshtastic_FromRadio union.
+bool decodeFromRadio(const uint8_t *bytes, size_t size, const FromRadioHandlers &handlers);
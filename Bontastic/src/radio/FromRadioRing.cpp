@@ -0,0 +1,65 @@
+#include "FromRadioRing.h"
+#include "../nanopb/pb_decode.h"
+
+FromRadioFrame *FromRadioRing::acquire()
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= fromRadioSlotCount)
+    {
+        return nullptr;
+    }
+    FromRadioFrame *slot = &slots[h & (fromRadioSlotCount - 1)];
+    slot->size = 0;
+    return slot;
+}
+
+void FromRadioRing::publish()
+{
+    uint32_t h = head.load(std::memory_order_relaxed) + 1;
+    head.store(h, std::memory_order_release);
+    size_t used = h - tail.load(std::memory_order_acquire);
+    if (used > peak)
+    {
+        peak = used;
+    }
+}
+
+FromRadioFrame *FromRadioRing::front()
+{
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    return &slots[t & (fromRadioSlotCount - 1)];
+}
+
+void FromRadioRing::release()
+{
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+size_t FromRadioRing::count() const
+{
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+pb_size_t peekFromRadioVariant(const FromRadioFrame &frame)
+{
+    pb_istream_t stream = pb_istream_from_buffer(frame.bytes, frame.size);
+    pb_wire_type_t wireType;
+    uint32_t tag;
+    bool eof;
+    while (pb_decode_tag(&stream, &wireType, &tag, &eof))
+    {
+        if (tag != meshtastic_FromRadio_id_tag)
+        {
+            return tag;
+        }
+        if (!pb_skip_field(&stream, wireType))
+        {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "../nanopb/pb.h"
+#include "../protobufs/mesh.pb.h"
+
+// One slot holds the largest encoded FromRadio, rounded up to a word multiple.
+static const size_t fromRadioSlotSize = (meshtastic_FromRadio_size + 3) & ~static_cast<size_t>(3);
+static const size_t fromRadioSlotCount = 8;
+
+static_assert(fromRadioSlotSize >= meshtastic_FromRadio_size, "FromRadio slot too small");
+static_assert((fromRadioSlotCount & (fromRadioSlotCount - 1)) == 0, "slot count must be a power of two");
+
+struct FromRadioFrame
+{
+    uint16_t size;
+    uint8_t bytes[fromRadioSlotSize];
+};
+
+// Fixed single-producer/single-consumer ring of frame slots. The producer fills
+// the slot returned by acquire() in place and hands it over with publish(); the
+// consumer decodes front() in place and gives it back with release().
+class FromRadioRing
+{
+public:
+    FromRadioFrame *acquire();
+    void publish();
+    FromRadioFrame *front();
+    void release();
+
+    size_t count() const;
+    size_t highWater() const { return peak; }
+
+private:
+    FromRadioFrame slots[fromRadioSlotCount];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    size_t peak = 0;
+};
+
+// Returns the payload_variant tag of an encoded frame without decoding it,
+// or 0 if the frame carries none.
+pb_size_t peekFromRadioVariant(const FromRadioFrame &frame);
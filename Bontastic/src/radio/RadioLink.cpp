@@ -0,0 +1,446 @@
+#include "RadioLink.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <atomic>
+#include "../nanopb/pb_encode.h"
+#include "../pipeline/Pipeline.h"
+#include "../printer/PrintHelpers.h"
+#include "../printer/PrinterControl.h"
+#include "../protobufs/mesh.pb.h"
+
+static const char *targetService = "6ba1b218-15a8-461f-9fa8-5dcae273eafd";
+static const char *uuidFromRadio = "2c55e69e-4993-11ed-b878-0242ac120002";
+static const char *uuidToRadio = "f75c76d2-129e-4dad-a1dd-7866124401e7";
+static const char *uuidFromNum = "ed9da18c-a800-4f66-a670-aa7547e34453";
+
+static const char *deviceInfoServiceUuid = "180a";
+static const char *manufacturerUuid = "2a29";
+static const char *modelNumberUuid = "2a24";
+static const char *serialNumberUuid = "2a25";
+static const char *hardwareRevUuid = "2a27";
+static const char *firmwareRevUuid = "2a26";
+static const char *softwareRevUuid = "2a28";
+
+static const uint32_t scanDurationMs = 5000;
+static const uint16_t scanIntervalMs = 100;
+static const uint32_t connectTimeoutMs = 5000;
+static const unsigned long minBackoffMs = 1000;
+static const unsigned long maxBackoffMs = 30000;
+static const uint8_t maxDirectFailures = 3;
+
+enum LinkState : uint8_t
+{
+    LinkIdle,
+    LinkDirect,
+    LinkScan,
+    LinkScanning,
+    LinkSetup,
+    LinkStreaming,
+    LinkBackoff
+};
+
+static LinkState state = LinkIdle;
+static NimBLEClient *client;
+static NimBLEAddress peerAddress;
+static bool havePeer;
+static bool viaDirect;
+static uint8_t directFailures;
+static bool printedDeviceInfo;
+static uint32_t wantConfigId;
+static unsigned long backoffMs = minBackoffMs;
+static unsigned long retryAt;
+static std::atomic<bool> linkLost{false};
+static std::atomic<bool> scanMatched{false};
+static std::atomic<bool> scanEnded{false};
+static NimBLEAddress scanAddress;
+static std::atomic<NimBLERemoteCharacteristic *> fromRadio{nullptr};
+// Reads between radioAcquireFromRadio() and radioReleaseFromRadio().
+static std::atomic<uint8_t> fromRadioReaders{0};
+static Preferences linkPrefs;
+
+class ClientCallbacks : public NimBLEClientCallbacks
+{
+    void onConnect(NimBLEClient *) override
+    {
+        Serial.println("Connected");
+    }
+
+    void onDisconnect(NimBLEClient *, int reason) override
+    {
+        Serial.print("Disconnected ");
+        Serial.println(reason);
+        fromRadio = nullptr;
+        linkLost = true;
+    }
+
+    void onPassKeyEntry(NimBLEConnInfo &info) override
+    {
+        Serial.println("Passkey requested");
+        uint32_t passkey = atoi(getPrinterSettings().meshPin);
+        NimBLEDevice::injectPassKey(info, passkey);
+    }
+
+    void onAuthenticationComplete(NimBLEConnInfo &) override
+    {
+        Serial.println("Bonded");
+    }
+} clientCallbacks;
+
+// Runs on the NimBLE host task for every advertiser; the scan stops at the
+// first radio that advertises the Meshtastic service under our mesh name.
+class ScanCallbacks : public NimBLEScanCallbacks
+{
+    void onResult(const NimBLEAdvertisedDevice *device) override
+    {
+        if (scanMatched || !device->isAdvertisingService(NimBLEUUID(targetService)))
+        {
+            return;
+        }
+        if (device->getName() != getPrinterSettings().meshName)
+        {
+            return;
+        }
+        scanAddress = device->getAddress();
+        scanMatched = true;
+        NimBLEDevice::getScan()->stop();
+    }
+
+    void onScanEnd(const NimBLEScanResults &, int) override
+    {
+        scanEnded = true;
+    }
+} scanCallbacks;
+
+// The cached peer is only trusted for the mesh name it was found under.
+static void loadPeer()
+{
+    havePeer = false;
+    if (!linkPrefs.begin("radio", true))
+    {
+        return;
+    }
+    String name = linkPrefs.getString("peerName", "");
+    String addr = linkPrefs.getString("peer", "");
+    uint8_t type = linkPrefs.getUChar("peerType", 0);
+    linkPrefs.end();
+    if (addr.length() && name == getPrinterSettings().meshName)
+    {
+        peerAddress = NimBLEAddress(std::string(addr.c_str()), type);
+        havePeer = true;
+    }
+}
+
+static void savePeer(const NimBLEAddress &address)
+{
+    if (havePeer && address == peerAddress)
+    {
+        return;
+    }
+    peerAddress = address;
+    havePeer = true;
+    if (!linkPrefs.begin("radio", false))
+    {
+        return;
+    }
+    linkPrefs.putString("peer", address.toString().c_str());
+    linkPrefs.putUChar("peerType", address.getType());
+    linkPrefs.putString("peerName", getPrinterSettings().meshName);
+    linkPrefs.end();
+}
+
+// A cached peer that keeps connecting but never finishes setup (changed
+// bonding, wrong service, a different node now at that address) is dropped
+// so the next attempt scans for the mesh name again.
+static void forgetPeer()
+{
+    Serial.println("Forgetting cached peer");
+    havePeer = false;
+    directFailures = 0;
+    if (!linkPrefs.begin("radio", false))
+    {
+        return;
+    }
+    linkPrefs.remove("peer");
+    linkPrefs.remove("peerType");
+    linkPrefs.remove("peerName");
+    linkPrefs.end();
+}
+
+static void scheduleRetry(const char *reason)
+{
+    Serial.print(reason);
+    Serial.print(", retry in ");
+    Serial.print(backoffMs);
+    Serial.println(" ms");
+    if (client && client->isConnected())
+    {
+        client->disconnect();
+    }
+    fromRadio = nullptr;
+    retryAt = millis() + backoffMs;
+    backoffMs = backoffMs * 2 > maxBackoffMs ? maxBackoffMs : backoffMs * 2;
+    state = LinkBackoff;
+}
+
+static bool connectDirect()
+{
+    Serial.print("Connecting to cached peer ");
+    Serial.println(peerAddress.toString().c_str());
+    return client->connect(peerAddress, false);
+}
+
+static void startScan()
+{
+    scanMatched = false;
+    scanEnded = false;
+    NimBLEScan *scan = NimBLEDevice::getScan();
+    scan->setScanCallbacks(&scanCallbacks, false);
+    scan->setActiveScan(true);
+    scan->setInterval(scanIntervalMs);
+    scan->setWindow(scanIntervalMs);
+    // Results are handled in the callback; keeping none saves RAM at busy sites.
+    scan->setMaxResults(0);
+    if (!scan->start(scanDurationMs, false, true))
+    {
+        scanEnded = true;
+    }
+    Serial.println("Scanning");
+}
+
+// The ingest task may still be inside a read of the characteristic it last
+// acquired; that read ends within remoteReadTimeoutMs.
+static void waitFromRadioIdle()
+{
+    fromRadio = nullptr;
+    while (fromRadioReaders.load() != 0)
+    {
+        delay(1);
+    }
+}
+
+static bool connectScanned()
+{
+    Serial.print("Target ");
+    Serial.print(scanAddress.toString().c_str());
+    Serial.print(" ");
+    Serial.println(getPrinterSettings().meshName);
+    if (!havePeer || !(scanAddress == peerAddress))
+    {
+        waitFromRadioIdle();
+        client->deleteServices();
+    }
+    Serial.println("Connecting");
+    return client->connect(scanAddress, false);
+}
+
+static void printDeviceInfo()
+{
+    NimBLERemoteService *deviceInfo = client->getService(deviceInfoServiceUuid);
+    if (!deviceInfo)
+    {
+        return;
+    }
+    Serial.println("DeviceInformationService");
+
+    auto printChar = [&](const char *name, const char *uuid)
+    {
+        NimBLERemoteCharacteristic *c = deviceInfo->getCharacteristic(uuid);
+        if (!c)
+        {
+            return;
+        }
+        std::string v = c->readValue();
+        printInfo(name, v.c_str());
+    };
+
+    printChar("Manufacturer", manufacturerUuid);
+    printChar("Model", modelNumberUuid);
+    printChar("Serial", serialNumberUuid);
+    printChar("HW", hardwareRevUuid);
+    printChar("FW", firmwareRevUuid);
+    printChar("SW", softwareRevUuid);
+}
+
+static bool setupLink()
+{
+    if (!printedDeviceInfo)
+    {
+        printDeviceInfo();
+        printedDeviceInfo = true;
+    }
+
+    Serial.println("Securing");
+    if (!client->secureConnection())
+    {
+        Serial.println("Secure start failed");
+    }
+
+    NimBLERemoteService *service = client->getService(targetService);
+    if (!service)
+    {
+        Serial.println("Service not found");
+        return false;
+    }
+
+    Serial.print("Service ");
+    Serial.println(targetService);
+
+    NimBLERemoteCharacteristic *fromRadioChar = service->getCharacteristic(uuidFromRadio);
+    NimBLERemoteCharacteristic *toRadio = service->getCharacteristic(uuidToRadio);
+    NimBLERemoteCharacteristic *fromNum = service->getCharacteristic(uuidFromNum);
+    if (!fromRadioChar || !toRadio || !fromNum)
+    {
+        Serial.println("Characteristic missing");
+        return false;
+    }
+
+    auto notifyCallback = [](NimBLERemoteCharacteristic *characteristic, uint8_t *data, size_t length, bool isNotify)
+    {
+        if (!isNotify || length < sizeof(uint32_t))
+        {
+            return;
+        }
+        uint32_t num = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+        pipelineAnnounce(num);
+    };
+
+    if (!fromNum->subscribe(true, notifyCallback, true))
+    {
+        Serial.println("FromNum subscribe failed");
+    }
+
+    meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
+    req.which_payload_variant = meshtastic_ToRadio_want_config_id_tag;
+    req.want_config_id = wantConfigId++;
+
+    uint8_t buffer[16];
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
+    if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
+    {
+        Serial.println("Start config encode failed");
+        return false;
+    }
+
+    Serial.println("Request config");
+    if (!toRadio->writeValue(buffer, ostream.bytes_written, true))
+    {
+        Serial.println("Start config failed");
+        return false;
+    }
+
+    fromRadio = fromRadioChar;
+    Serial.println("Reading FromRadio");
+    pipelineWake();
+    return true;
+}
+
+void radioLinkBegin()
+{
+    wantConfigId = millis() & 0xFFFF;
+    client = NimBLEDevice::createClient();
+    if (!client)
+    {
+        Serial.println("Client create failed");
+        return;
+    }
+    client->setClientCallbacks(&clientCallbacks, false);
+    client->setConnectTimeout(connectTimeoutMs);
+    loadPeer();
+    state = havePeer ? LinkDirect : LinkScan;
+}
+
+void radioLinkLoop()
+{
+    if (!client)
+    {
+        return;
+    }
+
+    switch (state)
+    {
+    case LinkIdle:
+        break;
+
+    case LinkDirect:
+        linkLost = false;
+        viaDirect = true;
+        state = connectDirect() ? LinkSetup : LinkScan;
+        break;
+
+    case LinkScan:
+        startScan();
+        state = LinkScanning;
+        break;
+
+    case LinkScanning:
+        if (scanMatched)
+        {
+            linkLost = false;
+            viaDirect = false;
+            if (connectScanned())
+            {
+                state = LinkSetup;
+            }
+            else
+            {
+                scheduleRetry("Connect failed");
+            }
+        }
+        else if (scanEnded)
+        {
+            scheduleRetry("Target not found");
+        }
+        break;
+
+    case LinkSetup:
+        if (setupLink())
+        {
+            savePeer(client->getPeerAddress());
+            directFailures = 0;
+            backoffMs = minBackoffMs;
+            state = LinkStreaming;
+        }
+        else
+        {
+            if (viaDirect && ++directFailures >= maxDirectFailures)
+            {
+                forgetPeer();
+            }
+            scheduleRetry("Link setup failed");
+        }
+        break;
+
+    case LinkStreaming:
+        if (linkLost)
+        {
+            scheduleRetry("Link lost");
+        }
+        break;
+
+    case LinkBackoff:
+        if ((long)(millis() - retryAt) >= 0)
+        {
+            loadPeer();
+            state = havePeer ? LinkDirect : LinkScan;
+        }
+        break;
+    }
+}
+
+bool radioLinkStreaming()
+{
+    return state == LinkStreaming;
+}
+
+NimBLERemoteCharacteristic *radioAcquireFromRadio()
+{
+    // Counted before the load, so waitFromRadioIdle() cannot miss a reader
+    // that saw the old pointer.
+    fromRadioReaders++;
+    return fromRadio;
+}
+
+void radioReleaseFromRadio()
+{
+    fromRadioReaders--;
+}
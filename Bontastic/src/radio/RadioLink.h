@@ -0,0 +1,14 @@
+#pragma once
+
+#include <NimBLEDevice.h>
+
+// Owns the BLE client connection to the Meshtastic radio. Connects straight to
+// the last good peer address when one is known, falls back to a filtered scan,
+// and reconnects with exponential backoff whenever the link drops.
+void radioLinkBegin();
+void radioLinkLoop();
+bool radioLinkStreaming();
+// Pins the FromRadio characteristic (null when not streaming) against the
+// link deleting its services; every acquire is paired with a release.
+NimBLERemoteCharacteristic *radioAcquireFromRadio();
+void radioReleaseFromRadio();
@@ -0,0 +1,115 @@
+#include "RemoteRead.h"
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/semphr.h>
+
+enum RemoteReadState : uint8_t
+{
+    ReadIdle,
+    ReadRunning,
+    ReadDone,
+    ReadAbandoned // timed out; the callback still owns the procedure
+};
+
+struct RemoteReadContext
+{
+    uint8_t *buffer;
+    size_t capacity;
+    size_t length;
+    int status;
+    bool overflow;
+};
+
+// One long read at a time: the ingest task is the only reader, and a read
+// abandoned after a timeout keeps the slot until NimBLE completes it.
+static RemoteReadContext readContext;
+static std::atomic<uint8_t> readState{ReadIdle};
+static SemaphoreHandle_t readDone;
+
+static int onReadChunk(uint16_t, const ble_gatt_error *error, ble_gatt_attr *attr, void *arg)
+{
+    RemoteReadContext *ctx = static_cast<RemoteReadContext *>(arg);
+    if (error->status == 0 && attr)
+    {
+        // The caller has given up on an abandoned read; leave its buffer be.
+        if (readState.load() == ReadAbandoned)
+        {
+            return 0;
+        }
+        uint16_t chunk = OS_MBUF_PKTLEN(attr->om);
+        if (ctx->length + chunk > ctx->capacity)
+        {
+            ctx->overflow = true;
+            chunk = ctx->capacity - ctx->length;
+        }
+        os_mbuf_copydata(attr->om, 0, chunk, ctx->buffer + ctx->length);
+        ctx->length += chunk;
+        return 0;
+    }
+    ctx->status = error->status == BLE_HS_EDONE ? 0 : error->status;
+    if (readState.exchange(ReadDone) == ReadAbandoned)
+    {
+        readState.store(ReadIdle);
+        return 0;
+    }
+    xSemaphoreGive(readDone);
+    return 0;
+}
+
+bool readRemoteValue(NimBLERemoteCharacteristic *characteristic, uint8_t *buffer, size_t capacity, size_t &length)
+{
+    length = 0;
+    if (!characteristic)
+    {
+        return false;
+    }
+    if (!readDone)
+    {
+        readDone = xSemaphoreCreateBinary();
+    }
+    uint8_t idle = ReadIdle;
+    if (!readState.compare_exchange_strong(idle, ReadRunning))
+    {
+        Serial.println("Read still pending");
+        return false;
+    }
+
+    readContext = {buffer, capacity, 0, 0, false};
+    uint16_t conn = characteristic->getClient()->getConnHandle();
+    int rc = ble_gattc_read_long(conn, characteristic->getHandle(), 0, onReadChunk, &readContext);
+    if (rc != 0)
+    {
+        readState.store(ReadIdle);
+        Serial.print("Read start failed ");
+        Serial.println(rc);
+        return false;
+    }
+    if (xSemaphoreTake(readDone, pdMS_TO_TICKS(remoteReadTimeoutMs)) != pdTRUE)
+    {
+        uint8_t running = ReadRunning;
+        if (readState.compare_exchange_strong(running, ReadAbandoned))
+        {
+            // NimBLE finishes the procedure on its ATT timeout or the
+            // disconnect at the latest; until then reads are refused.
+            Serial.println("Read timed out");
+            return false;
+        }
+        // Completed just as the wait ran out.
+        xSemaphoreTake(readDone, portMAX_DELAY);
+    }
+    RemoteReadContext ctx = readContext;
+    readState.store(ReadIdle);
+    if (ctx.status != 0)
+    {
+        Serial.print("Read failed ");
+        Serial.println(ctx.status);
+        return false;
+    }
+    if (ctx.overflow)
+    {
+        Serial.println("Read truncated");
+        return false;
+    }
+    length = ctx.length;
+    return true;
+}
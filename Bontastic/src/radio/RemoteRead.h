@@ -0,0 +1,15 @@
+#pragma once
+
+#include <NimBLEDevice.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// How long a read may take before the caller gives up on it; a FromRadio
+// packet is a few ATT round trips.
+static const uint32_t remoteReadTimeoutMs = 2000;
+
+// Reads a remote characteristic straight into a caller-owned buffer using the
+// NimBLE long-read procedure, so no heap-backed value copy is made per read.
+// Single caller only: a read started while another is still in flight, or a
+// timed-out one that NimBLE has not completed yet, fails at once.
+bool readRemoteValue(NimBLERemoteCharacteristic *characteristic, uint8_t *buffer, size_t capacity, size_t &length);
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Generates src/printer/CodePageTables.h from Python's codecs.
+
+For every ESC t code page Python knows, emits the Unicode code points of
+bytes 0x80-0xFF sorted for binary search, plus a shared ASCII
+transliteration table for characters a page cannot show.
+
+    python3 tools/gen_codepages.py > src/printer/CodePageTables.h
+"""
+
+import unicodedata
+
+# ESC t number -> Python codec, following the QR204 code page list.
+PAGES = [
+    (0, "cp437"), (2, "cp850"), (3, "cp860"), (4, "cp863"), (5, "cp865"),
+    (6, "cp1251"), (7, "cp866"), (15, "cp862"), (16, "cp1252"),
+    (17, "cp1253"), (18, "cp852"), (19, "cp858"), (22, "cp864"),
+    (23, "latin_1"), (24, "cp737"), (25, "cp1257"), (27, "cp720"),
+    (28, "cp855"), (29, "cp857"), (30, "cp1250"), (31, "cp775"),
+    (32, "cp1254"), (33, "cp1255"), (34, "cp1256"), (35, "cp1258"),
+    (36, "iso8859_2"), (37, "iso8859_3"), (38, "iso8859_4"),
+    (39, "iso8859_5"), (40, "iso8859_6"), (41, "iso8859_7"),
+    (42, "iso8859_8"), (43, "iso8859_9"), (44, "iso8859_15"),
+    (46, "cp856"), (47, "cp874"),
+]
+
+PUNCTUATION = {
+    0x00A0: " ", 0x00A9: "(c)", 0x00AB: "<<", 0x00AE: "(R)", 0x00B0: "o",
+    0x00B7: ".", 0x00BB: ">>", 0x00D7: "x", 0x00DF: "ss", 0x00C6: "AE",
+    0x00E6: "ae", 0x00D8: "O", 0x00F8: "o", 0x0110: "D", 0x0111: "d",
+    0x0141: "L", 0x0142: "l", 0x0152: "OE", 0x0153: "oe", 0x00D0: "D",
+    0x00F0: "d", 0x00DE: "Th", 0x00FE: "th", 0x0131: "i",
+    0x2010: "-", 0x2011: "-", 0x2012: "-", 0x2013: "-", 0x2014: "-",
+    0x2015: "-", 0x2018: "'", 0x2019: "'", 0x201A: ",", 0x201B: "'",
+    0x201C: '"', 0x201D: '"', 0x201E: '"', 0x201F: '"', 0x2020: "+",
+    0x2022: "*", 0x2026: "...", 0x2032: "'", 0x2033: '"', 0x2039: "<",
+    0x203A: ">", 0x20AC: "EUR", 0x2122: "TM", 0x2190: "<-", 0x2192: "->",
+    0x2191: "^", 0x2193: "v", 0x2212: "-", 0x2713: "v", 0x2714: "v",
+    0x2717: "x", 0x2718: "x", 0x00BD: "1/2", 0x00BC: "1/4", 0x00BE: "3/4",
+}
+
+CYRILLIC = "A B V G D E Zh Z I Y K L M N O P R S T U F Kh Ts Ch Sh Shch \" Y ' E Yu Ya".split()
+GREEK = {
+    0x0391: "A", 0x0392: "V", 0x0393: "G", 0x0394: "D", 0x0395: "E",
+    0x0396: "Z", 0x0397: "I", 0x0398: "Th", 0x0399: "I", 0x039A: "K",
+    0x039B: "L", 0x039C: "M", 0x039D: "N", 0x039E: "X", 0x039F: "O",
+    0x03A0: "P", 0x03A1: "R", 0x03A3: "S", 0x03A4: "T", 0x03A5: "Y",
+    0x03A6: "F", 0x03A7: "Ch", 0x03A8: "Ps", 0x03A9: "O",
+}
+
+
+def page_table(codec):
+    entries = []
+    for b in range(0x80, 0x100):
+        try:
+            ch = bytes([b]).decode(codec)
+        except UnicodeDecodeError:
+            continue
+        cp = ord(ch)
+        # C1 controls are not glyphs; never emit them.
+        if cp < 0xA0 or cp > 0xFFFF:
+            continue
+        entries.append((cp, b))
+    # First byte wins if a page maps a code point twice.
+    seen = {}
+    for cp, b in entries:
+        seen.setdefault(cp, b)
+    return sorted(seen.items())
+
+
+def translit_table():
+    table = {}
+    for cp in range(0x00A0, 0x0250):
+        base = unicodedata.normalize("NFKD", chr(cp))
+        ascii_only = "".join(c for c in base if ord(c) < 0x80 and c.isprintable())
+        if ascii_only and len(ascii_only) <= 4:
+            table[cp] = ascii_only
+    for i, text in enumerate(CYRILLIC):
+        table[0x0410 + i] = text
+        table[0x0430 + i] = text.lower()
+    table[0x0401] = "E"
+    table[0x0451] = "e"
+    for cp, text in GREEK.items():
+        table[cp] = text
+        if cp + 0x20 <= 0x03C9 and cp != 0x03A2:
+            table[cp + 0x20] = text.lower()
+    table[0x03C2] = "s"
+    # Accented Greek and Cyrillic letters fall back to their base letter.
+    for cp in range(0x0370, 0x0500):
+        base = ord(unicodedata.normalize("NFD", chr(cp))[0])
+        if cp not in table and base in table:
+            table[cp] = table[base]
+    table.update(PUNCTUATION)
+    return sorted(table.items())
+
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def main():
+    print("// Generated by tools/gen_codepages.py; do not edit.")
+    print("#pragma once")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("struct CodePageTable")
+    print("{")
+    print("    uint8_t escT;")
+    print("    uint8_t count;")
+    print("    const uint16_t *codepoints; // sorted")
+    print("    const uint8_t *bytes;")
+    print("};")
+    print()
+    for number, codec in PAGES:
+        entries = page_table(codec)
+        name = "page%d" % number
+        print("// ESC t %d: %s" % (number, codec))
+        print("static const uint16_t %sCodepoints[] = {" % name)
+        for i in range(0, len(entries), 12):
+            row = ", ".join("0x%04X" % cp for cp, _ in entries[i:i + 12])
+            print("    %s," % row)
+        print("};")
+        print("static const uint8_t %sBytes[] = {" % name)
+        for i in range(0, len(entries), 16):
+            row = ", ".join("0x%02X" % b for _, b in entries[i:i + 16])
+            print("    %s," % row)
+        print("};")
+    print()
+    print("static const CodePageTable codePageTables[] = {")
+    for number, codec in PAGES:
+        name = "page%d" % number
+        print("    {%d, sizeof(%sBytes), %sCodepoints, %sBytes}," % (number, name, name, name))
+    print("};")
+    print()
+    translit = translit_table()
+    print("// ASCII stand-ins for characters missing from the active code page.")
+    print("static const uint16_t translitCodepoints[] = {")
+    for i in range(0, len(translit), 12):
+        print("    %s," % ", ".join("0x%04X" % cp for cp, _ in translit[i:i + 12]))
+    print("};")
+    print("static const char translitText[][5] = {")
+    for i in range(0, len(translit), 12):
+        print("    %s," % ", ".join(c_string(t) for _, t in translit[i:i + 12]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
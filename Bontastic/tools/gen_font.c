@@ -0,0 +1,287 @@
+/*
+ * Generates src/printer/RasterFont.h: a 1bpp, run-length compressed subset
+ * of a TrueType font for the raster text renderer.
+ *
+ *   cc tools/gen_font.c $(pkg-config --cflags --libs freetype2) -o gen_font
+ *   ./gen_font /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf [fallback.ttf ...] > src/printer/RasterFont.h
+ *
+ * Each code point comes from the first font that has it, so a CJK font such
+ * as Noto Sans CJK or Unifont can be passed after DejaVu for the ideographs
+ * and kana below; code points no font has are left out and print as a box.
+ * Glyphs are rendered with FreeType's monochrome hinter at a pixel size that
+ * fits ascender + descender into rasterFontHeight rows, and every font is
+ * placed on the first font's baseline. Each bitmap is stored
+ * row-major as alternating white/black run lengths starting with white, packed
+ * as nibbles (high nibble first): 0-14 ends a run, 15 adds 15 and continues
+ * it. A trailing white run is omitted and every glyph starts on a byte.
+ */
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FONT_HEIGHT 24
+
+static const unsigned ranges[][2] = {
+    {0x0020, 0x007E}, /* ASCII */
+    {0x00A0, 0x017F}, /* Latin-1, Latin Extended-A */
+    {0x0218, 0x021B}, /* Romanian comma-below letters */
+    {0x0300, 0x036F}, /* combining diacritics */
+    {0x0370, 0x03FF}, /* Greek */
+    {0x0400, 0x04FF}, /* Cyrillic */
+    {0x0530, 0x058F}, /* Armenian */
+    {0x05D0, 0x05EA}, /* Hebrew letters */
+    {0x10A0, 0x10FF}, /* Georgian */
+    {0x1E00, 0x1EFF}, /* Latin Extended Additional (Vietnamese) */
+    {0x2010, 0x205E}, /* punctuation */
+    {0x20A0, 0x20BF}, /* currency */
+    {0x2100, 0x214F}, /* letterlike */
+    {0x2190, 0x21FF}, /* arrows */
+    {0x2200, 0x22FF}, /* math operators */
+    {0x2500, 0x25FF}, /* box drawing, blocks, shapes */
+    {0x2600, 0x26FF}, /* miscellaneous symbols */
+    {0x2700, 0x27BF}, /* dingbats */
+    {0x3000, 0x303F}, /* CJK punctuation */
+    {0x3040, 0x30FF}, /* hiragana, katakana */
+    {0xFF01, 0xFF5E}, /* fullwidth ASCII */
+    {0x1F300, 0x1F5FF}, /* pictographs */
+    {0x1F600, 0x1F64F}, /* emoticons */
+    {0x1F680, 0x1F6FF}, /* transport and map */
+    {0x1F900, 0x1F9FF}, /* supplemental pictographs */
+};
+
+/* The most frequent hanzi/kanji and hangul syllables; the full blocks would
+ * not fit in flash. */
+static const char commonCjk[] =
+    "的一是不了在人有我他这个们中来上大为和国地到以说时要就出会可也你对生能而子那得于着下自之年过发后作里用道行所然"
+    "家种事成方多经么去法学如都同现当没动面起看定天分还进好小部其些主样理心她本前开但因只从想实日军者意无力它与长把"
+    "机十民第公此已工使情明性知全三又关点正业外将两高间由问很最重并物手应战向头文体政美相见被利什二等产或新己制身果"
+    "加西斯月话合回特代内信表化老给世位次度门任常先海通教儿原东声提立及比员解水名真论处走义各入几口认条平系气题活"
+    "尔更别打女变四神总何电数安少报才结反受目太量再感建务做接必场件计管期市直德资命山金指克许统区保至队形社便空决"
+    "治展马科司五基眼书非则听白却界达光放强即像难且权思王象完设式色路记南品住告类求据程北边死张该交规万取拉格望觉"
+    "术领共确传师观清今切院让识候带导争运笑飞风步改收根干造言联持组每济车亲极林服快办议往元英士证近失转夫令准布始"
+    "怎呢存未远叫台单影具罗字爱击流备兵连调深商算质团集百需价花党华城石级整府离况亚请技际约示复病息究线似官火断精"
+    "满支视消越器容照须九增研写称企八功吗包片史委乎查轻易早曾除农找装广显吧阿李标谈吃图念六引历首医局突专费号尾"
+    "們個來時會對說過還進後國學開見問長電現發點話員關當無爲經與讓給東動機點車頭"
+    "日本語私東京大阪月火水木金土円駅"
+    "이가은는을를의에와과도로하고다니요있습없어서한국사람안녕감사합니다네아요";
+
+struct glyph
+{
+    unsigned codepoint, offset;
+    int advance, width, height, left, top;
+};
+
+static unsigned codepoints[8192];
+static int codepointCount;
+static struct glyph glyphs[8192];
+static unsigned char data[1 << 20];
+static unsigned dataSize;
+static int glyphCount;
+
+static int nibbleHigh = 1;
+
+static void emitNibble(unsigned nibble)
+{
+    if (nibbleHigh)
+    {
+        data[dataSize++] = (unsigned char)(nibble << 4);
+    }
+    else
+    {
+        data[dataSize - 1] |= (unsigned char)nibble;
+    }
+    nibbleHigh = !nibbleHigh;
+}
+
+static void emitRun(unsigned run)
+{
+    while (run >= 15)
+    {
+        emitNibble(15);
+        run -= 15;
+    }
+    emitNibble(run);
+}
+
+static int compareCodepoints(const void *a, const void *b)
+{
+    unsigned x = *(const unsigned *)a;
+    unsigned y = *(const unsigned *)b;
+    return x < y ? -1 : x > y;
+}
+
+/* Decodes the next UTF-8 sequence of a well-formed string. */
+static unsigned nextUtf8(const unsigned char **p)
+{
+    unsigned cp = *(*p)++;
+    int more = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+    cp &= 0x3F >> more;
+    while (more--)
+    {
+        cp = (cp << 6) | (*(*p)++ & 0x3F);
+    }
+    return cp;
+}
+
+/* Every code point to look up, sorted and without repeats. */
+static void collectCodepoints(void)
+{
+    for (unsigned r = 0; r < sizeof(ranges) / sizeof(ranges[0]); ++r)
+    {
+        for (unsigned cp = ranges[r][0]; cp <= ranges[r][1]; ++cp)
+        {
+            codepoints[codepointCount++] = cp;
+        }
+    }
+    const unsigned char *p = (const unsigned char *)commonCjk;
+    while (*p)
+    {
+        codepoints[codepointCount++] = nextUtf8(&p);
+    }
+    qsort(codepoints, codepointCount, sizeof(codepoints[0]), compareCodepoints);
+    int unique = 0;
+    for (int i = 0; i < codepointCount; ++i)
+    {
+        if (!unique || codepoints[unique - 1] != codepoints[i])
+        {
+            codepoints[unique++] = codepoints[i];
+        }
+    }
+    codepointCount = unique;
+}
+
+/* Largest pixel size whose ascender + descender fit FONT_HEIGHT rows. */
+static int fitFont(FT_Face face, int *ascent)
+{
+    int pixels = FONT_HEIGHT;
+    for (; pixels > 8; --pixels)
+    {
+        FT_Set_Pixel_Sizes(face, 0, pixels);
+        *ascent = (face->size->metrics.ascender + 63) >> 6;
+        int descent = (-face->size->metrics.descender + 63) >> 6;
+        if (*ascent + descent <= FONT_HEIGHT)
+        {
+            break;
+        }
+    }
+    return pixels;
+}
+
+#define MAX_FONTS 8
+
+int main(int argc, char **argv)
+{
+    FT_Library library;
+    FT_Face faces[MAX_FONTS];
+    int fontCount = argc - 1;
+    if (fontCount < 1 || fontCount > MAX_FONTS || FT_Init_FreeType(&library))
+    {
+        fprintf(stderr, "usage: %s font.ttf [fallback.ttf ...]\n", argv[0]);
+        return 1;
+    }
+    for (int f = 0; f < fontCount; ++f)
+    {
+        if (FT_New_Face(library, argv[f + 1], 0, &faces[f]))
+        {
+            fprintf(stderr, "cannot open %s\n", argv[f + 1]);
+            return 1;
+        }
+    }
+    int ascent = 0;
+    int pixels = fitFont(faces[0], &ascent);
+    for (int f = 1; f < fontCount; ++f)
+    {
+        int fallbackAscent;
+        fitFont(faces[f], &fallbackAscent); /* sizes the face; its own baseline is unused */
+    }
+
+    collectCodepoints();
+    for (int c = 0; c < codepointCount; ++c)
+    {
+        unsigned cp = codepoints[c];
+        FT_Face face = NULL;
+        FT_UInt index = 0;
+        for (int f = 0; f < fontCount && !index; ++f)
+        {
+            face = faces[f];
+            index = FT_Get_Char_Index(face, cp);
+        }
+        if (!index || FT_Load_Glyph(face, index, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME))
+        {
+            continue;
+        }
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap *bm = &slot->bitmap;
+        struct glyph *g = &glyphs[glyphCount++];
+        g->codepoint = cp;
+        g->offset = dataSize;
+        nibbleHigh = 1;
+        g->advance = (slot->advance.x + 32) >> 6;
+        g->width = bm->width;
+        g->height = bm->rows;
+        g->left = slot->bitmap_left;
+        g->top = ascent - slot->bitmap_top;
+
+        int color = 0;
+        unsigned run = 0;
+        for (unsigned y = 0; y < bm->rows; ++y)
+        {
+            for (unsigned x = 0; x < bm->width; ++x)
+            {
+                int bit = (bm->buffer[y * bm->pitch + x / 8] >> (7 - x % 8)) & 1;
+                if (bit != color)
+                {
+                    emitRun(run);
+                    run = 0;
+                    color = bit;
+                }
+                run++;
+            }
+        }
+        if (color)
+        {
+            emitRun(run);
+        }
+    }
+
+    printf("// Generated by tools/gen_font.c from %s (%s %s, %d px)", argv[1], faces[0]->family_name,
+           faces[0]->style_name, pixels);
+    for (int f = 1; f < fontCount; ++f)
+    {
+        printf(" + %s", argv[f + 1]);
+    }
+    printf("; do not edit.\n");
+    printf("#pragma once\n\n#include <stdint.h>\n\n");
+    printf("static const uint8_t rasterFontHeight = %d;\n", FONT_HEIGHT);
+    printf("static const uint8_t rasterFontBaseline = %d;\n\n", ascent);
+    printf("struct RasterGlyph\n{\n    uint32_t codepoint;\n    uint8_t advance;\n    uint8_t width;\n"
+           "    uint8_t height;\n    int8_t left;\n    int8_t top;\n    uint32_t offset;\n};\n\n");
+    printf("// Sorted by code point.\nstatic const RasterGlyph rasterGlyphs[] = {\n");
+    for (int i = 0; i < glyphCount; ++i)
+    {
+        struct glyph *g = &glyphs[i];
+        printf("    {0x%04X, %d, %d, %d, %d, %d, %u},\n", g->codepoint, g->advance, g->width, g->height, g->left,
+               g->top, g->offset);
+    }
+    printf("};\n\n// Nibble-packed run lengths, alternating white/black from white, row-major per glyph.\n");
+    printf("static const uint8_t rasterGlyphRuns[] = {\n");
+    for (unsigned i = 0; i < dataSize; i += 20)
+    {
+        printf("   ");
+        for (unsigned j = i; j < i + 20 && j < dataSize; ++j)
+        {
+            printf(" %u,", data[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n");
+    unsigned raw = 0;
+    for (int i = 0; i < glyphCount; ++i)
+    {
+        raw += (glyphs[i].width * glyphs[i].height + 7) / 8;
+    }
+    fprintf(stderr, "%u bytes as raw bitmaps\n", raw);
+    fprintf(stderr, "%d glyphs, %u bytes of runs, %d px, baseline %d\n", glyphCount, dataSize, pixels, ascent);
+    return 0;
+}